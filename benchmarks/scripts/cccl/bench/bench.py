@@ -1,6 +1,7 @@
 import itertools
 import json
 import os
+import platform
 import signal
 import subprocess
 import time
@@ -54,6 +55,11 @@ class JsonCache:
             )
             devices = json.loads(result)["devices"]
 
+            # Host benchmarks of the CPU systems run without a GPU
+            if not devices:
+                self.device_cache[algname] = None
+                return None
+
             if len(devices) != 1:
                 raise Exception(
                     "NVBench doesn't work well with multiple GPUs, use `CUDA_VISIBLE_DEVICES`"
@@ -150,7 +156,14 @@ def parse_samples_meta(state):
         return None, None
 
     summary = next(
-        filter(lambda s: s["tag"] == "nv/json/bin:nv/cold/sample_times", summaries),
+        filter(
+            lambda s: s["tag"]
+            in (
+                "nv/json/bin:nv/cold/sample_times",
+                "nv/json/bin:nv/cpu_only/sample_times",
+            ),
+            summaries,
+        ),
         None,
     )
     if not summary:
@@ -178,7 +191,9 @@ def parse_samples(state):
 def parse_bw(state):
     bwutil = next(
         filter(
-            lambda s: s["tag"] == "nv/cold/bw/global/utilization", state["summaries"]
+            lambda s: s["tag"]
+            in ("nv/cold/bw/global/utilization", "nv/cpu_only/bw/global/utilization"),
+            state["summaries"],
         ),
         None,
     )
@@ -269,6 +284,9 @@ def device_json(algname):
 
 
 def get_device_name(device):
+    if device is None:
+        return "{} ({} threads)".format(platform.processor() or "CPU", os.cpu_count())
+
     gpu_name = device["name"]
     bus_width = device["global_memory_bus_width"]
     sms = device["number_of_sms"]
@@ -676,8 +694,9 @@ class Bench:
             cmd.append("entropy")
 
             # NVBench is currently broken for multiple GPUs, use `CUDA_VISIBLE_DEVICES`
-            cmd.append("-d")
-            cmd.append("0")
+            if device_json(self.algname) is not None:
+                cmd.append("-d")
+                cmd.append("0")
 
             for bench in rt_values:
                 cmd.append("-b")
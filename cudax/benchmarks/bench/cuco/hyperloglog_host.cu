@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__cuco/hyperloglog_ref.cuh>
+
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+namespace cudax = cuda::experimental;
+
+template <typename T>
+using host_ref_type = cudax::cuco::hyperloglog_ref<T>;
+
+// Counts distinct items with host threads, each filling its own register array
+template <typename T>
+void add_host(nvbench::state& state, nvbench::type_list<T>)
+{
+  using ref_type      = host_ref_type<T>;
+  using register_type = typename ref_type::register_type;
+
+  const auto num_items   = static_cast<std::size_t>(state.get_int64("NumInputs"));
+  const auto precision   = typename ref_type::precision(static_cast<int>(state.get_int64("Precision")));
+  const auto num_threads = static_cast<int>(state.get_int64("Threads"));
+
+  if (num_threads > static_cast<int>(std::thread::hardware_concurrency()))
+  {
+    state.skip("Not enough hardware threads");
+    return;
+  }
+
+  std::vector<T> items(num_items);
+  std::iota(items.begin(), items.end(), T{0});
+
+  std::vector<register_type> sketch(ref_type::sketch_bytes(precision) / sizeof(register_type));
+  ref_type ref{cuda::std::as_writable_bytes(cuda::std::span{sketch})};
+
+  state.add_element_count(num_items);
+  state.add_global_memory_reads<T>(num_items);
+
+  state.exec(nvbench::exec_tag::no_gpu, [&](nvbench::launch&) {
+    ref.clear_host();
+    ref.add_host(items.begin(), items.end(), num_threads);
+  });
+}
+
+// Computes the estimate of a full sketch
+void estimate_host(nvbench::state& state)
+{
+  using ref_type      = host_ref_type<cuda::std::int64_t>;
+  using register_type = typename ref_type::register_type;
+
+  const auto precision = typename ref_type::precision(static_cast<int>(state.get_int64("Precision")));
+
+  std::vector<register_type> sketch(ref_type::sketch_bytes(precision) / sizeof(register_type));
+  ref_type ref{cuda::std::as_writable_bytes(cuda::std::span{sketch})};
+
+  std::vector<cuda::std::int64_t> items(std::size_t{1} << 22);
+  std::iota(items.begin(), items.end(), cuda::std::int64_t{0});
+  ref.add_host(items.begin(), items.end());
+
+  state.add_element_count(sketch.size(), "Registers");
+
+  state.exec(nvbench::exec_tag::no_gpu, [&](nvbench::launch&) {
+    do_not_optimize(ref.estimate_host());
+  });
+}
+
+using key_types = nvbench::type_list<cuda::std::int32_t, cuda::std::int64_t>;
+
+NVBENCH_BENCH_TYPES(add_host, NVBENCH_TYPE_AXES(key_types))
+  .set_name("add_host")
+  .set_type_axes_names({"Key"})
+  .set_is_cpu_only(true)
+  .add_int64_power_of_two_axis("NumInputs", {24})
+  .add_int64_axis("Precision", {12, 18})
+  .add_int64_axis("Threads", {1, 2, 4, 8, 16});
+
+NVBENCH_BENCH(estimate_host)
+  .set_name("estimate_host")
+  .set_is_cpu_only(true)
+  .add_int64_axis("Precision", nvbench::range(4, 18, 2));
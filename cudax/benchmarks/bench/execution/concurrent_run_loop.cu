@@ -0,0 +1,113 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include <nvbench/nvbench.cuh>
+
+namespace ex = cuda::experimental::execution;
+
+// Worker counts from a single thread up to the number of hardware threads
+static std::vector<nvbench::int64_t> thread_counts()
+{
+  std::vector<nvbench::int64_t> counts;
+  const auto hw = static_cast<nvbench::int64_t>(std::thread::hardware_concurrency());
+  for (nvbench::int64_t n = 1; n < hw; n *= 2)
+  {
+    counts.push_back(n);
+  }
+  counts.push_back(hw > 0 ? hw : 1);
+  return counts;
+}
+
+// A small amount of work per task, so that a single thread cannot keep up with the tasks
+static double busy_work(double x)
+{
+  for (int i = 0; i < 64; ++i)
+  {
+    x = std::sqrt(x * 1.0001 + 0.5);
+  }
+  return x;
+}
+
+// Spawns many small tasks on a scheduler from the calling thread and waits for all of them
+template <class Sched>
+void spawn_tasks(Sched sched, nvbench::int64_t tasks, std::vector<double>& results)
+{
+  ex::counting_scope scope;
+  for (nvbench::int64_t i = 0; i < tasks; ++i)
+  {
+    ex::spawn(ex::schedule(sched) | ex::then([&results, i] {
+                results[i] = busy_work(static_cast<double>(i));
+              }),
+              scope.get_token());
+  }
+  ex::sync_wait(scope.join());
+}
+
+// Throughput of small tasks on a thread_context, which runs a run_loop on a single thread,
+// and on a concurrent_run_loop that is driven by an increasing number of threads
+static void task_throughput(nvbench::state& state)
+{
+  const auto tasks   = state.get_int64("Tasks");
+  const auto threads = static_cast<unsigned>(state.get_int64("Threads"));
+  const auto& loop   = state.get_string("Loop");
+
+  if (loop == "thread_context" && threads != 1)
+  {
+    state.skip("A thread_context has a single thread");
+    return;
+  }
+
+  std::vector<double> results(static_cast<std::size_t>(tasks));
+  state.add_element_count(tasks, "Tasks");
+
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    if (loop == "thread_context")
+    {
+      ex::thread_context ctx;
+      timer.start();
+      spawn_tasks(ctx.get_scheduler(), tasks, results);
+      timer.stop();
+    }
+    else
+    {
+      ex::concurrent_run_loop run_loop{threads};
+      std::vector<std::thread> workers;
+      for (unsigned i = 0; i < threads; ++i)
+      {
+        workers.emplace_back([&] {
+          run_loop.run();
+        });
+      }
+
+      timer.start();
+      spawn_tasks(run_loop.get_scheduler(), tasks, results);
+      timer.stop();
+
+      run_loop.finish();
+      for (auto& worker : workers)
+      {
+        worker.join();
+      }
+    }
+  });
+}
+
+NVBENCH_BENCH(task_throughput)
+  .set_name("task_throughput")
+  .set_is_cpu_only(true)
+  .add_string_axis("Loop", {"thread_context", "concurrent_run_loop"})
+  .add_int64_axis("Threads", thread_counts())
+  .add_int64_axis("Tasks", {1 << 16});
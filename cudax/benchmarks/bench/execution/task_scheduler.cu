@@ -0,0 +1,144 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <nvbench/nvbench.cuh>
+
+namespace ex = cuda::experimental::execution;
+
+// Converts to the result of a function, so that an immovable operation state can be
+// constructed in place
+template <class Fn>
+struct emplacer
+{
+  operator decltype(std::declval<Fn&>()())()
+  {
+    return fn();
+  }
+
+  Fn fn;
+};
+
+template <class Fn>
+emplacer(Fn) -> emplacer<Fn>;
+
+// Schedules tasks on a run_loop one after the other. Each task is connected and started by
+// the completion of the previous one, so the loop never holds more than one task. Storage is
+// the inline storage that task_scheduler operations reserve for the run_loop's operation state.
+template <class Sched, std::size_t Storage>
+struct schedule_chain
+{
+  struct receiver
+  {
+    using receiver_concept = ex::receiver_t;
+
+    void set_value() noexcept
+    {
+      self->next();
+    }
+
+    template <class Error>
+    void set_error(Error&&) noexcept
+    {
+      std::terminate();
+    }
+
+    void set_stopped() noexcept
+    {
+      std::terminate();
+    }
+
+    auto get_env() const noexcept
+    {
+      return ex::prop{ex::get_task_storage_size, ex::task_storage_size_t<Storage>{}};
+    }
+
+    schedule_chain* self;
+  };
+
+  using op_t = ex::connect_result_t<ex::schedule_result_t<Sched>, receiver>;
+
+  void next()
+  {
+    if (remaining == 0)
+    {
+      loop->finish();
+      return;
+    }
+    // The task in this slot completed before the one that is completing now.
+    auto& slot = ops[--remaining % 2];
+    slot.reset();
+    slot.emplace(emplacer{[this] {
+      return ex::connect(ex::schedule(sched), receiver{this});
+    }});
+    ex::start(*slot);
+  }
+
+  ex::run_loop* loop;
+  Sched sched;
+  nvbench::int64_t remaining;
+  std::optional<op_t> ops[2]{};
+};
+
+template <std::size_t Storage = 8 * sizeof(void*), class Sched>
+void run_chain(ex::run_loop& loop, Sched sched, nvbench::int64_t tasks)
+{
+  schedule_chain<Sched, Storage> chain{&loop, sched, tasks};
+  chain.next();
+  loop.run();
+}
+
+// Cost of scheduling a task on a run_loop directly, through a task_scheduler, through a
+// task_scheduler_ref, and through a task_scheduler whose operation states do not fit in the
+// inline storage and are taken from the per-thread cache
+static void schedule_latency(nvbench::state& state)
+{
+  const auto tasks  = state.get_int64("Tasks");
+  const auto& sched = state.get_string("Scheduler");
+
+  state.add_element_count(tasks, "Tasks");
+
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    ex::run_loop loop;
+    ex::task_scheduler task_sched{loop.get_scheduler()};
+
+    timer.start();
+    if (sched == "run_loop")
+    {
+      run_chain(loop, loop.get_scheduler(), tasks);
+    }
+    else if (sched == "task_scheduler")
+    {
+      run_chain(loop, task_sched, tasks);
+    }
+    else if (sched == "task_scheduler_ref")
+    {
+      run_chain(loop, ex::task_scheduler_ref{task_sched}, tasks);
+    }
+    else
+    {
+      run_chain<1>(loop, task_sched, tasks);
+    }
+    timer.stop();
+  });
+}
+
+NVBENCH_BENCH(schedule_latency)
+  .set_name("schedule_latency")
+  .set_is_cpu_only(true)
+  .add_string_axis("Scheduler", {"run_loop", "task_scheduler", "task_scheduler_ref", "task_scheduler_heap"})
+  .add_int64_axis("Tasks", {1 << 16});
@@ -0,0 +1,129 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include <nvbench/nvbench.cuh>
+
+namespace ex = cuda::experimental::execution;
+
+// Worker counts from a single thread up to the number of hardware threads
+static std::vector<nvbench::int64_t> thread_counts()
+{
+  std::vector<nvbench::int64_t> counts;
+  const auto hw = static_cast<nvbench::int64_t>(std::thread::hardware_concurrency());
+  for (nvbench::int64_t n = 1; n < hw; n *= 2)
+  {
+    counts.push_back(n);
+  }
+  counts.push_back(hw > 0 ? hw : 1);
+  return counts;
+}
+
+// Strong scaling of a compute bound bulk_chunked loop over a fixed number of elements
+static void bulk_chunked_scaling(nvbench::state& state)
+{
+  const auto threads  = static_cast<unsigned>(state.get_int64("Threads"));
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+
+  ex::thread_pool pool{threads};
+  std::vector<double> data(elements, 1.0);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<double>(elements);
+  state.add_global_memory_writes<double>(elements);
+
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    auto sndr = ex::just() | ex::continues_on(pool.get_scheduler())
+              | ex::bulk_chunked(ex::par, elements, [&](std::size_t begin, std::size_t end) {
+                  for (std::size_t i = begin; i < end; ++i)
+                  {
+                    data[i] = std::sqrt(data[i] * 1.0001 + 0.5);
+                  }
+                });
+
+    timer.start();
+    ex::sync_wait(std::move(sndr));
+    timer.stop();
+  });
+}
+
+NVBENCH_BENCH(bulk_chunked_scaling)
+  .set_name("bulk_chunked_scaling")
+  .set_is_cpu_only(true)
+  .add_int64_axis("Threads", thread_counts())
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 24, 4));
+
+// Load balancing of bulk_unchunked when the cost of an index varies by orders of magnitude
+static void bulk_unchunked_imbalanced(nvbench::state& state)
+{
+  const auto threads = static_cast<unsigned>(state.get_int64("Threads"));
+  const auto shape   = static_cast<std::size_t>(state.get_int64("Shape"));
+
+  ex::thread_pool pool{threads};
+  std::vector<double> results(shape);
+
+  state.add_element_count(shape);
+
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    auto sndr = ex::just() | ex::continues_on(pool.get_scheduler())
+              | ex::bulk_unchunked(ex::par, shape, [&](std::size_t i) {
+                  // Every 64th index is much more expensive than the others
+                  const std::size_t iterations = i % 64 == 0 ? 1 << 14 : 1 << 6;
+                  double acc                   = static_cast<double>(i);
+                  for (std::size_t j = 0; j < iterations; ++j)
+                  {
+                    acc = std::sqrt(acc + 1.0);
+                  }
+                  results[i] = acc;
+                });
+
+    timer.start();
+    ex::sync_wait(std::move(sndr));
+    timer.stop();
+  });
+}
+
+NVBENCH_BENCH(bulk_unchunked_imbalanced)
+  .set_name("bulk_unchunked_imbalanced")
+  .set_is_cpu_only(true)
+  .add_int64_axis("Threads", thread_counts())
+  .add_int64_axis("Shape", {4096});
+
+// Round trip latency of scheduling a single task on the pool from an external thread
+static void schedule_latency(nvbench::state& state)
+{
+  const auto threads = static_cast<unsigned>(state.get_int64("Threads"));
+  const auto tasks   = state.get_int64("Tasks");
+
+  ex::thread_pool pool{threads};
+  auto sched = pool.get_scheduler();
+
+  state.add_element_count(tasks, "Tasks");
+
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    timer.start();
+    for (nvbench::int64_t i = 0; i < tasks; ++i)
+    {
+      ex::sync_wait(ex::schedule(sched));
+    }
+    timer.stop();
+  });
+}
+
+NVBENCH_BENCH(schedule_latency)
+  .set_name("schedule_latency")
+  .set_is_cpu_only(true)
+  .add_int64_axis("Threads", thread_counts())
+  .add_int64_axis("Tasks", {1 << 10});
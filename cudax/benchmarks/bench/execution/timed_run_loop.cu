@@ -0,0 +1,177 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <nvbench/nvbench.cuh>
+
+namespace ex = cuda::experimental::execution;
+
+using clock_type = ex::timed_run_loop::clock;
+
+// Converts to the result of a function, so that an immovable operation state can be
+// constructed in place
+template <class Fn>
+struct emplacer
+{
+  operator decltype(std::declval<Fn&>()())()
+  {
+    return fn();
+  }
+
+  Fn fn;
+};
+
+template <class Fn>
+emplacer(Fn) -> emplacer<Fn>;
+
+// Starts one timer per deadline and records how late each of them completes. The loop is
+// finished when the last timer has completed.
+struct timer_set
+{
+  struct receiver
+  {
+    using receiver_concept = ex::receiver_t;
+
+    void set_value() noexcept
+    {
+      self->complete(index);
+    }
+
+    template <class Error>
+    void set_error(Error&&) noexcept
+    {
+      std::terminate();
+    }
+
+    void set_stopped() noexcept
+    {
+      std::terminate();
+    }
+
+    timer_set* self;
+    std::size_t index;
+  };
+
+  using sndr_t = decltype(ex::schedule_at(std::declval<ex::timed_run_loop::scheduler>(), clock_type::time_point{}));
+  using op_t   = ex::connect_result_t<sndr_t, receiver>;
+
+  void complete(std::size_t index)
+  {
+    lateness[index] = std::chrono::duration<double, std::micro>(clock_type::now() - deadlines[index]).count();
+    if (--pending == 0)
+    {
+      loop->finish();
+    }
+  }
+
+  void start(ex::timed_run_loop& run_loop, clock_type::time_point base,
+             const std::vector<clock_type::duration>& offsets)
+  {
+    loop    = &run_loop;
+    pending = offsets.size();
+    for (std::size_t i = 0; i < offsets.size(); ++i)
+    {
+      deadlines[i] = base + offsets[i];
+      ops[i].reset();
+      ops[i].emplace(emplacer{[&] {
+        return ex::connect(ex::schedule_at(run_loop.get_scheduler(), deadlines[i]), receiver{this, i});
+      }});
+      ex::start(*ops[i]);
+    }
+  }
+
+  explicit timer_set(std::size_t count)
+      : ops{new std::optional<op_t>[count]}
+      , deadlines(count)
+      , lateness(count)
+  {}
+
+  ex::timed_run_loop* loop = nullptr;
+  std::size_t pending      = 0;
+  std::unique_ptr<std::optional<op_t>[]> ops;
+  std::vector<clock_type::time_point> deadlines;
+  std::vector<double> lateness;
+};
+
+// Jitter of a timed_run_loop that holds a large number of pending timers with random deadlines
+// spread over a window. The lateness of a timer is the time between its deadline and its
+// completion; the loop rounds deadlines up to its resolution, so it is never negative and is
+// expected to stay below the resolution plus the wake-up latency of the loop's thread.
+static void timer_jitter(nvbench::state& state)
+{
+  const auto timers     = static_cast<std::size_t>(state.get_int64("Timers"));
+  const auto window     = std::chrono::milliseconds{state.get_int64("WindowMs")};
+  const auto resolution = std::chrono::microseconds{state.get_int64("ResolutionUs")};
+  // Leaves time to start all timers before the first one is due
+  const auto lead = std::chrono::milliseconds{100};
+
+  std::mt19937_64 rng{42};
+  std::uniform_int_distribution<clock_type::rep> dist{
+    0, std::chrono::duration_cast<clock_type::duration>(window).count()};
+  std::vector<clock_type::duration> offsets(timers);
+  std::generate(offsets.begin(), offsets.end(), [&] {
+    return clock_type::duration{dist(rng)};
+  });
+
+  timer_set set{timers};
+  double lateness_sum = 0.0;
+  double worst_p99    = 0.0;
+  double worst        = 0.0;
+  std::size_t samples = 0;
+
+  state.add_element_count(timers, "Timers");
+
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    ex::timed_run_loop loop{resolution};
+    set.start(loop, clock_type::now() + lead, offsets);
+
+    timer.start();
+    loop.run();
+    timer.stop();
+
+    for (double late : set.lateness)
+    {
+      lateness_sum += late;
+    }
+    auto p99 = set.lateness.begin() + static_cast<std::ptrdiff_t>(timers * 99 / 100);
+    std::nth_element(set.lateness.begin(), p99, set.lateness.end());
+    worst_p99 = (std::max) (worst_p99, *p99);
+    worst     = (std::max) (worst, *std::max_element(p99, set.lateness.end()));
+    ++samples;
+  });
+
+  state.add_summary("MeanLateness")
+    .set_string("name", "Mean Lateness (us)")
+    .set_float64("value", lateness_sum / static_cast<double>(timers * samples));
+  state.add_summary("P99Lateness")
+    .set_string("name", "P99 Lateness (us)")
+    .set_float64("value", worst_p99);
+  state.add_summary("MaxLateness")
+    .set_string("name", "Max Lateness (us)")
+    .set_float64("value", worst);
+}
+
+NVBENCH_BENCH(timer_jitter)
+  .set_name("timer_jitter")
+  .set_is_cpu_only(true)
+  .add_int64_axis("Timers", {1000000})
+  .add_int64_axis("WindowMs", {100, 1000})
+  .add_int64_axis("ResolutionUs", {1, 10});
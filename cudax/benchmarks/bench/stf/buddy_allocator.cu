@@ -0,0 +1,123 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/__stf/allocators/buddy_allocator.cuh>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <nvbench/nvbench.cuh>
+
+using cuda::experimental::stf::event_list;
+using cuda::experimental::stf::reserved::buddy_allocator_metadata;
+
+// The metadata only hands out offsets, so a large address space costs nothing and never runs out
+static constexpr std::size_t buffer_size = std::size_t(1) << 40;
+
+// Sizes of the temporaries, from 256 B to 64 KiB
+static std::vector<std::size_t> block_sizes(std::size_t blocks)
+{
+  std::mt19937_64 rng(42);
+  std::uniform_int_distribution<int> log_size(8, 16);
+  std::vector<std::size_t> sizes(blocks);
+  for (auto& size : sizes)
+  {
+    size = std::size_t(1) << log_size(rng);
+  }
+  return sizes;
+}
+
+// A task graph holding many temporaries at once: all blocks are allocated, then freed in a random order so that
+// coalescing happens throughout the free list rather than only with the most recent block
+static void alloc_then_free(nvbench::state& state)
+{
+  const auto blocks = static_cast<std::size_t>(state.get_int64("Blocks"));
+  const auto sizes  = block_sizes(blocks);
+
+  std::vector<std::size_t> order(blocks);
+  for (std::size_t i = 0; i < blocks; ++i)
+  {
+    order[i] = i;
+  }
+  std::shuffle(order.begin(), order.end(), std::mt19937_64(7));
+
+  std::vector<std::ptrdiff_t> offsets(blocks);
+
+  state.add_element_count(blocks, "Blocks");
+
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    buddy_allocator_metadata metadata(buffer_size, event_list());
+    event_list prereqs;
+
+    timer.start();
+    for (std::size_t i = 0; i < blocks; ++i)
+    {
+      offsets[i] = metadata.allocate(sizes[i], prereqs);
+    }
+    for (std::size_t i : order)
+    {
+      metadata.deallocate(offsets[i], sizes[i], prereqs);
+    }
+    timer.stop();
+  });
+}
+
+NVBENCH_BENCH(alloc_then_free)
+  .set_name("alloc_then_free")
+  .set_is_cpu_only(true)
+  .add_int64_power_of_two_axis("Blocks", nvbench::range(10, 16, 2));
+
+// Steady state of a long running submission: a fixed number of live temporaries, each step frees a random one and
+// allocates a new one
+static void churn(nvbench::state& state)
+{
+  const auto blocks     = static_cast<std::size_t>(state.get_int64("Blocks"));
+  const std::size_t ops = 1 << 16;
+  const auto sizes      = block_sizes(blocks + ops);
+
+  std::vector<std::size_t> victims(ops);
+  std::mt19937_64 rng(7);
+  std::uniform_int_distribution<std::size_t> victim(0, blocks - 1);
+  for (auto& v : victims)
+  {
+    v = victim(rng);
+  }
+
+  state.add_element_count(ops, "Operations");
+
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    buddy_allocator_metadata metadata(buffer_size, event_list());
+    event_list prereqs;
+
+    std::vector<std::ptrdiff_t> offsets(blocks);
+    std::vector<std::size_t> live_sizes(sizes.begin(), sizes.begin() + blocks);
+    for (std::size_t i = 0; i < blocks; ++i)
+    {
+      offsets[i] = metadata.allocate(live_sizes[i], prereqs);
+    }
+
+    timer.start();
+    for (std::size_t i = 0; i < ops; ++i)
+    {
+      const std::size_t v = victims[i];
+      metadata.deallocate(offsets[v], live_sizes[v], prereqs);
+      live_sizes[v] = sizes[blocks + i];
+      offsets[v]    = metadata.allocate(live_sizes[v], prereqs);
+    }
+    timer.stop();
+  });
+}
+
+NVBENCH_BENCH(churn)
+  .set_name("churn")
+  .set_is_cpu_only(true)
+  .add_int64_power_of_two_axis("Blocks", nvbench::range(10, 16, 2));
@@ -29,8 +29,10 @@
 #include <cuda/__utility/in_range.h>
 #include <cuda/atomic>
 #include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__bit/countr.h>
 #include <cuda/std/__bit/integral.h>
+#include <cuda/std/__cmath/exponential_functions.h>
 #include <cuda/std/__cstddef/types.h>
 #include <cuda/std/__host_stdlib/stdexcept>
 #include <cuda/std/__iterator/concepts.h>
@@ -47,6 +49,11 @@
 
 #include <cooperative_groups.h>
 
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
 #include <cooperative_groups/reduce.h>
 #include <cuda/std/__cccl/prologue.h>
 
@@ -461,23 +468,186 @@ public:
       __host_sketch_buf.data(), __sketch.data(), sizeof(__register_type) * __num_regs, __stream.get());
     __stream.sync();
 
-    __fp_type __sum = 0;
-    int __zeroes    = 0;
+    return __estimate_registers(
+      ::cuda::std::span<const __register_type>{__host_sketch_buf.data(), static_cast<::cuda::std::size_t>(__num_regs)});
+  }
+
+  // #endif
+
+  //! @brief Resets the estimator on the host, i.e., clears the current count estimate.
+  //!
+  //! @note The sketch storage must be host accessible.
+  _CCCL_HOST void __clear_host() noexcept
+  {
+    ::std::fill(__sketch.begin(), __sketch.end(), 0);
+  }
+
+  //! @brief Adds to be counted items to the estimator using host threads.
+  //!
+  //! Each thread counts a contiguous chunk of the input into its own register array. The arrays are
+  //! merged into the sketch by taking the per-register maximum once all threads have finished, so the
+  //! resulting sketch is identical to the one produced by `__add` for the same items.
+  //!
+  //! @note The sketch storage must be host accessible and must not be modified concurrently.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator where
+  //! <tt>std::is_convertible<std::iterator_traits<_InputIt>::value_type,
+  //! _Tp></tt> is `true`
+  //!
+  //! @param __first Beginning of the sequence of items
+  //! @param __last End of the sequence of items
+  //! @param __num_threads Maximum number of threads to use, or 0 for `std::thread::hardware_concurrency()`
+  template <class _InputIt>
+  _CCCL_HOST void __add_host(_InputIt __first, _InputIt __last, int __num_threads)
+  {
+    const ::cuda::std::int64_t __num_items = ::cuda::std::distance(__first, __last);
+    if (__num_items == 0)
+    {
+      return;
+    }
+
+    if (__num_threads <= 0)
+    {
+      __num_threads = static_cast<int>(::cuda::std::max(1u, ::std::thread::hardware_concurrency()));
+    }
+
+    // Every thread owns a full register array, so small inputs are not worth splitting
+    constexpr ::cuda::std::int64_t __min_items_per_thread = 1 << 16;
 
-    // geometric mean computation + count registers with 0s
-    for (const auto __reg : __host_sketch_buf)
+    const auto __max_threads = (__num_items + __min_items_per_thread - 1) / __min_items_per_thread;
+    __num_threads            = static_cast<int>(::cuda::std::min<::cuda::std::int64_t>(__num_threads, __max_threads));
+
+    if (__num_threads == 1)
     {
-      __sum += __fp_type{1} / static_cast<__fp_type>(1ull << __reg);
-      __zeroes += __reg == 0;
+      __add_range(__sketch.data(), __first, 0, __num_items);
+      return;
     }
 
-    const auto __finalize = ::cuda::experimental::cuco::__hyperloglog_ns::_Finalizer(__precision);
+    const auto __num_regs = __sketch.size();
+    ::std::vector<__register_type> __local_sketches(__num_regs * __num_threads, 0);
+    const auto __chunk_begin = [&](int __tid) {
+      return __num_items * __tid / __num_threads;
+    };
+
+    ::std::vector<::std::thread> __workers;
+    __workers.reserve(__num_threads - 1);
+    for (int __tid = 1; __tid < __num_threads; ++__tid)
+    {
+      __workers.emplace_back([&, __tid] {
+        __add_range(
+          __local_sketches.data() + __num_regs * __tid, __first, __chunk_begin(__tid), __chunk_begin(__tid + 1));
+      });
+    }
+    __add_range(__local_sketches.data(), __first, 0, __chunk_begin(1));
+    for (auto& __worker : __workers)
+    {
+      __worker.join();
+    }
 
-    // pass intermediate result to _Finalizer for bias correction, etc.
-    return __finalize(__sum, __zeroes);
+    for (int __tid = 0; __tid < __num_threads; ++__tid)
+    {
+      __merge_registers(__local_sketches.data() + __num_regs * __tid);
+    }
   }
 
-  // #endif
+  //! @brief Merges the result of `other` estimator reference into `*this` estimator reference on the host.
+  //!
+  //! @note Both sketch storages must be host accessible.
+  //!
+  //! @throw If __sketch_bytes() != __other.__sketch_bytes()
+  //!
+  //! @tparam _OtherScope Thread scope of `other` estimator
+  //!
+  //! @param __other Other estimator reference to be merged into `*this`
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST void __merge_host(const __hyperloglog_impl<_Tp, _OtherScope, _Hash>& __other)
+  {
+    if (__other.__precision != __precision)
+    {
+      _CCCL_THROW(::std::invalid_argument, "Cannot merge estimators with different sketch sizes");
+    }
+
+    __merge_registers(__other.__sketch.data());
+  }
+
+  //! @brief Compute the estimated distinct items count on the host.
+  //!
+  //! @note The sketch storage must be host accessible.
+  //!
+  //! @return Approximate distinct items count
+  [[nodiscard]] _CCCL_HOST ::cuda::std::size_t __estimate_host() const noexcept
+  {
+    return __estimate_registers(::cuda::std::span<const __register_type>{__sketch.data(), __sketch.size()});
+  }
+
+  //! @brief Copies the sketch into host memory.
+  //!
+  //! The serialized sketch is the register array in the byte order of the device, so sketches serialized
+  //! on the host and on the device can be exchanged freely.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @throw If __out.size() != __sketch_bytes()
+  //!
+  //! @param __out Host memory the sketch is written to
+  //! @param __stream CUDA stream this operation is executed in
+  _CCCL_HOST void __serialize(::cuda::std::span<::cuda::std::byte> __out, ::cuda::stream_ref __stream) const
+  {
+    __check_serialized_size(__out.size());
+    _CCCL_TRY_CUDA_API(
+      ::cudaMemcpyAsync,
+      "cudaMemcpyAsync failed",
+      __out.data(),
+      __sketch.data(),
+      __sketch_bytes(),
+      ::cudaMemcpyDefault,
+      __stream.get());
+    __stream.sync();
+  }
+
+  //! @brief Replaces the sketch with a serialized one stored in host memory.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @throw If __in.size() != __sketch_bytes() or __in contains a value that is not a valid register
+  //!
+  //! @param __in Host memory holding a sketch produced by `__serialize` or `__serialize_host`
+  //! @param __stream CUDA stream this operation is executed in
+  _CCCL_HOST void __deserialize(::cuda::std::span<const ::cuda::std::byte> __in, ::cuda::stream_ref __stream)
+  {
+    __check_serialized_sketch(__in);
+    _CCCL_TRY_CUDA_API(
+      ::cudaMemcpyAsync,
+      "cudaMemcpyAsync failed",
+      __sketch.data(),
+      __in.data(),
+      __sketch_bytes(),
+      ::cudaMemcpyDefault,
+      __stream.get());
+    __stream.sync();
+  }
+
+  //! @brief Copies a host accessible sketch into host memory.
+  //!
+  //! @throw If __out.size() != __sketch_bytes()
+  //!
+  //! @param __out Host memory the sketch is written to
+  _CCCL_HOST void __serialize_host(::cuda::std::span<::cuda::std::byte> __out) const
+  {
+    __check_serialized_size(__out.size());
+    ::std::memcpy(__out.data(), __sketch.data(), __sketch_bytes());
+  }
+
+  //! @brief Replaces a host accessible sketch with a serialized one.
+  //!
+  //! @throw If __in.size() != __sketch_bytes() or __in contains a value that is not a valid register
+  //!
+  //! @param __in Host memory holding a sketch produced by `__serialize` or `__serialize_host`
+  _CCCL_HOST void __deserialize_host(::cuda::std::span<const ::cuda::std::byte> __in)
+  {
+    __check_serialized_sketch(__in);
+    ::std::memcpy(__sketch.data(), __in.data(), __sketch_bytes());
+  }
 
   //! @brief Gets the hash function.
   //!
@@ -570,6 +740,131 @@ private:
     return (1ull << __precision) - 1;
   }
 
+  //! @brief Gets the largest value a register can hold.
+  //!
+  //! @return The maximum register value
+  [[nodiscard]] _CCCL_API constexpr __register_type __max_register() const noexcept
+  {
+    return static_cast<__register_type>(sizeof(__hash_value_type) * 8 - __precision + 1);
+  }
+
+  //! @brief Counts the items in [__first + __begin, __first + __end) into a thread-private register array.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator
+  //!
+  //! @param __registers Register array with `__sketch.size()` entries
+  //! @param __first Beginning of the sequence of items
+  //! @param __begin Index of the first item to count
+  //! @param __end Index one past the last item to count
+  template <class _InputIt>
+  _CCCL_HOST void __add_range(
+    __register_type* __registers, _InputIt __first, ::cuda::std::int64_t __begin, ::cuda::std::int64_t __end) const
+  {
+    const auto __mask = __register_mask();
+    for (auto __idx = __begin; __idx < __end; ++__idx)
+    {
+      const _Tp& __item   = *(__first + __idx);
+      const auto __h      = __hash(__item);
+      const auto __reg    = static_cast<int>(__h & __mask);
+      const auto __zeroes = static_cast<__register_type>(::cuda::std::countl_zero(__h | __mask) + 1);
+      __registers[__reg]  = ::cuda::std::max(__registers[__reg], __zeroes);
+    }
+  }
+
+  //! @brief Updates every register with the maximum of itself and the corresponding entry of `__registers`.
+  //!
+  //! @param __registers Host accessible register array with `__sketch.size()` entries
+  _CCCL_HOST void __merge_registers(const __register_type* __registers) noexcept
+  {
+    auto* __sketch_ptr    = __sketch.data();
+    const auto __num_regs = __sketch.size();
+    for (::cuda::std::size_t __i = 0; __i < __num_regs; ++__i)
+    {
+      __sketch_ptr[__i] = ::cuda::std::max(__sketch_ptr[__i], __registers[__i]);
+    }
+  }
+
+  //! @brief Computes the estimate from a host accessible register array.
+  //!
+  //! The registers are first binned into a histogram of their values. The sum over all registers is
+  //! then formed from at most 65 exact terms, which makes the result independent of the register order
+  //! and avoids a division per register.
+  //!
+  //! @param __registers The registers of the sketch
+  //!
+  //! @return Approximate distinct items count
+  [[nodiscard]] _CCCL_HOST ::cuda::std::size_t
+  __estimate_registers(::cuda::std::span<const __register_type> __registers) const noexcept
+  {
+    constexpr int __num_bins = sizeof(__hash_value_type) * 8 + 1;
+    // Interleaved histograms break the store-to-load dependency between neighboring registers with the
+    // same value, which is the common case
+    constexpr int __num_histograms                                  = 4;
+    ::cuda::std::int64_t __histograms[__num_histograms][__num_bins] = {};
+
+    const auto __num_regs   = __registers.size();
+    ::cuda::std::size_t __i = 0;
+    for (; __i + __num_histograms <= __num_regs; __i += __num_histograms)
+    {
+      for (int __j = 0; __j < __num_histograms; ++__j)
+      {
+        ++__histograms[__j][__registers[__i + __j]];
+      }
+    }
+    for (; __i < __num_regs; ++__i)
+    {
+      ++__histograms[0][__registers[__i]];
+    }
+
+    // geometric mean computation + count registers with 0s, adding the smallest terms first
+    __fp_type __sum              = 0;
+    ::cuda::std::int64_t __count = 0;
+    for (int __bin = __num_bins - 1; __bin >= 0; --__bin)
+    {
+      __count = 0;
+      for (int __j = 0; __j < __num_histograms; ++__j)
+      {
+        __count += __histograms[__j][__bin];
+      }
+      __sum += ::cuda::std::ldexp(static_cast<__fp_type>(__count), -__bin);
+    }
+    const auto __zeroes = static_cast<int>(__count);
+
+    const auto __finalize = ::cuda::experimental::cuco::__hyperloglog_ns::_Finalizer(__precision);
+
+    // pass intermediate result to _Finalizer for bias correction, etc.
+    return __finalize(__sum, __zeroes);
+  }
+
+  //! @brief Checks that a serialization buffer matches the sketch size.
+  //!
+  //! @param __size Size of the buffer in bytes
+  _CCCL_HOST void __check_serialized_size(::cuda::std::size_t __size) const
+  {
+    if (__size != __sketch_bytes())
+    {
+      _CCCL_THROW(::std::invalid_argument, "Serialized sketch size does not match the sketch size");
+    }
+  }
+
+  //! @brief Checks that a serialized sketch matches the sketch size and only holds valid registers.
+  //!
+  //! @param __in Host memory holding a serialized sketch
+  _CCCL_HOST void __check_serialized_sketch(::cuda::std::span<const ::cuda::std::byte> __in) const
+  {
+    __check_serialized_size(__in.size());
+    for (::cuda::std::size_t __offset = 0; __offset < __in.size(); __offset += sizeof(__register_type))
+    {
+      // The buffer is not required to be aligned for the register type
+      __register_type __reg;
+      ::std::memcpy(&__reg, __in.data() + __offset, sizeof(__register_type));
+      if (__reg < 0 || __reg > __max_register())
+      {
+        _CCCL_THROW(::std::invalid_argument, "Serialized sketch holds an invalid register value");
+      }
+    }
+  }
+
   //! @brief Atomically updates the register at position `i` with `max(reg[i], value)`.
   //!
   //! @param __i Register index
@@ -362,6 +362,34 @@ public:
     return __ref.estimate(__host_mr, __stream);
   }
 
+  //! @brief Copies the sketch into host memory.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @throw If __out.size() != sketch_bytes()
+  //!
+  //! @param __out Host memory the sketch is written to
+  //! @param __stream CUDA stream this operation is executed in
+  void serialize(::cuda::std::span<::cuda::std::byte> __out,
+                 ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    __ref.serialize(__out, __stream);
+  }
+
+  //! @brief Replaces the sketch with a serialized one stored in host memory.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @throw If __in.size() != sketch_bytes() or __in holds an invalid register value
+  //!
+  //! @param __in Host memory holding a sketch produced by `serialize` or `serialize_host`
+  //! @param __stream CUDA stream this operation is executed in
+  void deserialize(::cuda::std::span<const ::cuda::std::byte> __in,
+                   ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __ref.deserialize(__in, __stream);
+  }
+
   //! @brief Get device ref.
   //!
   //! @return Device ref object of the current `hyperloglog` host object
@@ -251,6 +251,112 @@ public:
     return __impl.__estimate(__host_mr, __stream);
   }
 
+  //! @brief Resets the estimator on the host, i.e., clears the current count estimate.
+  //!
+  //! @note The sketch storage must be host accessible.
+  _CCCL_HOST void clear_host() noexcept
+  {
+    __impl.__clear_host();
+  }
+
+  //! @brief Adds to be counted items to the estimator using host threads.
+  //!
+  //! Each thread counts its share of the items into a private register array, and the arrays are merged
+  //! into the sketch by taking the per-register maximum. The resulting sketch is identical to the one
+  //! produced by `add` on the device for the same items and hash function.
+  //!
+  //! @note The sketch storage must be host accessible and must not be modified concurrently.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator where
+  //! <tt>std::is_convertible<std::iterator_traits<_InputIt>::value_type,
+  //! _Tp></tt> is `true`
+  //!
+  //! @param __first Beginning of the sequence of items
+  //! @param __last End of the sequence of items
+  //! @param __num_threads Maximum number of threads to use, or 0 for `std::thread::hardware_concurrency()`
+  template <class _InputIt>
+  _CCCL_HOST void add_host(_InputIt __first, _InputIt __last, int __num_threads = 0)
+  {
+    __impl.__add_host(__first, __last, __num_threads);
+  }
+
+  //! @brief Merges the result of `other` estimator reference into `*this` estimator reference on the host.
+  //!
+  //! @note Both sketch storages must be host accessible.
+  //!
+  //! @throw If sketch_bytes() != __other.sketch_bytes()
+  //!
+  //! @tparam _OtherScope Thread scope of `other` estimator
+  //!
+  //! @param __other Other estimator reference to be merged into `*this`
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST void merge_host(const hyperloglog_ref<_Tp, _OtherScope, _Hash>& __other)
+  {
+    __impl.__merge_host(__other.__impl);
+  }
+
+  //! @brief Compute the estimated distinct items count on the host.
+  //!
+  //! @note The sketch storage must be host accessible.
+  //!
+  //! @return Approximate distinct items count
+  [[nodiscard]] _CCCL_HOST ::cuda::std::size_t estimate_host() const noexcept
+  {
+    return __impl.__estimate_host();
+  }
+
+  //! @brief Copies the sketch into host memory.
+  //!
+  //! The serialized sketch consists of `sketch_bytes()` bytes holding the registers in device byte
+  //! order. It can be restored with `deserialize` or `deserialize_host` into any estimator with the same
+  //! precision and hash function, regardless of whether the sketch was built on the host or the device.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @throw If __out.size() != sketch_bytes()
+  //!
+  //! @param __out Host memory the sketch is written to
+  //! @param __stream CUDA stream this operation is executed in
+  _CCCL_HOST void serialize(::cuda::std::span<::cuda::std::byte> __out,
+                            ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    __impl.__serialize(__out, __stream);
+  }
+
+  //! @brief Replaces the sketch with a serialized one stored in host memory.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @throw If __in.size() != sketch_bytes() or __in holds an invalid register value
+  //!
+  //! @param __in Host memory holding a sketch produced by `serialize` or `serialize_host`
+  //! @param __stream CUDA stream this operation is executed in
+  _CCCL_HOST void deserialize(::cuda::std::span<const ::cuda::std::byte> __in,
+                              ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __impl.__deserialize(__in, __stream);
+  }
+
+  //! @brief Copies a host accessible sketch into host memory without involving the CUDA runtime.
+  //!
+  //! @throw If __out.size() != sketch_bytes()
+  //!
+  //! @param __out Host memory the sketch is written to
+  _CCCL_HOST void serialize_host(::cuda::std::span<::cuda::std::byte> __out) const
+  {
+    __impl.__serialize_host(__out);
+  }
+
+  //! @brief Replaces a host accessible sketch with a serialized one without involving the CUDA runtime.
+  //!
+  //! @throw If __in.size() != sketch_bytes() or __in holds an invalid register value
+  //!
+  //! @param __in Host memory holding a sketch produced by `serialize` or `serialize_host`
+  _CCCL_HOST void deserialize_host(::cuda::std::span<const ::cuda::std::byte> __in)
+  {
+    __impl.__deserialize_host(__in);
+  }
+
   //! @brief Gets the hash function.
   //!
   //! @return The hash function
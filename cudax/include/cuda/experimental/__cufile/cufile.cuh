@@ -27,14 +27,11 @@
 #include <cuda/experimental/__cufile/cufile_ref.cuh>
 #include <cuda/experimental/__cufile/driver.cuh>
 #include <cuda/experimental/__cufile/exception.cuh>
+#include <cuda/experimental/__cufile/io.cuh>
+#include <cuda/experimental/__cufile/native_file.cuh>
 #include <cuda/experimental/__cufile/open_mode.cuh>
 
-#include <string>
-
 #include <cufile.h>
-#include <errno.h>
-#include <fcntl.h>
-#include <unistd.h>
 
 namespace cuda::experimental
 {
@@ -45,9 +42,7 @@ public:
   using native_handle_type = __cufile_os_native_type; //!< The underlying OS native handle type.
 
 private:
-  using __oflags_type = int;
-
-  static constexpr native_handle_type __invalid_native_handle = -1;
+  static constexpr native_handle_type __invalid_native_handle = __cufile_native::__invalid_native_handle;
 
   native_handle_type __native_handle_{__invalid_native_handle}; //< The native handle.
 
@@ -57,100 +52,6 @@ private:
       , __native_handle_{__native_handle}
   {}
 
-  //! @brief Make open flags from the \c cuda::cufile_open_mode.
-  //!
-  //! @param __om The cuFile open mode.
-  //!
-  //! @return The flags mask to be passed to open function.
-  [[nodiscard]] static _CCCL_HOST_API constexpr __oflags_type __make_oflags(cufile_open_mode __om) noexcept
-  {
-    __oflags_type __ret{};
-    if ((__om & (cufile_open_mode::in | cufile_open_mode::out)) == (cufile_open_mode::in | cufile_open_mode::out))
-    {
-      __ret |= O_RDWR | O_CREAT;
-    }
-    else if ((__om & cufile_open_mode::in) == cufile_open_mode::in)
-    {
-      __ret |= O_RDONLY;
-    }
-    else if ((__om & cufile_open_mode::out) == cufile_open_mode::out)
-    {
-      __ret |= O_WRONLY | O_CREAT;
-    }
-
-    __ret |= ((__om & cufile_open_mode::trunc) == cufile_open_mode::trunc) ? O_TRUNC : 0;
-    __ret |= ((__om & cufile_open_mode::noreplace) == cufile_open_mode::noreplace) ? O_EXCL : 0;
-    __ret |= ((__om & cufile_open_mode::direct) == cufile_open_mode::direct) ? O_DIRECT : 0;
-    return __ret;
-  }
-
-  //! @brief Wrapper for opening the native handle.
-  [[nodiscard]] static _CCCL_HOST_API native_handle_type __open_file(const char* __filename, __oflags_type __oflags)
-  {
-    // if O_CREAT flag is specified, use the same mode as if opened by fopend
-    ::mode_t __ocreat_mode{};
-    if (__oflags & O_CREAT)
-    {
-      __ocreat_mode = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH;
-    }
-
-    int __fd = ::open(__filename, __oflags, __ocreat_mode);
-
-    if (__fd == -1)
-    {
-      errno = 0; // clear errno
-      _CCCL_THROW(::std::runtime_error, "Failed to open file.");
-    }
-
-    return __fd;
-  }
-
-  //! @brief Wrapper for retrieving the open mode.
-  [[nodiscard]] static _CCCL_HOST_API cufile_open_mode __open_mode(native_handle_type __native_handle)
-  {
-    int __oflags = ::fcntl(__native_handle, F_GETFL);
-
-    if (__oflags == -1)
-    {
-      errno = 0; // clear errno
-      _CCCL_THROW(::std::runtime_error, "Failed to retrieve open flags.");
-    }
-
-    cufile_open_mode __om{};
-    if (__oflags & O_RDWR)
-    {
-      __om |= cufile_open_mode::in | cufile_open_mode::out;
-    }
-    else if (__oflags & O_RDONLY)
-    {
-      __om |= cufile_open_mode::in;
-    }
-    else if (__oflags & O_WRONLY)
-    {
-      __om |= cufile_open_mode::out;
-    }
-    __om |= (__oflags & O_TRUNC) ? cufile_open_mode::trunc : cufile_open_mode{};
-    __om |= (__oflags & O_EXCL) ? cufile_open_mode::noreplace : cufile_open_mode{};
-    __om |= (__oflags & O_DIRECT) ? cufile_open_mode::direct : cufile_open_mode{};
-    return __om;
-  }
-
-  //! @brief Wrapper for closing the native handle.
-  [[nodiscard]] static _CCCL_HOST_API bool __close_file_no_throw(native_handle_type __native_handle) noexcept
-  {
-    return ::close(__native_handle) == 0;
-  }
-
-  //! @brief Wrapper for closing the native handle. Throws \c cuda::std::runtime_error if an error occurs.
-  static _CCCL_HOST_API void __close_file(native_handle_type __native_handle)
-  {
-    if (!__close_file_no_throw(__native_handle))
-    {
-      errno = 0; // clear errno
-      _CCCL_THROW(::std::runtime_error, "Failed to close file.");
-    }
-  }
-
 public:
   //! @brief Make a cufile object from already existing native handle.
   //!
@@ -171,19 +72,19 @@ public:
   //! @param __filename Path to the file. Must be a zero terminated string.
   //! @param __open_mode Open mode to open the file with.
   //!
-  //! @throws cuda::std::runtime_error if the file cannot be opened.
+  //! @throws std::system_error if the file cannot be opened.
   //! @throws cuda::cuda_error if a CUDA driver error occurs.
   //! @throws cuda::cufile_error if a cuFile driver error occurs.
   _CCCL_HOST_API cufile(const char* __filename, cufile_open_mode __open_mode)
   {
-    __native_handle_ = __open_file(__filename, __make_oflags(__open_mode));
+    __native_handle_ = __cufile_native::__open_file(__filename, __cufile_native::__make_oflags(__open_mode));
     try
     {
       __cufile_handle_ = cufile_driver.register_native_handle(__native_handle_).get();
     }
     catch (...)
     {
-      __close_file(__native_handle_);
+      __cufile_native::__close_file(__native_handle_);
       throw;
     }
   }
@@ -208,7 +109,7 @@ public:
   //!
   //! @post `__other` is in moved-from state.
   //!
-  //! @throws cuda::std::runtime_error if the currently opened file fails to close.
+  //! @throws std::system_error if the currently opened file fails to close.
   _CCCL_HOST_API cufile& operator=(cufile&& __other)
   {
     if (this != ::cuda::std::addressof(__other))
@@ -226,7 +127,7 @@ public:
     if (is_open())
     {
       cufile_driver.deregister_native_handle(__cufile_handle_);
-      [[maybe_unused]] const auto __ignore_close_retval = __close_file_no_throw(__native_handle_);
+      [[maybe_unused]] const auto __ignore_close_retval = __cufile_native::__close_file_no_throw(__native_handle_);
     }
   }
 
@@ -243,7 +144,7 @@ public:
   //! @return The \c cuda::cufile_open_mode value if opened, empty value otherwise.
   [[nodiscard]] _CCCL_HOST_API cufile_open_mode open_mode() const
   {
-    return is_open() ? __open_mode(__native_handle_) : cufile_open_mode{};
+    return is_open() ? __cufile_native::__open_mode(__native_handle_) : cufile_open_mode{};
   }
 
   //! @brief Opens file @c __filename in mode @c __open_mode.
@@ -251,7 +152,8 @@ public:
   //! @param __filename Path to the file.
   //! @param __open_mode Open mode to open the file with.
   //!
-  //! @throws cuda::std::runtime_error if the file cannot be opened or if a file is already opened.
+  //! @throws cuda::std::runtime_error if a file is already opened.
+  //! @throws std::system_error if the file cannot be opened.
   //! @throws cuda::cuda_error if a CUDA driver error occurs.
   //! @throws cuda::cufile_error if a cuFile driver error occurs.
   _CCCL_HOST_API void open(const char* __filename, cufile_open_mode __open_mode)
@@ -261,7 +163,7 @@ public:
       _CCCL_THROW(::std::runtime_error, "File is already opened.");
     }
 
-    __native_handle_ = __open_file(__filename, __make_oflags(__open_mode));
+    __native_handle_ = __cufile_native::__open_file(__filename, __cufile_native::__make_oflags(__open_mode));
 
     try
     {
@@ -269,14 +171,14 @@ public:
     }
     catch (...)
     {
-      __close_file(::cuda::std::exchange(__native_handle_, __invalid_native_handle));
+      __cufile_native::__close_file(::cuda::std::exchange(__native_handle_, __invalid_native_handle));
       throw;
     }
   }
 
   //! @brief Closes the currently opened file. If there is no opened file, no action is taken.
   //!
-  //! @throws cuda::std::runtime_error if the file fails to close.
+  //! @throws std::system_error if the file fails to close.
   //! @throws cuda::cuda_error if a CUDA driver error occurs.
   //! @throws cuda::cufile_error if a cuFile driver error occurs.
   _CCCL_HOST_API void close()
@@ -287,7 +189,7 @@ public:
     }
 
     cufile_driver.deregister_native_handle(::cuda::std::exchange(__cufile_handle_, nullptr));
-    __close_file(::cuda::std::exchange(__native_handle_, __invalid_native_handle));
+    __cufile_native::__close_file(::cuda::std::exchange(__native_handle_, __invalid_native_handle));
   }
 
   //! @brief Gets the OS native handle.
@@ -298,6 +200,86 @@ public:
     return __native_handle_;
   }
 
+  //! @brief Creates a sender that reads from the file on scheduler @c __sch.
+  //!
+  //! Device memory is read with \c cuFileRead, which uses GPUDirect Storage when it is available. Host, pinned and
+  //! managed memory are read with \c pread, so the same code runs on machines without GDS. Opening a \c cufile
+  //! requires the cuFile driver, so machines without a GPU use \c posix_file, which has the same I/O interface.
+  //!
+  //! The sender completes with the number of bytes read, which is less than @c __buffer.size() only if the end of the
+  //! file is reached, or with an error if the read fails. The file and the buffer must outlive the operation.
+  //!
+  //! @param __sch The scheduler the read is executed on.
+  //! @param __buffer The buffer to read into.
+  //! @param __offset The offset in the file to read from.
+  //!
+  //! @return A sender of \c cuda::std::size_t.
+  template <class _Sch>
+  [[nodiscard]] _CCCL_HOST_API auto
+  read(_Sch __sch, ::cuda::std::span<::cuda::std::byte> __buffer, off_type __offset) const
+  {
+    return __cufile_io::__read_sender(__sch, __native_handle_, __cufile_handle_, __buffer, __offset);
+  }
+
+  //! @brief Creates a sender that writes to the file on scheduler @c __sch.
+  //!
+  //! Device memory is written with \c cuFileWrite, which uses GPUDirect Storage when it is available. Host, pinned
+  //! and managed memory are written with \c pwrite.
+  //!
+  //! The sender completes with the number of bytes written or with an error if the write fails. The file and the
+  //! buffer must outlive the operation.
+  //!
+  //! @param __sch The scheduler the write is executed on.
+  //! @param __buffer The buffer to write.
+  //! @param __offset The offset in the file to write to.
+  //!
+  //! @return A sender of \c cuda::std::size_t.
+  template <class _Sch>
+  [[nodiscard]] _CCCL_HOST_API auto
+  write(_Sch __sch, ::cuda::std::span<const ::cuda::std::byte> __buffer, off_type __offset) const
+  {
+    return __cufile_io::__write_sender(__sch, __native_handle_, __cufile_handle_, __buffer, __offset);
+  }
+
+  //! @brief Creates a sender that performs many reads from the file as a bulk operation on scheduler @c __sch.
+  //!
+  //! The reads are independent and may complete in any order. At most @c __queue_depth of them are in flight at the
+  //! same time, each on its own execution agent of the bulk operation, e.g. a worker of a \c thread_pool. A queue
+  //! depth of 0 runs all reads at once, up to the parallelism of the scheduler. Each read behaves like \c read.
+  //!
+  //! The sender completes with the number of bytes read by each request, in the order of @c __requests, or with the
+  //! first error in that order once all reads have finished. The requests are copied, but the file and the buffers
+  //! must outlive the operation.
+  //!
+  //! @param __sch The scheduler the reads are executed on.
+  //! @param __requests The reads to perform.
+  //! @param __queue_depth The maximum number of reads in flight.
+  //!
+  //! @return A sender of \c std::vector<cuda::std::size_t>.
+  template <class _Sch>
+  [[nodiscard]] _CCCL_HOST_API auto batch_read(
+    _Sch __sch, ::cuda::std::span<const cufile_read_request> __requests, ::cuda::std::size_t __queue_depth = 0) const
+  {
+    return __cufile_io::__batch_sender(__sch, __native_handle_, __cufile_handle_, __requests, __queue_depth);
+  }
+
+  //! @brief Creates a sender that performs many writes to the file as a bulk operation on scheduler @c __sch.
+  //!
+  //! Behaves like \c batch_read, except that each request behaves like \c write. Overlapping requests are written
+  //! in an unspecified order.
+  //!
+  //! @param __sch The scheduler the writes are executed on.
+  //! @param __requests The writes to perform.
+  //! @param __queue_depth The maximum number of writes in flight.
+  //!
+  //! @return A sender of \c std::vector<cuda::std::size_t>.
+  template <class _Sch>
+  [[nodiscard]] _CCCL_HOST_API auto batch_write(
+    _Sch __sch, ::cuda::std::span<const cufile_write_request> __requests, ::cuda::std::size_t __queue_depth = 0) const
+  {
+    return __cufile_io::__batch_sender(__sch, __native_handle_, __cufile_handle_, __requests, __queue_depth);
+  }
+
   //! @brief Deregisters the cuFile file handle and releases the native handle. The ownership of the native handle is
   //!        transferred to the caller.
   //!
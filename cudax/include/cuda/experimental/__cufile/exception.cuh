@@ -25,7 +25,9 @@
 #include <cuda/std/__host_stdlib/stdexcept>
 #include <cuda/std/source_location>
 
+#include <cerrno>
 #include <cstdio>
+#include <system_error>
 
 #include <cufile.h>
 
@@ -89,6 +91,18 @@ public:
   }
 };
 
+//! @brief Throws \c std::system_error for the error reported by a failed OS or cuFile API call in \c errno. The message
+//!        contains @c __msg, the name of the API and the description of the error. Clears \c errno.
+[[noreturn]] _CCCL_HOST_API inline void __throw_errno_error(const char* __msg, const char* __api)
+{
+  const int __err = errno;
+  errno           = 0; // clear errno
+
+  char __buffer[256]{};
+  ::snprintf(__buffer, sizeof(__buffer), "%s (%s)", __msg, __api);
+  _CCCL_THROW(::std::system_error, __err, ::std::generic_category(), __buffer);
+}
+
 //! @brief Macro to call a cuFile API and throw a cufile_error or cuda_error if it fails.
 #define _CCCL_TRY_CUFILE_API(_NAME, _MSG, ...)                                                                   \
   do                                                                                                             \
@@ -0,0 +1,316 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__exception/exception_macros.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__cufile/cufile_ref.cuh>
+#include <cuda/experimental/__cufile/exception.cuh>
+#include <cuda/experimental/__execution/bulk.cuh>
+#include <cuda/experimental/__execution/continues_on.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/just.cuh>
+#include <cuda/experimental/__execution/policy.cuh>
+#include <cuda/experimental/__execution/then.cuh>
+
+#include <exception>
+#include <vector>
+
+#include <cuda_runtime_api.h>
+#include <cufile.h>
+#include <errno.h>
+#include <unistd.h>
+
+namespace cuda::experimental
+{
+//! @brief One transfer of a batched read. The data at @c file_offset is read into @c buffer.
+struct cufile_read_request
+{
+  ::cuda::std::span<::cuda::std::byte> buffer; //!< The destination buffer, in host or device memory.
+  ::off_t file_offset; //!< The offset in the file to read from.
+};
+
+//! @brief One transfer of a batched write. The contents of @c buffer are written at @c file_offset.
+struct cufile_write_request
+{
+  ::cuda::std::span<const ::cuda::std::byte> buffer; //!< The source buffer, in host or device memory.
+  ::off_t file_offset; //!< The offset in the file to write to.
+};
+
+namespace __cufile_io
+{
+//! @brief Queries whether a buffer lives in device memory and must be transferred with cuFile.
+//!
+//! Host, pinned and managed memory are transferred with @c pread and @c pwrite. If the CUDA runtime cannot be used,
+//! e.g. on a machine without a GPU, every buffer is host memory.
+[[nodiscard]] _CCCL_HOST_API inline bool __is_device_buffer(const void* __ptr) noexcept
+{
+  ::cudaPointerAttributes __attrs{};
+  if (::cudaPointerGetAttributes(&__attrs, __ptr) != ::cudaSuccess)
+  {
+    [[maybe_unused]] const auto __ignore = ::cudaGetLastError(); // clear the error
+    return false;
+  }
+  return __attrs.type == ::cudaMemoryTypeDevice;
+}
+
+//! @brief Throws the error reported by a failed cuFileRead or cuFileWrite call, which is either a system error in
+//!        \c errno or a negated cuFile status.
+[[noreturn]] _CCCL_HOST_API inline void __throw_cufile_io_error(::ssize_t __ret, const char* __msg, const char* __api)
+{
+  if (__ret == -1)
+  {
+    ::cuda::experimental::__throw_errno_error(__msg, __api);
+  }
+  _CCCL_THROW(::cuda::experimental::cufile_error, static_cast<__cufile_error_t>(-__ret), __msg, __api);
+}
+
+//! @brief Reads up to @c __buffer.size() bytes at @c __offset. Stops early only at the end of the file.
+//!
+//! Device memory is read with cuFile through @c __handle. Without a cuFile handle, the buffer must be host accessible
+//! and neither the cuFile driver nor the CUDA runtime is used.
+//!
+//! @return The number of bytes read.
+[[nodiscard]] _CCCL_HOST_API inline ::cuda::std::size_t __read(
+  int __native_handle, ::CUfileHandle_t __handle, ::cuda::std::span<::cuda::std::byte> __buffer, ::off_t __offset)
+{
+  if (__buffer.empty())
+  {
+    return 0;
+  }
+
+  if (__handle != nullptr && __is_device_buffer(__buffer.data()))
+  {
+    const ::ssize_t __ret = ::cuFileRead(__handle, __buffer.data(), __buffer.size(), __offset, 0);
+    if (__ret < 0)
+    {
+      __throw_cufile_io_error(__ret, "Failed to read from file", "cuFileRead");
+    }
+    return static_cast<::cuda::std::size_t>(__ret);
+  }
+
+  ::cuda::std::size_t __done = 0;
+  while (__done < __buffer.size())
+  {
+    const ::ssize_t __ret = ::pread(
+      __native_handle, __buffer.data() + __done, __buffer.size() - __done, __offset + static_cast<::off_t>(__done));
+    if (__ret == 0)
+    {
+      break; // end of file
+    }
+    if (__ret == -1)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      ::cuda::experimental::__throw_errno_error("Failed to read from file", "pread");
+    }
+    __done += static_cast<::cuda::std::size_t>(__ret);
+  }
+  return __done;
+}
+
+//! @brief Writes all of @c __buffer at @c __offset. Uses cuFile and the CUDA runtime like @c __read.
+//!
+//! @return The number of bytes written.
+[[nodiscard]] _CCCL_HOST_API inline ::cuda::std::size_t __write(
+  int __native_handle,
+  ::CUfileHandle_t __handle,
+  ::cuda::std::span<const ::cuda::std::byte> __buffer,
+  ::off_t __offset)
+{
+  if (__buffer.empty())
+  {
+    return 0;
+  }
+
+  if (__handle != nullptr && __is_device_buffer(__buffer.data()))
+  {
+    const ::ssize_t __ret = ::cuFileWrite(__handle, __buffer.data(), __buffer.size(), __offset, 0);
+    if (__ret < 0)
+    {
+      __throw_cufile_io_error(__ret, "Failed to write to file", "cuFileWrite");
+    }
+    return static_cast<::cuda::std::size_t>(__ret);
+  }
+
+  ::cuda::std::size_t __done = 0;
+  while (__done < __buffer.size())
+  {
+    const ::ssize_t __ret = ::pwrite(
+      __native_handle, __buffer.data() + __done, __buffer.size() - __done, __offset + static_cast<::off_t>(__done));
+    if (__ret == -1)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      ::cuda::experimental::__throw_errno_error("Failed to write to file", "pwrite");
+    }
+    __done += static_cast<::cuda::std::size_t>(__ret);
+  }
+  return __done;
+}
+
+//! @brief The function run by the sender returned from @c cufile::read.
+struct __read_fn
+{
+  int __native_handle_;
+  ::CUfileHandle_t __handle_;
+  ::cuda::std::span<::cuda::std::byte> __buffer_;
+  ::off_t __offset_;
+
+  [[nodiscard]] _CCCL_HOST_API ::cuda::std::size_t operator()() const
+  {
+    return __cufile_io::__read(__native_handle_, __handle_, __buffer_, __offset_);
+  }
+};
+
+//! @brief The function run by the sender returned from @c cufile::write.
+struct __write_fn
+{
+  int __native_handle_;
+  ::CUfileHandle_t __handle_;
+  ::cuda::std::span<const ::cuda::std::byte> __buffer_;
+  ::off_t __offset_;
+
+  [[nodiscard]] _CCCL_HOST_API ::cuda::std::size_t operator()() const
+  {
+    return __cufile_io::__write(__native_handle_, __handle_, __buffer_, __offset_);
+  }
+};
+
+//! @brief The state of a batched transfer, passed along the sender chain.
+template <class _Request>
+struct __batch
+{
+  ::std::vector<_Request> __requests_;
+  ::std::vector<::cuda::std::size_t> __bytes_;
+  ::std::vector<::std::exception_ptr> __errors_;
+
+  _CCCL_HOST_API explicit __batch(::cuda::std::span<const _Request> __requests)
+      : __requests_(__requests.begin(), __requests.end())
+      , __bytes_(__requests.size(), 0)
+      , __errors_(__requests.size())
+  {}
+};
+
+//! @brief The bulk function of a batched transfer. Runs the transfers with index @c __i, @c __i + @c __queue_depth_,
+//!        @c __i + 2 * @c __queue_depth_, ... one after another, so that at most @c __queue_depth_ are in flight.
+//!
+//! A failing transfer must not complete the bulk operation while the other transfers are still running, so errors
+//! are stored and rethrown by @c __batch_result_fn once all transfers are done.
+struct __batch_transfer_fn
+{
+  int __native_handle_;
+  ::CUfileHandle_t __handle_;
+  ::cuda::std::size_t __queue_depth_;
+
+  template <class _Request>
+  _CCCL_HOST_API void operator()(::cuda::std::size_t __i, __batch<_Request>& __state) const noexcept
+  {
+    for (; __i < __state.__requests_.size(); __i += __queue_depth_)
+    {
+      const auto& __request = __state.__requests_[__i];
+      _CCCL_TRY
+      {
+        if constexpr (::cuda::std::is_same_v<_Request, cufile_read_request>)
+        {
+          __state.__bytes_[__i] =
+            __cufile_io::__read(__native_handle_, __handle_, __request.buffer, __request.file_offset);
+        }
+        else
+        {
+          __state.__bytes_[__i] =
+            __cufile_io::__write(__native_handle_, __handle_, __request.buffer, __request.file_offset);
+        }
+      }
+      _CCCL_CATCH_ALL
+      {
+        __state.__errors_[__i] = ::std::current_exception();
+      }
+    }
+  }
+};
+
+//! @brief Completes a batched transfer with the number of bytes of each transfer, or rethrows the first error.
+struct __batch_result_fn
+{
+  template <class _Request>
+  [[nodiscard]] _CCCL_HOST_API ::std::vector<::cuda::std::size_t> operator()(__batch<_Request>&& __state) const
+  {
+    for (auto& __error : __state.__errors_)
+    {
+      if (__error)
+      {
+        ::std::rethrow_exception(__error);
+      }
+    }
+    return static_cast<::std::vector<::cuda::std::size_t>&&>(__state.__bytes_);
+  }
+};
+//! @brief Creates the sender of a single read with \c __read.
+template <class _Sch>
+[[nodiscard]] _CCCL_HOST_API auto __read_sender(
+  _Sch __sch,
+  int __native_handle,
+  ::CUfileHandle_t __handle,
+  ::cuda::std::span<::cuda::std::byte> __buffer,
+  ::off_t __offset)
+{
+  return execution::schedule(__sch) | execution::then(__read_fn{__native_handle, __handle, __buffer, __offset});
+}
+
+//! @brief Creates the sender of a single write with \c __write.
+template <class _Sch>
+[[nodiscard]] _CCCL_HOST_API auto __write_sender(
+  _Sch __sch,
+  int __native_handle,
+  ::CUfileHandle_t __handle,
+  ::cuda::std::span<const ::cuda::std::byte> __buffer,
+  ::off_t __offset)
+{
+  return execution::schedule(__sch) | execution::then(__write_fn{__native_handle, __handle, __buffer, __offset});
+}
+
+//! @brief Creates the sender of a batched read or write with at most @c __queue_depth transfers in flight. A queue
+//!        depth of 0 runs all transfers at once.
+template <class _Sch, class _Request>
+[[nodiscard]] _CCCL_HOST_API auto __batch_sender(
+  _Sch __sch,
+  int __native_handle,
+  ::CUfileHandle_t __handle,
+  ::cuda::std::span<const _Request> __requests,
+  ::cuda::std::size_t __queue_depth)
+{
+  if (__queue_depth == 0 || __queue_depth > __requests.size())
+  {
+    __queue_depth = __requests.size();
+  }
+  const __batch_transfer_fn __transfer{__native_handle, __handle, __queue_depth};
+  return execution::just(__batch<_Request>{__requests}) | execution::continues_on(__sch)
+       | execution::bulk(execution::par, __queue_depth, __transfer) | execution::then(__batch_result_fn{});
+}
+} // namespace __cufile_io
+} // namespace cuda::experimental
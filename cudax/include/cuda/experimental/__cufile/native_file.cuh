@@ -0,0 +1,129 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/experimental/__cufile/cufile_ref.cuh>
+#include <cuda/experimental/__cufile/exception.cuh>
+#include <cuda/experimental/__cufile/open_mode.cuh>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace cuda::experimental
+{
+//! Operations on OS native file handles shared by \c cufile and \c posix_file.
+namespace __cufile_native
+{
+using __oflags_type = int;
+
+inline constexpr __cufile_os_native_type __invalid_native_handle = -1;
+
+//! @brief Make open flags from the \c cuda::cufile_open_mode.
+//!
+//! @param __om The cuFile open mode.
+//!
+//! @return The flags mask to be passed to open function.
+[[nodiscard]] _CCCL_HOST_API constexpr __oflags_type __make_oflags(cufile_open_mode __om) noexcept
+{
+  __oflags_type __ret{};
+  if ((__om & (cufile_open_mode::in | cufile_open_mode::out)) == (cufile_open_mode::in | cufile_open_mode::out))
+  {
+    __ret |= O_RDWR | O_CREAT;
+  }
+  else if ((__om & cufile_open_mode::in) == cufile_open_mode::in)
+  {
+    __ret |= O_RDONLY;
+  }
+  else if ((__om & cufile_open_mode::out) == cufile_open_mode::out)
+  {
+    __ret |= O_WRONLY | O_CREAT;
+  }
+
+  __ret |= ((__om & cufile_open_mode::trunc) == cufile_open_mode::trunc) ? O_TRUNC : 0;
+  __ret |= ((__om & cufile_open_mode::noreplace) == cufile_open_mode::noreplace) ? O_EXCL : 0;
+  __ret |= ((__om & cufile_open_mode::direct) == cufile_open_mode::direct) ? O_DIRECT : 0;
+  return __ret;
+}
+
+//! @brief Wrapper for opening the native handle.
+[[nodiscard]] _CCCL_HOST_API inline __cufile_os_native_type __open_file(const char* __filename, __oflags_type __oflags)
+{
+  // if O_CREAT flag is specified, use the same mode as if opened by fopend
+  ::mode_t __ocreat_mode{};
+  if (__oflags & O_CREAT)
+  {
+    __ocreat_mode = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH;
+  }
+
+  int __fd = ::open(__filename, __oflags, __ocreat_mode);
+
+  if (__fd == -1)
+  {
+    __throw_errno_error("Failed to open file", "open");
+  }
+
+  return __fd;
+}
+
+//! @brief Wrapper for retrieving the open mode.
+[[nodiscard]] _CCCL_HOST_API inline cufile_open_mode __open_mode(__cufile_os_native_type __native_handle)
+{
+  int __oflags = ::fcntl(__native_handle, F_GETFL);
+
+  if (__oflags == -1)
+  {
+    __throw_errno_error("Failed to retrieve open flags", "fcntl");
+  }
+
+  cufile_open_mode __om{};
+  if (__oflags & O_RDWR)
+  {
+    __om |= cufile_open_mode::in | cufile_open_mode::out;
+  }
+  else if (__oflags & O_RDONLY)
+  {
+    __om |= cufile_open_mode::in;
+  }
+  else if (__oflags & O_WRONLY)
+  {
+    __om |= cufile_open_mode::out;
+  }
+  __om |= (__oflags & O_TRUNC) ? cufile_open_mode::trunc : cufile_open_mode{};
+  __om |= (__oflags & O_EXCL) ? cufile_open_mode::noreplace : cufile_open_mode{};
+  __om |= (__oflags & O_DIRECT) ? cufile_open_mode::direct : cufile_open_mode{};
+  return __om;
+}
+
+//! @brief Wrapper for closing the native handle.
+[[nodiscard]] _CCCL_HOST_API inline bool __close_file_no_throw(__cufile_os_native_type __native_handle) noexcept
+{
+  return ::close(__native_handle) == 0;
+}
+
+//! @brief Wrapper for closing the native handle. Throws \c std::system_error if an error occurs.
+_CCCL_HOST_API inline void __close_file(__cufile_os_native_type __native_handle)
+{
+  if (!__close_file_no_throw(__native_handle))
+  {
+    __throw_errno_error("Failed to close file", "close");
+  }
+}
+} // namespace __cufile_native
+} // namespace cuda::experimental
@@ -0,0 +1,238 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__exception/exception_macros.h>
+#include <cuda/std/__host_stdlib/stdexcept>
+#include <cuda/std/__memory/addressof.h>
+#include <cuda/std/__utility/exchange.h>
+
+#include <cuda/experimental/__cufile/io.cuh>
+#include <cuda/experimental/__cufile/native_file.cuh>
+#include <cuda/experimental/__cufile/open_mode.cuh>
+
+namespace cuda::experimental
+{
+//! @brief An owning wrapper of an OS specific native file handle with the I/O interface of \c cufile.
+//!
+//! Unlike \c cufile, the file is not registered with the cuFile driver and data is transferred with \c pread and
+//! \c pwrite only, so neither the cuFile driver nor the CUDA runtime is used. This allows running the same I/O code
+//! on machines without a GPU. Buffers must be accessible from the host, e.g. host, pinned or managed memory.
+class posix_file
+{
+public:
+  using native_handle_type = __cufile_os_native_type; //!< The underlying OS native handle type.
+  using off_type           = ::off_t;
+
+private:
+  static constexpr native_handle_type __invalid_native_handle = __cufile_native::__invalid_native_handle;
+
+  native_handle_type __native_handle_{__invalid_native_handle}; //< The native handle.
+
+  _CCCL_HIDE_FROM_ABI explicit posix_file(native_handle_type __native_handle) noexcept
+      : __native_handle_{__native_handle}
+  {}
+
+public:
+  //! @brief Make a posix_file object from already existing native handle. The ownership of the handle is transferred
+  //!        to the object.
+  //!
+  //! @param __native_handle The native handle.
+  //!
+  //! @return The created posix_file object.
+  [[nodiscard]] static _CCCL_HOST_API posix_file from_native_handle(native_handle_type __native_handle) noexcept
+  {
+    return posix_file{__native_handle};
+  }
+
+  _CCCL_HIDE_FROM_ABI posix_file() noexcept = default;
+
+  //! @brief Constructs the object by opening file @c __filename in mode @c __open_mode.
+  //!
+  //! @param __filename Path to the file. Must be a zero terminated string.
+  //! @param __open_mode Open mode to open the file with.
+  //!
+  //! @throws std::system_error if the file cannot be opened.
+  _CCCL_HOST_API posix_file(const char* __filename, cufile_open_mode __open_mode)
+      : __native_handle_{__cufile_native::__open_file(__filename, __cufile_native::__make_oflags(__open_mode))}
+  {}
+
+  posix_file(const posix_file&) = delete;
+
+  //! @brief Move-construct a new @c posix_file.
+  //!
+  //! @param __other The other @c posix_file.
+  //!
+  //! @post `__other` is in moved-from state.
+  _CCCL_HOST_API posix_file(posix_file&& __other) noexcept
+      : __native_handle_{::cuda::std::exchange(__other.__native_handle_, __invalid_native_handle)}
+  {}
+
+  posix_file& operator=(const posix_file&) = delete;
+
+  //! @brief Move-assign from a @c posix_file object.
+  //!
+  //! @param __other The other @c posix_file.
+  //!
+  //! @post `__other` is in moved-from state.
+  //!
+  //! @throws std::system_error if the currently opened file fails to close.
+  _CCCL_HOST_API posix_file& operator=(posix_file&& __other)
+  {
+    if (this != ::cuda::std::addressof(__other))
+    {
+      close();
+      __native_handle_ = ::cuda::std::exchange(__other.__native_handle_, __invalid_native_handle);
+    }
+    return *this;
+  }
+
+  //! @brief Destructor. Closes the native handle.
+  _CCCL_HOST_API ~posix_file()
+  {
+    if (is_open())
+    {
+      [[maybe_unused]] const auto __ignore_close_retval = __cufile_native::__close_file_no_throw(__native_handle_);
+    }
+  }
+
+  //! @brief Queries whether the file is opened.
+  //!
+  //! @return True, if opened, false otherwise.
+  [[nodiscard]] _CCCL_HOST_API bool is_open() const noexcept
+  {
+    return __native_handle_ != __invalid_native_handle;
+  }
+
+  //! @brief Queries the open mode the object was opened with.
+  //!
+  //! @return The \c cuda::cufile_open_mode value if opened, empty value otherwise.
+  [[nodiscard]] _CCCL_HOST_API cufile_open_mode open_mode() const
+  {
+    return is_open() ? __cufile_native::__open_mode(__native_handle_) : cufile_open_mode{};
+  }
+
+  //! @brief Opens file @c __filename in mode @c __open_mode.
+  //!
+  //! @param __filename Path to the file.
+  //! @param __open_mode Open mode to open the file with.
+  //!
+  //! @throws cuda::std::runtime_error if a file is already opened.
+  //! @throws std::system_error if the file cannot be opened.
+  _CCCL_HOST_API void open(const char* __filename, cufile_open_mode __open_mode)
+  {
+    if (is_open())
+    {
+      _CCCL_THROW(::std::runtime_error, "File is already opened.");
+    }
+
+    __native_handle_ = __cufile_native::__open_file(__filename, __cufile_native::__make_oflags(__open_mode));
+  }
+
+  //! @brief Closes the currently opened file. If there is no opened file, no action is taken.
+  //!
+  //! @throws std::system_error if the file fails to close.
+  _CCCL_HOST_API void close()
+  {
+    if (!is_open())
+    {
+      return;
+    }
+
+    __cufile_native::__close_file(::cuda::std::exchange(__native_handle_, __invalid_native_handle));
+  }
+
+  //! @brief Gets the OS native handle.
+  //!
+  //! @return The native handle.
+  [[nodiscard]] _CCCL_HOST_API native_handle_type native_handle() const noexcept
+  {
+    return __native_handle_;
+  }
+
+  //! @brief Creates a sender that reads from the file with \c pread on scheduler @c __sch. Behaves like
+  //!        \c cufile::read.
+  //!
+  //! @param __sch The scheduler the read is executed on.
+  //! @param __buffer The buffer to read into.
+  //! @param __offset The offset in the file to read from.
+  //!
+  //! @return A sender of \c cuda::std::size_t.
+  template <class _Sch>
+  [[nodiscard]] _CCCL_HOST_API auto
+  read(_Sch __sch, ::cuda::std::span<::cuda::std::byte> __buffer, off_type __offset) const
+  {
+    return __cufile_io::__read_sender(__sch, __native_handle_, nullptr, __buffer, __offset);
+  }
+
+  //! @brief Creates a sender that writes to the file with \c pwrite on scheduler @c __sch. Behaves like
+  //!        \c cufile::write.
+  //!
+  //! @param __sch The scheduler the write is executed on.
+  //! @param __buffer The buffer to write.
+  //! @param __offset The offset in the file to write to.
+  //!
+  //! @return A sender of \c cuda::std::size_t.
+  template <class _Sch>
+  [[nodiscard]] _CCCL_HOST_API auto
+  write(_Sch __sch, ::cuda::std::span<const ::cuda::std::byte> __buffer, off_type __offset) const
+  {
+    return __cufile_io::__write_sender(__sch, __native_handle_, nullptr, __buffer, __offset);
+  }
+
+  //! @brief Creates a sender that performs many reads from the file as a bulk operation on scheduler @c __sch.
+  //!        Behaves like \c cufile::batch_read.
+  //!
+  //! @param __sch The scheduler the reads are executed on.
+  //! @param __requests The reads to perform.
+  //! @param __queue_depth The maximum number of reads in flight.
+  //!
+  //! @return A sender of \c std::vector<cuda::std::size_t>.
+  template <class _Sch>
+  [[nodiscard]] _CCCL_HOST_API auto batch_read(
+    _Sch __sch, ::cuda::std::span<const cufile_read_request> __requests, ::cuda::std::size_t __queue_depth = 0) const
+  {
+    return __cufile_io::__batch_sender(__sch, __native_handle_, nullptr, __requests, __queue_depth);
+  }
+
+  //! @brief Creates a sender that performs many writes to the file as a bulk operation on scheduler @c __sch.
+  //!        Behaves like \c cufile::batch_write.
+  //!
+  //! @param __sch The scheduler the writes are executed on.
+  //! @param __requests The writes to perform.
+  //! @param __queue_depth The maximum number of writes in flight.
+  //!
+  //! @return A sender of \c std::vector<cuda::std::size_t>.
+  template <class _Sch>
+  [[nodiscard]] _CCCL_HOST_API auto batch_write(
+    _Sch __sch, ::cuda::std::span<const cufile_write_request> __requests, ::cuda::std::size_t __queue_depth = 0) const
+  {
+    return __cufile_io::__batch_sender(__sch, __native_handle_, nullptr, __requests, __queue_depth);
+  }
+
+  //! @brief Releases the native handle. The ownership of the native handle is transferred to the caller.
+  //!
+  //! @returns The native handle.
+  [[nodiscard]] _CCCL_HOST_API native_handle_type release() noexcept
+  {
+    return ::cuda::std::exchange(__native_handle_, __invalid_native_handle);
+  }
+};
+} // namespace cuda::experimental
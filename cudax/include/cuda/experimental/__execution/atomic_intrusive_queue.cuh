@@ -66,6 +66,12 @@ public:
     __head_.wait(nullptr);
   }
 
+  [[nodiscard]]
+  _CCCL_API auto empty() const noexcept -> bool
+  {
+    return __head_.load(::cuda::std::memory_order_acquire) == nullptr;
+  }
+
   [[nodiscard]]
   _CCCL_API auto pop_all() noexcept -> __intrusive_queue<_NextPtr>
   {
@@ -0,0 +1,442 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_CONCURRENT_RUN_LOOP
+#define __CUDAX_EXECUTION_CONCURRENT_RUN_LOOP
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__thread/threading_support.h>
+#include <cuda/std/__utility/exchange.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstdint>
+
+#include <cuda/experimental/__detail/utility.cuh>
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/fwd.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/stop_token.cuh>
+#include <cuda/experimental/__execution/utility.cuh>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+//! @brief A run loop that several threads can drive at the same time.
+//!
+//! Every thread that calls @c run() executes work that is scheduled on the loop until
+//! @c finish() is called. Work is kept in one FIFO segment per worker. Work scheduled from
+//! one of the loop's workers goes to that worker's segment, and work scheduled from
+//! elsewhere is spread over the segments round-robin. A worker takes all the work in its own
+//! segment at once and executes it in the order in which it was scheduled. When its segment
+//! is empty, it takes the work of the other segments instead.
+//!
+//! Scheduling work is lock-free. A worker that runs out of work spins for a little while
+//! before it goes to sleep, and scheduling work only takes a lock to wake a worker when one
+//! is asleep.
+//!
+//! It can replace a @c run_loop or a @c thread_context whose single thread cannot keep up
+//! with the work that is scheduled on it.
+class _CCCL_TYPE_VISIBILITY_DEFAULT concurrent_run_loop : __immovable
+{
+  // How many times an idle worker looks for work before it goes to sleep.
+  static constexpr uint32_t __spin_count = 256;
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __task : __immovable
+  {
+    using __execute_fn_t _CCCL_NODEBUG_ALIAS = void(__task*) noexcept;
+
+    _CCCL_HIDE_FROM_ABI __task() = default;
+
+    _CCCL_HOST_API explicit __task(__execute_fn_t* __execute_fn) noexcept
+        : __execute_fn_(__execute_fn)
+    {}
+
+    _CCCL_HOST_API void __execute() noexcept
+    {
+      (*__execute_fn_)(this);
+    }
+
+    __execute_fn_t* __execute_fn_ = nullptr;
+    ::cuda::std::atomic<__task*> __next_{nullptr};
+  };
+
+  //! A FIFO queue of tasks with any number of producers and consumers.
+  //!
+  //! Producers append to the tail with a single exchange and then link the previous tail to
+  //! the new task. The head is always one of two stub tasks. A consumer detaches everything
+  //! behind the head at once by swapping the tail for the other stub, so the tasks come out in
+  //! the order in which they were pushed without a pass to reverse them. Consumers take turns
+  //! through a flag; one that finds the flag taken moves on to another segment.
+  struct alignas(64) __segment
+  {
+    _CCCL_HOST_API void __push(__task* __item) noexcept
+    {
+      __item->__next_.store(nullptr, ::cuda::std::memory_order_relaxed);
+      __task* __prev = __tail_.exchange(__item, ::cuda::std::memory_order_acq_rel);
+      __prev->__next_.store(__item, ::cuda::std::memory_order_release);
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto __has_work() const noexcept -> bool
+    {
+      const __task* __tail = __tail_.load(::cuda::std::memory_order_relaxed);
+      return __tail != &__stubs_[0] && __tail != &__stubs_[1];
+    }
+
+    //! Detaches the tasks in the segment, from @c __first to @c __last. Returns false if the
+    //! segment is empty or another consumer is taking its tasks.
+    [[nodiscard]] _CCCL_HOST_API auto __try_take(__task*& __first, __task*& __last) noexcept -> bool
+    {
+      if (!__has_work() || __busy_.exchange(true, ::cuda::std::memory_order_acquire))
+      {
+        return false;
+      }
+
+      __task* __stub   = __head_;
+      const bool __any = __tail_.load(::cuda::std::memory_order_relaxed) != __stub;
+      if (__any)
+      {
+        __task* __next_stub = __stub == &__stubs_[0] ? &__stubs_[1] : &__stubs_[0];
+        __next_stub->__next_.store(nullptr, ::cuda::std::memory_order_relaxed);
+        __last = __tail_.exchange(__next_stub, ::cuda::std::memory_order_acq_rel);
+        // The old stub is reused by the next consumer, so its link must be read now.
+        __first = __wait_for_next(__stub);
+        __head_ = __next_stub;
+      }
+
+      __busy_.store(false, ::cuda::std::memory_order_release);
+      return __any;
+    }
+
+    //! Returns the task after @c __item once the producer that pushed it has linked it.
+    [[nodiscard]] _CCCL_HOST_API static auto __wait_for_next(__task* __item) noexcept -> __task*
+    {
+      __stok::__spin_wait __spin{};
+      __task* __next = __item->__next_.load(::cuda::std::memory_order_acquire);
+      while (__next == nullptr)
+      {
+        __spin.__wait();
+        __next = __item->__next_.load(::cuda::std::memory_order_acquire);
+      }
+      return __next;
+    }
+
+    ::cuda::std::atomic<__task*> __tail_{&__stubs_[0]};
+    ::cuda::std::atomic<bool> __busy_{false};
+    __task* __head_ = &__stubs_[0];
+    __task __stubs_[2]{};
+  };
+
+  struct __worker_id
+  {
+    const concurrent_run_loop* __loop_;
+    uint32_t __index_;
+  };
+
+  [[nodiscard]] _CCCL_HOST_API static auto __this_worker() noexcept -> __worker_id&
+  {
+    static thread_local __worker_id __id{nullptr, 0};
+    return __id;
+  }
+
+  template <class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t : __task
+  {
+    using operation_state_concept = operation_state_t;
+
+    _CCCL_HOST_API explicit __opstate_t(concurrent_run_loop* __loop, _Rcvr __rcvr)
+        : __task{&__execute_impl}
+        , __loop_{__loop}
+        , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+    {}
+
+    _CCCL_HOST_API void start() noexcept
+    {
+      __loop_->__push(this);
+    }
+
+    _CCCL_HOST_API static void __execute_impl(__task* __p) noexcept
+    {
+      auto& __rcvr = static_cast<__opstate_t*>(__p)->__rcvr_;
+      if (get_stop_token(get_env(__rcvr)).stop_requested())
+      {
+        set_stopped(static_cast<_Rcvr&&>(__rcvr));
+      }
+      else
+      {
+        set_value(static_cast<_Rcvr&&>(__rcvr));
+      }
+    }
+
+    concurrent_run_loop* __loop_;
+    _Rcvr __rcvr_;
+  };
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __attrs_t
+  {
+    [[nodiscard]] _CCCL_HOST_API auto query(get_completion_scheduler_t<set_value_t>) const noexcept;
+    [[nodiscard]] _CCCL_HOST_API auto query(get_completion_scheduler_t<set_stopped_t>) const noexcept;
+
+    [[nodiscard]] _CCCL_API constexpr auto query(get_completion_behavior_t) const noexcept
+    {
+      return completion_behavior::asynchronous;
+    }
+
+    concurrent_run_loop* __loop_;
+  };
+
+public:
+  //! @brief Creates a loop with one segment per hardware thread.
+  _CCCL_HOST_API concurrent_run_loop()
+      : concurrent_run_loop(::std::thread::hardware_concurrency())
+  {}
+
+  //! @brief Creates a loop with @p __num_segments segments, or a single segment if
+  //! @p __num_segments is zero. The loop works best with a segment per thread that drives it.
+  _CCCL_HOST_API explicit concurrent_run_loop(uint32_t __num_segments)
+      : __num_segments_{__num_segments == 0 ? 1 : __num_segments}
+      , __segments_{new __segment[__num_segments_]}
+  {}
+
+  class _CCCL_TYPE_VISIBILITY_DEFAULT scheduler : __attrs_t
+  {
+    friend concurrent_run_loop;
+
+    _CCCL_HOST_API explicit scheduler(concurrent_run_loop* __loop) noexcept
+        : __attrs_t{__loop}
+    {}
+
+  public:
+    using scheduler_concept = scheduler_t;
+
+    struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t
+    {
+      using sender_concept = sender_t;
+
+      template <class _Rcvr>
+      [[nodiscard]] _CCCL_HOST_API auto connect(_Rcvr __rcvr) const noexcept(__nothrow_movable<_Rcvr>)
+        -> __opstate_t<_Rcvr>
+      {
+        return __opstate_t<_Rcvr>{__loop_, static_cast<_Rcvr&&>(__rcvr)};
+      }
+
+      template <class _Self>
+      [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+      {
+        return completion_signatures<set_value_t(), set_stopped_t()>{};
+      }
+
+      [[nodiscard]] _CCCL_HOST_API auto get_env() const noexcept -> __attrs_t
+      {
+        return __attrs_t{__loop_};
+      }
+
+      concurrent_run_loop* __loop_;
+    };
+
+    [[nodiscard]] _CCCL_HOST_API auto schedule() const noexcept -> __sndr_t
+    {
+      return __sndr_t{this->__loop_};
+    }
+
+    using __attrs_t::query;
+
+    [[nodiscard]] _CCCL_API constexpr auto query(get_forward_progress_guarantee_t) const noexcept
+      -> forward_progress_guarantee
+    {
+      return forward_progress_guarantee::parallel;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API friend bool operator==(const scheduler& __a, const scheduler& __b) noexcept
+    {
+      return __a.__loop_ == __b.__loop_;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API friend bool operator!=(const scheduler& __a, const scheduler& __b) noexcept
+    {
+      return __a.__loop_ != __b.__loop_;
+    }
+  };
+
+  [[nodiscard]] _CCCL_HOST_API auto get_scheduler() noexcept -> scheduler
+  {
+    return scheduler{this};
+  }
+
+  //! @brief Executes work on the calling thread until @c finish() is called and there is no
+  //! work left. Any number of threads can call @c run() at the same time.
+  _CCCL_HOST_API void run() noexcept
+  {
+    const uint32_t __index = __next_segment_.fetch_add(1, ::cuda::std::memory_order_relaxed) % __num_segments_;
+    const __worker_id __outer = ::cuda::std::exchange(__this_worker(), __worker_id{this, __index});
+
+    while (true)
+    {
+      if (__execute_batch(__index))
+      {
+        continue;
+      }
+      if (__finishing_.load(::cuda::std::memory_order_acquire))
+      {
+        // Work that was scheduled before finish() was called is visible now.
+        if (__execute_batch(__index))
+        {
+          continue;
+        }
+        break;
+      }
+      __idle();
+    }
+
+    __this_worker() = __outer;
+  }
+
+  //! @brief Makes the calls to @c run() return once they have executed the work that was
+  //! scheduled before.
+  _CCCL_HOST_API void finish() noexcept
+  {
+    if (!__finishing_.exchange(true, ::cuda::std::memory_order_acq_rel))
+    {
+      {
+        ::std::lock_guard<::std::mutex> __lock{__mtx_};
+        __epoch_.fetch_add(1, ::cuda::std::memory_order_release);
+      }
+      __cv_.notify_all();
+    }
+  }
+
+private:
+  _CCCL_HOST_API void __push(__task* __item) noexcept
+  {
+    const __worker_id& __id = __this_worker();
+    const uint32_t __index  = __id.__loop_ == this
+                              ? __id.__index_
+                              : __round_robin_.fetch_add(1, ::cuda::std::memory_order_relaxed) % __num_segments_;
+    __segments_[__index].__push(__item);
+
+    // Pairs with the fence in __idle: either this thread sees the sleeper and wakes it, or
+    // the sleeper sees the new task and does not go to sleep.
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    if (__sleepers_.load(::cuda::std::memory_order_relaxed) != 0)
+    {
+      {
+        ::std::lock_guard<::std::mutex> __lock{__mtx_};
+        __epoch_.fetch_add(1, ::cuda::std::memory_order_release);
+      }
+      __cv_.notify_one();
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __has_work() const noexcept -> bool
+  {
+    for (uint32_t __i = 0; __i < __num_segments_; ++__i)
+    {
+      if (__segments_[__i].__has_work())
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Executes the tasks of the first segment that has any, starting with the worker's own.
+  // Returns true if any tasks were executed.
+  _CCCL_HOST_API auto __execute_batch(uint32_t __index) noexcept -> bool
+  {
+    __task* __first = nullptr;
+    __task* __last  = nullptr;
+    for (uint32_t __i = 0; __i < __num_segments_; ++__i)
+    {
+      if (__segments_[(__index + __i) % __num_segments_].__try_take(__first, __last))
+      {
+        while (true)
+        {
+          // Executing a task may destroy it, so find the next one first.
+          __task* __next = __first == __last ? nullptr : __segment::__wait_for_next(__first);
+          __first->__execute();
+          if (__next == nullptr)
+          {
+            return true;
+          }
+          __first = __next;
+        }
+      }
+    }
+    return false;
+  }
+
+  // Spins for a while, and then sleeps until work is scheduled or finish() is called.
+  _CCCL_HOST_API void __idle() noexcept
+  {
+    for (uint32_t __i = 0; __i < __spin_count; ++__i)
+    {
+      if (__has_work() || __finishing_.load(::cuda::std::memory_order_relaxed))
+      {
+        return;
+      }
+      ::cuda::std::__cccl_thread_yield_processor();
+    }
+
+    __sleepers_.fetch_add(1, ::cuda::std::memory_order_relaxed);
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    const uint32_t __epoch = __epoch_.load(::cuda::std::memory_order_acquire);
+    if (!__has_work() && !__finishing_.load(::cuda::std::memory_order_acquire))
+    {
+      ::std::unique_lock<::std::mutex> __lock{__mtx_};
+      while (__epoch_.load(::cuda::std::memory_order_relaxed) == __epoch)
+      {
+        __cv_.wait(__lock);
+      }
+    }
+    __sleepers_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+  }
+
+  uint32_t __num_segments_;
+  ::std::unique_ptr<__segment[]> __segments_;
+  ::cuda::std::atomic<uint32_t> __next_segment_{0};
+  ::cuda::std::atomic<uint32_t> __round_robin_{0};
+  ::cuda::std::atomic<uint32_t> __sleepers_{0};
+  ::cuda::std::atomic<uint32_t> __epoch_{0};
+  ::cuda::std::atomic<bool> __finishing_{false};
+  ::std::mutex __mtx_;
+  ::std::condition_variable __cv_;
+};
+
+_CCCL_HOST_API inline auto
+concurrent_run_loop::__attrs_t::query(get_completion_scheduler_t<set_value_t>) const noexcept
+{
+  return scheduler{__loop_};
+}
+
+_CCCL_HOST_API inline auto
+concurrent_run_loop::__attrs_t::query(get_completion_scheduler_t<set_stopped_t>) const noexcept
+{
+  return scheduler{__loop_};
+}
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_CONCURRENT_RUN_LOOP
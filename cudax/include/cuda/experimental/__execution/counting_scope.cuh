@@ -0,0 +1,425 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_COUNTING_SCOPE
+#define __CUDAX_EXECUTION_COUNTING_SCOPE
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__type_traits/copy_cvref.h>
+#include <cuda/std/atomic>
+
+#include <cuda/experimental/__detail/utility.cuh>
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/get_completion_signatures.cuh>
+#include <cuda/experimental/__execution/lazy.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/stop_token.cuh>
+#include <cuda/experimental/__execution/utility.cuh>
+
+#include <mutex>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+//! @brief An async scope that counts the operations associated with it.
+//!
+//! Work is associated with the scope through its token, usually with @c spawn or @c spawn_future. The sender
+//! returned by @c join completes once all of the associated work has completed. @c request_stop sends a stop
+//! request to all of the associated work.
+//!
+//! Associating and disassociating an operation is a single atomic operation. A mutex is only taken while a @c join
+//! is waiting for the associated operations to complete.
+//!
+//! @note Based on @c counting_scope from P3149. Unlike in P3149, the sender returned by @c join completes on the
+//! thread that completed the last associated operation, or inline if there is none.
+//!
+//! @pre All associated operations have completed when the scope is destroyed, e.g. because it has been joined.
+class _CCCL_TYPE_VISIBILITY_DEFAULT counting_scope
+{
+  // Layout of __state_: bit 0 is set once the scope is closed, bit 1 is set while a join operation waits for
+  // the associated operations to complete, and the remaining bits count the associated operations.
+  static constexpr size_t __closed_bit  = 1;
+  static constexpr size_t __joining_bit = 2;
+  static constexpr size_t __one_op      = 4;
+
+  struct __join_waiter
+  {
+    void (*__complete_)(__join_waiter*) noexcept;
+    __join_waiter* __next_ = nullptr;
+  };
+
+  template <class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __join_opstate_t : __join_waiter
+  {
+    using operation_state_concept = operation_state_t;
+
+    _CCCL_HOST_API explicit __join_opstate_t(counting_scope* __scope, _Rcvr __rcvr) noexcept
+        : __join_waiter{&__complete_impl}
+        , __scope_{__scope}
+        , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+    {}
+
+    _CCCL_IMMOVABLE(__join_opstate_t);
+
+    _CCCL_HOST_API void start() noexcept
+    {
+      __scope_->__start_join(this);
+    }
+
+    _CCCL_HOST_API static void __complete_impl(__join_waiter* __waiter) noexcept
+    {
+      execution::set_value(static_cast<_Rcvr&&>(static_cast<__join_opstate_t*>(__waiter)->__rcvr_));
+    }
+
+    counting_scope* __scope_;
+    _Rcvr __rcvr_;
+  };
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __join_sndr_t
+  {
+    using sender_concept = sender_t;
+
+    template <class _Self, class... _Env>
+    [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+    {
+      return completion_signatures<set_value_t()>{};
+    }
+
+    template <class _Rcvr>
+    [[nodiscard]] _CCCL_HOST_API auto connect(_Rcvr __rcvr) const noexcept(__nothrow_movable<_Rcvr>)
+      -> __join_opstate_t<_Rcvr>
+    {
+      return __join_opstate_t<_Rcvr>{__scope_, static_cast<_Rcvr&&>(__rcvr)};
+    }
+
+    counting_scope* __scope_;
+  };
+
+  // Passes the stop token of the scope to a wrapped sender. If the receiver of the wrapped sender can be stopped,
+  // too, stop requests from both of them are forwarded to a stop source owned by the operation.
+  template <class _StopToken, bool = unstoppable_token<_StopToken>>
+  struct __stop_link_t
+  {
+    _CCCL_API void __link(inplace_stop_token __scope_token, const _StopToken&) noexcept
+    {
+      __token_ = __scope_token;
+    }
+
+    _CCCL_API void __unlink() noexcept {}
+
+    [[nodiscard]] _CCCL_API auto __get_token() const noexcept -> inplace_stop_token
+    {
+      return __token_;
+    }
+
+    inplace_stop_token __token_;
+  };
+
+  template <class _StopToken>
+  struct __stop_link_t<_StopToken, false>
+  {
+    _CCCL_API void __link(inplace_stop_token __scope_token, const _StopToken& __rcvr_token) noexcept
+    {
+      __on_scope_stop_.__construct(__scope_token, __on_stop_request{__stop_source_});
+      __on_rcvr_stop_.__construct(__rcvr_token, __on_stop_request{__stop_source_});
+    }
+
+    _CCCL_API void __unlink() noexcept
+    {
+      __on_rcvr_stop_.__destroy();
+      __on_scope_stop_.__destroy();
+    }
+
+    [[nodiscard]] _CCCL_API auto __get_token() const noexcept -> inplace_stop_token
+    {
+      return __stop_source_.get_token();
+    }
+
+    inplace_stop_source __stop_source_;
+    __lazy<stop_callback_for_t<inplace_stop_token, __on_stop_request>> __on_scope_stop_;
+    __lazy<stop_callback_for_t<_StopToken, __on_stop_request>> __on_rcvr_stop_;
+  };
+
+  template <class _Env>
+  using __wrap_env_t _CCCL_NODEBUG_ALIAS = __join_env_t<prop<get_stop_token_t, inplace_stop_token>, _Env>;
+
+  template <class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __wrap_state_t
+  {
+    _Rcvr __rcvr_;
+    __stop_link_t<stop_token_of_t<env_of_t<_Rcvr>>> __stop_link_;
+  };
+
+  template <class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __wrap_rcvr_t
+  {
+    using receiver_concept = receiver_t;
+
+    template <class... _As>
+    _CCCL_API void set_value(_As&&... __as) noexcept
+    {
+      __state_->__stop_link_.__unlink();
+      execution::set_value(static_cast<_Rcvr&&>(__state_->__rcvr_), static_cast<_As&&>(__as)...);
+    }
+
+    template <class _Error>
+    _CCCL_API void set_error(_Error&& __error) noexcept
+    {
+      __state_->__stop_link_.__unlink();
+      execution::set_error(static_cast<_Rcvr&&>(__state_->__rcvr_), static_cast<_Error&&>(__error));
+    }
+
+    _CCCL_API void set_stopped() noexcept
+    {
+      __state_->__stop_link_.__unlink();
+      execution::set_stopped(static_cast<_Rcvr&&>(__state_->__rcvr_));
+    }
+
+    [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __wrap_env_t<env_of_t<_Rcvr>>
+    {
+      return __join_env(prop{execution::get_stop_token, __state_->__stop_link_.__get_token()},
+                        execution::get_env(__state_->__rcvr_));
+    }
+
+    __wrap_state_t<_Rcvr>* __state_;
+  };
+
+  template <class _CvSndr, class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __wrap_opstate_t
+  {
+    using operation_state_concept = operation_state_t;
+
+    _CCCL_API explicit __wrap_opstate_t(_CvSndr&& __sndr, const counting_scope* __scope, _Rcvr __rcvr)
+        : __scope_{__scope}
+        , __state_{static_cast<_Rcvr&&>(__rcvr), {}}
+        , __opstate_(execution::connect(static_cast<_CvSndr&&>(__sndr), __wrap_rcvr_t<_Rcvr>{&__state_}))
+    {}
+
+    _CCCL_IMMOVABLE(__wrap_opstate_t);
+
+    _CCCL_API void start() noexcept
+    {
+      __state_.__stop_link_.__link(__scope_->get_stop_token(),
+                                  execution::get_stop_token(execution::get_env(__state_.__rcvr_)));
+      execution::start(__opstate_);
+    }
+
+    const counting_scope* __scope_;
+    __wrap_state_t<_Rcvr> __state_;
+    connect_result_t<_CvSndr, __wrap_rcvr_t<_Rcvr>> __opstate_;
+  };
+
+  template <class _Sndr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __wrap_sndr_t
+  {
+    using sender_concept = sender_t;
+
+    template <class _Self, class... _Env>
+    [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures()
+    {
+      return execution::get_completion_signatures<::cuda::std::__copy_cvref_t<_Self, _Sndr>, __wrap_env_t<_Env>...>();
+    }
+
+    template <class _Rcvr>
+    [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) && -> __wrap_opstate_t<_Sndr, _Rcvr>
+    {
+      return __wrap_opstate_t<_Sndr, _Rcvr>{static_cast<_Sndr&&>(__sndr_), __scope_, static_cast<_Rcvr&&>(__rcvr)};
+    }
+
+    template <class _Rcvr>
+    [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) const& -> __wrap_opstate_t<const _Sndr&, _Rcvr>
+    {
+      return __wrap_opstate_t<const _Sndr&, _Rcvr>{__sndr_, __scope_, static_cast<_Rcvr&&>(__rcvr)};
+    }
+
+    [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __fwd_env_t<env_of_t<_Sndr>>
+    {
+      return __fwd_env(execution::get_env(__sndr_));
+    }
+
+    const counting_scope* __scope_;
+    _Sndr __sndr_;
+  };
+
+public:
+  //! @brief A handle to a @c counting_scope used to associate work with it.
+  class _CCCL_TYPE_VISIBILITY_DEFAULT token
+  {
+  public:
+    //! @brief Associates an operation with the scope.
+    //! @return @c false if the scope is closed, in which case no association was made.
+    [[nodiscard]] _CCCL_HOST_API auto try_associate() const noexcept -> bool
+    {
+      return __scope_->__try_associate();
+    }
+
+    //! @brief Ends an association made by a successful call to @c try_associate.
+    _CCCL_HOST_API void disassociate() const noexcept
+    {
+      __scope_->__disassociate();
+    }
+
+    //! @brief Wraps a sender so that it observes the stop requests of the scope in addition to those of its
+    //! receiver.
+    template <class _Sndr>
+    [[nodiscard]] _CCCL_API auto wrap(_Sndr __sndr) const -> __wrap_sndr_t<_Sndr>
+    {
+      static_assert(__is_sender<_Sndr>);
+      return __wrap_sndr_t<_Sndr>{__scope_, static_cast<_Sndr&&>(__sndr)};
+    }
+
+  private:
+    friend counting_scope;
+
+    _CCCL_HOST_API explicit token(counting_scope* __scope) noexcept
+        : __scope_{__scope}
+    {}
+
+    counting_scope* __scope_;
+  };
+
+  _CCCL_HIDE_FROM_ABI counting_scope() noexcept = default;
+
+  _CCCL_IMMOVABLE(counting_scope);
+
+  _CCCL_HOST_API ~counting_scope()
+  {
+    _CCCL_ASSERT(__state_.load(::cuda::std::memory_order_relaxed) / __one_op == 0,
+                 "counting_scope destroyed while operations are still associated with it");
+  }
+
+  //! @brief Returns a token that associates work with this scope.
+  [[nodiscard]] _CCCL_HOST_API auto get_token() noexcept -> token
+  {
+    return token{this};
+  }
+
+  //! @brief Closes the scope. Subsequent calls to @c token::try_associate fail, so work spawned afterwards is
+  //! discarded without being started.
+  _CCCL_HOST_API void close() noexcept
+  {
+    __state_.fetch_or(__closed_bit, ::cuda::std::memory_order_acq_rel);
+  }
+
+  //! @brief Sends a stop request to all operations associated with the scope through @c token::wrap.
+  _CCCL_HOST_API void request_stop() noexcept
+  {
+    __stop_source_.request_stop();
+  }
+
+  //! @brief Returns the stop token observed by the operations associated with the scope.
+  [[nodiscard]] _CCCL_API auto get_stop_token() const noexcept -> inplace_stop_token
+  {
+    return __stop_source_.get_token();
+  }
+
+  //! @brief Returns a sender that completes with @c set_value() once no operations are associated with the scope.
+  //!
+  //! The scope is not closed by joining it, so it can be reused once the sender has completed.
+  [[nodiscard]] _CCCL_HOST_API auto join() noexcept -> __join_sndr_t
+  {
+    return __join_sndr_t{this};
+  }
+
+private:
+  [[nodiscard]] _CCCL_HOST_API auto __try_associate() noexcept -> bool
+  {
+    size_t __state = __state_.load(::cuda::std::memory_order_relaxed);
+    do
+    {
+      if (__state & __closed_bit)
+      {
+        return false;
+      }
+    } while (!__state_.compare_exchange_weak(__state, __state + __one_op, ::cuda::std::memory_order_acq_rel));
+    return true;
+  }
+
+  _CCCL_HOST_API void __disassociate() noexcept
+  {
+    size_t __state = __state_.load(::cuda::std::memory_order_relaxed);
+    do
+    {
+      _CCCL_ASSERT(__state / __one_op != 0, "disassociate called without a matching try_associate");
+      if (__state & __joining_bit)
+      {
+        __disassociate_slow();
+        return;
+      }
+    } while (!__state_.compare_exchange_weak(__state, __state - __one_op, ::cuda::std::memory_order_acq_rel));
+  }
+
+  // The joining bit only changes while the mutex is held. Decrementing under the mutex while it is set makes sure
+  // that exactly one thread completes the join operations, and that no thread touches the scope after that.
+  _CCCL_HOST_API void __disassociate_slow() noexcept
+  {
+    __join_waiter* __waiters = nullptr;
+    {
+      ::std::lock_guard<::std::mutex> __lock{__mtx_};
+      const size_t __old_state = __state_.fetch_sub(__one_op, ::cuda::std::memory_order_acq_rel);
+      if (__old_state / __one_op == 1 && (__old_state & __joining_bit))
+      {
+        __state_.fetch_and(~__joining_bit, ::cuda::std::memory_order_relaxed);
+        __waiters  = __waiters_;
+        __waiters_ = nullptr;
+      }
+    }
+
+    while (__waiters != nullptr)
+    {
+      // Completing a join operation may destroy it, so advance before completing it.
+      __join_waiter* __waiter = __waiters;
+      __waiters               = __waiter->__next_;
+      __waiter->__complete_(__waiter);
+    }
+  }
+
+  _CCCL_HOST_API void __start_join(__join_waiter* __waiter) noexcept
+  {
+    {
+      ::std::lock_guard<::std::mutex> __lock{__mtx_};
+      // Setting the joining bit fails if the last associated operation completes concurrently.
+      size_t __state = __state_.load(::cuda::std::memory_order_acquire);
+      while (__state / __one_op != 0)
+      {
+        if (__state_.compare_exchange_weak(__state, __state | __joining_bit, ::cuda::std::memory_order_acq_rel))
+        {
+          __waiter->__next_ = __waiters_;
+          __waiters_        = __waiter;
+          return;
+        }
+      }
+    }
+    __waiter->__complete_(__waiter);
+  }
+
+  ::cuda::std::atomic<size_t> __state_{0};
+  inplace_stop_source __stop_source_;
+  ::std::mutex __mtx_;
+  __join_waiter* __waiters_ = nullptr;
+};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_COUNTING_SCOPE
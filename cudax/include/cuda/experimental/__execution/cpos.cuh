@@ -178,12 +178,38 @@ struct schedule_t
   }
 };
 
+// Timed schedulers, like the one of a timed_run_loop, return a sender that completes at or
+// after a point in time from sch.schedule_at(tp), and after a delay from sch.schedule_after(d).
+struct schedule_after_t
+{
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _Sch, class _Duration>
+  _CCCL_TRIVIAL_API constexpr auto operator()(_Sch&& __sch, _Duration&& __duration) const
+    noexcept(noexcept(static_cast<_Sch&&>(__sch).schedule_after(static_cast<_Duration&&>(__duration))))
+  {
+    return static_cast<_Sch&&>(__sch).schedule_after(static_cast<_Duration&&>(__duration));
+  }
+};
+
+struct schedule_at_t
+{
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _Sch, class _TimePoint>
+  _CCCL_TRIVIAL_API constexpr auto operator()(_Sch&& __sch, _TimePoint&& __time_point) const
+    noexcept(noexcept(static_cast<_Sch&&>(__sch).schedule_at(static_cast<_TimePoint&&>(__time_point))))
+  {
+    return static_cast<_Sch&&>(__sch).schedule_at(static_cast<_TimePoint&&>(__time_point));
+  }
+};
+
 _CCCL_GLOBAL_CONSTANT set_value_t set_value{};
 _CCCL_GLOBAL_CONSTANT set_error_t set_error{};
 _CCCL_GLOBAL_CONSTANT set_stopped_t set_stopped{};
 _CCCL_GLOBAL_CONSTANT start_t start{};
 _CCCL_GLOBAL_CONSTANT connect_t connect{};
 _CCCL_GLOBAL_CONSTANT schedule_t schedule{};
+_CCCL_GLOBAL_CONSTANT schedule_after_t schedule_after{};
+_CCCL_GLOBAL_CONSTANT schedule_at_t schedule_at{};
 } // namespace cuda::experimental::execution
 
 #include <cuda/experimental/__execution/epilogue.cuh>
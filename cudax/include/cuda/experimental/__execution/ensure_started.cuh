@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_ENSURE_STARTED
+#define __CUDAX_EXECUTION_ENSURE_STARTED
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/fwd.cuh>
+#include <cuda/experimental/__execution/split.cuh>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+//! @brief Starts a sender eagerly and returns a sender for its result.
+//!
+//! @c ensure_started(sndr) starts @c sndr right away and returns a move-only sender that can be
+//! connected once. Its result is decay-copied into a shared state and moved out to the consumer,
+//! which may be started before or after @c sndr completes. If the returned sender, or the
+//! operation it is connected to, is destroyed without being started, or if the consumer's stop
+//! token is triggered, @c sndr is asked to stop through the stop token in its environment.
+struct ensure_started_t
+{
+  template <class _Sndr>
+  [[nodiscard]] _CCCL_HOST_API auto operator()(_Sndr __sndr) const -> __shared::__sndr_t<ensure_started_t, _Sndr>
+  {
+    static_assert(__is_sender<_Sndr>);
+    static_assert(__valid_completion_signatures<decltype(__shared::__get_completions<ensure_started_t, _Sndr>())>,
+                  "The sender passed to ensure_started has invalid completion signatures.");
+    auto* __state = new __shared::__state_t<ensure_started_t, _Sndr>{static_cast<_Sndr&&>(__sndr)};
+    __shared::__sndr_t<ensure_started_t, _Sndr> __result{__state};
+    __state->__try_start();
+    return __result;
+  }
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __closure_t
+  {
+    template <class _Sndr>
+    [[nodiscard]] _CCCL_HOST_API auto operator()(_Sndr __sndr) const -> __shared::__sndr_t<ensure_started_t, _Sndr>
+    {
+      return ensure_started_t{}(static_cast<_Sndr&&>(__sndr));
+    }
+
+    template <class _Sndr>
+    [[nodiscard]] _CCCL_HOST_API friend auto operator|(_Sndr __sndr, __closure_t)
+      -> __shared::__sndr_t<ensure_started_t, _Sndr>
+    {
+      return ensure_started_t{}(static_cast<_Sndr&&>(__sndr));
+    }
+  };
+
+  [[nodiscard]] _CCCL_HOST_API auto operator()() const noexcept -> __closure_t
+  {
+    return {};
+  }
+};
+
+_CCCL_GLOBAL_CONSTANT ensure_started_t ensure_started{};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_ENSURE_STARTED
@@ -160,6 +160,8 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT set_stopped_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT start_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT connect_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT schedule_t;
+struct _CCCL_TYPE_VISIBILITY_DEFAULT schedule_after_t;
+struct _CCCL_TYPE_VISIBILITY_DEFAULT schedule_at_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT transform_sender_t;
 
 template <class _Sch>
@@ -206,10 +208,14 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT schedule_from_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT bulk_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT bulk_chunked_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT bulk_unchunked_t;
+struct _CCCL_TYPE_VISIBILITY_DEFAULT split_t;
+struct _CCCL_TYPE_VISIBILITY_DEFAULT ensure_started_t;
 
 // sender consumer algorithms:
 struct _CCCL_TYPE_VISIBILITY_DEFAULT sync_wait_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT start_detached_t;
+struct _CCCL_TYPE_VISIBILITY_DEFAULT spawn_t;
+struct _CCCL_TYPE_VISIBILITY_DEFAULT spawn_future_t;
 
 // queries:
 struct _CCCL_TYPE_VISIBILITY_DEFAULT get_allocator_t;
@@ -287,8 +293,11 @@ template <>
 inline constexpr __disposition __signature_disposition<set_stopped_t()> = __disposition::__stopped;
 } // namespace __detail
 
+class concurrent_run_loop;
 struct inline_scheduler;
 class task_scheduler;
+class task_scheduler_ref;
+class thread_pool;
 
 struct stream_domain;
 struct stream_context;
@@ -0,0 +1,219 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_SLAB_ALLOCATOR
+#define __CUDAX_EXECUTION_SLAB_ALLOCATOR
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__exception/exception_macros.h>
+#include <cuda/std/__host_stdlib/new>
+#include <cuda/std/__new/allocate.h>
+#include <cuda/std/atomic>
+
+#include <mutex>
+#include <vector>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+//! @brief A thread-safe pool of fixed-size blocks that are carved from large slabs and recycled when they are freed.
+//!
+//! Requests are rounded up to a power of two between 64 bytes and 8 KiB, and each size class keeps its own free
+//! list. Freeing a block pushes it on a lock-free list of its size class. Allocating pops from a list that is
+//! private to the size class and guarded by a mutex, and refills it from the lock-free list or from a new slab
+//! when it runs dry. Memory is only returned to the system when the pool is destroyed. Larger or over-aligned
+//! requests are forwarded to @c operator new.
+//!
+//! The pool is meant for the operation states of work spawned into a @c counting_scope, which are allocated and
+//! freed at a high rate, often on different threads. Use it through @c slab_allocator.
+class _CCCL_TYPE_VISIBILITY_DEFAULT slab_pool
+{
+  static constexpr size_t __min_block_log2 = 6; // 64 bytes
+  static constexpr size_t __num_classes    = 8; // up to 8 KiB
+  static constexpr size_t __block_align    = size_t{1} << __min_block_log2;
+
+  struct __free_block
+  {
+    __free_block* __next_;
+  };
+
+  struct alignas(64) __size_class
+  {
+    ::std::mutex __mtx_;
+    __free_block* __free_ = nullptr;
+    ::cuda::std::atomic<__free_block*> __freed_{nullptr};
+    ::std::vector<void*> __slabs_;
+  };
+
+public:
+  //! @brief The largest request that is served from a size class.
+  static constexpr size_t max_block_size = size_t{1} << (__min_block_log2 + __num_classes - 1);
+
+  //! @brief Creates a pool that allocates slabs of at least @c __slab_size bytes.
+  _CCCL_HOST_API explicit slab_pool(size_t __slab_size = 64 * 1024) noexcept
+      : __slab_size_{(::cuda::std::max) (__slab_size, max_block_size)}
+  {}
+
+  _CCCL_IMMOVABLE(slab_pool);
+
+  _CCCL_HOST_API ~slab_pool()
+  {
+    for (auto& __class : __classes_)
+    {
+      for (void* __slab : __class.__slabs_)
+      {
+        ::cuda::std::__cccl_deallocate(__slab, __slab_size_, __block_align);
+      }
+    }
+  }
+
+  //! @brief Allocates @c __bytes bytes aligned to @c __align.
+  //! @throws std::bad_alloc if the memory cannot be allocated.
+  [[nodiscard]] _CCCL_HOST_API auto allocate(size_t __bytes, size_t __align) -> void*
+  {
+    const size_t __class = __size_class_of(__bytes, __align);
+    if (__class == __num_classes)
+    {
+      return ::cuda::std::__cccl_allocate(__bytes, __align);
+    }
+
+    __size_class& __sc = __classes_[__class];
+    ::std::lock_guard<::std::mutex> __lock{__sc.__mtx_};
+    if (__sc.__free_ == nullptr)
+    {
+      __sc.__free_ = __sc.__freed_.exchange(nullptr, ::cuda::std::memory_order_acquire);
+      if (__sc.__free_ == nullptr)
+      {
+        __add_slab(__sc, __class);
+      }
+    }
+    __free_block* __block = __sc.__free_;
+    __sc.__free_          = __block->__next_;
+    return __block;
+  }
+
+  //! @brief Returns a block obtained from @c allocate with the same @c __bytes and @c __align to the pool.
+  _CCCL_HOST_API void deallocate(void* __ptr, size_t __bytes, size_t __align) noexcept
+  {
+    const size_t __class = __size_class_of(__bytes, __align);
+    if (__class == __num_classes)
+    {
+      ::cuda::std::__cccl_deallocate(__ptr, __bytes, __align);
+      return;
+    }
+
+    __size_class& __sc   = __classes_[__class];
+    auto* __block        = ::new (__ptr) __free_block{nullptr};
+    __free_block* __head = __sc.__freed_.load(::cuda::std::memory_order_relaxed);
+    do
+    {
+      __block->__next_ = __head;
+    } while (!__sc.__freed_.compare_exchange_weak(__head, __block, ::cuda::std::memory_order_release));
+  }
+
+private:
+  [[nodiscard]] _CCCL_HOST_API static auto __size_class_of(size_t __bytes, size_t __align) noexcept -> size_t
+  {
+    if (__bytes > max_block_size || __align > __block_align)
+    {
+      return __num_classes;
+    }
+    size_t __class = 0;
+    while ((__block_align << __class) < __bytes)
+    {
+      ++__class;
+    }
+    return __class;
+  }
+
+  _CCCL_HOST_API void __add_slab(__size_class& __sc, size_t __class)
+  {
+    __sc.__slabs_.reserve(__sc.__slabs_.size() + 1);
+    auto* __slab = static_cast<::cuda::std::byte*>(::cuda::std::__cccl_allocate(__slab_size_, __block_align));
+    __sc.__slabs_.push_back(__slab);
+
+    const size_t __block_size = __block_align << __class;
+    for (size_t __offset = __slab_size_ - __slab_size_ % __block_size; __offset != 0; __offset -= __block_size)
+    {
+      __sc.__free_ = ::new (__slab + __offset - __block_size) __free_block{__sc.__free_};
+    }
+  }
+
+  size_t __slab_size_;
+  __size_class __classes_[__num_classes];
+};
+
+//! @brief An allocator that obtains memory from a @c slab_pool.
+//!
+//! Pass it to @c spawn or @c spawn_future through the environment, e.g. with
+//! @c prop{get_allocator, slab_allocator<cuda::std::byte>{pool}}, to recycle the memory of spawned operations. The
+//! pool must outlive all memory allocated from it.
+template <class _Ty>
+class _CCCL_TYPE_VISIBILITY_DEFAULT slab_allocator
+{
+public:
+  using value_type = _Ty;
+
+  _CCCL_HOST_API explicit slab_allocator(slab_pool& __pool) noexcept
+      : __pool_{&__pool}
+  {}
+
+  template <class _Other>
+  _CCCL_HOST_API slab_allocator(const slab_allocator<_Other>& __other) noexcept
+      : __pool_{__other.__pool_}
+  {}
+
+  [[nodiscard]] _CCCL_HOST_API auto allocate(size_t __count) -> _Ty*
+  {
+    if (__count > size_t(-1) / sizeof(_Ty))
+    {
+      _CCCL_THROW(::std::bad_array_new_length);
+    }
+    return static_cast<_Ty*>(__pool_->allocate(__count * sizeof(_Ty), alignof(_Ty)));
+  }
+
+  _CCCL_HOST_API void deallocate(_Ty* __ptr, size_t __count) noexcept
+  {
+    __pool_->deallocate(__ptr, __count * sizeof(_Ty), alignof(_Ty));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API friend bool operator==(const slab_allocator& __lhs, const slab_allocator& __rhs) noexcept
+  {
+    return __lhs.__pool_ == __rhs.__pool_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API friend bool operator!=(const slab_allocator& __lhs, const slab_allocator& __rhs) noexcept
+  {
+    return __lhs.__pool_ != __rhs.__pool_;
+  }
+
+private:
+  template <class>
+  friend class slab_allocator;
+
+  slab_pool* __pool_;
+};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_SLAB_ALLOCATOR
@@ -0,0 +1,165 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_SPAWN
+#define __CUDAX_EXECUTION_SPAWN
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__exception/exception_macros.h>
+#include <cuda/std/__exception/terminate.h>
+#include <cuda/std/__memory/allocator_traits.h>
+
+#include <cuda/experimental/__detail/utility.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/utility.cuh>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+//! @brief Starts a sender eagerly and associates it with an async scope, e.g. a @c counting_scope.
+//!
+//! @c spawn(sndr, token, env) wraps @c sndr with @c token.wrap and stores the resulting operation state in memory
+//! obtained from the allocator returned by @c get_allocator(env), which defaults to @c cuda::std::allocator. The
+//! operation is started only if @c token.try_associate() succeeds. When it completes, the operation state is
+//! destroyed and deallocated before @c token.disassociate() is called, so the allocator only needs to outlive the
+//! scope's @c join. Value and stopped completions are ignored. An error completion terminates the program.
+struct spawn_t
+{
+private:
+  template <class _Sndr, class _Token, class _Env>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t;
+
+  template <class _Sndr, class _Token, class _Env>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __rcvr_t
+  {
+    using receiver_concept = receiver_t;
+
+    template <class... _As>
+    _CCCL_HOST_API void set_value(_As&&...) noexcept
+    {
+      __opstate_->__complete();
+    }
+
+    template <class _Error>
+    _CCCL_HOST_API void set_error(_Error&&) noexcept
+    {
+      ::cuda::std::terminate();
+    }
+
+    _CCCL_HOST_API void set_stopped() noexcept
+    {
+      __opstate_->__complete();
+    }
+
+    [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __env_ref_t<const _Env&>
+    {
+      return __env_ref(__opstate_->__env_);
+    }
+
+    __opstate_t<_Sndr, _Token, _Env>* __opstate_;
+  };
+
+  template <class _Sndr, class _Token, class _Env>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t
+  {
+    using operation_state_concept = operation_state_t;
+    using __alloc_t _CCCL_NODEBUG_ALIAS =
+      ::cuda::std::__rebind_alloc<::cuda::std::allocator_traits<__call_result_t<get_allocator_t, const _Env&>>,
+                                  __opstate_t>;
+    using __traits_t _CCCL_NODEBUG_ALIAS = ::cuda::std::allocator_traits<__alloc_t>;
+
+    _CCCL_HOST_API explicit __opstate_t(_Sndr&& __sndr, _Token __token, _Env&& __env, __alloc_t __alloc)
+        : __token_{static_cast<_Token&&>(__token)}
+        , __env_{static_cast<_Env&&>(__env)}
+        , __alloc_{static_cast<__alloc_t&&>(__alloc)}
+        , __opstate_(execution::connect(static_cast<_Sndr&&>(__sndr), __rcvr_t<_Sndr, _Token, _Env>{this}))
+    {}
+
+    _CCCL_IMMOVABLE(__opstate_t);
+
+    _CCCL_HOST_API void start() noexcept
+    {
+      execution::start(__opstate_);
+    }
+
+    _CCCL_HOST_API void __destroy() noexcept
+    {
+      __alloc_t __alloc{static_cast<__alloc_t&&>(__alloc_)};
+      this->~__opstate_t();
+      __traits_t::deallocate(__alloc, this, 1);
+    }
+
+    _CCCL_HOST_API void __complete() noexcept
+    {
+      // The scope may be destroyed as soon as the operation is disassociated from it, so this must come last.
+      _Token __token{static_cast<_Token&&>(__token_)};
+      __destroy();
+      __token.disassociate();
+    }
+
+    _Token __token_;
+    _Env __env_;
+    __alloc_t __alloc_;
+    connect_result_t<_Sndr, __rcvr_t<_Sndr, _Token, _Env>> __opstate_;
+  };
+
+public:
+  template <class _Sndr, class _Token, class _Env = env<>>
+  _CCCL_HOST_API void operator()(_Sndr __sndr, _Token __token, _Env __env = {}) const
+  {
+    static_assert(__is_sender<_Sndr>);
+    using __wrapped_t _CCCL_NODEBUG_ALIAS = decltype(__token.wrap(static_cast<_Sndr&&>(__sndr)));
+    using __opstate_t _CCCL_NODEBUG_ALIAS = spawn_t::__opstate_t<__wrapped_t, _Token, _Env>;
+    using __alloc_t _CCCL_NODEBUG_ALIAS   = typename __opstate_t::__alloc_t;
+    using __traits_t _CCCL_NODEBUG_ALIAS  = typename __opstate_t::__traits_t;
+
+    __alloc_t __alloc(execution::get_allocator(__env));
+    __opstate_t* __opstate = __traits_t::allocate(__alloc, 1);
+    _CCCL_TRY
+    {
+      ::new (static_cast<void*>(__opstate))
+        __opstate_t{__token.wrap(static_cast<_Sndr&&>(__sndr)), __token, static_cast<_Env&&>(__env), __alloc};
+    }
+    _CCCL_CATCH_ALL
+    {
+      __traits_t::deallocate(__alloc, __opstate, 1);
+      _CCCL_RETHROW;
+    }
+
+    if (__token.try_associate())
+    {
+      execution::start(*__opstate);
+    }
+    else
+    {
+      __opstate->__destroy();
+    }
+  }
+};
+
+_CCCL_GLOBAL_CONSTANT spawn_t spawn{};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_SPAWN
@@ -0,0 +1,410 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_SPAWN_FUTURE
+#define __CUDAX_EXECUTION_SPAWN_FUTURE
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__cccl/unreachable.h>
+#include <cuda/std/__exception/exception_macros.h>
+#include <cuda/std/__memory/allocator_traits.h>
+#include <cuda/std/__utility/exchange.h>
+#include <cuda/std/__utility/pod_tuple.h>
+#include <cuda/std/atomic>
+
+#include <cuda/experimental/__detail/utility.cuh>
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/exception.cuh>
+#include <cuda/experimental/__execution/get_completion_signatures.cuh>
+#include <cuda/experimental/__execution/lazy.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/stop_token.cuh>
+#include <cuda/experimental/__execution/transform_completion_signatures.cuh>
+#include <cuda/experimental/__execution/utility.cuh>
+#include <cuda/experimental/__execution/variant.cuh>
+#include <cuda/experimental/__execution/visit.cuh>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+//! @brief Starts a sender eagerly, associates it with an async scope, and returns a sender of its result.
+//!
+//! @c spawn_future(sndr, token, env) allocates the spawned operation together with storage for its result from the
+//! allocator returned by @c get_allocator(env), and starts it if @c token.try_associate() succeeds. The returned
+//! sender completes with the decay-copied result of @c sndr, or with @c set_stopped() if the association failed.
+//!
+//! Stop requests sent to the receiver of the returned sender are forwarded to the spawned operation. If the returned
+//! sender is destroyed without being started, a stop request is sent to the spawned operation and its result is
+//! discarded. The operation stays associated with the scope until its result has been consumed or discarded.
+struct spawn_future_t
+{
+private:
+  // Bits of __state_base_t::__flags_:
+  static constexpr int __done_bit      = 1; // the spawned operation has completed
+  static constexpr int __waiting_bit   = 2; // the future has been started and waits for the result
+  static constexpr int __abandoned_bit = 4; // the future has been destroyed without being started
+
+  template <class _Tag>
+  struct __decay_args
+  {
+    template <class... _Ts>
+    [[nodiscard]] _CCCL_API _CCCL_CONSTEVAL auto operator()() const noexcept
+    {
+      if constexpr (!__decay_copyable<_Ts...>)
+      {
+        return invalid_completion_signature<_WHERE(_IN_ALGORITHM, spawn_future_t),
+                                            _WHAT(_ARGUMENTS_ARE_NOT_DECAY_COPYABLE),
+                                            _WITH_ARGUMENTS(_Ts...)>();
+      }
+      else if constexpr (!__nothrow_decay_copyable<_Ts...>)
+      {
+        return completion_signatures<_Tag(decay_t<_Ts>...), set_error_t(exception_ptr)>{};
+      }
+      else
+      {
+        return completion_signatures<_Tag(decay_t<_Ts>...)>{};
+      }
+    }
+  };
+
+  template <class _Env>
+  using __env_t _CCCL_NODEBUG_ALIAS =
+    __join_env_t<prop<get_stop_token_t, inplace_stop_token>, __env_ref_t<const _Env&>>;
+
+  template <class _Sndr, class _Env>
+  [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto __get_completions()
+  {
+    _CUDAX_LET_COMPLETIONS(auto(__child_completions) = execution::get_completion_signatures<_Sndr, __env_t<_Env>>())
+    {
+      return concat_completion_signatures(
+        transform_completion_signatures(__child_completions, __decay_args<set_value_t>{}, __decay_args<set_error_t>{}),
+        completion_signatures<set_stopped_t()>{});
+    }
+
+    _CCCL_UNREACHABLE();
+  }
+
+  template <class _Completions>
+  using __results_t _CCCL_NODEBUG_ALIAS =
+    typename _Completions::template __transform_q<::cuda::std::__decayed_tuple, __variant>;
+
+  struct __consumer_base
+  {
+    void (*__complete_)(__consumer_base*) noexcept;
+  };
+
+  //! The part of the shared state that does not depend on the spawned sender.
+  template <class _Completions>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __state_base_t
+  {
+    _CCCL_HOST_API explicit __state_base_t(void (*__destroy)(__state_base_t*) noexcept) noexcept
+        : __destroy_{__destroy}
+    {}
+
+    _CCCL_IMMOVABLE(__state_base_t);
+
+    //! Called when the future is destroyed without having been started.
+    _CCCL_HOST_API void __abandon() noexcept
+    {
+      __stop_source_.request_stop();
+      if (__flags_.fetch_or(__abandoned_bit, ::cuda::std::memory_order_acq_rel) & __done_bit)
+      {
+        __destroy_(this);
+      }
+    }
+
+    void (*__destroy_)(__state_base_t*) noexcept;
+    __results_t<_Completions> __results_;
+    inplace_stop_source __stop_source_;
+    __consumer_base* __consumer_ = nullptr;
+    ::cuda::std::atomic<int> __flags_{0};
+  };
+
+  template <class _Sndr, class _Token, class _Env, class _Completions>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __state_t;
+
+  template <class _Sndr, class _Token, class _Env, class _Completions>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __rcvr_t
+  {
+    using receiver_concept = receiver_t;
+
+    template <class... _As>
+    _CCCL_HOST_API void set_value(_As&&... __as) noexcept
+    {
+      __state_->__set_result(set_value_t{}, static_cast<_As&&>(__as)...);
+    }
+
+    template <class _Error>
+    _CCCL_HOST_API void set_error(_Error&& __error) noexcept
+    {
+      __state_->__set_result(set_error_t{}, static_cast<_Error&&>(__error));
+    }
+
+    _CCCL_HOST_API void set_stopped() noexcept
+    {
+      __state_->__set_result(set_stopped_t{});
+    }
+
+    [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __env_t<_Env>
+    {
+      return __join_env(prop{get_stop_token, __state_->__stop_source_.get_token()}, __env_ref(__state_->__env_));
+    }
+
+    __state_t<_Sndr, _Token, _Env, _Completions>* __state_;
+  };
+
+  template <class _Sndr, class _Token, class _Env, class _Completions>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __state_t : __state_base_t<_Completions>
+  {
+    using __alloc_t _CCCL_NODEBUG_ALIAS =
+      ::cuda::std::__rebind_alloc<::cuda::std::allocator_traits<__call_result_t<get_allocator_t, const _Env&>>,
+                                  __state_t>;
+    using __traits_t _CCCL_NODEBUG_ALIAS = ::cuda::std::allocator_traits<__alloc_t>;
+    using __rcvr_t _CCCL_NODEBUG_ALIAS   = spawn_future_t::__rcvr_t<_Sndr, _Token, _Env, _Completions>;
+
+    _CCCL_HOST_API explicit __state_t(_Sndr&& __sndr, _Token __token, _Env&& __env, __alloc_t __alloc)
+        : __state_base_t<_Completions>{&__destroy_impl}
+        , __token_{static_cast<_Token&&>(__token)}
+        , __env_{static_cast<_Env&&>(__env)}
+        , __alloc_{static_cast<__alloc_t&&>(__alloc)}
+        , __opstate_(execution::connect(static_cast<_Sndr&&>(__sndr), __rcvr_t{this}))
+    {}
+
+    _CCCL_HOST_API void __start() noexcept
+    {
+      if (__token_.try_associate())
+      {
+        __associated_ = true;
+        execution::start(__opstate_);
+      }
+      else
+      {
+        __set_result(set_stopped_t{});
+      }
+    }
+
+    template <class _Tag, class... _As>
+    _CCCL_HOST_API void __set_result(_Tag, _As&&... __as) noexcept
+    {
+      using __tupl_t _CCCL_NODEBUG_ALIAS = ::cuda::std::__tuple<_Tag, decay_t<_As>...>;
+      _CCCL_TRY
+      {
+        this->__results_.template __emplace<__tupl_t>(_Tag{}, static_cast<_As&&>(__as)...);
+      }
+      _CCCL_CATCH_ALL
+      {
+        if constexpr (!__nothrow_decay_copyable<_As...>)
+        {
+          using __error_t _CCCL_NODEBUG_ALIAS = ::cuda::std::__tuple<set_error_t, exception_ptr>;
+          this->__results_.template __emplace<__error_t>(set_error_t{}, execution::current_exception());
+        }
+      }
+
+      const int __flags = this->__flags_.fetch_or(__done_bit, ::cuda::std::memory_order_acq_rel);
+      if (__flags & __waiting_bit)
+      {
+        this->__consumer_->__complete_(this->__consumer_);
+      }
+      else if (__flags & __abandoned_bit)
+      {
+        __destroy_impl(this);
+      }
+    }
+
+    _CCCL_HOST_API static void __destroy_impl(__state_base_t<_Completions>* __base) noexcept
+    {
+      auto* __self = static_cast<__state_t*>(__base);
+      _Token __token{static_cast<_Token&&>(__self->__token_)};
+      __alloc_t __alloc{static_cast<__alloc_t&&>(__self->__alloc_)};
+      const bool __associated = __self->__associated_;
+
+      __self->~__state_t();
+      __traits_t::deallocate(__alloc, __self, 1);
+
+      // The scope may be destroyed as soon as the operation is disassociated from it, so this must come last.
+      if (__associated)
+      {
+        __token.disassociate();
+      }
+    }
+
+    _Token __token_;
+    _Env __env_;
+    __alloc_t __alloc_;
+    bool __associated_ = false;
+    connect_result_t<_Sndr, __rcvr_t> __opstate_;
+  };
+
+  struct __send_result_fn
+  {
+    template <class _Rcvr, class _Tag, class... _As>
+    _CCCL_API void operator()(_Rcvr& __rcvr, _Tag, _As&... __args) const noexcept
+    {
+      _Tag{}(static_cast<_Rcvr&&>(__rcvr), static_cast<_As&&>(__args)...);
+    }
+  };
+
+  struct __send_result_visitor
+  {
+    template <class _Rcvr, class _Tuple>
+    _CCCL_API void operator()(_Rcvr& __rcvr, _Tuple& __tuple) const noexcept
+    {
+      ::cuda::std::__apply(__send_result_fn{}, __tuple, __rcvr);
+    }
+  };
+
+  template <class _Completions, class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t : __consumer_base
+  {
+    using operation_state_concept = operation_state_t;
+    using __stop_token_t _CCCL_NODEBUG_ALIAS    = stop_token_of_t<env_of_t<_Rcvr>>;
+    using __stop_callback_t _CCCL_NODEBUG_ALIAS = stop_callback_for_t<__stop_token_t, __on_stop_request>;
+
+    _CCCL_HOST_API explicit __opstate_t(__state_base_t<_Completions>* __state, _Rcvr __rcvr) noexcept
+        : __consumer_base{&__complete_impl}
+        , __state_{__state}
+        , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+    {}
+
+    _CCCL_IMMOVABLE(__opstate_t);
+
+    _CCCL_HOST_API ~__opstate_t()
+    {
+      if (!__started_)
+      {
+        __state_->__abandon();
+      }
+    }
+
+    _CCCL_HOST_API void start() noexcept
+    {
+      __started_ = true;
+      __on_stop_.__construct(get_stop_token(execution::get_env(__rcvr_)), __on_stop_request{__state_->__stop_source_});
+
+      __state_->__consumer_ = this;
+      if (__state_->__flags_.fetch_or(__waiting_bit, ::cuda::std::memory_order_acq_rel) & __done_bit)
+      {
+        __complete();
+      }
+    }
+
+    _CCCL_HOST_API static void __complete_impl(__consumer_base* __self) noexcept
+    {
+      static_cast<__opstate_t*>(__self)->__complete();
+    }
+
+    _CCCL_HOST_API void __complete() noexcept
+    {
+      __on_stop_.__destroy();
+
+      // The shared state is released before the receiver is completed, because completing the receiver may join
+      // the scope and destroy the allocator.
+      __results_t<_Completions> __results{static_cast<__results_t<_Completions>&&>(__state_->__results_)};
+      __state_->__destroy_(__state_);
+      __visit(__send_result_visitor{}, __results, __rcvr_);
+    }
+
+    __state_base_t<_Completions>* __state_;
+    _Rcvr __rcvr_;
+    bool __started_ = false;
+    __lazy<__stop_callback_t> __on_stop_;
+  };
+
+public:
+  //! @brief The sender returned by @c spawn_future.
+  template <class _Completions>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t
+  {
+    using sender_concept = sender_t;
+
+    _CCCL_HOST_API explicit __sndr_t(__state_base_t<_Completions>* __state) noexcept
+        : __state_{__state}
+    {}
+
+    _CCCL_HOST_API __sndr_t(__sndr_t&& __other) noexcept
+        : __state_{::cuda::std::exchange(__other.__state_, nullptr)}
+    {}
+
+    _CCCL_HOST_API ~__sndr_t()
+    {
+      if (__state_ != nullptr)
+      {
+        __state_->__abandon();
+      }
+    }
+
+    template <class _Self, class... _Env>
+    [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+    {
+      return _Completions{};
+    }
+
+    template <class _Rcvr>
+    [[nodiscard]] _CCCL_HOST_API auto connect(_Rcvr __rcvr) && noexcept(__nothrow_movable<_Rcvr>)
+      -> __opstate_t<_Completions, _Rcvr>
+    {
+      _CCCL_ASSERT(__state_ != nullptr, "spawn_future sender connected twice");
+      return __opstate_t<_Completions, _Rcvr>{::cuda::std::exchange(__state_, nullptr), static_cast<_Rcvr&&>(__rcvr)};
+    }
+
+  private:
+    __state_base_t<_Completions>* __state_;
+  };
+
+  template <class _Sndr, class _Token, class _Env = env<>>
+  [[nodiscard]] _CCCL_HOST_API auto operator()(_Sndr __sndr, _Token __token, _Env __env = {}) const
+  {
+    static_assert(__is_sender<_Sndr>);
+    using __wrapped_t _CCCL_NODEBUG_ALIAS = decltype(__token.wrap(static_cast<_Sndr&&>(__sndr)));
+    using __completions_t _CCCL_NODEBUG_ALIAS = decltype(__get_completions<__wrapped_t, _Env>());
+    static_assert(__valid_completion_signatures<__completions_t>,
+                  "The sender passed to spawn_future has invalid completion signatures.");
+
+    using __state_t _CCCL_NODEBUG_ALIAS  = spawn_future_t::__state_t<__wrapped_t, _Token, _Env, __completions_t>;
+    using __alloc_t _CCCL_NODEBUG_ALIAS  = typename __state_t::__alloc_t;
+    using __traits_t _CCCL_NODEBUG_ALIAS = typename __state_t::__traits_t;
+
+    __alloc_t __alloc(execution::get_allocator(__env));
+    __state_t* __state = __traits_t::allocate(__alloc, 1);
+    _CCCL_TRY
+    {
+      ::new (static_cast<void*>(__state))
+        __state_t{__token.wrap(static_cast<_Sndr&&>(__sndr)), __token, static_cast<_Env&&>(__env), __alloc};
+    }
+    _CCCL_CATCH_ALL
+    {
+      __traits_t::deallocate(__alloc, __state, 1);
+      _CCCL_RETHROW;
+    }
+
+    __state->__start();
+    return __sndr_t<__completions_t>{__state};
+  }
+};
+
+_CCCL_GLOBAL_CONSTANT spawn_future_t spawn_future{};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_SPAWN_FUTURE
@@ -0,0 +1,700 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_SPLIT
+#define __CUDAX_EXECUTION_SPLIT
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__cccl/unreachable.h>
+#include <cuda/std/__exception/exception_macros.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__utility/exchange.h>
+#include <cuda/std/__utility/pod_tuple.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstdint>
+
+#include <cuda/experimental/__detail/utility.cuh>
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/exception.cuh>
+#include <cuda/experimental/__execution/fwd.cuh>
+#include <cuda/experimental/__execution/get_completion_signatures.cuh>
+#include <cuda/experimental/__execution/lazy.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/stop_token.cuh>
+#include <cuda/experimental/__execution/thread.cuh>
+#include <cuda/experimental/__execution/transform_completion_signatures.cuh>
+#include <cuda/experimental/__execution/utility.cuh>
+#include <cuda/experimental/__execution/variant.cuh>
+#include <cuda/experimental/__execution/visit.cuh>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+// The machinery shared by split and ensure_started. The child operation and its result live in
+// a reference-counted __state_t. Consumers register themselves in a lock-free list of waiters
+// and are completed from that list when the child operation completes.
+namespace __shared
+{
+template <class _AlgoTag, class _Tag>
+struct __decay_args
+{
+  template <class... _Ts>
+  [[nodiscard]] _CCCL_API _CCCL_CONSTEVAL auto operator()() const noexcept
+  {
+    if constexpr (!__decay_copyable<_Ts...>)
+    {
+      return invalid_completion_signature<_WHERE(_IN_ALGORITHM, _AlgoTag),
+                                          _WHAT(_ARGUMENTS_ARE_NOT_DECAY_COPYABLE),
+                                          _WITH_ARGUMENTS(_Ts...)>();
+    }
+    else if constexpr (!__nothrow_decay_copyable<_Ts...>)
+    {
+      return completion_signatures<_Tag(decay_t<_Ts>...), set_error_t(exception_ptr)>{};
+    }
+    else
+    {
+      return completion_signatures<_Tag(decay_t<_Ts>...)>{};
+    }
+  }
+};
+
+template <class _Tag>
+struct __as_const_ref
+{
+  template <class... _Ts>
+  [[nodiscard]] _CCCL_API _CCCL_CONSTEVAL auto operator()() const noexcept
+  {
+    return completion_signatures<_Tag(const _Ts&...)>{};
+  }
+};
+
+// split hands out the stored result to all consumers by const reference. ensure_started
+// has a single consumer, so it moves the result out instead.
+template <class _AlgoTag>
+inline constexpr bool __is_split = __same_as<_AlgoTag, split_t>;
+
+// The environment of the child operation.
+using __env_t _CCCL_NODEBUG_ALIAS = prop<get_stop_token_t, inplace_stop_token>;
+
+// The completions of the child operation with decay-copied arguments, as they are stored.
+template <class _AlgoTag, class _Sndr>
+[[nodiscard]] _CCCL_API _CCCL_CONSTEVAL auto __stored_completions()
+{
+  _CUDAX_LET_COMPLETIONS(auto(__child_completions) = execution::get_completion_signatures<_Sndr, __env_t>())
+  {
+    return concat_completion_signatures(
+      transform_completion_signatures(
+        __child_completions, __decay_args<_AlgoTag, set_value_t>{}, __decay_args<_AlgoTag, set_error_t>{}),
+      completion_signatures<set_stopped_t()>{});
+  }
+
+  _CCCL_UNREACHABLE();
+}
+
+// The completions of the senders returned by split and ensure_started.
+template <class _AlgoTag, class _Sndr>
+[[nodiscard]] _CCCL_API _CCCL_CONSTEVAL auto __get_completions()
+{
+  _CUDAX_LET_COMPLETIONS(auto(__completions) = __shared::__stored_completions<_AlgoTag, _Sndr>())
+  {
+    if constexpr (__is_split<_AlgoTag>)
+    {
+      return transform_completion_signatures(
+        __completions, __as_const_ref<set_value_t>{}, __as_const_ref<set_error_t>{});
+    }
+    else
+    {
+      return __completions;
+    }
+  }
+
+  _CCCL_UNREACHABLE();
+}
+
+template <class _AlgoTag, class _Sndr>
+using __results_t _CCCL_NODEBUG_ALIAS =
+  typename decltype(__shared::__stored_completions<_AlgoTag, _Sndr>())::template __transform_q<
+    ::cuda::std::__decayed_tuple,
+    __variant>;
+
+//! A consumer that waits for the result of the child operation.
+struct __waiter
+{
+  void (*__complete_)(__waiter*) noexcept;
+  __waiter* __next_ = nullptr;
+};
+
+enum class __remove_result
+{
+  __removed,   //!< The waiter was unlinked and will not be completed with the result.
+  __absent,    //!< The waiter has not been added yet.
+  __completed, //!< The waiters have been taken to be completed with the result.
+};
+
+template <class _AlgoTag, class _Sndr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __state_t;
+
+template <class _AlgoTag, class _Sndr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __rcvr_t
+{
+  using receiver_concept = receiver_t;
+
+  template <class... _As>
+  _CCCL_HOST_API void set_value(_As&&... __as) noexcept
+  {
+    __state_->__set_result(set_value_t{}, static_cast<_As&&>(__as)...);
+  }
+
+  template <class _Error>
+  _CCCL_HOST_API void set_error(_Error&& __error) noexcept
+  {
+    __state_->__set_result(set_error_t{}, static_cast<_Error&&>(__error));
+  }
+
+  _CCCL_HOST_API void set_stopped() noexcept
+  {
+    __state_->__set_result(set_stopped_t{});
+  }
+
+  [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __env_t
+  {
+    return prop{get_stop_token, __state_->__stop_source_.get_token()};
+  }
+
+  __state_t<_AlgoTag, _Sndr>* __state_;
+};
+
+//! @brief The shared state of split and ensure_started.
+//!
+//! The state is kept alive by a reference count. Every sender and every consumer operation
+//! holds a reference, and so does the child operation while it runs. When the child operation
+//! is the only one left holding a reference, nobody can observe its result anymore and it is
+//! asked to stop.
+//!
+//! The waiters form an intrusive stack whose head is updated with compare-and-swap. Once the
+//! result is available, the head is replaced with a sentinel that makes later consumers
+//! complete inline. A consumer whose stop token is triggered must unlink itself from the
+//! middle of the stack. It does so after setting a lock bit in the head, which only holds off
+//! other updates of the head for the length of the unlinking.
+template <class _AlgoTag, class _Sndr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __state_t
+{
+  using __rcvr_t _CCCL_NODEBUG_ALIAS = __shared::__rcvr_t<_AlgoTag, _Sndr>;
+
+  static constexpr ::cuda::std::uintptr_t __locked_bit = 1;
+
+  _CCCL_HOST_API explicit __state_t(_Sndr&& __sndr)
+      : __opstate_(execution::connect(static_cast<_Sndr&&>(__sndr), __rcvr_t{this}))
+  {}
+
+  _CCCL_IMMOVABLE(__state_t);
+
+  _CCCL_HOST_API void __inc_ref() noexcept
+  {
+    __refs_.fetch_add(1, ::cuda::std::memory_order_relaxed);
+  }
+
+  _CCCL_HOST_API void __dec_ref() noexcept
+  {
+    size_t __refs = __refs_.load(::cuda::std::memory_order_relaxed);
+    while (true)
+    {
+      if (__refs == 2 && __started_.load(::cuda::std::memory_order_acquire))
+      {
+        // Only the child operation is left besides this reference. Ask it to stop while this
+        // reference still keeps the state alive. If it has already completed, this has no effect.
+        __stop_source_.request_stop();
+        __refs = __refs_.fetch_sub(1, ::cuda::std::memory_order_acq_rel);
+        break;
+      }
+      if (__refs_.compare_exchange_weak(
+            __refs, __refs - 1, ::cuda::std::memory_order_acq_rel, ::cuda::std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+
+    if (__refs == 1)
+    {
+      delete this;
+    }
+  }
+
+  //! Starts the child operation unless it has been started already.
+  _CCCL_HOST_API void __try_start() noexcept
+  {
+    // The child operation's reference must be counted before the operation counts as started,
+    // see __dec_ref.
+    __inc_ref();
+    if (__started_.exchange(true, ::cuda::std::memory_order_acq_rel))
+    {
+      __dec_ref();
+    }
+    else
+    {
+      execution::start(__opstate_);
+    }
+  }
+
+  //! Adds a waiter. Returns false if the result is already available.
+  [[nodiscard]] _CCCL_HOST_API auto __push(__waiter* __node) noexcept -> bool
+  {
+    ::cuda::std::uintptr_t __head = __head_.load(::cuda::std::memory_order_acquire);
+    while (true)
+    {
+      if (__head == __completed())
+      {
+        return false;
+      }
+      if (__head & __locked_bit)
+      {
+        execution::__this_thread_yield();
+        __head = __head_.load(::cuda::std::memory_order_acquire);
+        continue;
+      }
+      __node->__next_ = reinterpret_cast<__waiter*>(__head);
+      if (__head_.compare_exchange_weak(__head,
+                                        reinterpret_cast<::cuda::std::uintptr_t>(__node),
+                                        ::cuda::std::memory_order_acq_rel,
+                                        ::cuda::std::memory_order_acquire))
+      {
+        return true;
+      }
+    }
+  }
+
+  //! Unlinks a waiter.
+  [[nodiscard]] _CCCL_HOST_API auto __remove(__waiter* __node) noexcept -> __remove_result
+  {
+    ::cuda::std::uintptr_t __head = __lock_head();
+    if (__head == __completed())
+    {
+      return __remove_result::__completed;
+    }
+
+    auto* __first = reinterpret_cast<__waiter*>(__head);
+    auto __result = __remove_result::__absent;
+    if (__first == __node)
+    {
+      __first  = __node->__next_;
+      __result = __remove_result::__removed;
+    }
+    else
+    {
+      for (auto* __it = __first; __it != nullptr; __it = __it->__next_)
+      {
+        if (__it->__next_ == __node)
+        {
+          __it->__next_ = __node->__next_;
+          __result      = __remove_result::__removed;
+          break;
+        }
+      }
+    }
+
+    __head_.store(reinterpret_cast<::cuda::std::uintptr_t>(__first), ::cuda::std::memory_order_release);
+    return __result;
+  }
+
+  template <class _Tag, class... _As>
+  _CCCL_HOST_API void __set_result(_Tag, _As&&... __as) noexcept
+  {
+    using __tupl_t _CCCL_NODEBUG_ALIAS = ::cuda::std::__tuple<_Tag, decay_t<_As>...>;
+    _CCCL_TRY
+    {
+      __results_.template __emplace<__tupl_t>(_Tag{}, static_cast<_As&&>(__as)...);
+    }
+    _CCCL_CATCH_ALL
+    {
+      if constexpr (!__nothrow_decay_copyable<_As...>)
+      {
+        using __error_t _CCCL_NODEBUG_ALIAS = ::cuda::std::__tuple<set_error_t, exception_ptr>;
+        __results_.template __emplace<__error_t>(set_error_t{}, execution::current_exception());
+      }
+    }
+
+    // Take the waiters and mark the result as available. Completing a waiter may destroy it, so
+    // read the next one first.
+    auto* __waiters = reinterpret_cast<__waiter*>(__exchange_head(__completed()));
+    while (__waiters != nullptr)
+    {
+      auto* __next = __waiters->__next_;
+      __waiters->__complete_(__waiters);
+      __waiters = __next;
+    }
+
+    // Release the reference of the child operation.
+    __dec_ref();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __completed() const noexcept -> ::cuda::std::uintptr_t
+  {
+    return reinterpret_cast<::cuda::std::uintptr_t>(this);
+  }
+
+  // Sets the lock bit of the head, unless the waiters have been taken. Returns the old head.
+  [[nodiscard]] _CCCL_HOST_API auto __lock_head() noexcept -> ::cuda::std::uintptr_t
+  {
+    ::cuda::std::uintptr_t __head = __head_.load(::cuda::std::memory_order_acquire);
+    while (true)
+    {
+      if (__head == __completed())
+      {
+        return __head;
+      }
+      if (__head & __locked_bit)
+      {
+        execution::__this_thread_yield();
+        __head = __head_.load(::cuda::std::memory_order_acquire);
+        continue;
+      }
+      if (__head_.compare_exchange_weak(
+            __head, __head | __locked_bit, ::cuda::std::memory_order_acquire, ::cuda::std::memory_order_acquire))
+      {
+        return __head;
+      }
+    }
+  }
+
+  // Replaces the head once it is not locked. Returns the old head.
+  [[nodiscard]] _CCCL_HOST_API auto __exchange_head(::cuda::std::uintptr_t __new_head) noexcept
+    -> ::cuda::std::uintptr_t
+  {
+    ::cuda::std::uintptr_t __head = __head_.load(::cuda::std::memory_order_acquire);
+    while (true)
+    {
+      if (__head & __locked_bit)
+      {
+        execution::__this_thread_yield();
+        __head = __head_.load(::cuda::std::memory_order_acquire);
+        continue;
+      }
+      if (__head_.compare_exchange_weak(
+            __head, __new_head, ::cuda::std::memory_order_acq_rel, ::cuda::std::memory_order_acquire))
+      {
+        return __head;
+      }
+    }
+  }
+
+  ::cuda::std::atomic<size_t> __refs_{1};
+  ::cuda::std::atomic<bool> __started_{false};
+  ::cuda::std::atomic<::cuda::std::uintptr_t> __head_{0};
+  inplace_stop_source __stop_source_;
+  __results_t<_AlgoTag, _Sndr> __results_;
+  connect_result_t<_Sndr, __rcvr_t> __opstate_;
+};
+
+template <class _AlgoTag>
+struct __send_result_fn
+{
+  template <class _Rcvr, class _Tag, class... _As>
+  _CCCL_API void operator()(_Rcvr& __rcvr, _Tag, _As&... __args) const noexcept
+  {
+    if constexpr (__is_split<_AlgoTag>)
+    {
+      _Tag{}(static_cast<_Rcvr&&>(__rcvr), static_cast<const _As&>(__args)...);
+    }
+    else
+    {
+      _Tag{}(static_cast<_Rcvr&&>(__rcvr), static_cast<_As&&>(__args)...);
+    }
+  }
+};
+
+template <class _AlgoTag>
+struct __send_result_visitor
+{
+  template <class _Rcvr, class _Tuple>
+  _CCCL_API void operator()(_Rcvr& __rcvr, _Tuple& __tuple) const noexcept
+  {
+    ::cuda::std::__apply(__send_result_fn<_AlgoTag>{}, __tuple, __rcvr);
+  }
+};
+
+//! @brief The operation state of a consumer of split or ensure_started.
+//!
+//! A stop request can race with the start of the operation. @c start() announces that it is
+//! about to add the waiter before it does so, and the stop callback announces the stop request.
+//! If the stop request comes first, the waiter is never added. Otherwise the stop callback unlinks
+//! the waiter, waiting for @c start() to add it if necessary. After the waiter is added,
+//! @c start() must not touch the operation state anymore, since it may be completed and destroyed
+//! on another thread at any time.
+template <class _AlgoTag, class _Sndr, class _Rcvr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t : __waiter
+{
+  using operation_state_concept = operation_state_t;
+  using __state_t _CCCL_NODEBUG_ALIAS = __shared::__state_t<_AlgoTag, _Sndr>;
+
+  static constexpr int __pushed_bit = 1;
+  static constexpr int __stop_bit   = 2;
+
+  struct __on_stop_fn
+  {
+    _CCCL_HOST_API void operator()() const noexcept
+    {
+      __self_->__on_stop();
+    }
+
+    __opstate_t* __self_;
+  };
+
+  using __stop_token_t _CCCL_NODEBUG_ALIAS    = stop_token_of_t<env_of_t<_Rcvr>>;
+  using __stop_callback_t _CCCL_NODEBUG_ALIAS = stop_callback_for_t<__stop_token_t, __on_stop_fn>;
+
+  //! Takes over a reference to the shared state.
+  _CCCL_HOST_API explicit __opstate_t(__state_t* __state, _Rcvr __rcvr) noexcept(__nothrow_movable<_Rcvr>)
+      : __waiter{&__complete_impl}
+      , __state_{__state}
+      , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+  {}
+
+  _CCCL_IMMOVABLE(__opstate_t);
+
+  _CCCL_HOST_API ~__opstate_t()
+  {
+    __state_->__dec_ref();
+  }
+
+  _CCCL_HOST_API void start() noexcept
+  {
+    __on_stop_.__construct(get_stop_token(execution::get_env(__rcvr_)), __on_stop_fn{this});
+
+    if (__flags_.fetch_or(__pushed_bit, ::cuda::std::memory_order_acq_rel) & __stop_bit)
+    {
+      __complete_stopped();
+      return;
+    }
+
+    // Hold on to the shared state with a reference of our own, since this operation may be
+    // destroyed as soon as the waiter is added.
+    __state_t* __state = __state_;
+    __state->__inc_ref();
+    if (__state->__push(this))
+    {
+      __state->__try_start();
+    }
+    else
+    {
+      __complete();
+    }
+    __state->__dec_ref();
+  }
+
+  _CCCL_HOST_API void __on_stop() noexcept
+  {
+    if (!(__flags_.fetch_or(__stop_bit, ::cuda::std::memory_order_acq_rel) & __pushed_bit))
+    {
+      return; // start() will see the stop request
+    }
+
+    while (true)
+    {
+      switch (__state_->__remove(this))
+      {
+        case __remove_result::__removed:
+          __complete_stopped();
+          return;
+        case __remove_result::__completed:
+          return;
+        case __remove_result::__absent:
+          execution::__this_thread_yield(); // start() is about to add the waiter
+          break;
+      }
+    }
+  }
+
+  _CCCL_HOST_API static void __complete_impl(__waiter* __self) noexcept
+  {
+    static_cast<__opstate_t*>(__self)->__complete();
+  }
+
+  _CCCL_HOST_API void __complete() noexcept
+  {
+    __on_stop_.__destroy();
+    __visit(__send_result_visitor<_AlgoTag>{}, __state_->__results_, __rcvr_);
+  }
+
+  _CCCL_HOST_API void __complete_stopped() noexcept
+  {
+    __on_stop_.__destroy();
+    execution::set_stopped(static_cast<_Rcvr&&>(__rcvr_));
+  }
+
+  __state_t* __state_;
+  _Rcvr __rcvr_;
+  ::cuda::std::atomic<int> __flags_{0};
+  __lazy<__stop_callback_t> __on_stop_;
+};
+
+//! An owning reference to the shared state. Copying it adds a reference.
+template <class _State>
+class _CCCL_TYPE_VISIBILITY_DEFAULT __state_ref
+{
+public:
+  //! Takes over a reference to the shared state.
+  _CCCL_HOST_API explicit __state_ref(_State* __state) noexcept
+      : __state_{__state}
+  {}
+
+  _CCCL_HOST_API __state_ref(__state_ref&& __other) noexcept
+      : __state_{::cuda::std::exchange(__other.__state_, nullptr)}
+  {}
+
+  _CCCL_HOST_API __state_ref(const __state_ref& __other) noexcept
+      : __state_{__other.__state_}
+  {
+    if (__state_ != nullptr)
+    {
+      __state_->__inc_ref();
+    }
+  }
+
+  __state_ref& operator=(const __state_ref&) = delete;
+
+  _CCCL_HOST_API ~__state_ref()
+  {
+    if (__state_ != nullptr)
+    {
+      __state_->__dec_ref();
+    }
+  }
+
+  //! Returns a new reference to the shared state.
+  [[nodiscard]] _CCCL_HOST_API auto __copy() const noexcept -> _State*
+  {
+    _CCCL_ASSERT(__state_ != nullptr, "connecting a moved-from sender");
+    __state_->__inc_ref();
+    return __state_;
+  }
+
+  //! Gives up the reference to the shared state.
+  [[nodiscard]] _CCCL_HOST_API auto __release() noexcept -> _State*
+  {
+    _CCCL_ASSERT(__state_ != nullptr, "connecting a moved-from sender");
+    return ::cuda::std::exchange(__state_, nullptr);
+  }
+
+private:
+  _State* __state_;
+};
+
+// Makes the sender returned by ensure_started move-only.
+struct __move_only
+{
+  __move_only()              = default;
+  __move_only(__move_only&&) = default;
+};
+
+struct __copyable
+{};
+
+//! @brief The sender returned by split and ensure_started. The sender returned by split can be
+//! copied and connected as often as needed. The sender returned by ensure_started can only be
+//! moved and connected once.
+template <class _AlgoTag, class _Sndr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t
+    : ::cuda::std::conditional_t<__is_split<_AlgoTag>, __copyable, __move_only>
+{
+  using sender_concept = sender_t;
+  using __state_t _CCCL_NODEBUG_ALIAS = __shared::__state_t<_AlgoTag, _Sndr>;
+
+  //! Takes over a reference to the shared state.
+  _CCCL_HOST_API explicit __sndr_t(__state_t* __state) noexcept
+      : __state_{__state}
+  {}
+
+  template <class _Self, class... _Env>
+  [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+  {
+    return __shared::__get_completions<_AlgoTag, _Sndr>();
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_HOST_API auto connect(_Rcvr __rcvr) && noexcept(__nothrow_movable<_Rcvr>)
+    -> __opstate_t<_AlgoTag, _Sndr, _Rcvr>
+  {
+    return __opstate_t<_AlgoTag, _Sndr, _Rcvr>{__state_.__release(), static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+  _CCCL_TEMPLATE(class _Rcvr, class _Tag = _AlgoTag)
+  _CCCL_REQUIRES(__is_split<_Tag>)
+  [[nodiscard]] _CCCL_HOST_API auto connect(_Rcvr __rcvr) const& noexcept(__nothrow_movable<_Rcvr>)
+    -> __opstate_t<_AlgoTag, _Sndr, _Rcvr>
+  {
+    return __opstate_t<_AlgoTag, _Sndr, _Rcvr>{__state_.__copy(), static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+private:
+  __state_ref<__state_t> __state_;
+};
+} // namespace __shared
+
+//! @brief Adapts a sender so that its result can be consumed many times without running it again.
+//!
+//! @c split(sndr) returns a copyable sender. The first time one of its copies is started, @c sndr
+//! is started. Its result is decay-copied into a shared state and sent to every consumer by const
+//! reference, including consumers that are started after it is available.
+//!
+//! Consumers are independently stoppable: a consumer whose stop token is triggered before the
+//! result is available completes with @c set_stopped() while @c sndr keeps running for the
+//! others. Once no sender or consumer is left that could observe the result, @c sndr is asked to
+//! stop through the stop token in its environment.
+struct split_t
+{
+  template <class _Sndr>
+  [[nodiscard]] _CCCL_HOST_API auto operator()(_Sndr __sndr) const -> __shared::__sndr_t<split_t, _Sndr>
+  {
+    static_assert(__is_sender<_Sndr>);
+    static_assert(__valid_completion_signatures<decltype(__shared::__get_completions<split_t, _Sndr>())>,
+                  "The sender passed to split has invalid completion signatures.");
+    return __shared::__sndr_t<split_t, _Sndr>{new __shared::__state_t<split_t, _Sndr>{static_cast<_Sndr&&>(__sndr)}};
+  }
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __closure_t
+  {
+    template <class _Sndr>
+    [[nodiscard]] _CCCL_HOST_API auto operator()(_Sndr __sndr) const -> __shared::__sndr_t<split_t, _Sndr>
+    {
+      return split_t{}(static_cast<_Sndr&&>(__sndr));
+    }
+
+    template <class _Sndr>
+    [[nodiscard]] _CCCL_HOST_API friend auto operator|(_Sndr __sndr, __closure_t) -> __shared::__sndr_t<split_t, _Sndr>
+    {
+      return split_t{}(static_cast<_Sndr&&>(__sndr));
+    }
+  };
+
+  [[nodiscard]] _CCCL_HOST_API auto operator()() const noexcept -> __closure_t
+  {
+    return {};
+  }
+};
+
+_CCCL_GLOBAL_CONSTANT split_t split{};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_SPLIT
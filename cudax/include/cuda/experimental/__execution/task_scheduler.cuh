@@ -21,11 +21,18 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__cstddef/types.h>
 #include <cuda/std/__exception/cuda_error.h>
+#include <cuda/std/__exception/exception_macros.h>
 #include <cuda/std/__exception/terminate.h>
 #include <cuda/std/__memory/addressof.h>
 #include <cuda/std/__memory/allocator.h>
+#include <cuda/std/__new/allocate.h>
 #include <cuda/std/__tuple_dir/ignore.h>
+#include <cuda/std/__type_traits/integral_constant.h>
 #include <cuda/std/__utility/pod_tuple.h>
 
 #include <cuda/experimental/__detail/type_traits.cuh>
@@ -50,12 +57,46 @@ namespace cuda::experimental::execution
 {
 struct task_scheduler;
 
+class task_scheduler_ref;
+
 struct task_scheduler_domain;
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// get_task_storage_size: A receiver can define this query to set the number of bytes that an
+// operation of a task_scheduler reserves for the operation state of the underlying scheduler.
+// Operation states that do not fit are allocated. The result must be a task_storage_size_t.
+template <size_t _Bytes>
+using task_storage_size_t = ::cuda::std::integral_constant<size_t, _Bytes>;
+
+_CCCL_GLOBAL_CONSTANT struct get_task_storage_size_t
+{
+  template <class _Env>
+  [[nodiscard]] _CCCL_API constexpr auto operator()(const _Env& __env) const noexcept
+    -> __query_result_or_t<_Env, get_task_storage_size_t, task_storage_size_t<8 * sizeof(void*)>>
+  {
+    static_assert(__nothrow_queryable_with_or<_Env, get_task_storage_size_t, true>,
+                  "The get_task_storage_size query must be noexcept.");
+    return __query_or(__env, *this, task_storage_size_t<8 * sizeof(void*)>{});
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr auto query(forwarding_query_t) noexcept -> bool
+  {
+    return true;
+  }
+} get_task_storage_size{};
+
 namespace __detail
 {
-// The concrete type-erased sender returned by task_scheduler::schedule()
+// The number of bytes of inline storage for the type-erased operation states started by an
+// operation connected to a receiver with environment _Env.
+template <class _Env>
+inline constexpr size_t __task_storage_size_v =
+  (::cuda::std::max) (__call_result_t<get_task_storage_size_t, const _Env&>::value, size_t{1});
+
+// The concrete type-erased senders returned by task_scheduler::schedule() and
+// task_scheduler_ref::schedule()
 struct __task_sender;
+struct __task_ref_sender;
 
 template <class _Sndr>
 struct __task_bulk_sender;
@@ -77,6 +118,7 @@ using __backend_ptr_t = __shared_ptr<__task_scheduler_backend>;
 template <class _Sch>
 _CCCL_CONCEPT __non_task_scheduler = _CCCL_REQUIRES_EXPR((_Sch))( //
   requires(__not_same_as<task_scheduler, _Sch>), //
+  requires(__not_same_as<task_scheduler_ref, _Sch>),
   requires(scheduler<_Sch>));
 } // namespace __detail
 
@@ -190,21 +232,79 @@ private:
   template <class>
   friend struct __detail::__task_bulk_sender;
   friend struct __detail::__task_sender;
+  friend struct __detail::__task_ref_sender;
+  friend class task_scheduler_ref;
+  friend class thread_pool;
+
+  // Used by execution contexts that implement the backend interface directly.
+  _CCCL_API explicit task_scheduler(__detail::__backend_ptr_t __backend) noexcept
+      : __backend_(_CCCL_MOVE(__backend))
+  {}
 
   __detail::__backend_ptr_t __backend_;
 };
 
+//! @brief A non-owning reference to a @c task_scheduler.
+//!
+//! Every copy of a @c task_scheduler, and every sender and operation state obtained from it,
+//! holds a reference to the type-erased backend that is counted with atomic operations. A
+//! @c task_scheduler_ref and the senders and operation states obtained from it only store a
+//! pointer, which makes scheduling through it cheaper on hot paths. The referenced
+//! @c task_scheduler must outlive them.
+class _CCCL_TYPE_VISIBILITY_DEFAULT task_scheduler_ref
+{
+public:
+  using scheduler_concept = scheduler_t;
+
+  _CCCL_API task_scheduler_ref(const task_scheduler& __sch) noexcept
+      : __sch_{::cuda::std::addressof(__sch)}
+  {}
+
+  task_scheduler_ref(const task_scheduler&&) = delete;
+
+  [[nodiscard]] _CCCL_API auto schedule() const noexcept -> __detail::__task_ref_sender;
+
+  [[nodiscard]] _CCCL_API friend bool operator==(task_scheduler_ref __lhs, task_scheduler_ref __rhs) noexcept
+  {
+    return *__lhs.__sch_ == *__rhs.__sch_;
+  }
+
+  [[nodiscard]] _CCCL_API friend bool operator!=(task_scheduler_ref __lhs, task_scheduler_ref __rhs) noexcept
+  {
+    return !(*__lhs.__sch_ == *__rhs.__sch_);
+  }
+
+  [[nodiscard]] _CCCL_API auto query(get_forward_progress_guarantee_t) const noexcept -> forward_progress_guarantee
+  {
+    return __sch_->query(get_forward_progress_guarantee_t{});
+  }
+
+  [[nodiscard]] _CCCL_API auto query(get_completion_scheduler_t<set_value_t>) const noexcept -> const task_scheduler&
+  {
+    return *__sch_;
+  }
+
+  [[nodiscard]] _CCCL_API constexpr auto query(get_completion_domain_t<set_value_t>) const noexcept
+  {
+    return task_scheduler_domain{};
+  }
+
+private:
+  const task_scheduler* __sch_;
+};
+
 namespace __detail
 {
 //! @brief A type-erased opstate returned when connecting the result of
-//! task_scheduler::schedule() to a receiver.
-template <class _Rcvr>
+//! task_scheduler::schedule() or task_scheduler_ref::schedule() to a receiver. It either
+//! shares ownership of the backend or, for task_scheduler_ref, borrows it.
+template <class _Rcvr, class _BackendPtr = __backend_ptr_t>
 class __task_opstate_t
 {
 public:
   using operation_state_concept = operation_state_t;
 
-  _CCCL_API __task_opstate_t(__backend_ptr_t __backend, _Rcvr __rcvr)
+  _CCCL_API __task_opstate_t(_BackendPtr __backend, _Rcvr __rcvr)
       : __rcvr_proxy_(_CCCL_MOVE(__rcvr))
       , __backend_(_CCCL_MOVE(__backend))
   {}
@@ -223,8 +323,8 @@ public:
 
 private:
   __detail::__receiver_proxy<_Rcvr> __rcvr_proxy_;
-  __backend_ptr_t __backend_;
-  ::cuda::std::byte __storage_[8 * sizeof(void*)];
+  _BackendPtr __backend_;
+  alignas(::cuda::std::max_align_t) ::cuda::std::byte __storage_[__task_storage_size_v<env_of_t<_Rcvr>>];
 };
 
 //! @brief A type-erased sender returned by task_scheduler::schedule().
@@ -242,9 +342,16 @@ struct __task_sender
   {}
 
   template <class _Rcvr>
-  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) const noexcept -> __task_opstate_t<_Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) && noexcept -> __task_opstate_t<_Rcvr>
   {
-    return __task_opstate_t<_Rcvr>(get_completion_scheduler<set_value_t>(__attrs_).__backend_, _CCCL_MOVE(__rcvr));
+    // Steal the reference to the backend instead of taking a new one.
+    return __task_opstate_t<_Rcvr>(_CCCL_MOVE(__attrs_.__sch_.__backend_), _CCCL_MOVE(__rcvr));
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) const& noexcept -> __task_opstate_t<_Rcvr>
+  {
+    return __task_opstate_t<_Rcvr>(__attrs_.__sch_.__backend_, _CCCL_MOVE(__rcvr));
   }
 
   template <class _Self>
@@ -262,6 +369,39 @@ private:
   __sch_attrs_t<task_scheduler> __attrs_;
 };
 
+//! @brief A type-erased sender returned by task_scheduler_ref::schedule(). It refers to the
+//! task_scheduler that it was obtained from and never touches the backend's reference count.
+struct __task_ref_sender
+{
+  using sender_concept  = sender_t;
+  using __completions_t = __task_sender::__completions_t;
+
+  _CCCL_API explicit __task_ref_sender(const task_scheduler& __sch) noexcept
+      : __attrs_{__sch}
+  {}
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) const noexcept
+    -> __task_opstate_t<_Rcvr, __task_scheduler_backend*>
+  {
+    return __task_opstate_t<_Rcvr, __task_scheduler_backend*>(__attrs_.__sch_.__backend_.get(), _CCCL_MOVE(__rcvr));
+  }
+
+  template <class _Self>
+  [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept -> __completions_t
+  {
+    return {};
+  }
+
+  [[nodiscard]] _CCCL_API auto get_env() const noexcept -> const __sch_attrs_t<const task_scheduler&>&
+  {
+    return __attrs_;
+  }
+
+private:
+  __sch_attrs_t<const task_scheduler&> __attrs_;
+};
+
 //! @brief A receiver used to connect the predecessor of a bulk operation launched by a
 //! task_scheduler. Its set_value member stores the predecessor's values in the bulk
 //! operation state and then starts the bulk operation.
@@ -279,16 +419,18 @@ struct __task_bulk_receiver
       using __values_t = ::cuda::std::__decayed_tuple<_As...>;
       __state_->__values_.template __emplace<__values_t>(static_cast<_As&&>(__as)...);
 
-      // Start the bulk operation.
+      // Start the bulk operation. Unless the policy allows the iterations to run in parallel,
+      // the backend is asked for a single item, and the bulk state's execute runs the whole
+      // shape when it is called for it.
+      constexpr bool __parallelize = _Policy() == par || _Policy() == par_unseq;
+      const size_t __shape = __parallelize ? __state_->__shape_ : (::cuda::std::min) (__state_->__shape_, size_t{1});
       if constexpr (__same_as<_BulkTag, bulk_chunked_t>)
       {
-        __state_->__backend_->schedule_bulk_chunked(
-          __state_->__shape_, *__state_, ::cuda::std::span{__state_->__storage_});
+        __state_->__backend_->schedule_bulk_chunked(__shape, *__state_, ::cuda::std::span{__state_->__storage_});
       }
       else
       {
-        __state_->__backend_->schedule_bulk_unchunked(
-          __state_->__shape_, *__state_, ::cuda::std::span{__state_->__storage_});
+        __state_->__backend_->schedule_bulk_unchunked(__shape, *__state_, ::cuda::std::span{__state_->__storage_});
       }
     }
     _CCCL_CATCH_ALL
@@ -442,7 +584,7 @@ private:
   size_t __shape_;
   _Values __values_{};
   __backend_ptr_t __backend_;
-  ::cuda::std::byte __storage_[8 * sizeof(void*)];
+  alignas(::cuda::std::max_align_t) ::cuda::std::byte __storage_[__task_storage_size_v<env_of_t<_Rcvr>>];
 };
 
 ////////////////////////////////////////////////////////////////////////////////////
@@ -539,6 +681,136 @@ struct __bulk_unchunked_fn
   bulk_item_receiver_proxy& __rcvr_;
 };
 
+//! @brief A per-thread cache of the memory used for the type-erased operation states that do
+//! not fit in the inline storage of a task_scheduler operation.
+//!
+//! Blocks are rounded up to a power of two between 128 bytes and 1 KiB. A freed block is kept
+//! by the thread that frees it, up to a fixed number of blocks per size, so a thread that
+//! schedules work over and over reuses the same few blocks instead of calling the allocator.
+class __task_opstate_cache
+{
+  static constexpr size_t __min_block_log2 = 7; // 128 bytes
+  static constexpr size_t __num_classes    = 4; // up to 1 KiB
+  static constexpr size_t __max_cached     = 16; // blocks per size
+
+  struct __block
+  {
+    __block* __next_;
+  };
+
+  struct __free_list
+  {
+    __block* __head_ = nullptr;
+    size_t __size_   = 0;
+  };
+
+public:
+  static constexpr size_t __max_block_size = size_t{1} << (__min_block_log2 + __num_classes - 1);
+  static constexpr size_t __block_align    = alignof(::cuda::std::max_align_t);
+
+  _CCCL_HIDE_FROM_ABI __task_opstate_cache() = default;
+
+  _CCCL_IMMOVABLE(__task_opstate_cache);
+
+  _CCCL_HOST_API ~__task_opstate_cache()
+  {
+    for (size_t __class = 0; __class < __num_classes; ++__class)
+    {
+      while (__block* __blk = __lists_[__class].__head_)
+      {
+        __lists_[__class].__head_ = __blk->__next_;
+        ::cuda::std::__cccl_deallocate(__blk, __block_size(__class), __block_align);
+      }
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static auto __local() noexcept -> __task_opstate_cache&
+  {
+    static thread_local __task_opstate_cache __cache;
+    return __cache;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __allocate(size_t __bytes) -> void*
+  {
+    const size_t __class = __class_of(__bytes);
+    __free_list& __list  = __lists_[__class];
+    if (__block* __blk = __list.__head_)
+    {
+      __list.__head_ = __blk->__next_;
+      --__list.__size_;
+      return __blk;
+    }
+    return ::cuda::std::__cccl_allocate(__block_size(__class), __block_align);
+  }
+
+  _CCCL_HOST_API void __deallocate(void* __ptr, size_t __bytes) noexcept
+  {
+    const size_t __class = __class_of(__bytes);
+    __free_list& __list  = __lists_[__class];
+    if (__list.__size_ == __max_cached)
+    {
+      ::cuda::std::__cccl_deallocate(__ptr, __block_size(__class), __block_align);
+      return;
+    }
+    __list.__head_ = ::new (__ptr) __block{__list.__head_};
+    ++__list.__size_;
+  }
+
+private:
+  [[nodiscard]] _CCCL_HOST_API static constexpr auto __block_size(size_t __class) noexcept -> size_t
+  {
+    return size_t{1} << (__min_block_log2 + __class);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static constexpr auto __class_of(size_t __bytes) noexcept -> size_t
+  {
+    size_t __class = 0;
+    while (__block_size(__class) < __bytes)
+    {
+      ++__class;
+    }
+    return __class;
+  }
+
+  __free_list __lists_[__num_classes];
+};
+
+// Operation states are taken from the per-thread cache only when the task_scheduler uses the
+// default allocator. A user-provided allocator is always honored.
+template <class _Alloc, class _Ty>
+inline constexpr bool __uses_opstate_cache =
+  __same_as<__rebind_alloc_t<_Alloc, ::cuda::std::byte>, ::cuda::std::allocator<::cuda::std::byte>>
+  && sizeof(_Ty) <= __task_opstate_cache::__max_block_size && alignof(_Ty) <= __task_opstate_cache::__block_align;
+
+// The inline storage of a task_scheduler operation is aligned for any scalar type.
+template <class _Ty>
+[[nodiscard]] _CCCL_API constexpr auto __fits_in_situ(::cuda::std::span<::cuda::std::byte> __storage) noexcept -> bool
+{
+  return __storage.size() >= sizeof(_Ty) && alignof(_Ty) <= alignof(::cuda::std::max_align_t);
+}
+
+template <class _Ty, class _Alloc>
+[[nodiscard]] _CCCL_API auto __allocate_opstate(_Alloc& __alloc) -> _Ty*
+{
+  if constexpr (__uses_opstate_cache<_Alloc, _Ty>)
+  {
+    NV_IF_TARGET(NV_IS_HOST, (return static_cast<_Ty*>(__task_opstate_cache::__local().__allocate(sizeof(_Ty)));))
+  }
+  __rebind_alloc_t<_Alloc, _Ty> __alloc_copy{__alloc};
+  return ::cuda::std::allocator_traits<__rebind_alloc_t<_Alloc, _Ty>>::allocate(__alloc_copy, 1);
+}
+
+template <class _Ty, class _Alloc>
+_CCCL_API void __deallocate_opstate(_Alloc& __alloc, _Ty* __ptr) noexcept
+{
+  if constexpr (__uses_opstate_cache<_Alloc, _Ty>)
+  {
+    NV_IF_TARGET(NV_IS_HOST, (__task_opstate_cache::__local().__deallocate(__ptr, sizeof(_Ty)); return;))
+  }
+  __rebind_alloc_t<_Alloc, _Ty> __alloc_copy{__alloc};
+  ::cuda::std::allocator_traits<__rebind_alloc_t<_Alloc, _Ty>>::deallocate(__alloc_copy, __ptr, 1);
+}
+
 template <class _Ty, class _Alloc, class... _Args>
 _CCCL_API auto __emplace_into(::cuda::std::span<::cuda::std::byte> __storage, _Alloc& __alloc, _Args&&... __args)
   -> _Ty&
@@ -546,9 +818,20 @@ _CCCL_API auto __emplace_into(::cuda::std::span<::cuda::std::byte> __storage, _A
   using __traits_t = ::cuda::std::allocator_traits<__rebind_alloc_t<_Alloc, _Ty>>;
   __rebind_alloc_t<_Alloc, _Ty> __alloc_copy{__alloc};
 
-  const bool __in_situ = __storage.size() >= sizeof(_Ty);
-  auto* __ty_ptr       = __in_situ ? reinterpret_cast<_Ty*>(__storage.data()) : __traits_t::allocate(__alloc_copy, 1);
-  __traits_t::construct(__alloc_copy, __ty_ptr, static_cast<_Args&&>(__args)...);
+  const bool __in_situ = __detail::__fits_in_situ<_Ty>(__storage);
+  auto* __ty_ptr = __in_situ ? reinterpret_cast<_Ty*>(__storage.data()) : __detail::__allocate_opstate<_Ty>(__alloc);
+  _CCCL_TRY
+  {
+    __traits_t::construct(__alloc_copy, __ty_ptr, static_cast<_Args&&>(__args)...);
+  }
+  _CCCL_CATCH_ALL
+  {
+    if (!__in_situ)
+    {
+      __detail::__deallocate_opstate(__alloc, __ty_ptr);
+    }
+    _CCCL_RETHROW;
+  }
   return *::cuda::std::launder(__ty_ptr);
 }
 
@@ -589,7 +872,7 @@ private:
     __traits_t::destroy(__alloc_copy, __opstate);
     if constexpr (!_InSitu)
     {
-      __traits_t::deallocate(__alloc_copy, __opstate, 1);
+      __detail::__deallocate_opstate(__alloc_copy, __opstate);
     }
   }
 
@@ -603,6 +886,11 @@ private:
   return __detail::__task_sender{*this};
 }
 
+[[nodiscard]] _CCCL_API inline auto task_scheduler_ref::schedule() const noexcept -> __detail::__task_ref_sender
+{
+  return __detail::__task_ref_sender{*__sch_};
+}
+
 template <class _Sch, class _Alloc>
 class _CCCL_DECLSPEC_EMPTY_BASES task_scheduler::__backend_for
     : public __detail::__task_scheduler_backend
@@ -617,10 +905,10 @@ class _CCCL_DECLSPEC_EMPTY_BASES task_scheduler::__backend_for
   {
     _CCCL_TRY
     {
-      using __opstate_t    = connect_result_t<_Sndr, __detail::__proxy_receiver<_RcvrProxy>>;
-      const bool __in_situ = __storage.size() >= sizeof(__opstate_t);
+      using __opstate_t    = __detail::__opstate_t<_Alloc, _Sndr>;
+      const bool __in_situ = __detail::__fits_in_situ<__opstate_t>(__storage);
       _Alloc& __alloc      = *this;
-      auto& __opstate      = __detail::__emplace_into<__detail::__opstate_t<_Alloc, _Sndr>>(
+      auto& __opstate      = __detail::__emplace_into<__opstate_t>(
         __storage, __alloc, __alloc, static_cast<_Sndr&&>(__sndr), __rcvr_proxy, __in_situ);
       execution::start(__opstate);
     }
@@ -0,0 +1,549 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_THREAD_POOL
+#define __CUDAX_EXECUTION_THREAD_POOL
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__new/launder.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__execution/parallel_scheduler_backend.cuh>
+#include <cuda/experimental/__execution/stop_token.cuh>
+#include <cuda/experimental/__execution/task_scheduler.cuh>
+#include <cuda/experimental/__utility/shared_ptr.cuh>
+
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+namespace __detail
+{
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __pool_task : __immovable
+{
+  using __execute_fn_t _CCCL_NODEBUG_ALIAS = void(__pool_task*) noexcept;
+
+  _CCCL_HOST_API explicit __pool_task(__execute_fn_t* __execute_fn) noexcept
+      : __execute_fn_(__execute_fn)
+  {}
+
+  _CCCL_HOST_API void __execute() noexcept
+  {
+    (*__execute_fn_)(this);
+  }
+
+  __execute_fn_t* __execute_fn_ = nullptr;
+  __pool_task* __next_          = nullptr;
+  __pool_task* __prev_          = nullptr;
+};
+
+//! A worker's queue of tasks. The owning worker pushes and pops at the back, so that it
+//! keeps working on the most recently spawned (and most likely cache-hot) task, while
+//! other workers steal the oldest tasks from the front.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __pool_task_deque
+{
+public:
+  _CCCL_HOST_API void push_back(__pool_task* __task) noexcept
+  {
+    ::std::lock_guard<::std::mutex> __lock{__mtx_};
+    __task->__next_ = nullptr;
+    __task->__prev_ = __tail_;
+    (__tail_ ? __tail_->__next_ : __head_) = __task;
+    __tail_                                = __task;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto pop_back() noexcept -> __pool_task*
+  {
+    ::std::lock_guard<::std::mutex> __lock{__mtx_};
+    __pool_task* __task = __tail_;
+    if (__task != nullptr)
+    {
+      __tail_                                = __task->__prev_;
+      (__tail_ ? __tail_->__next_ : __head_) = nullptr;
+    }
+    return __task;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto steal_front() noexcept -> __pool_task*
+  {
+    ::std::lock_guard<::std::mutex> __lock{__mtx_};
+    __pool_task* __task = __head_;
+    if (__task != nullptr)
+    {
+      __head_                                = __task->__next_;
+      (__head_ ? __head_->__prev_ : __tail_) = nullptr;
+    }
+    return __task;
+  }
+
+private:
+  ::std::mutex __mtx_;
+  __pool_task* __head_ = nullptr;
+  __pool_task* __tail_ = nullptr;
+};
+
+class _CCCL_TYPE_VISIBILITY_DEFAULT __thread_pool_backend final : public __task_scheduler_backend
+{
+  // Each bulk operation is split into about this many chunks per worker. Chunks are
+  // claimed dynamically, so a few extra chunks let fast workers pick up the slack of
+  // slow ones without paying for a task per element.
+  static constexpr size_t __chunks_per_worker = 4;
+
+  struct alignas(64) __worker
+  {
+    __pool_task_deque __tasks_;
+    ::std::thread __thrd_;
+  };
+
+  struct __worker_id
+  {
+    const __thread_pool_backend* __pool_;
+    uint32_t __index_;
+  };
+
+  [[nodiscard]] _CCCL_HOST_API static auto __this_worker() noexcept -> __worker_id&
+  {
+    static thread_local __worker_id __id{nullptr, 0};
+    return __id;
+  }
+
+  //! The operation state of a task started with `schedule`.
+  struct __schedule_task : __pool_task
+  {
+    _CCCL_HOST_API explicit __schedule_task(receiver_proxy& __rcvr, bool __in_situ) noexcept
+        : __pool_task{&__execute_impl}
+        , __rcvr_{__rcvr}
+        , __in_situ_{__in_situ}
+    {}
+
+    _CCCL_HOST_API static void __execute_impl(__pool_task* __p) noexcept
+    {
+      auto* __self          = static_cast<__schedule_task*>(__p);
+      receiver_proxy& __rcvr = __self->__rcvr_;
+      if (!__self->__in_situ_)
+      {
+        delete __self;
+      }
+
+      if (get_stop_token(__rcvr.get_env()).stop_requested())
+      {
+        __rcvr.set_stopped();
+      }
+      else
+      {
+        __rcvr.set_value();
+      }
+    }
+
+    receiver_proxy& __rcvr_;
+    bool __in_situ_;
+  };
+
+  struct __bulk_state;
+
+  //! One of the tasks that cooperatively execute the chunks of a bulk operation. There is
+  //! at most one helper per worker.
+  struct __bulk_helper : __pool_task
+  {
+    _CCCL_HOST_API __bulk_helper() noexcept
+        : __pool_task{&__execute_impl}
+    {}
+
+    _CCCL_HOST_API static void __execute_impl(__pool_task* __p) noexcept
+    {
+      static_cast<__bulk_helper*>(__p)->__state_->__work();
+    }
+
+    __bulk_state* __state_ = nullptr;
+  };
+
+  //! The shared state of a bulk operation, followed in memory by its helper tasks.
+  struct __bulk_state
+  {
+    _CCCL_HOST_API explicit __bulk_state(
+      bulk_item_receiver_proxy& __rcvr, size_t __shape, size_t __chunk_size, uint32_t __num_helpers, bool __chunked)
+        : __rcvr_{__rcvr}
+        , __stoken_{get_stop_token(__rcvr.get_env())}
+        , __shape_{__shape}
+        , __chunk_size_{__chunk_size}
+        , __num_chunks_{(__shape + __chunk_size - 1) / __chunk_size}
+        , __num_helpers_{__num_helpers}
+        , __chunked_{__chunked}
+        , __active_{__num_helpers}
+    {
+      for (uint32_t __i = 0; __i < __num_helpers_; ++__i)
+      {
+        ::new (static_cast<void*>(__helpers() + __i)) __bulk_helper{};
+        __helpers()[__i].__state_ = this;
+      }
+    }
+
+    [[nodiscard]] _CCCL_HOST_API static auto __allocation_size(uint32_t __num_helpers) noexcept -> size_t
+    {
+      return sizeof(__bulk_state) + __num_helpers * sizeof(__bulk_helper);
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto __helpers() noexcept -> __bulk_helper*
+    {
+      return ::cuda::std::launder(reinterpret_cast<__bulk_helper*>(this + 1));
+    }
+
+    _CCCL_HOST_API void __work() noexcept
+    {
+      while (true)
+      {
+        const size_t __chunk = __next_chunk_.fetch_add(1, ::cuda::std::memory_order_relaxed);
+        if (__chunk >= __num_chunks_)
+        {
+          break;
+        }
+
+        const size_t __begin = __chunk * __chunk_size_;
+        const size_t __end   = (::cuda::std::min) (__begin + __chunk_size_, __shape_);
+        size_t __i           = __begin;
+        if (__chunked_)
+        {
+          if (!__stoken_.stop_requested())
+          {
+            __rcvr_.execute(__begin, __end);
+            __i = __end;
+          }
+        }
+        else
+        {
+          // Every index is a separate execution agent, so a stop request is honored between them.
+          for (; __i < __end && !__stoken_.stop_requested(); ++__i)
+          {
+            __rcvr_.execute(__i, __i + 1);
+          }
+        }
+
+        if (__i != __end)
+        {
+          // Stopped. Claim all the remaining chunks so the other helpers finish early, too.
+          __next_chunk_.store(__num_chunks_, ::cuda::std::memory_order_relaxed);
+          __stopped_.store(true, ::cuda::std::memory_order_relaxed);
+          break;
+        }
+      }
+
+      if (__active_.fetch_sub(1, ::cuda::std::memory_order_acq_rel) == 1)
+      {
+        __complete();
+      }
+    }
+
+    _CCCL_HOST_API void __complete() noexcept
+    {
+      // A stop request that arrives after all the work has been done does not change the
+      // result of the operation.
+      const bool __stopped             = __stopped_.load(::cuda::std::memory_order_relaxed);
+      bulk_item_receiver_proxy& __rcvr = __rcvr_;
+
+      // The receiver may destroy the operation state that owns the proxy, so the bulk state
+      // must be gone by the time it is completed.
+      this->~__bulk_state();
+      ::operator delete(static_cast<void*>(this));
+
+      if (__stopped)
+      {
+        __rcvr.set_stopped();
+      }
+      else
+      {
+        __rcvr.set_value();
+      }
+    }
+
+    bulk_item_receiver_proxy& __rcvr_;
+    inplace_stop_token __stoken_;
+    size_t __shape_;
+    size_t __chunk_size_;
+    size_t __num_chunks_;
+    uint32_t __num_helpers_;
+    bool __chunked_;
+    ::cuda::std::atomic<size_t> __next_chunk_{0};
+    ::cuda::std::atomic<uint32_t> __active_;
+    ::cuda::std::atomic<bool> __stopped_{false};
+  };
+
+public:
+  _CCCL_HOST_API explicit __thread_pool_backend(uint32_t __num_threads)
+      : __num_workers_{__num_threads == 0 ? 1 : __num_threads}
+      , __workers_{new __worker[__num_workers_]}
+  {
+    for (uint32_t __i = 0; __i < __num_workers_; ++__i)
+    {
+      __workers_[__i].__thrd_ = ::std::thread{[this, __i] {
+        __run(__i);
+      }};
+    }
+  }
+
+  _CCCL_HOST_API ~__thread_pool_backend() override
+  {
+    join();
+  }
+
+  _CCCL_HOST_API void join() noexcept
+  {
+    if (!__finishing_.exchange(true, ::cuda::std::memory_order_acq_rel))
+    {
+      __epoch_.fetch_add(1, ::cuda::std::memory_order_seq_cst);
+      __epoch_.notify_all();
+    }
+    for (uint32_t __i = 0; __i < __num_workers_; ++__i)
+    {
+      if (__workers_[__i].__thrd_.joinable())
+      {
+        __workers_[__i].__thrd_.join();
+      }
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto available_parallelism() const noexcept -> uint32_t
+  {
+    return __num_workers_;
+  }
+
+  _CCCL_HOST_API void schedule(receiver_proxy& __rcvr, ::cuda::std::span<::cuda::std::byte> __storage) noexcept override
+  {
+    if (get_stop_token(__rcvr.get_env()).stop_requested())
+    {
+      __rcvr.set_stopped();
+      return;
+    }
+
+    _CCCL_TRY
+    {
+      const bool __in_situ = __storage.size() >= sizeof(__schedule_task);
+      auto* __task         = __in_situ ? ::new (static_cast<void*>(__storage.data())) __schedule_task{__rcvr, true}
+                                       : new __schedule_task{__rcvr, false};
+      __push(__task, __next_worker());
+    }
+    _CCCL_CATCH_ALL
+    {
+      __rcvr.set_error(execution::current_exception());
+    }
+  }
+
+  _CCCL_HOST_API void schedule_bulk_chunked(
+    size_t __shape, bulk_item_receiver_proxy& __rcvr, ::cuda::std::span<::cuda::std::byte>) noexcept override
+  {
+    __schedule_bulk(__shape, __rcvr, true);
+  }
+
+  _CCCL_HOST_API void schedule_bulk_unchunked(
+    size_t __shape, bulk_item_receiver_proxy& __rcvr, ::cuda::std::span<::cuda::std::byte>) noexcept override
+  {
+    __schedule_bulk(__shape, __rcvr, false);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto query(get_forward_progress_guarantee_t) const noexcept
+    -> forward_progress_guarantee override
+  {
+    return forward_progress_guarantee::parallel;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __equal_to(const void*, ::cuda::std::__type_info_ref) -> bool override
+  {
+    // A thread pool is only ever reachable through a task_scheduler.
+    return false;
+  }
+
+private:
+  //! Splits @p __shape into chunks and hands one helper task to each of up to
+  //! `__num_workers_` workers. The helpers claim chunks until there are none left or a stop
+  //! is requested, and the last helper to finish completes the operation.
+  _CCCL_HOST_API void __schedule_bulk(size_t __shape, bulk_item_receiver_proxy& __rcvr, bool __chunked) noexcept
+  {
+    if (get_stop_token(__rcvr.get_env()).stop_requested())
+    {
+      __rcvr.set_stopped();
+      return;
+    }
+    if (__shape == 0)
+    {
+      __rcvr.set_value();
+      return;
+    }
+
+    const size_t __target_chunks = static_cast<size_t>(__num_workers_) * __chunks_per_worker;
+    const size_t __chunk_size    = (__shape + __target_chunks - 1) / __target_chunks;
+    const size_t __num_chunks    = (__shape + __chunk_size - 1) / __chunk_size;
+    const auto __num_helpers =
+      static_cast<uint32_t>((::cuda::std::min) (__num_chunks, static_cast<size_t>(__num_workers_)));
+
+    _CCCL_TRY
+    {
+      void* __ptr    = ::operator new(__bulk_state::__allocation_size(__num_helpers));
+      auto* __state  = ::new (__ptr) __bulk_state{__rcvr, __shape, __chunk_size, __num_helpers, __chunked};
+      const uint32_t __first = __next_worker();
+      for (uint32_t __i = 0; __i < __num_helpers; ++__i)
+      {
+        __push(__state->__helpers() + __i, (__first + __i) % __num_workers_);
+      }
+    }
+    _CCCL_CATCH_ALL
+    {
+      __rcvr.set_error(execution::current_exception());
+    }
+  }
+
+  //! Work submitted from one of this pool's workers goes to that worker's own deque; work
+  //! submitted from elsewhere is spread over the workers round-robin.
+  [[nodiscard]] _CCCL_HOST_API auto __next_worker() noexcept -> uint32_t
+  {
+    const __worker_id& __id = __this_worker();
+    if (__id.__pool_ == this)
+    {
+      return __id.__index_;
+    }
+    return __round_robin_.fetch_add(1, ::cuda::std::memory_order_relaxed) % __num_workers_;
+  }
+
+  _CCCL_HOST_API void __push(__pool_task* __task, uint32_t __index) noexcept
+  {
+    __workers_[__index].__tasks_.push_back(__task);
+    // Pairs with the increment of __sleepers_ in __run: either this thread sees the sleeper
+    // and wakes it, or the sleeper sees the new epoch and does not go to sleep.
+    __epoch_.fetch_add(1, ::cuda::std::memory_order_seq_cst);
+    if (__sleepers_.load(::cuda::std::memory_order_seq_cst) != 0)
+    {
+      __epoch_.notify_one();
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __find_task(uint32_t __index) noexcept -> __pool_task*
+  {
+    if (__pool_task* __task = __workers_[__index].__tasks_.pop_back())
+    {
+      return __task;
+    }
+    for (uint32_t __i = 1; __i < __num_workers_; ++__i)
+    {
+      if (__pool_task* __task = __workers_[(__index + __i) % __num_workers_].__tasks_.steal_front())
+      {
+        return __task;
+      }
+    }
+    return nullptr;
+  }
+
+  _CCCL_HOST_API void __run(uint32_t __index) noexcept
+  {
+    __this_worker() = __worker_id{this, __index};
+
+    while (true)
+    {
+      const uint32_t __epoch = __epoch_.load(::cuda::std::memory_order_seq_cst);
+      if (__pool_task* __task = __find_task(__index))
+      {
+        __task->__execute();
+        continue;
+      }
+      if (__finishing_.load(::cuda::std::memory_order_acquire))
+      {
+        break;
+      }
+      // Nothing to do. Sleep until a task is pushed after the epoch was sampled.
+      __sleepers_.fetch_add(1, ::cuda::std::memory_order_seq_cst);
+      __epoch_.wait(__epoch, ::cuda::std::memory_order_seq_cst);
+      __sleepers_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+    }
+
+    __this_worker() = __worker_id{nullptr, 0};
+  }
+
+  uint32_t __num_workers_;
+  ::std::unique_ptr<__worker[]> __workers_;
+  ::cuda::std::atomic<uint32_t> __round_robin_{0};
+  ::cuda::std::atomic<uint32_t> __epoch_{0};
+  ::cuda::std::atomic<uint32_t> __sleepers_{0};
+  ::cuda::std::atomic<bool> __finishing_{false};
+};
+} // namespace __detail
+
+//! @brief A pool of worker threads that execute work scheduled through a
+//! @c task_scheduler.
+//!
+//! Every worker owns a deque of tasks. Workers run their own tasks newest first and,
+//! when they run out, steal the oldest tasks of the other workers. `bulk`,
+//! `bulk_chunked` and `bulk_unchunked` senders with a parallel policy that are started on
+//! the pool's scheduler are split into chunks based on their shape and the number of
+//! workers, and the chunks are executed by all workers in parallel. With any other policy,
+//! the whole shape is executed by a single worker. Chunks are not started after a stop has
+//! been requested on the receiver's stop token, in which case the operation completes with
+//! `set_stopped`.
+//!
+//! @note The destructor joins the worker threads after they have drained their queues. Work
+//! must not be scheduled on the pool once it has been joined.
+class _CCCL_TYPE_VISIBILITY_DEFAULT thread_pool : __immovable
+{
+public:
+  //! @brief Starts a pool with one worker per hardware thread.
+  _CCCL_HOST_API thread_pool()
+      : thread_pool(::std::thread::hardware_concurrency())
+  {}
+
+  //! @brief Starts a pool with @p __num_threads workers, or a single worker if
+  //! @p __num_threads is zero.
+  _CCCL_HOST_API explicit thread_pool(uint32_t __num_threads)
+      : __backend_(experimental::__make_shared<__detail::__thread_pool_backend>(__num_threads))
+  {}
+
+  _CCCL_HOST_API ~thread_pool() noexcept
+  {
+    join();
+  }
+
+  //! @brief Waits for all scheduled work to finish and stops the worker threads.
+  _CCCL_HOST_API void join() noexcept
+  {
+    static_cast<__detail::__thread_pool_backend&>(*__backend_).join();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto get_scheduler() const noexcept -> task_scheduler
+  {
+    return task_scheduler{__backend_};
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto available_parallelism() const noexcept -> uint32_t
+  {
+    return static_cast<const __detail::__thread_pool_backend&>(*__backend_).available_parallelism();
+  }
+
+private:
+  __detail::__backend_ptr_t __backend_;
+};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_THREAD_POOL
@@ -0,0 +1,825 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_TIMED_RUN_LOOP
+#define __CUDAX_EXECUTION_TIMED_RUN_LOOP
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__bit/rotate.h>
+#include <cuda/std/__cccl/unreachable.h>
+#include <cuda/std/__utility/exchange.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstdint>
+
+#include <cuda/experimental/__detail/utility.cuh>
+#include <cuda/experimental/__execution/atomic_intrusive_queue.cuh>
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/fwd.cuh>
+#include <cuda/experimental/__execution/lazy.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/stop_token.cuh>
+#include <cuda/experimental/__execution/utility.cuh>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+namespace __detail
+{
+//! A timer in a @c __timer_wheel.
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __timer_node
+{
+  ::cuda::std::uint64_t __expiry_     = 0;
+  __timer_node* __wheel_next_         = nullptr;
+  __timer_node* __wheel_prev_         = nullptr;
+  ::cuda::std::uint8_t __wheel_level_ = 0;
+  ::cuda::std::uint8_t __wheel_slot_  = 0;
+};
+
+//! @brief A hierarchical timer wheel.
+//!
+//! Time is measured in ticks. Level @c L of the wheel has 64 slots of 64^L ticks each. A timer
+//! goes into the lowest level whose slot size covers the distance between the current tick and
+//! its expiry, in the slot that its expiry falls into. When the current tick advances past a slot,
+//! the timers in it either expire or cascade down to a lower level. Every level keeps a bitmask of
+//! its occupied slots, so advancing by any number of ticks and finding the next expiry only visit
+//! occupied slots. Inserting and removing a timer take constant time.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __timer_wheel : __immovable
+{
+public:
+  using __tick_t _CCCL_NODEBUG_ALIAS = ::cuda::std::uint64_t;
+
+  static constexpr int __slot_bits = 6;
+  static constexpr int __num_slots = 1 << __slot_bits;
+
+  //! Expiries are clamped to this tick, which keeps the arithmetic on the top level from overflowing.
+  static constexpr __tick_t __max_tick  = __tick_t{1} << 62;
+  static constexpr int __num_levels     = (62 + __slot_bits - 1) / __slot_bits;
+  static constexpr __tick_t __no_expiry = ~__tick_t{0};
+
+  _CCCL_HIDE_FROM_ABI __timer_wheel() = default;
+
+  [[nodiscard]] _CCCL_HOST_API auto __now() const noexcept -> __tick_t
+  {
+    return __now_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __empty() const noexcept -> bool
+  {
+    return __size_ == 0;
+  }
+
+  //! Adds a timer that expires after the current tick.
+  _CCCL_HOST_API void __insert(__timer_node* __node) noexcept
+  {
+    const __tick_t __expiry = __node->__expiry_;
+    _CCCL_ASSERT(__now_ < __expiry && __expiry <= __max_tick, "the timer must expire after the current tick");
+
+    const int __level = (::cuda::std::bit_width(__expiry ^ __now_) - 1) / __slot_bits;
+    const int __slot  = static_cast<int>((__expiry >> (__level * __slot_bits)) % __num_slots);
+
+    __timer_node*& __head  = __slots_[__level][__slot];
+    __node->__wheel_level_ = static_cast<::cuda::std::uint8_t>(__level);
+    __node->__wheel_slot_  = static_cast<::cuda::std::uint8_t>(__slot);
+    __node->__wheel_prev_  = nullptr;
+    __node->__wheel_next_  = __head;
+    if (__head != nullptr)
+    {
+      __head->__wheel_prev_ = __node;
+    }
+    __head = __node;
+    __occupied_[__level] |= ::cuda::std::uint64_t{1} << __slot;
+    ++__size_;
+  }
+
+  //! Removes a timer that has been inserted and has neither expired nor been taken.
+  _CCCL_HOST_API void __remove(__timer_node* __node) noexcept
+  {
+    const int __level = __node->__wheel_level_;
+    const int __slot  = __node->__wheel_slot_;
+    (__node->__wheel_prev_ ? __node->__wheel_prev_->__wheel_next_ : __slots_[__level][__slot]) = __node->__wheel_next_;
+    if (__node->__wheel_next_ != nullptr)
+    {
+      __node->__wheel_next_->__wheel_prev_ = __node->__wheel_prev_;
+    }
+    if (__slots_[__level][__slot] == nullptr)
+    {
+      __occupied_[__level] &= ~(::cuda::std::uint64_t{1} << __slot);
+    }
+    --__size_;
+  }
+
+  //! Makes @c __to the current tick. Returns the timers that expire by then, in no particular
+  //! order, linked through @c __wheel_next_.
+  [[nodiscard]] _CCCL_HOST_API auto __advance(__tick_t __to) noexcept -> __timer_node*
+  {
+    if (__to <= __now_)
+    {
+      return nullptr;
+    }
+
+    // Take the timers out of every slot that is passed on the way. Once the slot of a level does
+    // not change, the slots of the levels above it do not change either.
+    __timer_node* __passed_timers = nullptr;
+    for (int __level = 0; __level < __num_levels; ++__level)
+    {
+      const int __shift     = __level * __slot_bits;
+      const __tick_t __from = __now_ >> __shift;
+      const __tick_t __till = __to >> __shift;
+      if (__from == __till)
+      {
+        break;
+      }
+
+      // The slots after the current one, up to and including the new current one.
+      ::cuda::std::uint64_t __passed = ~::cuda::std::uint64_t{0};
+      if (__till - __from < __num_slots)
+      {
+        __passed = ::cuda::std::rotl((::cuda::std::uint64_t{1} << (__till - __from)) - 1,
+                                    static_cast<int>((__from + 1) % __num_slots));
+      }
+
+      __passed &= __occupied_[__level];
+      __occupied_[__level] &= ~__passed;
+      while (__passed != 0)
+      {
+        const int __slot = ::cuda::std::countr_zero(__passed);
+        __passed &= __passed - 1;
+        for (__timer_node* __node = ::cuda::std::exchange(__slots_[__level][__slot], nullptr); __node != nullptr;)
+        {
+          __timer_node* __next  = __node->__wheel_next_;
+          __node->__wheel_next_ = __passed_timers;
+          __passed_timers       = __node;
+          __node                = __next;
+        }
+      }
+    }
+
+    __now_ = __to;
+
+    // The timers that do not expire yet cascade down to a lower level.
+    __timer_node* __expired = nullptr;
+    while (__passed_timers != nullptr)
+    {
+      __timer_node* __node = ::cuda::std::exchange(__passed_timers, __passed_timers->__wheel_next_);
+      --__size_;
+      if (__node->__expiry_ <= __now_)
+      {
+        __node->__wheel_next_ = __expired;
+        __expired             = __node;
+      }
+      else
+      {
+        __insert(__node);
+      }
+    }
+    return __expired;
+  }
+
+  //! Returns a tick no later than the earliest expiry, or @c __no_expiry if the wheel is empty.
+  //! The result is exact if the earliest timer is in the lowest level. Otherwise it is the tick
+  //! at which that timer cascades down.
+  [[nodiscard]] _CCCL_HOST_API auto __next_expiry() const noexcept -> __tick_t
+  {
+    // All the timers in a level expire before all the timers in the levels above it.
+    for (int __level = 0; __level < __num_levels; ++__level)
+    {
+      if (__occupied_[__level] != 0)
+      {
+        // Rotate the mask so that the slot after the current one comes first.
+        const int __shift     = __level * __slot_bits;
+        const __tick_t __slot = __now_ >> __shift;
+        const auto __mask     = ::cuda::std::rotr(__occupied_[__level], static_cast<int>((__slot + 1) % __num_slots));
+        return (__slot + ::cuda::std::countr_zero(__mask) + 1) << __shift;
+      }
+    }
+    return __no_expiry;
+  }
+
+  //! Removes all the timers and returns them linked through @c __wheel_next_.
+  [[nodiscard]] _CCCL_HOST_API auto __take_all() noexcept -> __timer_node*
+  {
+    __timer_node* __all = nullptr;
+    for (int __level = 0; __level < __num_levels; ++__level)
+    {
+      for (::cuda::std::uint64_t __occupied = ::cuda::std::exchange(__occupied_[__level], 0); __occupied != 0;
+           __occupied &= __occupied - 1)
+      {
+        const int __slot = ::cuda::std::countr_zero(__occupied);
+        for (__timer_node* __node = ::cuda::std::exchange(__slots_[__level][__slot], nullptr); __node != nullptr;)
+        {
+          __timer_node* __next  = __node->__wheel_next_;
+          __node->__wheel_next_ = __all;
+          __all                 = __node;
+          __node                = __next;
+        }
+      }
+    }
+    __size_ = 0;
+    return __all;
+  }
+
+private:
+  __tick_t __now_ = 0;
+  size_t __size_  = 0;
+  ::cuda::std::uint64_t __occupied_[__num_levels]{};
+  __timer_node* __slots_[__num_levels][__num_slots]{};
+};
+} // namespace __detail
+
+//! @brief A run loop that can also run work at a point in time.
+//!
+//! Besides @c schedule(), the loop's scheduler has @c schedule_at(tp) and @c schedule_after(d),
+//! which return senders that complete on the loop once @c tp has been reached or @c d has elapsed
+//! since they were started. Deadlines are rounded up to the loop's resolution, so timers never
+//! complete early.
+//!
+//! Work from any thread is submitted to the loop's thread through the same lock-free queue that
+//! @c run_loop uses: starting an operation, and cancelling a timer through the stop token of its
+//! receiver, push a node onto the queue. The timers are kept in a hierarchical timer wheel that
+//! only the loop's thread touches. When there is nothing to do, the loop's thread sleeps until the
+//! next timer is due or new work is submitted. A submission only takes a lock to wake the loop's
+//! thread when it finds the queue empty and the loop's thread asleep.
+//!
+//! A timer whose stop token is triggered completes with @c set_stopped() on the loop's thread.
+//! When @c run() returns after @c finish(), the work that was submitted before has been executed
+//! and the timers that have not expired have completed with @c set_stopped().
+class _CCCL_TYPE_VISIBILITY_DEFAULT timed_run_loop : __immovable
+{
+public:
+  using clock      = ::std::chrono::steady_clock;
+  using duration   = clock::duration;
+  using time_point = clock::time_point;
+
+private:
+  using __tick_t _CCCL_NODEBUG_ALIAS = __detail::__timer_wheel::__tick_t;
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __task : __immovable
+  {
+    using __execute_fn_t _CCCL_NODEBUG_ALIAS = void(__task*) noexcept;
+
+    _CCCL_HOST_API explicit __task(__execute_fn_t* __execute_fn) noexcept
+        : __execute_fn_(__execute_fn)
+    {}
+
+    _CCCL_HOST_API void __execute() noexcept
+    {
+      (*__execute_fn_)(this);
+    }
+
+    __execute_fn_t* __execute_fn_ = nullptr;
+    __task* __next_               = nullptr;
+  };
+
+  template <class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t : __task
+  {
+    using operation_state_concept = operation_state_t;
+
+    _CCCL_HOST_API explicit __opstate_t(timed_run_loop* __loop, _Rcvr __rcvr)
+        : __task{&__execute_impl}
+        , __loop_{__loop}
+        , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+    {}
+
+    _CCCL_HOST_API void start() noexcept
+    {
+      __loop_->__push(this);
+    }
+
+    _CCCL_HOST_API static void __execute_impl(__task* __p) noexcept
+    {
+      auto& __rcvr = static_cast<__opstate_t*>(__p)->__rcvr_;
+      if (get_stop_token(get_env(__rcvr)).stop_requested())
+      {
+        set_stopped(static_cast<_Rcvr&&>(__rcvr));
+      }
+      else
+      {
+        set_value(static_cast<_Rcvr&&>(__rcvr));
+      }
+    }
+
+    timed_run_loop* __loop_;
+    _Rcvr __rcvr_;
+  };
+
+  //! Where a timer is in its life. Only the loop's thread reads and writes this.
+  enum class __timer_state : ::cuda::std::uint8_t
+  {
+    __submitted, //!< Started, but not added to the wheel yet.
+    __waiting,   //!< In the wheel.
+    __expired,   //!< Expired while a cancellation was in flight, which will complete it.
+    __cancelled, //!< Cancelled before it was added to the wheel, which will complete it.
+  };
+
+  //! @brief The part of a timer's operation state that the loop works with.
+  //!
+  //! The operation state itself is the task that adds the timer to the wheel. A stop request
+  //! pushes a second task, @c __cancel_, that takes it out again. Either task can reach the loop
+  //! first, and the timer can expire while the cancellation is in flight, so the timer is only
+  //! completed once the loop has seen the cancellation, if there is one. The stop callback is
+  //! destroyed before the timer is completed, which tells whether a cancellation is in flight.
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __timer_base
+      : __task
+      , __detail::__timer_node
+  {
+    using __unregister_fn_t _CCCL_NODEBUG_ALIAS = void(__timer_base*) noexcept;
+    using __complete_fn_t _CCCL_NODEBUG_ALIAS   = void(__timer_base*, bool __stopped) noexcept;
+
+    struct _CCCL_TYPE_VISIBILITY_DEFAULT __cancel_task : __task
+    {
+      _CCCL_HOST_API explicit __cancel_task(__timer_base* __timer) noexcept
+          : __task{&__execute_impl}
+          , __timer_{__timer}
+      {}
+
+      _CCCL_HOST_API static void __execute_impl(__task* __p) noexcept
+      {
+        __timer_base* __timer = static_cast<__cancel_task*>(__p)->__timer_;
+        __timer->__loop_->__cancel(__timer);
+      }
+
+      __timer_base* __timer_;
+    };
+
+    _CCCL_HOST_API explicit __timer_base(
+      timed_run_loop* __loop, __unregister_fn_t* __unregister, __complete_fn_t* __complete) noexcept
+        : __task{&__execute_impl}
+        , __loop_{__loop}
+        , __unregister_{__unregister}
+        , __complete_{__complete}
+        , __cancel_{this}
+    {}
+
+    _CCCL_HOST_API static void __execute_impl(__task* __p) noexcept
+    {
+      auto* __timer = static_cast<__timer_base*>(__p);
+      __timer->__loop_->__insert(__timer);
+    }
+
+    //! Called from the stop callback, on any thread.
+    _CCCL_HOST_API void __request_cancel() noexcept
+    {
+      __stop_requested_.store(true, ::cuda::std::memory_order_release);
+      __loop_->__push(&__cancel_);
+    }
+
+    timed_run_loop* __loop_;
+    __unregister_fn_t* __unregister_;
+    __complete_fn_t* __complete_;
+    __cancel_task __cancel_;
+    ::cuda::std::atomic<bool> __stop_requested_{false};
+    __timer_state __state_ = __timer_state::__submitted;
+  };
+
+  template <class _Time, class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __timer_opstate_t : __timer_base
+  {
+    using operation_state_concept = operation_state_t;
+
+    struct __on_stop_fn
+    {
+      _CCCL_HOST_API void operator()() const noexcept
+      {
+        __self_->__request_cancel();
+      }
+
+      __timer_opstate_t* __self_;
+    };
+
+    using __stop_token_t _CCCL_NODEBUG_ALIAS    = stop_token_of_t<env_of_t<_Rcvr>>;
+    using __stop_callback_t _CCCL_NODEBUG_ALIAS = stop_callback_for_t<__stop_token_t, __on_stop_fn>;
+
+    _CCCL_HOST_API explicit __timer_opstate_t(timed_run_loop* __loop, _Time __time, _Rcvr __rcvr)
+        : __timer_base{__loop, &__unregister_impl, &__complete_impl}
+        , __time_{__time}
+        , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+    {}
+
+    _CCCL_HOST_API void start() noexcept
+    {
+      this->__expiry_ = this->__loop_->__expiry_of(timed_run_loop::__deadline_of(__time_));
+      __on_stop_.__construct(get_stop_token(execution::get_env(__rcvr_)), __on_stop_fn{this});
+      this->__loop_->__push(this);
+    }
+
+    _CCCL_HOST_API static void __unregister_impl(__timer_base* __p) noexcept
+    {
+      static_cast<__timer_opstate_t*>(__p)->__on_stop_.__destroy();
+    }
+
+    _CCCL_HOST_API static void __complete_impl(__timer_base* __p, bool __stopped) noexcept
+    {
+      auto& __rcvr = static_cast<__timer_opstate_t*>(__p)->__rcvr_;
+      if (__stopped)
+      {
+        set_stopped(static_cast<_Rcvr&&>(__rcvr));
+      }
+      else
+      {
+        set_value(static_cast<_Rcvr&&>(__rcvr));
+      }
+    }
+
+    _Time __time_;
+    _Rcvr __rcvr_;
+    __lazy<__stop_callback_t> __on_stop_;
+  };
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __attrs_t
+  {
+    [[nodiscard]] _CCCL_HOST_API auto query(get_completion_scheduler_t<set_value_t>) const noexcept;
+    [[nodiscard]] _CCCL_HOST_API auto query(get_completion_scheduler_t<set_stopped_t>) const noexcept;
+
+    [[nodiscard]] _CCCL_API constexpr auto query(get_completion_behavior_t) const noexcept
+    {
+      return completion_behavior::asynchronous;
+    }
+
+    timed_run_loop* __loop_;
+  };
+
+public:
+  //! @brief Creates a loop whose timers expire on multiples of @c __resolution after its creation.
+  _CCCL_HOST_API explicit timed_run_loop(duration __resolution = ::std::chrono::microseconds{10}) noexcept
+      : __start_{clock::now()}
+      , __resolution_{__resolution}
+  {
+    _CCCL_ASSERT(__resolution > duration::zero(), "the resolution of a timed_run_loop must be positive");
+  }
+
+  class _CCCL_TYPE_VISIBILITY_DEFAULT scheduler : __attrs_t
+  {
+    friend timed_run_loop;
+
+    _CCCL_HOST_API explicit scheduler(timed_run_loop* __loop) noexcept
+        : __attrs_t{__loop}
+    {}
+
+    template <class _Time>
+    struct _CCCL_TYPE_VISIBILITY_DEFAULT __timer_sndr_t
+    {
+      using sender_concept = sender_t;
+
+      template <class _Rcvr>
+      [[nodiscard]] _CCCL_HOST_API auto connect(_Rcvr __rcvr) const noexcept(__nothrow_movable<_Rcvr>)
+        -> __timer_opstate_t<_Time, _Rcvr>
+      {
+        return __timer_opstate_t<_Time, _Rcvr>{__loop_, __time_, static_cast<_Rcvr&&>(__rcvr)};
+      }
+
+      template <class _Self>
+      [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+      {
+        return completion_signatures<set_value_t(), set_stopped_t()>{};
+      }
+
+      [[nodiscard]] _CCCL_HOST_API auto get_env() const noexcept -> __attrs_t
+      {
+        return __attrs_t{__loop_};
+      }
+
+      timed_run_loop* __loop_;
+      _Time __time_;
+    };
+
+  public:
+    using scheduler_concept = scheduler_t;
+
+    struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t
+    {
+      using sender_concept = sender_t;
+
+      template <class _Rcvr>
+      [[nodiscard]] _CCCL_HOST_API auto connect(_Rcvr __rcvr) const noexcept(__nothrow_movable<_Rcvr>)
+        -> __opstate_t<_Rcvr>
+      {
+        return __opstate_t<_Rcvr>{__loop_, static_cast<_Rcvr&&>(__rcvr)};
+      }
+
+      template <class _Self>
+      [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+      {
+        return completion_signatures<set_value_t(), set_stopped_t()>{};
+      }
+
+      [[nodiscard]] _CCCL_HOST_API auto get_env() const noexcept -> __attrs_t
+      {
+        return __attrs_t{__loop_};
+      }
+
+      timed_run_loop* __loop_;
+    };
+
+    //! @brief Returns a sender that completes on the loop as soon as possible.
+    [[nodiscard]] _CCCL_HOST_API auto schedule() const noexcept -> __sndr_t
+    {
+      return __sndr_t{this->__loop_};
+    }
+
+    //! @brief Returns a sender that completes on the loop once @c __time_point has been reached.
+    [[nodiscard]] _CCCL_HOST_API auto schedule_at(time_point __time_point) const noexcept -> __timer_sndr_t<time_point>
+    {
+      return __timer_sndr_t<time_point>{this->__loop_, __time_point};
+    }
+
+    //! @brief Returns a sender that completes on the loop once @c __duration has elapsed after it
+    //! was started.
+    [[nodiscard]] _CCCL_HOST_API auto schedule_after(duration __duration) const noexcept -> __timer_sndr_t<duration>
+    {
+      return __timer_sndr_t<duration>{this->__loop_, __duration};
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto now() const noexcept -> time_point
+    {
+      return clock::now();
+    }
+
+    using __attrs_t::query;
+
+    [[nodiscard]] _CCCL_API constexpr auto query(get_forward_progress_guarantee_t) const noexcept
+      -> forward_progress_guarantee
+    {
+      return forward_progress_guarantee::parallel;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API friend bool operator==(const scheduler& __a, const scheduler& __b) noexcept
+    {
+      return __a.__loop_ == __b.__loop_;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API friend bool operator!=(const scheduler& __a, const scheduler& __b) noexcept
+    {
+      return __a.__loop_ != __b.__loop_;
+    }
+  };
+
+  [[nodiscard]] _CCCL_HOST_API auto get_scheduler() noexcept -> scheduler
+  {
+    return scheduler{this};
+  }
+
+  //! @brief Executes work and expires timers on the calling thread until @c finish() is called.
+  _CCCL_HOST_API void run() noexcept
+  {
+    while (true)
+    {
+      __execute_all();
+      __expire_due();
+      if (__finishing_.load(::cuda::std::memory_order_acquire))
+      {
+        break;
+      }
+      __wait();
+    }
+
+    // Stop the timers that are left, taking care to execute any work that is submitted while
+    // doing so.
+    do
+    {
+      __stop_all();
+    } while (__execute_all());
+  }
+
+  //! @brief Makes @c run() return once it has executed the work that was submitted before.
+  _CCCL_HOST_API void finish() noexcept
+  {
+    if (!__finishing_.exchange(true, ::cuda::std::memory_order_acq_rel))
+    {
+      {
+        ::std::lock_guard<::std::mutex> __lock{__mtx_};
+      }
+      __cv_.notify_one();
+    }
+  }
+
+private:
+  // Submits a task to the loop. This is lock-free unless the loop's thread has to be woken up.
+  _CCCL_HOST_API void __push(__task* __item) noexcept
+  {
+    if (__queue_.push(__item))
+    {
+      // The queue was empty, so the loop's thread may be going to sleep. Pairs with the fence in
+      // __wait: either the loop's thread sees the task, or this thread sees that it is asleep.
+      ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+      if (__sleeping_.load(::cuda::std::memory_order_relaxed))
+      {
+        {
+          ::std::lock_guard<::std::mutex> __lock{__mtx_};
+        }
+        __cv_.notify_one();
+      }
+    }
+  }
+
+  // Returns true if any tasks were executed.
+  _CCCL_HOST_API auto __execute_all() noexcept -> bool
+  {
+    auto __queue = __queue_.pop_all();
+    if (__queue.empty())
+    {
+      return false;
+    }
+
+    do
+    {
+      __queue.pop_front()->__execute();
+    } while (!__queue.empty());
+    return true;
+  }
+
+  // Sleeps until a task is submitted, the next timer is due, or finish() is called.
+  _CCCL_HOST_API void __wait() noexcept
+  {
+    const __tick_t __next = __wheel_.__next_expiry();
+    const bool __timed    = __next <= __max_wait_tick();
+    const time_point __deadline =
+      __timed ? __start_ + __resolution_ * static_cast<duration::rep>(__next) : time_point{};
+
+    __sleeping_.store(true, ::cuda::std::memory_order_relaxed);
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    {
+      ::std::unique_lock<::std::mutex> __lock{__mtx_};
+      while (__queue_.empty() && !__finishing_.load(::cuda::std::memory_order_acquire))
+      {
+        if (!__timed)
+        {
+          __cv_.wait(__lock);
+        }
+        else if (__cv_.wait_until(__lock, __deadline) == ::std::cv_status::timeout)
+        {
+          break;
+        }
+      }
+    }
+    __sleeping_.store(false, ::cuda::std::memory_order_relaxed);
+  }
+
+  // Expires the timers that are due.
+  _CCCL_HOST_API void __expire_due() noexcept
+  {
+    if (__wheel_.__empty())
+    {
+      return;
+    }
+
+    const auto __now               = static_cast<__tick_t>((clock::now() - __start_) / __resolution_);
+    __detail::__timer_node* __node = __wheel_.__advance(__now);
+    while (__node != nullptr)
+    {
+      // Completing a timer may start other timers, so read the next one first.
+      auto* __timer = static_cast<__timer_base*>(::cuda::std::exchange(__node, __node->__wheel_next_));
+      __retire(__timer, false);
+    }
+  }
+
+  // Completes the timers that are left with set_stopped.
+  _CCCL_HOST_API void __stop_all() noexcept
+  {
+    __detail::__timer_node* __node = __wheel_.__take_all();
+    while (__node != nullptr)
+    {
+      auto* __timer = static_cast<__timer_base*>(::cuda::std::exchange(__node, __node->__wheel_next_));
+      __retire(__timer, true);
+    }
+  }
+
+  // Called on the loop's thread when a timer is started.
+  _CCCL_HOST_API void __insert(__timer_base* __timer) noexcept
+  {
+    if (__timer->__state_ == __timer_state::__cancelled)
+    {
+      __timer->__unregister_(__timer);
+      __timer->__complete_(__timer, true);
+    }
+    else if (__timer->__expiry_ <= __wheel_.__now())
+    {
+      __retire(__timer, false);
+    }
+    else
+    {
+      __timer->__state_ = __timer_state::__waiting;
+      __wheel_.__insert(__timer);
+    }
+  }
+
+  // Called on the loop's thread when a timer is cancelled.
+  _CCCL_HOST_API void __cancel(__timer_base* __timer) noexcept
+  {
+    switch (__timer->__state_)
+    {
+      case __timer_state::__submitted:
+        __timer->__state_ = __timer_state::__cancelled;
+        break;
+      case __timer_state::__waiting:
+        __wheel_.__remove(__timer);
+        __timer->__unregister_(__timer);
+        __timer->__complete_(__timer, true);
+        break;
+      case __timer_state::__expired:
+        __timer->__complete_(__timer, true);
+        break;
+      case __timer_state::__cancelled:
+        _CCCL_UNREACHABLE();
+    }
+  }
+
+  // Completes a timer that has left the wheel, unless a cancellation is in flight.
+  _CCCL_HOST_API void __retire(__timer_base* __timer, bool __stopped) noexcept
+  {
+    // This waits for a stop callback that is running on another thread to return, after which
+    // its cancellation is in the queue.
+    __timer->__unregister_(__timer);
+    if (__timer->__stop_requested_.load(::cuda::std::memory_order_acquire))
+    {
+      __timer->__state_ = __timer_state::__expired;
+    }
+    else
+    {
+      __timer->__complete_(__timer, __stopped);
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static auto __deadline_of(time_point __time_point) noexcept -> time_point
+  {
+    return __time_point;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static auto __deadline_of(duration __duration) noexcept -> time_point
+  {
+    const time_point __now = clock::now();
+    return __duration < time_point::max() - __now ? __now + __duration : time_point::max();
+  }
+
+  // Returns the first tick at or after __deadline.
+  [[nodiscard]] _CCCL_HOST_API auto __expiry_of(time_point __deadline) const noexcept -> __tick_t
+  {
+    if (__deadline <= __start_)
+    {
+      return 0;
+    }
+    const duration __elapsed = __deadline - __start_;
+    const auto __ticks       = static_cast<__tick_t>(__elapsed / __resolution_);
+    if (__ticks >= __detail::__timer_wheel::__max_tick)
+    {
+      return __detail::__timer_wheel::__max_tick;
+    }
+    return __ticks + (__elapsed % __resolution_ != duration::zero());
+  }
+
+  // The last tick whose point in time can be represented.
+  [[nodiscard]] _CCCL_HOST_API auto __max_wait_tick() const noexcept -> __tick_t
+  {
+    return static_cast<__tick_t>((time_point::max() - __start_) / __resolution_);
+  }
+
+  const time_point __start_;
+  const duration __resolution_;
+  ::cuda::std::atomic<bool> __finishing_{false};
+  ::cuda::std::atomic<bool> __sleeping_{false};
+  __atomic_intrusive_queue<&__task::__next_> __queue_{};
+  ::std::mutex __mtx_;
+  ::std::condition_variable __cv_;
+  __detail::__timer_wheel __wheel_;
+};
+
+_CCCL_HOST_API inline auto timed_run_loop::__attrs_t::query(get_completion_scheduler_t<set_value_t>) const noexcept
+{
+  return scheduler{__loop_};
+}
+
+_CCCL_HOST_API inline auto timed_run_loop::__attrs_t::query(get_completion_scheduler_t<set_stopped_t>) const noexcept
+{
+  return scheduler{__loop_};
+}
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_TIMED_RUN_LOOP
@@ -30,6 +30,12 @@
 #include <cuda/experimental/__stf/internal/backend_ctx.cuh>
 #include <cuda/experimental/__stf/utility/pretty_print.cuh>
 
+#include <cuda/std/__bit/countr.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
 namespace cuda::experimental::stf
 {
 namespace reserved
@@ -40,6 +46,9 @@ namespace reserved
  * It does not manipulate memory at all, but returns offsets within some memory space of size "size"
  *
  * We (currently) assume that the size is a power of 2
+ *
+ * Each level keeps its available blocks indexed by location, and a bitmap records which levels have available
+ * blocks, so allocating and deallocating only cost O(levels) regardless of the number of blocks.
  */
 class buddy_allocator_metadata
 {
@@ -59,6 +68,80 @@ private:
     event_list prereqs; // dependencies to use that block
   };
 
+  /**
+   * @brief Available blocks of one level
+   *
+   * Blocks are stored contiguously and the most recently freed block is reused first. The position of every block is
+   * hashed by its location, so that the buddy of a deallocated block is found and removed in constant time.
+   */
+  class free_list
+  {
+  public:
+    bool empty() const
+    {
+      return blocks_.empty();
+    }
+
+    void push(size_t index, event_list prereqs)
+    {
+      positions_.emplace(index, blocks_.size());
+      blocks_.emplace_back(index, mv(prereqs));
+    }
+
+    avail_block pop()
+    {
+      _CCCL_ASSERT(!blocks_.empty(), "no block available at this level");
+      avail_block b = mv(blocks_.back());
+      blocks_.pop_back();
+      positions_.erase(b.index);
+      return b;
+    }
+
+    // Removes the block at location `index` if it is available, and adds its dependencies to `prereqs`
+    bool take(size_t index, event_list& prereqs)
+    {
+      auto it = positions_.find(index);
+      if (it == positions_.end())
+      {
+        return false;
+      }
+
+      const size_t pos = it->second;
+      positions_.erase(it);
+      prereqs.merge(mv(blocks_[pos].prereqs));
+
+      // Fill the hole with the last block
+      if (pos + 1 != blocks_.size())
+      {
+        blocks_[pos]                   = mv(blocks_.back());
+        positions_[blocks_[pos].index] = pos;
+      }
+      blocks_.pop_back();
+      return true;
+    }
+
+    auto begin()
+    {
+      return blocks_.begin();
+    }
+    auto end()
+    {
+      return blocks_.end();
+    }
+    auto begin() const
+    {
+      return blocks_.begin();
+    }
+    auto end() const
+    {
+      return blocks_.end();
+    }
+
+  private:
+    ::std::vector<avail_block> blocks_;
+    ::std::unordered_map<size_t, size_t> positions_;
+  };
+
 public:
   buddy_allocator_metadata(size_t size, event_list init_prereqs)
       : free_lists_(int_log2(next_power_of_two(size)) + 1)
@@ -66,7 +149,7 @@ public:
     _CCCL_ASSERT(size && (size & (size - 1)) == 0,
                  "Allocation requests for this allocator must pass a size that is a power of two.");
     // Initially, the whole memory is free, but depends on init_prereqs
-    free_lists_.back().emplace_back(0, mv(init_prereqs));
+    push_block(free_lists_.size() - 1, 0, mv(init_prereqs));
   }
 
   ::std::ptrdiff_t allocate(size_t size, event_list& prereqs)
@@ -101,25 +184,21 @@ public:
     while (level < max_level)
     {
       const size_t buddy_index = get_buddy_index(index, level);
-      auto& buddy_list         = free_lists_[level];
-      auto it = ::std::find_if(buddy_list.begin(), buddy_list.end(), [buddy_index](const avail_block& block) {
-        return block.index == buddy_index;
-      });
-
-      if (it == buddy_list.end())
+      if (!free_lists_[level].take(buddy_index, block_prereqs))
       {
         // No buddy available to merge, stop here
         break;
       }
-      // Merge with buddy
-      block_prereqs.merge(it->prereqs);
-
-      buddy_list.erase(it);
+      // Merged with buddy
+      if (free_lists_[level].empty())
+      {
+        nonempty_levels_ &= ~(size_t(1) << level);
+      }
       index = ::std::min(index, ::std::ptrdiff_t(buddy_index));
       level++;
     }
 
-    free_lists_[level].emplace_back(index, prereqs);
+    push_block(level, index, mv(block_prereqs));
   }
 
   void deinit(event_list& prereqs)
@@ -184,34 +263,40 @@ private:
     return log;
   }
 
+  void push_block(size_t level, size_t index, event_list prereqs)
+  {
+    free_lists_[level].push(index, mv(prereqs));
+    nonempty_levels_ |= size_t(1) << level;
+  }
+
   ::std::ptrdiff_t find_free_block(size_t level, event_list& prereqs)
   {
-    for (size_t current_level : each(level, free_lists_.size()))
+    // Levels at or above the requested one which have an available block
+    const size_t candidates = nonempty_levels_ & (~size_t(0) << level);
+    if (candidates == 0)
     {
-      if (free_lists_[current_level].empty())
-      {
-        continue;
-      }
-      auto& b              = free_lists_[current_level].back();
-      size_t block_index   = b.index;
-      event_list b_prereqs = mv(b.prereqs);
-      free_lists_[current_level].pop_back();
-
-      // Dependencies to reuse that block
-      prereqs.merge(b_prereqs);
+      return -1; // No block available
+    }
 
-      // If we are not at the requested level, split blocks
-      while (current_level > level)
-      {
-        current_level--;
-        size_t buddy_index = block_index + (1ull << current_level);
-        // split blocks depend on the previous dependencies of the whole unsplit block
-        free_lists_[current_level].emplace_back(buddy_index, b_prereqs);
-      }
-      return block_index;
+    size_t current_level = ::cuda::std::countr_zero(candidates);
+    avail_block b        = free_lists_[current_level].pop();
+    if (free_lists_[current_level].empty())
+    {
+      nonempty_levels_ &= ~(size_t(1) << current_level);
     }
 
-    return -1; // No block available
+    // Dependencies to reuse that block
+    prereqs.merge(b.prereqs);
+
+    // If we are not at the requested level, split blocks
+    while (current_level > level)
+    {
+      current_level--;
+      size_t buddy_index = b.index + (1ull << current_level);
+      // split blocks depend on the previous dependencies of the whole unsplit block
+      push_block(current_level, buddy_index, b.prereqs);
+    }
+    return b.index;
   }
 
   size_t get_buddy_index(size_t index, size_t level)
@@ -220,7 +305,10 @@ private:
     return index ^ (1ull << level); // XOR to find the buddy block
   }
 
-  ::std::vector<::std::vector<avail_block>> free_lists_;
+  ::std::vector<free_list> free_lists_;
+
+  // Bit i is set if free_lists_[i] is not empty
+  size_t nonempty_levels_ = 0;
 };
 } // end namespace reserved
 
@@ -361,5 +449,51 @@ UNITTEST("buddy allocator meta data")
   // allocator.debug_print();
 };
 
+UNITTEST("buddy allocator meta data coalescing")
+{
+  event_list prereqs;
+  reserved::buddy_allocator_metadata allocator(1024, prereqs);
+
+  event_list dummy;
+
+  // Fill the whole buffer with the smallest blocks, each location is used only once
+  ::std::vector<::std::ptrdiff_t> offsets;
+  for (size_t i = 0; i < 1024; i++)
+  {
+    offsets.push_back(allocator.allocate(1, dummy));
+  }
+  ::std::vector<::std::ptrdiff_t> sorted = offsets;
+  ::std::sort(sorted.begin(), sorted.end());
+  for (size_t i = 0; i < 1024; i++)
+  {
+    EXPECT(sorted[i] == ::std::ptrdiff_t(i));
+  }
+
+  // Free every other block first so that no buddy is available, then the rest
+  for (size_t i = 0; i < 1024; i += 2)
+  {
+    allocator.deallocate(offsets[i], 1, dummy);
+  }
+  for (size_t i = 1; i < 1024; i += 2)
+  {
+    allocator.deallocate(offsets[i], 1, dummy);
+  }
+
+  // All blocks were merged back into the whole buffer
+  EXPECT(allocator.allocate(1024, dummy) == 0);
+  allocator.deallocate(0, 1024, dummy);
+
+  // Blocks of different sizes coalesce too
+  ::std::ptrdiff_t a = allocator.allocate(256, dummy);
+  ::std::ptrdiff_t b = allocator.allocate(128, dummy);
+  ::std::ptrdiff_t c = allocator.allocate(512, dummy);
+  ::std::ptrdiff_t d = allocator.allocate(128, dummy);
+  allocator.deallocate(b, 128, dummy);
+  allocator.deallocate(c, 512, dummy);
+  allocator.deallocate(a, 256, dummy);
+  allocator.deallocate(d, 128, dummy);
+  EXPECT(allocator.allocate(1024, dummy) == 0);
+};
+
 #endif // UNITTESTED_FILE
 } // end namespace cuda::experimental::stf
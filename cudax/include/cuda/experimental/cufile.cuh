@@ -37,6 +37,8 @@
 #include <cuda/experimental/__cufile/driver.cuh>
 #include <cuda/experimental/__cufile/driver_attributes.cuh>
 #include <cuda/experimental/__cufile/exception.cuh>
+#include <cuda/experimental/__cufile/io.cuh>
 #include <cuda/experimental/__cufile/open_mode.cuh>
+#include <cuda/experimental/__cufile/posix_file.cuh>
 
 #endif // __CUDAX_CUFILE_CUH
@@ -16,10 +16,13 @@
 #include <cuda/experimental/__execution/bulk.cuh>
 #include <cuda/experimental/__execution/completion_behavior.cuh>
 #include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/concurrent_run_loop.cuh>
 #include <cuda/experimental/__execution/conditional.cuh>
 #include <cuda/experimental/__execution/continues_on.cuh>
+#include <cuda/experimental/__execution/counting_scope.cuh>
 #include <cuda/experimental/__execution/cpos.cuh>
 #include <cuda/experimental/__execution/domain.cuh>
+#include <cuda/experimental/__execution/ensure_started.cuh>
 #include <cuda/experimental/__execution/env.cuh>
 #include <cuda/experimental/__execution/get_completion_signatures.cuh>
 #include <cuda/experimental/__execution/inline_scheduler.cuh>
@@ -32,6 +35,10 @@
 #include <cuda/experimental/__execution/read_env.cuh>
 #include <cuda/experimental/__execution/run_loop.cuh>
 #include <cuda/experimental/__execution/sequence.cuh>
+#include <cuda/experimental/__execution/slab_allocator.cuh>
+#include <cuda/experimental/__execution/spawn.cuh>
+#include <cuda/experimental/__execution/spawn_future.cuh>
+#include <cuda/experimental/__execution/split.cuh>
 #include <cuda/experimental/__execution/start_detached.cuh>
 #include <cuda/experimental/__execution/starts_on.cuh>
 #include <cuda/experimental/__execution/stop_token.cuh>
@@ -40,6 +47,8 @@
 #include <cuda/experimental/__execution/task_scheduler.cuh>
 #include <cuda/experimental/__execution/then.cuh>
 #include <cuda/experimental/__execution/thread_context.cuh>
+#include <cuda/experimental/__execution/thread_pool.cuh>
+#include <cuda/experimental/__execution/timed_run_loop.cuh>
 #include <cuda/experimental/__execution/trampoline_scheduler.cuh>
 #include <cuda/experimental/__execution/transform_completion_signatures.cuh>
 #include <cuda/experimental/__execution/transform_sender.cuh>
@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 
 #include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
 #include <thrust/sequence.h>
 
 #include <cuda/std/cstddef>
@@ -18,6 +19,10 @@
 #include <cuda/experimental/__cuco/hyperloglog.cuh>
 #include <cuda/experimental/__cuco/hyperloglog_ref.cuh>
 
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
 #include <cooperative_groups.h>
 #include <testing.cuh>
 
@@ -244,3 +249,91 @@ C2H_TEST("Hyperloglog estimate works with pinned memory pool", "[hyperloglog]")
   REQUIRE(relative_error < tolerance_factor * relative_standard_deviation);
 }
 #endif // _CCCL_CTK_AT_LEAST(12, 6)
+
+C2H_TEST("HyperLogLog host add matches device add", "[hyperloglog]", test_types)
+{
+  using T              = c2h::get<0, TestType>;
+  using estimator_type = cudax::cuco::hyperloglog<T>;
+  using ref_type       = typename estimator_type::template ref_type<>;
+
+  const std::size_t num_items = GENERATE(0, 1000, 1 << 20);
+  const int hll_precision     = GENERATE(4, 12, 18);
+  const int num_threads       = GENERATE(1, 4);
+  const typename estimator_type::precision precision(hll_precision);
+
+  CAPTURE(num_items, hll_precision, num_threads);
+
+  thrust::host_vector<T> h_items(num_items);
+  thrust::sequence(h_items.begin(), h_items.end(), T{0});
+  thrust::device_vector<T> d_items = h_items;
+
+  estimator_type estimator{precision};
+  estimator.add(d_items.begin(), d_items.end());
+
+  std::vector<typename ref_type::register_type> host_sketch(ref_type::sketch_bytes(precision)
+                                                            / sizeof(typename ref_type::register_type));
+  ref_type host_ref{cuda::std::as_writable_bytes(cuda::std::span{host_sketch})};
+  host_ref.clear_host();
+  REQUIRE(host_ref.estimate_host() == 0);
+
+  host_ref.add_host(h_items.begin(), h_items.end(), num_threads);
+
+  // The device sketch serialized to the host must match the host sketch bit for bit
+  std::vector<cuda::std::byte> device_bytes(estimator.sketch_bytes());
+  estimator.serialize(cuda::std::span{device_bytes});
+  std::vector<cuda::std::byte> host_bytes(host_ref.sketch_bytes());
+  host_ref.serialize_host(cuda::std::span{host_bytes});
+  REQUIRE(device_bytes == host_bytes);
+
+  REQUIRE(host_ref.estimate_host() == estimator.estimate());
+}
+
+C2H_TEST("HyperLogLog host merge and deserialization", "[hyperloglog]")
+{
+  using T              = int;
+  using estimator_type = cudax::cuco::hyperloglog<T>;
+  using ref_type       = typename estimator_type::template ref_type<>;
+  using register_type  = typename ref_type::register_type;
+
+  const estimator_type::precision precision(12);
+  const std::size_t num_items = 1 << 20;
+  const std::size_t num_regs  = ref_type::sketch_bytes(precision) / sizeof(register_type);
+
+  thrust::host_vector<T> h_items(num_items);
+  thrust::sequence(h_items.begin(), h_items.end(), T{0});
+  thrust::device_vector<T> d_items = h_items;
+
+  // The first half of the items is counted on the host, the second half on the device
+  std::vector<register_type> host_sketch(num_regs, 0);
+  ref_type host_ref{cuda::std::as_writable_bytes(cuda::std::span{host_sketch})};
+  host_ref.add_host(h_items.begin(), h_items.begin() + num_items / 2);
+
+  estimator_type estimator{precision};
+  estimator.add(d_items.begin() + num_items / 2, d_items.end());
+
+  std::vector<cuda::std::byte> device_bytes(estimator.sketch_bytes());
+  estimator.serialize(cuda::std::span{device_bytes});
+
+  std::vector<register_type> merged_sketch(num_regs, 0);
+  ref_type merged_ref{cuda::std::as_writable_bytes(cuda::std::span{merged_sketch})};
+  merged_ref.deserialize_host(cuda::std::span{device_bytes});
+  merged_ref.merge_host(host_ref);
+
+  // Merging on the host must produce the same sketch as counting all items on the device
+  estimator.add(d_items.begin(), d_items.begin() + num_items / 2);
+  REQUIRE(merged_ref.estimate_host() == estimator.estimate());
+
+  // A host sketch can be loaded into a device estimator
+  std::vector<cuda::std::byte> merged_bytes(merged_ref.sketch_bytes());
+  merged_ref.serialize_host(cuda::std::span{merged_bytes});
+  estimator_type loaded{precision};
+  loaded.deserialize(cuda::std::span{merged_bytes});
+  REQUIRE(loaded.estimate() == merged_ref.estimate_host());
+
+  // Mismatching sizes and out of range registers are rejected
+  REQUIRE_THROWS_AS(loaded.deserialize(cuda::std::span{merged_bytes}.first(merged_bytes.size() / 2)),
+                    std::invalid_argument);
+  const register_type invalid_register = 64;
+  std::memcpy(merged_bytes.data(), &invalid_register, sizeof(register_type));
+  REQUIRE_THROWS_AS(merged_ref.deserialize_host(cuda::std::span{merged_bytes}), std::invalid_argument);
+}
@@ -0,0 +1,292 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/cstddef>
+#include <cuda/std/span>
+#include <cuda/std/type_traits>
+
+#include <cuda/experimental/cufile.cuh>
+#include <cuda/experimental/execution.cuh>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <testing.cuh>
+
+#include "common.h"
+
+namespace ex = cuda::experimental::execution;
+
+namespace
+{
+std::vector<cuda::std::byte> make_pattern(std::size_t size, int seed)
+{
+  std::vector<cuda::std::byte> data(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    data[i] = static_cast<cuda::std::byte>((i * 31 + seed) & 0xff);
+  }
+  return data;
+}
+} // namespace
+
+C2H_CCCLRT_TEST("cuFile read and write", "[cufile][io]")
+{
+  constexpr auto filename = "cufile_io_test_file";
+
+  ex::thread_pool pool{4};
+  auto sched = pool.get_scheduler();
+
+  const auto data = make_pattern(1 << 20, 1);
+
+  // 1. Test write and read of host memory.
+  {
+    cudax::cufile file{filename, cudax::cufile_open_mode::in | cudax::cufile_open_mode::out};
+
+    auto [written] = ex::sync_wait(file.write(sched, cuda::std::span{data}, 0)).value();
+    CUDAX_REQUIRE(written == data.size());
+
+    std::vector<cuda::std::byte> out(data.size());
+    auto [read] = ex::sync_wait(file.read(sched, cuda::std::span{out}, 0)).value();
+    CUDAX_REQUIRE(read == data.size());
+    CUDAX_REQUIRE(out == data);
+
+    // Reading past the end of the file stops at the end of the file.
+    std::vector<cuda::std::byte> tail(4096);
+    auto [tail_read] = ex::sync_wait(file.read(sched, cuda::std::span{tail}, data.size() - 100)).value();
+    CUDAX_REQUIRE(tail_read == 100);
+    CUDAX_REQUIRE(std::equal(tail.begin(), tail.begin() + 100, data.end() - 100));
+
+    // Empty transfers do nothing.
+    auto [empty] = ex::sync_wait(file.read(sched, cuda::std::span<cuda::std::byte>{}, 0)).value();
+    CUDAX_REQUIRE(empty == 0);
+  }
+  test_remove_file(filename);
+
+  // 2. Test batched write and read of host memory.
+  {
+    cudax::cufile file{filename, cudax::cufile_open_mode::in | cudax::cufile_open_mode::out};
+
+    constexpr std::size_t num_chunks = 16;
+    const std::size_t chunk_size     = data.size() / num_chunks;
+
+    std::vector<cudax::cufile_write_request> writes;
+    for (std::size_t i = 0; i < num_chunks; ++i)
+    {
+      writes.push_back(
+        {cuda::std::span{data}.subspan(i * chunk_size, chunk_size), static_cast<::off_t>(i * chunk_size)});
+    }
+    auto [written] = ex::sync_wait(file.batch_write(sched, cuda::std::span{writes})).value();
+    CUDAX_REQUIRE(written == std::vector<std::size_t>(num_chunks, chunk_size));
+
+    // Read the chunks back in reverse order.
+    std::vector<cuda::std::byte> out(data.size());
+    std::vector<cudax::cufile_read_request> reads;
+    for (std::size_t i = 0; i < num_chunks; ++i)
+    {
+      const std::size_t chunk = num_chunks - 1 - i;
+      reads.push_back(
+        {cuda::std::span{out}.subspan(chunk * chunk_size, chunk_size), static_cast<::off_t>(chunk * chunk_size)});
+    }
+    auto [read] = ex::sync_wait(file.batch_read(sched, cuda::std::span{reads})).value();
+    CUDAX_REQUIRE(read == std::vector<std::size_t>(num_chunks, chunk_size));
+    CUDAX_REQUIRE(out == data);
+
+    // An empty batch completes immediately.
+    auto [none] = ex::sync_wait(file.batch_read(sched, cuda::std::span<const cudax::cufile_read_request>{})).value();
+    CUDAX_REQUIRE(none.empty());
+  }
+  test_remove_file(filename);
+
+  // 3. Test write and read of device memory.
+  {
+    cudax::cufile file{filename, cudax::cufile_open_mode::in | cudax::cufile_open_mode::out};
+
+    cuda::std::byte* device_data{};
+    CUDAX_REQUIRE(cudaMalloc(&device_data, data.size()) == cudaSuccess);
+    CUDAX_REQUIRE(cudaMemcpy(device_data, data.data(), data.size(), cudaMemcpyHostToDevice) == cudaSuccess);
+
+    auto [written] = ex::sync_wait(file.write(sched, cuda::std::span{device_data, data.size()}, 0)).value();
+    CUDAX_REQUIRE(written == data.size());
+
+    // Data written from device memory can be read into host memory and vice versa.
+    std::vector<cuda::std::byte> out(data.size());
+    auto [read] = ex::sync_wait(file.read(sched, cuda::std::span{out}, 0)).value();
+    CUDAX_REQUIRE(read == data.size());
+    CUDAX_REQUIRE(out == data);
+
+    CUDAX_REQUIRE(cudaMemset(device_data, 0, data.size()) == cudaSuccess);
+    const std::size_t half = data.size() / 2;
+    const cudax::cufile_read_request reads[] = {
+      {cuda::std::span{device_data, half}, 0}, {cuda::std::span{device_data + half, half}, static_cast<::off_t>(half)}};
+    auto [batch_read] = ex::sync_wait(file.batch_read(sched, cuda::std::span{reads})).value();
+    CUDAX_REQUIRE(batch_read == std::vector<std::size_t>{half, half});
+
+    std::fill(out.begin(), out.end(), cuda::std::byte{0});
+    CUDAX_REQUIRE(cudaMemcpy(out.data(), device_data, data.size(), cudaMemcpyDeviceToHost) == cudaSuccess);
+    CUDAX_REQUIRE(out == data);
+
+    CUDAX_REQUIRE(cudaFree(device_data) == cudaSuccess);
+  }
+  test_remove_file(filename);
+
+  // 4. Test that errors are reported through the error channel.
+  {
+    {
+      cudax::cufile file{filename, cudax::cufile_open_mode::out};
+    }
+    cudax::cufile file{filename, cudax::cufile_open_mode::in};
+
+    REQUIRE_THROWS_AS(ex::sync_wait(file.write(sched, cuda::std::span{data}, 0)), std::runtime_error);
+
+    const cudax::cufile_write_request writes[] = {{cuda::std::span{data}, 0}};
+    REQUIRE_THROWS_AS(ex::sync_wait(file.batch_write(sched, cuda::std::span{writes})), std::runtime_error);
+  }
+  test_remove_file(filename);
+
+  // 5. Test that the queue depth limits the number of transfers in flight.
+  {
+    cudax::cufile file{filename, cudax::cufile_open_mode::in | cudax::cufile_open_mode::out};
+
+    constexpr std::size_t num_chunks = 10;
+    const std::size_t chunk_size     = data.size() / num_chunks;
+
+    std::vector<cudax::cufile_write_request> writes;
+    for (std::size_t i = 0; i < num_chunks; ++i)
+    {
+      writes.push_back(
+        {cuda::std::span{data}.subspan(i * chunk_size, chunk_size), static_cast<::off_t>(i * chunk_size)});
+    }
+    auto [written] = ex::sync_wait(file.batch_write(sched, cuda::std::span{writes}, 3)).value();
+    CUDAX_REQUIRE(written == std::vector<std::size_t>(num_chunks, chunk_size));
+
+    std::vector<cuda::std::byte> out(num_chunks * chunk_size);
+    std::vector<cudax::cufile_read_request> reads;
+    for (std::size_t i = 0; i < num_chunks; ++i)
+    {
+      reads.push_back(
+        {cuda::std::span{out}.subspan(i * chunk_size, chunk_size), static_cast<::off_t>(i * chunk_size)});
+    }
+    auto [read] = ex::sync_wait(file.batch_read(sched, cuda::std::span{reads}, 1)).value();
+    CUDAX_REQUIRE(read == std::vector<std::size_t>(num_chunks, chunk_size));
+    CUDAX_REQUIRE(std::equal(out.begin(), out.end(), data.begin()));
+  }
+  test_remove_file(filename);
+}
+
+C2H_TEST("posix_file read and write", "[cufile][io]")
+{
+  constexpr auto filename = "posix_file_io_test_file";
+
+  ex::thread_pool pool{4};
+  auto sched = pool.get_scheduler();
+
+  const auto data = make_pattern(1 << 20, 2);
+
+  // 1. Test posix_file types and properties.
+  STATIC_REQUIRE(cuda::std::is_same_v<cudax::posix_file::off_type, ::off_t>);
+  STATIC_REQUIRE(cuda::std::is_same_v<cudax::posix_file::native_handle_type, int>);
+  STATIC_REQUIRE(cuda::std::is_nothrow_default_constructible_v<cudax::posix_file>);
+  STATIC_REQUIRE(!cuda::std::is_copy_constructible_v<cudax::posix_file>);
+  STATIC_REQUIRE(cuda::std::is_nothrow_move_constructible_v<cudax::posix_file>);
+  {
+    cudax::posix_file file;
+    CUDAX_REQUIRE(!file.is_open());
+    CUDAX_REQUIRE(file.native_handle() == -1);
+  }
+
+  // 2. Test write and read without the cuFile driver.
+  {
+    cudax::posix_file file{filename, cudax::cufile_open_mode::in | cudax::cufile_open_mode::out};
+    CUDAX_REQUIRE(file.is_open());
+    test_check_fd_is_valid(file.native_handle());
+    CUDAX_REQUIRE(file.open_mode() == (cudax::cufile_open_mode::in | cudax::cufile_open_mode::out));
+
+    auto [written] = ex::sync_wait(file.write(sched, cuda::std::span{data}, 0)).value();
+    CUDAX_REQUIRE(written == data.size());
+
+    std::vector<cuda::std::byte> out(data.size());
+    auto [read] = ex::sync_wait(file.read(sched, cuda::std::span{out}, 0)).value();
+    CUDAX_REQUIRE(read == data.size());
+    CUDAX_REQUIRE(out == data);
+  }
+  test_remove_file(filename);
+
+  // 3. Test batched write and read with a limited queue depth.
+  {
+    cudax::posix_file file{filename, cudax::cufile_open_mode::in | cudax::cufile_open_mode::out};
+
+    constexpr std::size_t num_chunks = 16;
+    const std::size_t chunk_size     = data.size() / num_chunks;
+
+    std::vector<cudax::cufile_write_request> writes;
+    std::vector<cuda::std::byte> out(data.size());
+    std::vector<cudax::cufile_read_request> reads;
+    for (std::size_t i = 0; i < num_chunks; ++i)
+    {
+      writes.push_back(
+        {cuda::std::span{data}.subspan(i * chunk_size, chunk_size), static_cast<::off_t>(i * chunk_size)});
+      reads.push_back(
+        {cuda::std::span{out}.subspan(i * chunk_size, chunk_size), static_cast<::off_t>(i * chunk_size)});
+    }
+
+    auto [written] = ex::sync_wait(file.batch_write(sched, cuda::std::span{writes}, 4)).value();
+    CUDAX_REQUIRE(written == std::vector<std::size_t>(num_chunks, chunk_size));
+
+    auto [read] = ex::sync_wait(file.batch_read(sched, cuda::std::span{reads}, 3)).value();
+    CUDAX_REQUIRE(read == std::vector<std::size_t>(num_chunks, chunk_size));
+    CUDAX_REQUIRE(out == data);
+  }
+  test_remove_file(filename);
+
+  // 4. Test from_native_handle and release.
+  {
+    cudax::posix_file file{filename, cudax::cufile_open_mode::out};
+    const int fd = file.release();
+    CUDAX_REQUIRE(!file.is_open());
+    test_check_fd_is_valid(fd);
+
+    cudax::posix_file other = cudax::posix_file::from_native_handle(fd);
+    CUDAX_REQUIRE(other.native_handle() == fd);
+    other.close();
+    CUDAX_REQUIRE(!other.is_open());
+  }
+  test_remove_file(filename);
+
+  // 5. Test that errors carry errno and its description.
+  {
+    {
+      cudax::posix_file file{filename, cudax::cufile_open_mode::out};
+    }
+    cudax::posix_file file{filename, cudax::cufile_open_mode::in};
+
+    try
+    {
+      ex::sync_wait(file.write(sched, cuda::std::span{data}, 0));
+      FAIL("write to a read-only file did not throw");
+    }
+    catch (const std::system_error& e)
+    {
+      CUDAX_REQUIRE(e.code() == std::errc::bad_file_descriptor);
+      const std::string what = e.what();
+      CUDAX_REQUIRE(what.find("pwrite") != std::string::npos);
+      CUDAX_REQUIRE(what.find(std::strerror(EBADF)) != std::string::npos);
+    }
+    CUDAX_REQUIRE(errno == 0);
+
+    CHECK_THROWS_AS(cudax::posix_file("posix_file_io_missing_file", cudax::cufile_open_mode::in), std::system_error);
+  }
+  test_remove_file(filename);
+}
@@ -0,0 +1,203 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/atomic>
+
+#include <cuda/experimental/execution.cuh>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "common/utility.cuh" // IWYU pragma: keep
+
+namespace ex = cuda::experimental::execution;
+
+namespace
+{
+// Drives a concurrent_run_loop with several threads for the lifetime of the object
+struct loop_threads
+{
+  explicit loop_threads(unsigned count)
+      : loop{count}
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      thrds.emplace_back([this] {
+        loop.run();
+      });
+    }
+  }
+
+  ~loop_threads()
+  {
+    loop.finish();
+    for (auto& thrd : thrds)
+    {
+      thrd.join();
+    }
+  }
+
+  ex::concurrent_run_loop loop;
+  std::vector<std::thread> thrds;
+};
+
+C2H_TEST("concurrent_run_loop is a scheduler", "[scheduler][concurrent_run_loop]")
+{
+  loop_threads thrds{2};
+  auto sched = thrds.loop.get_scheduler();
+  STATIC_CHECK(ex::scheduler<decltype(sched)>);
+  CHECK(ex::get_forward_progress_guarantee(sched) == ex::forward_progress_guarantee::parallel);
+  CHECK(sched == thrds.loop.get_scheduler());
+  CHECK(ex::get_completion_scheduler<ex::set_value_t>(ex::get_env(ex::schedule(sched))) == sched);
+
+  auto [id] = ex::sync_wait(ex::schedule(sched) | ex::then([] {
+                              return std::this_thread::get_id();
+                            }))
+                .value();
+  CHECK(id != std::this_thread::get_id());
+}
+
+C2H_TEST("concurrent_run_loop spreads work over the threads that run it", "[scheduler][concurrent_run_loop]")
+{
+  constexpr int num_tasks = 64;
+  loop_threads thrds{4};
+  auto sched = thrds.loop.get_scheduler();
+  ex::counting_scope scope;
+  cuda::std::atomic<int> count{0};
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::set<std::thread::id> ids;
+
+  // Every task blocks the thread that runs it until a second thread has picked up a task, so the work can only
+  // complete if it is shared between the threads. The timeout turns a failure into a failed check instead of a hang.
+  for (int i = 0; i < num_tasks; ++i)
+  {
+    ex::spawn(ex::schedule(sched) | ex::then([&] {
+                {
+                  std::unique_lock<std::mutex> lock{mtx};
+                  ids.insert(std::this_thread::get_id());
+                  cv.notify_all();
+                  cv.wait_for(lock, std::chrono::seconds{10}, [&] {
+                    return ids.size() >= 2;
+                  });
+                }
+                ++count;
+              }),
+              scope.get_token());
+  }
+  ex::sync_wait(scope.join());
+  CHECK(count.load() == num_tasks);
+  CHECK(ids.size() >= 2);
+  CHECK(ids.size() <= 4);
+  CHECK(ids.count(std::this_thread::get_id()) == 0);
+}
+
+C2H_TEST("concurrent_run_loop runs work from one thread in order", "[scheduler][concurrent_run_loop]")
+{
+  // With a single thread and a single segment, the work runs in the order it was scheduled.
+  ex::concurrent_run_loop loop{1};
+  auto sched = loop.get_scheduler();
+  ex::counting_scope scope;
+  std::vector<int> order;
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    ex::spawn(ex::schedule(sched) | ex::then([&order, i] {
+                order.push_back(i);
+              }),
+              scope.get_token());
+  }
+
+  std::thread thrd{[&] {
+    loop.run();
+  }};
+  ex::sync_wait(scope.join());
+  loop.finish();
+  thrd.join();
+
+  REQUIRE(order.size() == 1000);
+  for (int i = 0; i < 1000; ++i)
+  {
+    CHECK(order[i] == i);
+  }
+}
+
+C2H_TEST("concurrent_run_loop runs work that is scheduled from its own threads", "[scheduler][concurrent_run_loop]")
+{
+  loop_threads thrds{4};
+  auto sched = thrds.loop.get_scheduler();
+  ex::counting_scope scope;
+  cuda::std::atomic<int> count{0};
+
+  // Every task schedules more tasks on the loop, which go to the segment of the thread that
+  // runs it and are stolen by the other threads.
+  for (int i = 0; i < 16; ++i)
+  {
+    ex::spawn(ex::schedule(sched) | ex::then([&] {
+                for (int j = 0; j < 100; ++j)
+                {
+                  ex::spawn(ex::schedule(sched) | ex::then([&] {
+                              ++count;
+                            }),
+                            scope.get_token());
+                }
+              }),
+              scope.get_token());
+  }
+  ex::sync_wait(scope.join());
+  CHECK(count.load() == 1600);
+}
+
+C2H_TEST("concurrent_run_loop drains its work when it finishes", "[scheduler][concurrent_run_loop]")
+{
+  ex::concurrent_run_loop loop{2};
+  auto sched = loop.get_scheduler();
+  ex::counting_scope scope;
+  cuda::std::atomic<int> count{0};
+
+  for (int i = 0; i < 100; ++i)
+  {
+    ex::spawn(ex::schedule(sched) | ex::then([&] {
+                ++count;
+              }),
+              scope.get_token());
+  }
+  loop.finish();
+
+  std::thread thrd{[&] {
+    loop.run();
+  }};
+  loop.run();
+  thrd.join();
+  CHECK(count.load() == 100);
+  ex::sync_wait(scope.join());
+}
+
+C2H_TEST("concurrent_run_loop wakes sleeping threads", "[scheduler][concurrent_run_loop]")
+{
+  loop_threads thrds{2};
+  auto sched = thrds.loop.get_scheduler();
+
+  // Give the threads time to run out of spins and go to sleep between the tasks.
+  for (int i = 0; i < 5; ++i)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    auto [res] = ex::sync_wait(ex::schedule(sched) | ex::then([] {
+                                 return 42;
+                               }))
+                   .value();
+    CHECK(res == 42);
+  }
+}
+} // namespace
@@ -0,0 +1,281 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/atomic>
+
+#include <cuda/experimental/execution.cuh>
+
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "common/utility.cuh" // IWYU pragma: keep
+
+namespace ex = cuda::experimental::execution;
+
+namespace
+{
+//! An allocator that counts the allocations and deallocations made through it and all of its rebound copies.
+template <class T>
+struct counting_allocator
+{
+  using value_type = T;
+
+  counting_allocator(cuda::std::atomic<int>& allocated, cuda::std::atomic<int>& deallocated) noexcept
+      : allocated{&allocated}
+      , deallocated{&deallocated}
+  {}
+
+  template <class U>
+  counting_allocator(const counting_allocator<U>& other) noexcept
+      : allocated{other.allocated}
+      , deallocated{other.deallocated}
+  {}
+
+  T* allocate(size_t n)
+  {
+    ++*allocated;
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* p, size_t n) noexcept
+  {
+    ++*deallocated;
+    std::allocator<T>{}.deallocate(p, n);
+  }
+
+  friend bool operator==(const counting_allocator& lhs, const counting_allocator& rhs) noexcept
+  {
+    return lhs.allocated == rhs.allocated;
+  }
+
+  friend bool operator!=(const counting_allocator& lhs, const counting_allocator& rhs) noexcept
+  {
+    return lhs.allocated != rhs.allocated;
+  }
+
+  cuda::std::atomic<int>* allocated;
+  cuda::std::atomic<int>* deallocated;
+};
+
+C2H_TEST("counting_scope join completes once all spawned work is done", "[counting_scope][spawn]")
+{
+  ex::thread_pool pool{4};
+  ex::counting_scope scope;
+  cuda::std::atomic<int> count{0};
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    ex::spawn(ex::starts_on(pool.get_scheduler(), ex::just() | ex::then([&] {
+                                                    ++count;
+                                                  })),
+              scope.get_token());
+  }
+  ex::sync_wait(scope.join());
+  CHECK(count.load() == 1000);
+}
+
+C2H_TEST("counting_scope join of an empty scope completes inline", "[counting_scope]")
+{
+  ex::counting_scope scope;
+  auto res = ex::sync_wait(scope.join());
+  CHECK(res.has_value());
+}
+
+C2H_TEST("spawn_future returns the result of the spawned sender", "[counting_scope][spawn_future]")
+{
+  ex::thread_pool pool{2};
+  ex::counting_scope scope;
+
+  auto sndr   = ex::just(20) | ex::then([](int i) {
+                return std::make_pair(i + 22, std::this_thread::get_id());
+              });
+  auto future = ex::spawn_future(ex::starts_on(pool.get_scheduler(), std::move(sndr)), scope.get_token());
+  auto [res]  = ex::sync_wait(std::move(future)).value();
+  CHECK(res.first == 42);
+  CHECK(res.second != std::this_thread::get_id());
+  ex::sync_wait(scope.join());
+}
+
+C2H_TEST("dropping a spawn_future does not leak the operation", "[counting_scope][spawn_future]")
+{
+  ex::thread_pool pool{1};
+  ex::counting_scope scope;
+  cuda::std::atomic<int> completed{0};
+  cuda::std::atomic<int> stopped{0};
+  cuda::std::atomic<int> allocated{0};
+  cuda::std::atomic<int> deallocated{0};
+
+  // Keep the only worker busy until all futures have been spawned and half of them have been dropped, so that the
+  // stop request of every dropped future arrives before its operation is started.
+  std::promise<void> blocked;
+  std::promise<void> release;
+  ex::spawn(ex::starts_on(pool.get_scheduler(), ex::just() | ex::then([&, wait = release.get_future().share()] {
+                                                  blocked.set_value();
+                                                  wait.wait();
+                                                })),
+            scope.get_token());
+  blocked.get_future().wait();
+
+  auto env         = ex::prop{ex::get_allocator, counting_allocator<cuda::std::byte>{allocated, deallocated}};
+  auto make_future = [&] {
+    return ex::spawn_future(ex::starts_on(pool.get_scheduler(), ex::just() | ex::then([&] {
+                                            ++completed;
+                                          }))
+                              | ex::upon_stopped([&] {
+                                  ++stopped;
+                                }),
+                            scope.get_token(),
+                            env);
+  };
+
+  std::vector<decltype(make_future())> futures;
+  futures.reserve(50);
+  for (int i = 0; i < 100; ++i)
+  {
+    auto future = make_future();
+    if (i % 2 == 0)
+    {
+      futures.push_back(std::move(future));
+    }
+  }
+  CHECK(allocated.load() == 100);
+  release.set_value();
+
+  for (auto& future : futures)
+  {
+    CHECK(ex::sync_wait(std::move(future)).has_value());
+  }
+  ex::sync_wait(scope.join());
+  CHECK(completed.load() == 50);
+  CHECK(stopped.load() == 50);
+  CHECK(deallocated.load() == 100);
+}
+
+C2H_TEST("a closed counting_scope rejects new work", "[counting_scope][spawn][spawn_future]")
+{
+  ex::counting_scope scope;
+  scope.close();
+
+  bool called = false;
+  ex::spawn(ex::just() | ex::then([&] {
+              called = true;
+            }),
+            scope.get_token());
+  CHECK(!called);
+
+  auto res = ex::sync_wait(ex::spawn_future(ex::just(42), scope.get_token()));
+  CHECK(!res.has_value());
+  ex::sync_wait(scope.join());
+}
+
+C2H_TEST("counting_scope request_stop stops the spawned work", "[counting_scope][spawn]")
+{
+  ex::counting_scope scope;
+  cuda::std::atomic<int> result{0};
+
+  ex::spawn(ex::read_env(ex::get_stop_token) | ex::then([&](ex::inplace_stop_token token) {
+              result = token.stop_possible() ? 1 : 2;
+            }),
+            scope.get_token());
+  CHECK(result.load() == 1);
+
+  scope.request_stop();
+  CHECK(scope.get_stop_token().stop_requested());
+
+  ex::spawn(ex::read_env(ex::get_stop_token) | ex::then([&](ex::inplace_stop_token token) {
+              result = token.stop_requested() ? 3 : 4;
+            }),
+            scope.get_token());
+  CHECK(result.load() == 3);
+  ex::sync_wait(scope.join());
+}
+
+C2H_TEST("spawn allocates its operation states from the environment's allocator", "[counting_scope][spawn]")
+{
+  ex::thread_pool pool{4};
+  ex::slab_pool slabs;
+  ex::counting_scope scope;
+  cuda::std::atomic<int> count{0};
+
+  auto env = ex::prop{ex::get_allocator, ex::slab_allocator<cuda::std::byte>{slabs}};
+  for (int i = 0; i < 1000; ++i)
+  {
+    ex::spawn(ex::starts_on(pool.get_scheduler(), ex::just() | ex::then([&] {
+                                                    ++count;
+                                                  })),
+              scope.get_token(),
+              env);
+  }
+  auto future = ex::spawn_future(ex::just(42), scope.get_token(), env);
+  auto [val]  = ex::sync_wait(std::move(future)).value();
+  CHECK(val == 42);
+
+  ex::sync_wait(scope.join());
+  CHECK(count.load() == 1000);
+}
+
+C2H_TEST("slab_pool recycles freed blocks", "[slab_allocator]")
+{
+  constexpr size_t slab_size  = 64 * 1024;
+  constexpr size_t block_size = 64;
+  constexpr size_t num_blocks = slab_size / block_size;
+
+  ex::slab_pool slabs{slab_size};
+  ex::slab_allocator<int> alloc{slabs};
+
+  // The blocks of a size class are carved from a slab in order, so the first slab's worth of 40 byte requests are
+  // adjacent 64 byte blocks of one contiguous range.
+  std::vector<int*> blocks;
+  for (size_t i = 0; i < num_blocks; ++i)
+  {
+    blocks.push_back(alloc.allocate(10));
+  }
+  const auto first = reinterpret_cast<std::uintptr_t>(blocks.front());
+  CHECK(first % block_size == 0);
+  for (size_t i = 0; i < num_blocks; ++i)
+  {
+    CHECK(reinterpret_cast<std::uintptr_t>(blocks[i]) == first + i * block_size);
+  }
+
+  // Freed blocks are handed out again before any new memory is carved.
+  for (int* p : blocks)
+  {
+    alloc.deallocate(p, 10);
+  }
+  std::vector<int*> reused;
+  for (size_t i = 0; i < num_blocks; ++i)
+  {
+    reused.push_back(alloc.allocate(10));
+  }
+  std::sort(blocks.begin(), blocks.end());
+  std::sort(reused.begin(), reused.end());
+  CHECK(reused == blocks);
+
+  // Once the slab is used up, the next block comes from a new slab.
+  const auto next = reinterpret_cast<std::uintptr_t>(alloc.allocate(10));
+  CHECK((next < first || next >= first + slab_size));
+  alloc.deallocate(reinterpret_cast<int*>(next), 10);
+  for (int* p : reused)
+  {
+    alloc.deallocate(p, 10);
+  }
+
+  // Requests larger than the largest size class are forwarded to operator new.
+  int* big = alloc.allocate(ex::slab_pool::max_block_size);
+  alloc.deallocate(big, ex::slab_pool::max_block_size);
+
+  CHECK(alloc == ex::slab_allocator<int>{slabs});
+}
+} // namespace
@@ -0,0 +1,149 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/atomic>
+
+#include <cuda/experimental/execution.cuh>
+
+#include <string>
+#include <utility>
+
+#include "common/checked_receiver.cuh"
+#include "common/impulse_scheduler.cuh"
+#include "common/utility.cuh" // IWYU pragma: keep
+
+namespace ex = cuda::experimental::execution;
+
+namespace
+{
+// A receiver with a stop token that records a stopped completion.
+struct stoppable_receiver
+{
+  using receiver_concept = ex::receiver_t;
+
+  template <class... As>
+  void set_value(As&&...) && noexcept
+  {
+    CUDAX_FAIL("expected a stopped completion; got a value");
+  }
+
+  template <class Error>
+  void set_error(Error&&) && noexcept
+  {
+    CUDAX_FAIL("expected a stopped completion; got an error");
+  }
+
+  void set_stopped() && noexcept
+  {
+    *stopped = true;
+  }
+
+  auto get_env() const noexcept
+  {
+    return ex::prop{ex::get_stop_token, source->get_token()};
+  }
+
+  ex::inplace_stop_source* source;
+  bool* stopped;
+};
+
+C2H_TEST("split runs the child sender once for all consumers", "[split]")
+{
+  int count = 0;
+  auto sndr = ex::just(std::string("hello")) | ex::then([&](std::string str) {
+                ++count;
+                return str + " world";
+              })
+            | ex::split();
+  CHECK(count == 0);
+
+  auto size = [](const std::string& str) {
+    return str.size();
+  };
+
+  auto copy     = sndr;
+  auto [first]  = ex::sync_wait(sndr).value();
+  auto [second] = ex::sync_wait(std::move(copy)).value();
+  auto [third]  = ex::sync_wait(sndr | ex::then(size)).value();
+  CHECK(count == 1);
+  CHECK(first == "hello world");
+  CHECK(second == "hello world");
+  CHECK(third == 11);
+}
+
+C2H_TEST("split sends the result to consumers on other threads", "[split]")
+{
+  ex::thread_pool pool{4};
+  cuda::std::atomic<int> count{0};
+  auto sndr = ex::starts_on(pool.get_scheduler(), ex::just(20) | ex::then([&](int i) {
+                                                     ++count;
+                                                     return i + 22;
+                                                   }))
+            | ex::split();
+
+  auto [a, b, c] = ex::sync_wait(ex::when_all(sndr, sndr, sndr)).value();
+  CHECK(count.load() == 1);
+  CHECK(a == 42);
+  CHECK(b == 42);
+  CHECK(c == 42);
+}
+
+C2H_TEST("a stopped split consumer does not stop the others", "[split]")
+{
+  impulse_scheduler sched;
+  auto sndr = ex::schedule(sched) | ex::then([] {
+                return 42;
+              })
+            | ex::split();
+
+  ex::inplace_stop_source source;
+  bool stopped = false;
+  auto op1     = ex::connect(sndr, stoppable_receiver{&source, &stopped});
+  auto op2     = ex::connect(sndr, checked_value_receiver{42});
+  ex::start(op1);
+  ex::start(op2);
+
+  source.request_stop();
+  CHECK(stopped);
+
+  sched.start_next();
+}
+
+C2H_TEST("ensure_started starts the child sender eagerly", "[ensure_started]")
+{
+  int count = 0;
+  auto sndr = ex::just(20) | ex::then([&](int i) {
+                ++count;
+                return i + 22;
+              })
+            | ex::ensure_started();
+  CHECK(count == 1);
+
+  auto [val] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(val == 42);
+  CHECK(count == 1);
+}
+
+C2H_TEST("dropping an ensure_started sender stops the child sender", "[ensure_started]")
+{
+  impulse_scheduler sched;
+  bool stopped = false;
+  {
+    [[maybe_unused]] auto sndr = ex::schedule(sched) | ex::upon_stopped([&] {
+                                   stopped = true;
+                                 })
+                               | ex::ensure_started();
+  }
+  CHECK(!stopped);
+
+  sched.start_next();
+  CHECK(stopped);
+}
+} // namespace
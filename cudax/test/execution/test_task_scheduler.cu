@@ -10,6 +10,8 @@
 
 #include <cuda/experimental/execution.cuh>
 
+#include <memory>
+
 #include "common/checked_receiver.cuh" // IWYU pragma: keep
 #include "common/dummy_scheduler.cuh" // IWYU pragma: keep
 #include "common/error_scheduler.cuh" // IWYU pragma: keep
@@ -91,4 +93,125 @@ C2H_TEST("bulk dispatches correctly through task_scheduler", "[scheduler][task_s
   CHECK(val == -1);
   CHECK(g_called);
 }
+
+// An allocator that counts how many times it is asked for memory
+template <class T>
+struct counting_allocator
+{
+  using value_type = T;
+
+  explicit counting_allocator(int* count) noexcept
+      : count(count)
+  {}
+
+  template <class U>
+  counting_allocator(const counting_allocator<U>& other) noexcept
+      : count(other.count)
+  {}
+
+  T* allocate(std::size_t n)
+  {
+    ++*count;
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept
+  {
+    std::allocator<T>{}.deallocate(p, n);
+  }
+
+  friend bool operator==(const counting_allocator& a, const counting_allocator& b) noexcept
+  {
+    return a.count == b.count;
+  }
+
+  friend bool operator!=(const counting_allocator& a, const counting_allocator& b) noexcept
+  {
+    return a.count != b.count;
+  }
+
+  int* count;
+};
+
+// A receiver that sets the inline storage size of task_scheduler operations
+template <std::size_t Bytes>
+struct storage_size_receiver
+{
+  using receiver_concept = ex::receiver_t;
+
+  void set_value() noexcept
+  {
+    *called = true;
+  }
+
+  void set_error(ex::exception_ptr) noexcept {}
+
+  void set_error(cudaError_t) noexcept {}
+
+  void set_stopped() noexcept {}
+
+  auto get_env() const noexcept
+  {
+    return ex::prop{ex::get_task_storage_size, ex::task_storage_size_t<Bytes>{}};
+  }
+
+  bool* called;
+};
+
+C2H_TEST("task_scheduler uses the inline storage size from the receiver's environment", "[scheduler][task_scheduler]")
+{
+  using sndr_t = decltype(cuda::std::declval<ex::task_scheduler>().schedule());
+  STATIC_CHECK(sizeof(ex::connect_result_t<sndr_t, storage_size_receiver<512>>) >= 512);
+
+  int count = 0;
+  ex::task_scheduler sched{dummy_scheduler{}, counting_allocator<cuda::std::byte>{&count}};
+  const int initial = count;
+
+  bool called = false;
+  {
+    auto op = ex::connect(sched.schedule(), storage_size_receiver<64>{&called});
+    ex::start(op);
+  }
+  CHECK(called);
+  CHECK(count == initial);
+
+  // The operation state of the underlying scheduler doesn't fit, so it is allocated.
+  called = false;
+  {
+    auto op = ex::connect(sched.schedule(), storage_size_receiver<1>{&called});
+    ex::start(op);
+  }
+  CHECK(called);
+  CHECK(count == initial + 1);
+}
+
+C2H_TEST("task_scheduler_ref schedules through the referenced task_scheduler", "[scheduler][task_scheduler]")
+{
+  ex::thread_context ctx;
+  ex::task_scheduler sched{ctx.get_scheduler()};
+  ex::task_scheduler_ref ref{sched};
+  STATIC_CHECK(ex::scheduler<decltype(ref)>);
+  CHECK(ref == sched);
+  CHECK(ref == ex::task_scheduler_ref{sched});
+
+  // A distinct task_scheduler has its own backend
+  ex::task_scheduler other{ctx.get_scheduler()};
+  CHECK(ref != other);
+
+  auto sndr  = ex::starts_on(ref, ex::just() | ex::then([] {
+                                   return ::std::this_thread::get_id();
+                                 }));
+  auto [tid] = ex::sync_wait(cuda::std::move(sndr)).value();
+  CHECK(tid == ctx.get_id());
+}
+
+C2H_TEST("bulk dispatches correctly through task_scheduler_ref", "[scheduler][task_scheduler]")
+{
+  ex::task_scheduler sched{dummy_scheduler<test_domain>{}};
+  auto sndr  = ex::on(ex::task_scheduler_ref{sched}, ex::just(-1) | ex::bulk(ex::par_unseq, 100, [](int, int&) {}));
+  g_called   = false;
+  auto [val] = ex::sync_wait(cuda::std::move(sndr)).value();
+  CHECK(val == -1);
+  CHECK(g_called);
+}
 } // namespace
@@ -0,0 +1,228 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/atomic>
+
+#include <cuda/experimental/execution.cuh>
+
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "common/utility.cuh" // IWYU pragma: keep
+
+namespace ex = cuda::experimental::execution;
+
+namespace
+{
+// Receiver with a stop token in its environment that records how it was completed
+struct stoppable_receiver
+{
+  using receiver_concept = ex::receiver_t;
+
+  void set_value() noexcept
+  {
+    complete(1);
+  }
+
+  void set_error(ex::exception_ptr) noexcept
+  {
+    complete(2);
+  }
+
+  void set_stopped() noexcept
+  {
+    complete(3);
+  }
+
+  void complete(int how) noexcept
+  {
+    result->store(how);
+    result->notify_all();
+  }
+
+  auto get_env() const noexcept
+  {
+    return ex::prop{ex::get_stop_token, token};
+  }
+
+  ex::inplace_stop_token token;
+  cuda::std::atomic<int>* result;
+};
+
+C2H_TEST("thread_pool runs work on its worker threads", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{2};
+  CHECK(pool.available_parallelism() == 2);
+
+  auto sched = pool.get_scheduler();
+  STATIC_CHECK(ex::scheduler<decltype(sched)>);
+  CHECK(ex::get_forward_progress_guarantee(sched) == ex::forward_progress_guarantee::parallel);
+  CHECK(sched == pool.get_scheduler());
+
+  auto sndr  = ex::starts_on(sched, ex::just(42) | ex::then([](int i) {
+                                      return std::make_pair(i, std::this_thread::get_id());
+                                    }));
+  auto [res] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(res.first == 42);
+  CHECK(res.second != std::this_thread::get_id());
+}
+
+C2H_TEST("thread_pool bulk_chunked covers the whole shape exactly once", "[scheduler][thread_pool]")
+{
+  for (unsigned num_threads : {1u, 3u, 8u})
+  {
+    ex::thread_pool pool{num_threads};
+    for (std::size_t shape : {std::size_t{1}, std::size_t{7}, std::size_t{1000}, std::size_t{12345}})
+    {
+      std::vector<int> hits(shape, 0);
+      auto sndr = ex::just(2) | ex::continues_on(pool.get_scheduler())
+                | ex::bulk_chunked(ex::par, shape, [&](std::size_t begin, std::size_t end, int inc) {
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                      hits[i] += inc;
+                    }
+                  });
+      auto [val] = ex::sync_wait(std::move(sndr)).value();
+      CHECK(val == 2);
+      for (int h : hits)
+      {
+        CHECK(h == 2);
+      }
+    }
+  }
+}
+
+C2H_TEST("thread_pool bulk_unchunked fans out across the workers", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{4};
+  std::mutex mtx;
+  std::set<std::thread::id> ids;
+  std::vector<int> hits(16, 0);
+
+  auto sndr = ex::just() | ex::continues_on(pool.get_scheduler())
+            | ex::bulk_unchunked(ex::par, hits.size(), [&](std::size_t i) {
+                // Keep the workers busy for long enough that the others get a share.
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                std::lock_guard<std::mutex> lock{mtx};
+                ids.insert(std::this_thread::get_id());
+                ++hits[i];
+              });
+  ex::sync_wait(std::move(sndr));
+
+  CHECK(ids.size() > 1);
+  for (int h : hits)
+  {
+    CHECK(h == 1);
+  }
+}
+
+C2H_TEST("thread_pool bulk with a sequenced policy runs every index once", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{4};
+  for (std::size_t shape : {std::size_t{1}, std::size_t{7}, std::size_t{1000}})
+  {
+    std::vector<int> hits(shape, 0);
+    int out_of_range = 0;
+
+    auto sndr = ex::just(3) | ex::continues_on(pool.get_scheduler())
+              | ex::bulk(ex::seq, shape, [&](std::size_t i, int inc) {
+                  (i < shape ? hits[i] : out_of_range) += inc;
+                });
+    auto [val] = ex::sync_wait(std::move(sndr)).value();
+    CHECK(val == 3);
+    CHECK(out_of_range == 0);
+    for (int h : hits)
+    {
+      CHECK(h == 3);
+    }
+  }
+}
+
+C2H_TEST("thread_pool bulk_unchunked with a sequenced policy runs every index once", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{4};
+  for (std::size_t shape : {std::size_t{1}, std::size_t{7}, std::size_t{1000}})
+  {
+    std::vector<int> hits(shape, 0);
+    int out_of_range = 0;
+    std::mutex mtx;
+    std::set<std::thread::id> ids;
+
+    auto sndr = ex::just() | ex::continues_on(pool.get_scheduler())
+              | ex::bulk_unchunked(ex::seq, shape, [&](std::size_t i) {
+                  std::lock_guard<std::mutex> lock{mtx};
+                  ids.insert(std::this_thread::get_id());
+                  ++(i < shape ? hits[i] : out_of_range);
+                });
+    ex::sync_wait(std::move(sndr));
+    CHECK(ids.size() == 1);
+    CHECK(out_of_range == 0);
+    for (int h : hits)
+    {
+      CHECK(h == 1);
+    }
+  }
+}
+
+C2H_TEST("thread_pool bulk with an empty shape completes immediately", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{2};
+  bool called = false;
+  auto sndr   = ex::just(7) | ex::continues_on(pool.get_scheduler()) | ex::bulk(ex::par, 0, [&](std::size_t, int) {
+                called = true;
+              });
+  auto [val]  = ex::sync_wait(std::move(sndr)).value();
+  CHECK(val == 7);
+  CHECK(!called);
+}
+
+C2H_TEST("thread_pool bulk stops early when a stop is requested", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{2};
+  ex::inplace_stop_source source;
+  cuda::std::atomic<int> result{0};
+  cuda::std::atomic<int> count{0};
+
+  auto sndr = ex::just() | ex::continues_on(pool.get_scheduler())
+            | ex::bulk_unchunked(ex::par, 10000, [&](std::size_t) {
+                if (++count == 10)
+                {
+                  source.request_stop();
+                }
+              });
+  auto op = ex::connect(std::move(sndr), stoppable_receiver{source.get_token(), &result});
+  ex::start(op);
+  result.wait(0);
+
+  CHECK(result.load() == 3);
+  CHECK(count.load() < 10000);
+}
+
+C2H_TEST("thread_pool supports nested bulk operations", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{3};
+  auto sched = pool.get_scheduler();
+  cuda::std::atomic<int> total{0};
+
+  auto inner = [&](std::size_t) {
+    auto sndr = ex::just() | ex::continues_on(sched) | ex::bulk(ex::par, 100, [&](std::size_t) {
+                  ++total;
+                });
+    // Blocking a worker in sync_wait is fine as long as some workers remain free.
+    ex::sync_wait(std::move(sndr));
+  };
+  ex::sync_wait(ex::just() | ex::continues_on(sched) | ex::bulk(ex::par, 2, inner));
+
+  CHECK(total.load() == 200);
+}
+} // namespace
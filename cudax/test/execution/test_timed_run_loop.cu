@@ -0,0 +1,183 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/atomic>
+
+#include <cuda/experimental/execution.cuh>
+
+#include <chrono>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "common/utility.cuh" // IWYU pragma: keep
+
+namespace ex = cuda::experimental::execution;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// Runs a timed_run_loop on a thread of its own for the lifetime of the object
+struct loop_thread
+{
+  explicit loop_thread(ex::timed_run_loop::duration resolution = 10us)
+      : loop{resolution}
+      , thrd{[this] {
+        loop.run();
+      }}
+  {}
+
+  ~loop_thread()
+  {
+    loop.finish();
+    thrd.join();
+  }
+
+  ex::timed_run_loop loop;
+  std::thread thrd;
+};
+
+// Receiver with a stop token in its environment that records how it was completed
+struct stoppable_receiver
+{
+  using receiver_concept = ex::receiver_t;
+
+  void set_value() noexcept
+  {
+    complete(1);
+  }
+
+  void set_stopped() noexcept
+  {
+    complete(3);
+  }
+
+  void complete(int how) noexcept
+  {
+    result->store(how);
+    result->notify_all();
+  }
+
+  auto get_env() const noexcept
+  {
+    return ex::prop{ex::get_stop_token, token};
+  }
+
+  ex::inplace_stop_token token;
+  cuda::std::atomic<int>* result;
+};
+
+C2H_TEST("timed_run_loop schedule_after completes after the delay", "[timed_run_loop]")
+{
+  loop_thread thrd;
+  auto sched = thrd.loop.get_scheduler();
+  STATIC_CHECK(ex::scheduler<decltype(sched)>);
+  CHECK(ex::get_forward_progress_guarantee(sched) == ex::forward_progress_guarantee::parallel);
+
+  auto stamp = [&] {
+    return std::make_pair(sched.now(), std::this_thread::get_id());
+  };
+  const auto start = sched.now();
+  auto [res]       = ex::sync_wait(ex::schedule_after(sched, 20ms) | ex::then(stamp)).value();
+  CHECK(res.first - start >= 20ms);
+  CHECK(res.second == thrd.thrd.get_id());
+}
+
+C2H_TEST("timed_run_loop completes timers in the order of their deadlines", "[timed_run_loop]")
+{
+  loop_thread thrd;
+  auto sched = thrd.loop.get_scheduler();
+  std::vector<int> order;
+
+  auto record = [&](int i) {
+    return ex::then([&order, i] {
+      order.push_back(i);
+    });
+  };
+  ex::sync_wait(ex::when_all(ex::schedule_after(sched, 30ms) | record(3),
+                             ex::schedule_after(sched, 10ms) | record(1),
+                             ex::schedule_after(sched, 20ms) | record(2),
+                             ex::schedule(sched) | record(0)));
+  CHECK(order == std::vector<int>{0, 1, 2, 3});
+}
+
+C2H_TEST("timed_run_loop schedule_at in the past completes right away", "[timed_run_loop]")
+{
+  loop_thread thrd;
+  auto sched = thrd.loop.get_scheduler();
+  auto res   = ex::sync_wait(ex::schedule_at(sched, sched.now() - 1s));
+  CHECK(res.has_value());
+}
+
+C2H_TEST("timed_run_loop timers are cancelled through the stop token", "[timed_run_loop]")
+{
+  loop_thread thrd;
+  auto sched = thrd.loop.get_scheduler();
+
+  // when_all stops the timer when the other sender completes with set_stopped.
+  auto res = ex::sync_wait(ex::when_all(ex::schedule_after(sched, 1h), ex::just_stopped()));
+  CHECK(!res.has_value());
+
+  ex::inplace_stop_source source;
+  cuda::std::atomic<int> result{0};
+  auto op = ex::connect(sched.schedule_after(1h), stoppable_receiver{source.get_token(), &result});
+  ex::start(op);
+  source.request_stop();
+  result.wait(0);
+  CHECK(result.load() == 3);
+}
+
+C2H_TEST("timed_run_loop stops the pending timers when it finishes", "[timed_run_loop]")
+{
+  ex::inplace_stop_source source;
+  cuda::std::atomic<int> result{0};
+  ex::timed_run_loop loop;
+  auto op = ex::connect(loop.get_scheduler().schedule_after(1h), stoppable_receiver{source.get_token(), &result});
+  ex::start(op);
+
+  std::thread thrd{[&] {
+    loop.run();
+  }};
+  loop.finish();
+  thrd.join();
+  CHECK(result.load() == 3);
+}
+
+C2H_TEST("timed_run_loop never completes a timer early", "[timed_run_loop]")
+{
+  // With a resolution of 1us, the deadlines span several levels of the timer wheel.
+  loop_thread thrd{1us};
+  auto sched = thrd.loop.get_scheduler();
+  ex::counting_scope scope;
+  cuda::std::atomic<int> early{0};
+  cuda::std::atomic<int> count{0};
+
+  std::mt19937 rng{42};
+  std::uniform_int_distribution<int> dist{0, 50'000};
+  const auto start = sched.now();
+  for (int i = 0; i < 1000; ++i)
+  {
+    const auto deadline = start + std::chrono::microseconds{dist(rng)};
+    ex::spawn(ex::schedule_at(sched, deadline) | ex::then([&, deadline] {
+                if (sched.now() < deadline)
+                {
+                  ++early;
+                }
+                ++count;
+              }),
+              scope.get_token());
+  }
+  ex::sync_wait(scope.join());
+  CHECK(count.load() == 1000);
+  CHECK(early.load() == 0);
+}
+} // namespace
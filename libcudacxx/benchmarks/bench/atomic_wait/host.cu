@@ -0,0 +1,159 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/atomic>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+// Host threads blocking on cuda::std::atomic::wait. The "backoff" mode reproduces the polling wait that was used on the
+// host before the futex based implementation, where notifications are no-ops and waiters sleep in growing steps.
+
+template <class T>
+static void backoff_wait(const cuda::std::atomic<T>& a, T old)
+{
+  for (int i = 0; i < _LIBCUDACXX_POLLING_COUNT; ++i)
+  {
+    if (a.load() != old)
+    {
+      return;
+    }
+    cuda::std::__cccl_thread_yield();
+  }
+  cuda::std::__cccl_thread_poll_with_backoff([&] {
+    return a.load() != old;
+  });
+}
+
+template <class T>
+static void wait_for_change(const cuda::std::atomic<T>& a, T old, bool backoff)
+{
+  if (backoff)
+  {
+    backoff_wait(a, old);
+  }
+  else
+  {
+    a.wait(old);
+  }
+}
+
+template <class T>
+static void publish(cuda::std::atomic<T>& a, T value, bool all, bool backoff)
+{
+  a.store(value);
+  if (!backoff)
+  {
+    all ? a.notify_all() : a.notify_one();
+  }
+}
+
+// 32 bit atomics wait directly on a futex, 64 bit atomics go through the hashed waiter table
+using value_types = nvbench::type_list<cuda::std::int32_t, cuda::std::int64_t>;
+
+// Round trip latency between two threads handing a token back and forth
+template <typename T>
+static void ping_pong(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto round_trips = static_cast<T>(state.get_int64("RoundTrips"));
+  const bool backoff     = state.get_string("Mode") == "backoff";
+
+  state.add_element_count(round_trips, "RoundTrips");
+
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    cuda::std::atomic<T> token{0};
+
+    std::thread partner([&] {
+      for (T i = 0; i < round_trips; ++i)
+      {
+        wait_for_change(token, T(2 * i), backoff);
+        publish(token, T(2 * i + 2), false, backoff);
+      }
+    });
+
+    timer.start();
+    for (T i = 0; i < round_trips; ++i)
+    {
+      publish(token, T(2 * i + 1), false, backoff);
+      wait_for_change(token, T(2 * i + 1), backoff);
+    }
+    timer.stop();
+
+    partner.join();
+  });
+}
+
+NVBENCH_BENCH_TYPES(ping_pong, NVBENCH_TYPE_AXES(value_types))
+  .set_name("ping_pong")
+  .set_type_axes_names({"T{ct}"})
+  .set_is_cpu_only(true)
+  .add_string_axis("Mode", {"futex", "backoff"})
+  .add_int64_axis("RoundTrips", {1 << 12});
+
+// Throughput of broadcasting generations to a group of parked threads; each generation completes once every waiter
+// has acknowledged it
+template <typename T>
+static void broadcast(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto generations = static_cast<T>(state.get_int64("Generations"));
+  const auto waiters     = static_cast<int>(state.get_int64("Waiters"));
+  const bool backoff     = state.get_string("Mode") == "backoff";
+
+  state.add_element_count(generations, "Generations");
+
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    cuda::std::atomic<T> generation{0};
+    cuda::std::atomic<T> acks{0};
+
+    std::vector<std::thread> threads;
+    for (int w = 0; w < waiters; ++w)
+    {
+      threads.emplace_back([&] {
+        for (T g = 0; g < generations; ++g)
+        {
+          wait_for_change(generation, g, backoff);
+          const T target = T(waiters) * (g + 1);
+          if (acks.fetch_add(1) + 1 == target && !backoff)
+          {
+            acks.notify_one();
+          }
+        }
+      });
+    }
+
+    timer.start();
+    for (T g = 0; g < generations; ++g)
+    {
+      publish(generation, T(g + 1), true, backoff);
+      const T target = T(waiters) * (g + 1);
+      for (T seen = acks.load(); seen != target; seen = acks.load())
+      {
+        wait_for_change(acks, seen, backoff);
+      }
+    }
+    timer.stop();
+
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+  });
+}
+
+NVBENCH_BENCH_TYPES(broadcast, NVBENCH_TYPE_AXES(value_types))
+  .set_name("broadcast")
+  .set_type_axes_names({"T{ct}"})
+  .set_is_cpu_only(true)
+  .add_string_axis("Mode", {"futex", "backoff"})
+  .add_int64_axis("Waiters", {1, 4, 16})
+  .add_int64_axis("Generations", {1 << 10});
@@ -0,0 +1,182 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/bit>
+#include <cuda/std/charconv>
+#include <cuda/std/cmath>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+#include <charconv>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+// Host throughput of the floating point conversions compared to the standard library. The "std" implementation is
+// std::to_chars and std::from_chars, "strtod" is the C library parser.
+
+using value_types = nvbench::type_list<float, double>;
+
+// Large enough for the fixed representation of any value, which has up to hundreds of digits
+constexpr int max_chars = 400;
+
+// "bits" values are random bit patterns that cover the whole exponent range, "uniform" values are in [0, 1)
+template <class T>
+static std::vector<T> gen_values(std::size_t n, const std::string& dist)
+{
+  using bits_t = cuda::std::conditional_t<sizeof(T) == 4, cuda::std::uint32_t, cuda::std::uint64_t>;
+
+  std::mt19937_64 rng{42};
+  std::vector<T> values;
+  values.reserve(n);
+  while (values.size() < n)
+  {
+    T value{};
+    if (dist == "uniform")
+    {
+      value = std::uniform_real_distribution<T>{}(rng);
+    }
+    else
+    {
+      value = cuda::std::bit_cast<T>(static_cast<bits_t>(rng()));
+    }
+    if (cuda::std::isfinite(value))
+    {
+      values.push_back(value);
+    }
+  }
+  return values;
+}
+
+static cuda::std::chars_format to_cuda_format(std::chars_format fmt)
+{
+  return static_cast<cuda::std::chars_format>(static_cast<int>(fmt));
+}
+
+static std::chars_format get_format(const std::string& name)
+{
+  if (name == "fixed")
+  {
+    return std::chars_format::fixed;
+  }
+  if (name == "scientific")
+  {
+    return std::chars_format::scientific;
+  }
+  if (name == "hex")
+  {
+    return std::chars_format::hex;
+  }
+  return std::chars_format::general;
+}
+
+template <typename T>
+static void to_chars(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements    = static_cast<std::size_t>(state.get_int64("Elements"));
+  const std::string impl = state.get_string("Impl");
+  const auto fmt         = get_format(state.get_string("Format"));
+  const auto precision   = static_cast<int>(state.get_int64("Precision"));
+
+  const auto values = gen_values<T>(elements, state.get_string("Distribution"));
+  std::vector<char> buffer(elements * max_chars);
+
+  state.add_element_count(elements);
+  state.exec(nvbench::exec_tag::no_gpu, [&](nvbench::launch&) {
+    char* out = buffer.data();
+    for (const T value : values)
+    {
+      if (impl == "cuda")
+      {
+        const auto cuda_fmt = to_cuda_format(fmt);
+        (void) ((precision < 0) ? cuda::std::to_chars(out, out + max_chars, value, cuda_fmt)
+                                : cuda::std::to_chars(out, out + max_chars, value, cuda_fmt, precision));
+      }
+      else
+      {
+        (void) ((precision < 0) ? std::to_chars(out, out + max_chars, value, fmt)
+                                : std::to_chars(out, out + max_chars, value, fmt, precision));
+      }
+      out += max_chars;
+    }
+  });
+}
+
+NVBENCH_BENCH_TYPES(to_chars, NVBENCH_TYPE_AXES(value_types))
+  .set_name("to_chars")
+  .set_type_axes_names({"T{ct}"})
+  .set_is_cpu_only(true)
+  .add_string_axis("Impl", {"cuda", "std"})
+  .add_string_axis("Format", {"general", "scientific", "fixed", "hex"})
+  .add_int64_axis("Precision", {-1, 6, 17})
+  .add_string_axis("Distribution", {"bits", "uniform"})
+  .add_int64_axis("Elements", {1 << 16});
+
+template <typename T>
+static void from_chars(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements    = static_cast<std::size_t>(state.get_int64("Elements"));
+  const std::string impl = state.get_string("Impl");
+  const auto fmt         = get_format(state.get_string("Format"));
+
+  if (impl == "strtod" && fmt != std::chars_format::general)
+  {
+    state.skip("strtod only parses the general format");
+    return;
+  }
+
+  // The inputs are the shortest round trip strings, which is the common case of parsing serialized values
+  const auto values = gen_values<T>(elements, state.get_string("Distribution"));
+  std::vector<char> buffer(elements * max_chars);
+  for (std::size_t i = 0; i < elements; ++i)
+  {
+    char* first = buffer.data() + i * max_chars;
+    *std::to_chars(first, first + max_chars - 1, values[i], fmt).ptr = '\0';
+  }
+
+  std::vector<T> results(elements);
+
+  state.add_element_count(elements);
+  state.exec(nvbench::exec_tag::no_gpu, [&](nvbench::launch&) {
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+      const char* first = buffer.data() + i * max_chars;
+      const char* last  = first + max_chars;
+      if (impl == "cuda")
+      {
+        (void) cuda::std::from_chars(first, last, results[i], to_cuda_format(fmt));
+      }
+      else if (impl == "std")
+      {
+        (void) std::from_chars(first, last, results[i], fmt);
+      }
+      else if constexpr (sizeof(T) == 4)
+      {
+        results[i] = std::strtof(first, nullptr);
+      }
+      else
+      {
+        results[i] = std::strtod(first, nullptr);
+      }
+    }
+  });
+}
+
+NVBENCH_BENCH_TYPES(from_chars, NVBENCH_TYPE_AXES(value_types))
+  .set_name("from_chars")
+  .set_type_axes_names({"T{ct}"})
+  .set_is_cpu_only(true)
+  .add_string_axis("Impl", {"cuda", "std", "strtod"})
+  .add_string_axis("Format", {"general", "scientific", "hex"})
+  .add_string_axis("Distribution", {"bits", "uniform"})
+  .add_int64_axis("Elements", {1 << 16});
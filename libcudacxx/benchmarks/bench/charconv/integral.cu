@@ -0,0 +1,126 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/charconv>
+#include <cuda/std/cstdint>
+
+#include <charconv>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+// Host throughput of the integer conversions compared to std::to_chars and std::from_chars
+
+using value_types =
+  nvbench::type_list<cuda::std::int32_t, cuda::std::uint32_t, cuda::std::int64_t, cuda::std::uint64_t>;
+
+// Large enough for any 64-bit value in base 2 and a sign
+constexpr int max_chars = 66;
+
+// "full" values are random bit patterns, most of which have the maximal number of digits. "short" values have a random
+// number of significant bits, so that the number of digits varies from one value to the next.
+template <class T>
+static std::vector<T> gen_values(std::size_t n, const std::string& dist)
+{
+  std::mt19937_64 rng{42};
+  std::vector<T> values(n);
+  for (auto& value : values)
+  {
+    value = static_cast<T>(rng());
+    if (dist == "short")
+    {
+      value = static_cast<T>(value >> (rng() % (sizeof(T) * 8)));
+    }
+  }
+  return values;
+}
+
+template <typename T>
+static void to_chars(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements    = static_cast<std::size_t>(state.get_int64("Elements"));
+  const std::string impl = state.get_string("Impl");
+  const auto base        = static_cast<int>(state.get_int64("Base"));
+
+  const auto values = gen_values<T>(elements, state.get_string("Distribution"));
+  std::vector<char> buffer(elements * max_chars);
+
+  state.add_element_count(elements);
+  state.exec(nvbench::exec_tag::no_gpu, [&](nvbench::launch&) {
+    char* out = buffer.data();
+    for (const T value : values)
+    {
+      if (impl == "cuda")
+      {
+        (void) cuda::std::to_chars(out, out + max_chars, value, base);
+      }
+      else
+      {
+        (void) std::to_chars(out, out + max_chars, value, base);
+      }
+      out += max_chars;
+    }
+  });
+}
+
+NVBENCH_BENCH_TYPES(to_chars, NVBENCH_TYPE_AXES(value_types))
+  .set_name("to_chars")
+  .set_type_axes_names({"T{ct}"})
+  .set_is_cpu_only(true)
+  .add_string_axis("Impl", {"cuda", "std"})
+  .add_int64_axis("Base", {10, 16, 2, 7})
+  .add_string_axis("Distribution", {"full", "short"})
+  .add_int64_axis("Elements", {1 << 16});
+
+template <typename T>
+static void from_chars(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements    = static_cast<std::size_t>(state.get_int64("Elements"));
+  const std::string impl = state.get_string("Impl");
+  const auto base        = static_cast<int>(state.get_int64("Base"));
+
+  const auto values = gen_values<T>(elements, state.get_string("Distribution"));
+  std::vector<char> buffer(elements * max_chars);
+  std::vector<const char*> lasts(elements);
+  for (std::size_t i = 0; i < elements; ++i)
+  {
+    char* first = buffer.data() + i * max_chars;
+    lasts[i]    = std::to_chars(first, first + max_chars, values[i], base).ptr;
+  }
+
+  std::vector<T> results(elements);
+
+  state.add_element_count(elements);
+  state.exec(nvbench::exec_tag::no_gpu, [&](nvbench::launch&) {
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+      const char* first = buffer.data() + i * max_chars;
+      if (impl == "cuda")
+      {
+        (void) cuda::std::from_chars(first, lasts[i], results[i], base);
+      }
+      else
+      {
+        (void) std::from_chars(first, lasts[i], results[i], base);
+      }
+    }
+  });
+}
+
+NVBENCH_BENCH_TYPES(from_chars, NVBENCH_TYPE_AXES(value_types))
+  .set_name("from_chars")
+  .set_type_axes_names({"T{ct}"})
+  .set_is_cpu_only(true)
+  .add_string_axis("Impl", {"cuda", "std"})
+  .add_int64_axis("Base", {10, 16})
+  .add_string_axis("Distribution", {"full", "short"})
+  .add_int64_axis("Elements", {1 << 16});
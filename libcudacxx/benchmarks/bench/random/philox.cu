@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/random>
+#include <cuda/std/span>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+// Host throughput of filling a buffer with philox_engine, one value at a time with operator() and in bulk with
+// generate_random, next to std::mt19937_64
+
+using engine_types = nvbench::type_list<cuda::std::philox4x32, cuda::std::philox4x64>;
+
+template <typename Engine>
+static void host(nvbench::state& state, nvbench::type_list<Engine>)
+{
+  using result_type      = typename Engine::result_type;
+  const auto elements    = static_cast<std::size_t>(state.get_int64("Elements"));
+  const std::string impl = state.get_string("Impl");
+
+  std::vector<result_type> values(elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_writes<result_type>(elements);
+
+  if (impl == "mt19937_64")
+  {
+    std::mt19937_64 rng{42};
+    state.exec(nvbench::exec_tag::no_gpu, [&](nvbench::launch&) {
+      for (auto& value : values)
+      {
+        value = static_cast<result_type>(rng());
+      }
+      do_not_optimize(values.data());
+    });
+    return;
+  }
+
+  Engine rng{42};
+  if (impl == "one_at_a_time")
+  {
+    state.exec(nvbench::exec_tag::no_gpu, [&](nvbench::launch&) {
+      for (auto& value : values)
+      {
+        value = rng();
+      }
+      do_not_optimize(values.data());
+    });
+  }
+  else
+  {
+    state.exec(nvbench::exec_tag::no_gpu, [&](nvbench::launch&) {
+      rng.generate_random(cuda::std::span<result_type>{values.data(), values.size()});
+      do_not_optimize(values.data());
+    });
+  }
+}
+
+NVBENCH_BENCH_TYPES(host, NVBENCH_TYPE_AXES(engine_types))
+  .set_name("host")
+  .set_type_axes_names({"Engine{ct}"})
+  .set_is_cpu_only(true)
+  .add_string_axis("Impl", {"generate_random", "one_at_a_time", "mt19937_64"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(12, 24, 4));
@@ -0,0 +1,104 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/__pstl_algorithm>
+
+#if _CCCL_HAS_BACKEND_OMP()
+#  include <cuda/__execution/omp_policy.h>
+
+#  include <omp.h>
+#endif // _CCCL_HAS_BACKEND_OMP()
+
+#if _CCCL_HAS_BACKEND_TBB()
+#  include <cuda/__execution/tbb_policy.h>
+
+#  include <tbb/global_control.h>
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#if __has_include(<execution>)
+#  include <execution>
+#endif // __has_include(<execution>)
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+// Thread scaling of cuda::std::reduce with the CPU backends, next to std::reduce with the parallel policy of the host
+// standard library. The backends that are not enabled in the build are skipped.
+
+#if defined(__cpp_lib_parallel_algorithm) && _CCCL_HAS_BACKEND_TBB()
+#  define HAS_STD_PAR 1
+#else
+#  define HAS_STD_PAR 0
+#endif
+
+template <typename T>
+static void cpu(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements       = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto threads        = static_cast<int>(state.get_int64("Threads"));
+  const std::string backend = state.get_string("Backend");
+
+  std::vector<T> in(elements, T{1});
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+
+  const auto run = [&](auto reduce) {
+    state.exec(nvbench::exec_tag::no_gpu, [&](nvbench::launch&) {
+      do_not_optimize(reduce());
+    });
+  };
+
+  if (backend == "omp")
+  {
+#if _CCCL_HAS_BACKEND_OMP()
+    const int max_threads = omp_get_max_threads();
+    omp_set_num_threads(threads);
+    run([&] {
+      return cuda::std::reduce(cuda::execution::__omp_par_unseq, in.begin(), in.end());
+    });
+    omp_set_num_threads(max_threads);
+    return;
+#endif // _CCCL_HAS_BACKEND_OMP()
+  }
+  else if (backend == "tbb")
+  {
+#if _CCCL_HAS_BACKEND_TBB()
+    tbb::global_control limit{tbb::global_control::max_allowed_parallelism, static_cast<std::size_t>(threads)};
+    run([&] {
+      return cuda::std::reduce(cuda::execution::__tbb_par_unseq, in.begin(), in.end());
+    });
+    return;
+#endif // _CCCL_HAS_BACKEND_TBB()
+  }
+  else if (backend == "std_par")
+  {
+#if HAS_STD_PAR
+    // libstdc++ runs the parallel algorithms on TBB
+    tbb::global_control limit{tbb::global_control::max_allowed_parallelism, static_cast<std::size_t>(threads)};
+    run([&] {
+      return std::reduce(std::execution::par_unseq, in.begin(), in.end());
+    });
+    return;
+#endif // HAS_STD_PAR
+  }
+
+  state.skip("Backend " + backend + " is not available");
+}
+
+NVBENCH_BENCH_TYPES(cpu, NVBENCH_TYPE_AXES(nvbench::type_list<int32_t, int64_t, float>))
+  .set_name("cpu")
+  .set_type_axes_names({"T{ct}"})
+  .set_is_cpu_only(true)
+  .add_string_axis("Backend", {"omp", "tbb", "std_par"})
+  .add_int64_axis("Threads", {1, 2, 4, 8, 16, 32})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4));
@@ -0,0 +1,177 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___ATOMIC_WAIT_FUTEX_H
+#define _CUDA_STD___ATOMIC_WAIT_FUTEX_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_OS(LINUX) && !_CCCL_COMPILER(NVRTC) && !defined(CCCL_DISABLE_HOST_ATOMIC_FUTEX)
+#  define _LIBCUDACXX_HAS_HOST_ATOMIC_FUTEX() 1
+#else // ^^^ has futex ^^^ / vvv no futex vvv
+#  define _LIBCUDACXX_HAS_HOST_ATOMIC_FUTEX() 0
+#endif // ^^^ no futex ^^^
+
+#if _LIBCUDACXX_HAS_HOST_ATOMIC_FUTEX()
+
+#  include <cuda/std/__atomic/functions/host.h>
+#  include <cuda/std/__atomic/order.h>
+#  include <cuda/std/__chrono/duration.h>
+#  include <cuda/std/__chrono/high_resolution_clock.h>
+#  include <cuda/std/climits>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <time.h>
+#  include <unistd.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// Host threads blocked in atomic::wait sleep in the kernel instead of polling. Atomics whose value is exactly 32 bits
+// wide are waited on directly with a futex on their own address. All other atomics share a "parking lot": a fixed
+// table of slots indexed by a hash of the waited-on address, each holding a version counter that serves as the futex
+// word. Every slot also counts its sleeping threads, so that notify only enters the kernel when someone is waiting.
+
+struct alignas(64) __cccl_atomic_wait_slot
+{
+  int32_t __waiters; // threads currently parked on an address that hashes to this slot
+  uint32_t __version; // futex word for atomics that cannot be waited on directly
+};
+
+inline constexpr int __cccl_atomic_wait_table_bits = 8;
+
+// A waiter and its notifier must agree on the slot even when they live in different shared objects, so unlike the
+// rest of the host API the table has default visibility.
+_CCCL_HOST _CCCL_VISIBILITY_DEFAULT inline __cccl_atomic_wait_slot* __cccl_atomic_wait_table() noexcept
+{
+  static __cccl_atomic_wait_slot __table[size_t{1} << __cccl_atomic_wait_table_bits]{};
+  return __table;
+}
+
+_CCCL_HOST_API inline __cccl_atomic_wait_slot& __cccl_atomic_wait_slot_for(void const volatile* __addr) noexcept
+{
+  // Fibonacci hashing; the lowest bits carry no information since atomics are at least 4 byte aligned in practice
+  const auto __key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(__addr)) >> 2;
+  return __cccl_atomic_wait_table()[(__key * 0x9E3779B97F4A7C15ull) >> (64 - __cccl_atomic_wait_table_bits)];
+}
+
+_CCCL_HOST_API inline void
+__cccl_futex_wait(uint32_t const volatile* __addr, uint32_t __expected, const timespec* __timeout) noexcept
+{
+  ::syscall(SYS_futex, __addr, FUTEX_WAIT_PRIVATE, __expected, __timeout, nullptr, 0);
+}
+
+_CCCL_HOST_API inline void __cccl_futex_wake(uint32_t const volatile* __addr, int __count) noexcept
+{
+  ::syscall(SYS_futex, __addr, FUTEX_WAKE_PRIVATE, __count, nullptr, nullptr, 0);
+}
+
+//! @brief Blocks the calling thread until @p __changed returns true.
+//!
+//! If @p __word is not null, the thread sleeps on it for as long as it holds @p __expected, otherwise it sleeps on the
+//! version counter of the slot @p __key hashes to. With @p __bounded, every sleep is capped following the schedule of
+//! `__cccl_thread_poll_with_backoff`, because the value may also be changed by writers that cannot wake host threads,
+//! such as device threads or other processes.
+template <class _Fn>
+_CCCL_HOST_API void __cccl_atomic_wait_park(
+  void const volatile* __key, uint32_t const volatile* __word, uint32_t __expected, bool __bounded, _Fn __changed)
+{
+  __cccl_atomic_wait_slot& __slot = __cccl_atomic_wait_slot_for(__key);
+  ::cuda::std::chrono::high_resolution_clock::time_point const __start =
+    ::cuda::std::chrono::high_resolution_clock::now();
+
+  // Pairs with the fence in __cccl_atomic_notify_park: either the notifier sees this thread as a waiter, or this
+  // thread sees the new value.
+  ::cuda::std::__atomic_fetch_add_host(&__slot.__waiters, 1, memory_order_relaxed);
+  ::cuda::std::__atomic_thread_fence_host(memory_order_seq_cst);
+
+  while (true)
+  {
+    uint32_t const volatile* __futex = __word;
+    uint32_t __value                 = __expected;
+    if (__futex == nullptr)
+    {
+      // The version must be sampled before the value is checked, so that a notification in between is not lost
+      __futex = &__slot.__version;
+      __value = ::cuda::std::__atomic_load_host(__futex, memory_order_acquire);
+    }
+    if (__changed())
+    {
+      break;
+    }
+    if (__bounded)
+    {
+      ::cuda::std::chrono::nanoseconds const __elapsed = ::cuda::std::chrono::high_resolution_clock::now() - __start;
+      ::cuda::std::chrono::nanoseconds __step          = __elapsed / 4;
+      if (__step > ::cuda::std::chrono::milliseconds(1))
+      {
+        __step = ::cuda::std::chrono::milliseconds(1);
+      }
+      else if (__step < ::cuda::std::chrono::microseconds(10))
+      {
+        __step = ::cuda::std::chrono::microseconds(10);
+      }
+      const timespec __timeout{0, static_cast<long>(__step.count())};
+      ::cuda::std::__cccl_futex_wait(__futex, __value, &__timeout);
+    }
+    else
+    {
+      ::cuda::std::__cccl_futex_wait(__futex, __value, nullptr);
+    }
+  }
+
+  ::cuda::std::__atomic_fetch_sub_host(&__slot.__waiters, 1, memory_order_relaxed);
+}
+
+//! @brief Wakes threads parked by `__cccl_atomic_wait_park` on @p __key.
+//!
+//! Threads sleeping on @p __word are woken directly; all others share the version counter of their slot and can only
+//! be woken all at once.
+_CCCL_HOST_API inline void
+__cccl_atomic_notify_park(void const volatile* __key, uint32_t const volatile* __word, bool __all) noexcept
+{
+  __cccl_atomic_wait_slot& __slot = __cccl_atomic_wait_slot_for(__key);
+
+  ::cuda::std::__atomic_thread_fence_host(memory_order_seq_cst);
+  if (::cuda::std::__atomic_load_host(&__slot.__waiters, memory_order_relaxed) == 0)
+  {
+    return;
+  }
+
+  if (__word != nullptr)
+  {
+    ::cuda::std::__cccl_futex_wake(__word, __all ? INT_MAX : 1);
+  }
+  else
+  {
+    ::cuda::std::__atomic_fetch_add_host(&__slot.__version, 1u, memory_order_release);
+    ::cuda::std::__cccl_futex_wake(&__slot.__version, INT_MAX);
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX_HAS_HOST_ATOMIC_FUTEX()
+
+#endif // _CUDA_STD___ATOMIC_WAIT_FUTEX_H
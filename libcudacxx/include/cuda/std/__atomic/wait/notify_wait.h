@@ -23,7 +23,12 @@
 
 #include <cuda/std/__atomic/order.h>
 #include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__atomic/types/common.h>
+#include <cuda/std/__atomic/types/reference.h>
+#include <cuda/std/__atomic/wait/futex.h>
 #include <cuda/std/__atomic/wait/polling.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstdint>
 #include <cuda/std/cstring>
 
 #include <cuda/std/__cccl/prologue.h>
@@ -32,35 +37,109 @@ _CCCL_BEGIN_NAMESPACE_CUDA_STD
 
 extern "C" _CCCL_DEVICE void __atomic_try_wait_unsupported_before_SM_70__();
 
+template <typename _Tp>
+_CCCL_API inline bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
+{
+#if _CCCL_CUDA_COMPILATION()
+  return __lhs == __rhs;
+#else // ^^^ _CCCL_CUDA_COMPILATION() ^^^ / vvv !_CCCL_CUDA_COMPILATION() vvv
+  return ::cuda::std::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
+#endif // ^^^ !_CCCL_CUDA_COMPILATION() ^^^
+}
+
+#if _LIBCUDACXX_HAS_HOST_ATOMIC_FUTEX()
+// Threads are parked on the object an atomic refers to, which for atomic_ref is not the storage itself
+template <typename _Tp>
+_CCCL_HOST_API void const volatile* __atomic_wait_key(_Tp const volatile* __a)
+{
+  return __a;
+}
+
+template <typename _Tp>
+_CCCL_HOST_API void const volatile* __atomic_wait_key(__atomic_ref_storage<_Tp> const volatile* __a)
+{
+  return __a->get();
+}
+
+// 32 bit atomics that are not emulated can be handed to the kernel as they are
+template <typename _Tp>
+inline constexpr bool __atomic_waits_on_futex =
+  _Tp::__tag == __atomic_tag::__atomic_base_tag && sizeof(__atomic_underlying_t<_Tp>) == sizeof(uint32_t);
+
+template <typename _Tp>
+_CCCL_HOST_API uint32_t const volatile* __atomic_wait_futex_word(_Tp const volatile* __a)
+{
+  if constexpr (__atomic_waits_on_futex<_Tp>)
+  {
+    return reinterpret_cast<uint32_t const volatile*>(__a->get());
+  }
+  else
+  {
+    return nullptr;
+  }
+}
+#endif // _LIBCUDACXX_HAS_HOST_ATOMIC_FUTEX()
+
+template <typename _Tp, typename _Sco>
+_CCCL_HOST_API void __atomic_try_wait_slow_host(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+#if _LIBCUDACXX_HAS_HOST_ATOMIC_FUTEX()
+  uint32_t __expected = 0;
+  if constexpr (__atomic_waits_on_futex<_Tp>)
+  {
+    ::cuda::std::memcpy(&__expected, &__val, sizeof(uint32_t));
+  }
+  // Device threads do not notify host waiters, so system scope waits must keep polling occasionally
+  ::cuda::std::__cccl_atomic_wait_park(
+    ::cuda::std::__atomic_wait_key(__a),
+    ::cuda::std::__atomic_wait_futex_word(__a),
+    __expected,
+    is_same_v<_Sco, __thread_scope_system_tag>,
+    [&] {
+      return !::cuda::std::__nonatomic_compare_equal(__atomic_load_dispatch(__a, __order, _Sco{}), __val);
+    });
+#else // ^^^ _LIBCUDACXX_HAS_HOST_ATOMIC_FUTEX() ^^^ / vvv !_LIBCUDACXX_HAS_HOST_ATOMIC_FUTEX() vvv
+  ::cuda::std::__atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+#endif // ^^^ !_LIBCUDACXX_HAS_HOST_ATOMIC_FUTEX() ^^^
+}
+
+template <typename _Tp>
+_CCCL_HOST_API void __atomic_notify_host([[maybe_unused]] _Tp const volatile* __a, [[maybe_unused]] bool __all)
+{
+#if _LIBCUDACXX_HAS_HOST_ATOMIC_FUTEX()
+  ::cuda::std::__cccl_atomic_notify_park(
+    ::cuda::std::__atomic_wait_key(__a), ::cuda::std::__atomic_wait_futex_word(__a), __all);
+#endif // _LIBCUDACXX_HAS_HOST_ATOMIC_FUTEX()
+}
+
 template <typename _Tp, typename _Sco>
 _CCCL_API inline void
 __atomic_try_wait_slow(_Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
 {
   NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
-                     , NV_IS_HOST, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+                     , NV_IS_HOST, __atomic_try_wait_slow_host(__a, __val, __order, _Sco{});
                      , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
-_CCCL_API inline void __atomic_notify_one(_Tp const volatile*, _Sco)
+_CCCL_API inline void __atomic_notify_one([[maybe_unused]] _Tp const volatile* __a, _Sco)
 {
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70,
+                     ,
+                     NV_IS_HOST,
+                     __atomic_notify_host(__a, false);
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
-_CCCL_API inline void __atomic_notify_all(_Tp const volatile*, _Sco)
-{
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
-}
-
-template <typename _Tp>
-_CCCL_API inline bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
+_CCCL_API inline void __atomic_notify_all([[maybe_unused]] _Tp const volatile* __a, _Sco)
 {
-#if _CCCL_CUDA_COMPILATION()
-  return __lhs == __rhs;
-#else // ^^^ _CCCL_CUDA_COMPILATION() ^^^ / vvv !_CCCL_CUDA_COMPILATION() vvv
-  return ::cuda::std::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
-#endif // ^^^ !_CCCL_CUDA_COMPILATION() ^^^
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70,
+                     ,
+                     NV_IS_HOST,
+                     __atomic_notify_host(__a, true);
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
@@ -0,0 +1,214 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_BIGINT_H
+#define _CUDA_STD___CHARCONV_BIGINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief Unsigned integer of fixed capacity used by the exact floating point conversions of the charconv functions.
+//! The value is stored as little endian 32-bit limbs, so that all operations only need 64-bit arithmetic.
+template <int _Limbs>
+struct __charconv_bigint
+{
+  uint32_t __limbs_[_Limbs]{};
+  int __size_ = 0; // number of limbs in use, the most significant one is nonzero
+
+  _CCCL_API constexpr explicit __charconv_bigint(uint64_t __v = 0) noexcept
+  {
+    while (__v != 0)
+    {
+      __limbs_[__size_++] = static_cast<uint32_t>(__v);
+      __v >>= 32;
+    }
+  }
+
+  [[nodiscard]] _CCCL_API constexpr bool __is_zero() const noexcept
+  {
+    return __size_ == 0;
+  }
+
+  //! @brief Returns the number of significant bits
+  [[nodiscard]] _CCCL_API constexpr int __bit_width() const noexcept
+  {
+    return (__size_ == 0) ? 0 : 32 * __size_ - ::cuda::std::countl_zero(__limbs_[__size_ - 1]);
+  }
+
+  //! @brief Computes *this = *this * __mul + __add
+  _CCCL_API constexpr void __mul_add(uint32_t __mul, uint32_t __add = 0) noexcept
+  {
+    uint64_t __carry = __add;
+    for (int __i = 0; __i < __size_; ++__i)
+    {
+      __carry += uint64_t{__limbs_[__i]} * __mul;
+      __limbs_[__i] = static_cast<uint32_t>(__carry);
+      __carry >>= 32;
+    }
+    if (__carry != 0)
+    {
+      _CCCL_ASSERT(__size_ < _Limbs, "__charconv_bigint overflow");
+      __limbs_[__size_++] = static_cast<uint32_t>(__carry);
+    }
+  }
+
+  //! @brief Multiplies *this by 5^__n
+  _CCCL_API constexpr void __mul_pow5(int __n) noexcept
+  {
+    constexpr uint32_t __pow5_13 = 1220703125; // largest power of 5 that fits into 32 bits
+    for (; __n >= 13; __n -= 13)
+    {
+      __mul_add(__pow5_13);
+    }
+    uint32_t __rest = 1;
+    for (; __n > 0; --__n)
+    {
+      __rest *= 5;
+    }
+    if (__rest != 1)
+    {
+      __mul_add(__rest);
+    }
+  }
+
+  //! @brief Multiplies *this by 2^__n
+  _CCCL_API constexpr void __shift_left(int __n) noexcept
+  {
+    if (__size_ == 0)
+    {
+      return;
+    }
+    const int __limb_shift = __n / 32;
+    const int __bit_shift  = __n % 32;
+    const int __new_size   = __size_ + __limb_shift + (__bit_shift != 0);
+    _CCCL_ASSERT(__new_size <= _Limbs, "__charconv_bigint overflow");
+
+    if (__bit_shift == 0)
+    {
+      for (int __i = __size_ - 1; __i >= 0; --__i)
+      {
+        __limbs_[__i + __limb_shift] = __limbs_[__i];
+      }
+    }
+    else
+    {
+      __limbs_[__new_size - 1] = 0;
+      for (int __i = __size_ - 1; __i >= 0; --__i)
+      {
+        __limbs_[__i + __limb_shift + 1] |= __limbs_[__i] >> (32 - __bit_shift);
+        __limbs_[__i + __limb_shift] = __limbs_[__i] << __bit_shift;
+      }
+    }
+    for (int __i = 0; __i < __limb_shift; ++__i)
+    {
+      __limbs_[__i] = 0;
+    }
+    __size_ = __new_size;
+    __trim();
+  }
+
+  //! @brief Divides *this by __div and returns the remainder
+  _CCCL_API constexpr uint32_t __div_small(uint32_t __div) noexcept
+  {
+    uint64_t __rem = 0;
+    for (int __i = __size_ - 1; __i >= 0; --__i)
+    {
+      __rem         = (__rem << 32) | __limbs_[__i];
+      __limbs_[__i] = static_cast<uint32_t>(__rem / __div);
+      __rem %= __div;
+    }
+    __trim();
+    return static_cast<uint32_t>(__rem);
+  }
+
+  //! @brief Returns *this >> __n, which must fit into 32 bits, and keeps only the lowest __n bits in *this
+  _CCCL_API constexpr uint32_t __split(int __n) noexcept
+  {
+    const int __limb = __n / 32;
+    const int __bit  = __n % 32;
+    if (__limb >= __size_)
+    {
+      return 0;
+    }
+
+    uint64_t __high = __limbs_[__limb] >> __bit;
+    if (__limb + 1 < __size_)
+    {
+      __high |= uint64_t{__limbs_[__limb + 1]} << (32 - __bit);
+    }
+    _CCCL_ASSERT(__limb + 2 >= __size_ && (__high >> 32) == 0, "__charconv_bigint::__split result is too large");
+
+    __limbs_[__limb] &= (uint32_t{1} << __bit) - 1;
+    __size_ = __limb + 1;
+    __trim();
+    return static_cast<uint32_t>(__high);
+  }
+
+  //! @brief Returns whether any of the lowest __n bits is set
+  [[nodiscard]] _CCCL_API constexpr bool __has_low_bits(int __n) const noexcept
+  {
+    const int __limb = __n / 32;
+    for (int __i = 0; __i < __limb && __i < __size_; ++__i)
+    {
+      if (__limbs_[__i] != 0)
+      {
+        return true;
+      }
+    }
+    return __limb < __size_ && (__limbs_[__limb] & ((uint32_t{1} << (__n % 32)) - 1)) != 0;
+  }
+
+  //! @brief Three way comparison of two values, returns a negative value, zero or a positive value
+  [[nodiscard]] friend _CCCL_API constexpr int
+  __compare(const __charconv_bigint& __lhs, const __charconv_bigint& __rhs) noexcept
+  {
+    if (__lhs.__size_ != __rhs.__size_)
+    {
+      return (__lhs.__size_ < __rhs.__size_) ? -1 : 1;
+    }
+    for (int __i = __lhs.__size_ - 1; __i >= 0; --__i)
+    {
+      if (__lhs.__limbs_[__i] != __rhs.__limbs_[__i])
+      {
+        return (__lhs.__limbs_[__i] < __rhs.__limbs_[__i]) ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+
+private:
+  _CCCL_API constexpr void __trim() noexcept
+  {
+    while (__size_ > 0 && __limbs_[__size_ - 1] == 0)
+    {
+      --__size_;
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_BIGINT_H
@@ -0,0 +1,154 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_DIGITS_H
+#define _CUDA_STD___CHARCONV_DIGITS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+_CCCL_GLOBAL_CONSTANT uint64_t __charconv_pow10[20] = {
+  1,
+  10,
+  100,
+  1000,
+  10000,
+  100000,
+  1000000,
+  10000000,
+  100000000,
+  1000000000,
+  10000000000,
+  100000000000,
+  1000000000000,
+  10000000000000,
+  100000000000000,
+  1000000000000000,
+  10000000000000000,
+  100000000000000000,
+  1000000000000000000,
+  10000000000000000000u,
+};
+
+_CCCL_GLOBAL_CONSTANT char __charconv_digit_chars[37] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+//! @brief The value of every character as a digit of base 36, or 36 if it isn't one
+// clang-format off
+_CCCL_GLOBAL_CONSTANT unsigned char __charconv_digit_values[256] = {
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 36, 36, 36, 36, 36, 36,
+  36, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+  25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 36, 36, 36, 36,
+  36, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+  25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+};
+// clang-format on
+
+//! @brief The decimal representations of 00 to 99
+_CCCL_GLOBAL_CONSTANT char __charconv_digit_pairs[201] =
+  "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+//! @brief Returns log2(__base) if __base is a power of two and zero otherwise
+[[nodiscard]] _CCCL_API constexpr int __charconv_log2_base(int __base) noexcept
+{
+  return ((__base & (__base - 1)) == 0) ? ::cuda::std::countr_zero(static_cast<unsigned>(__base)) : 0;
+}
+
+//! @brief Returns the number of decimal digits of __v, which is one for zero
+[[nodiscard]] _CCCL_API constexpr int __charconv_decimal_width(uint64_t __v) noexcept
+{
+  // floor(bit_width * log10(2)) is either the number of digits or one less
+  __v |= 1;
+  const int __approx = ((64 - ::cuda::std::countl_zero(__v)) * 1233) >> 12;
+  return __approx + (__v >= __charconv_pow10[__approx]);
+}
+
+//! @brief Writes the __n least significant decimal digits of the unsigned __v to [__first, __first + __n), two at a
+//! time
+template <class _Up>
+_CCCL_API constexpr void __charconv_write_decimal(char* __first, _Up __v, int __n) noexcept
+{
+  for (; __n >= 2; __n -= 2)
+  {
+    const auto __pair = static_cast<int>(__v % 100);
+    __v /= 100;
+    __first[__n - 1] = __charconv_digit_pairs[2 * __pair + 1];
+    __first[__n - 2] = __charconv_digit_pairs[2 * __pair];
+  }
+  if (__n == 1)
+  {
+    __first[0] = static_cast<char>('0' + __v % 10);
+  }
+}
+
+//! @brief Loads 8 characters into an integer, the first one into the least significant byte
+[[nodiscard]] _CCCL_API constexpr uint64_t __charconv_load8(const char* __first) noexcept
+{
+  uint64_t __v = 0;
+  for (int __i = 0; __i < 8; ++__i)
+  {
+    __v |= uint64_t{static_cast<unsigned char>(__first[__i])} << (8 * __i);
+  }
+  return __v;
+}
+
+//! @brief Returns whether all 8 characters loaded by __charconv_load8 are decimal digits
+[[nodiscard]] _CCCL_API constexpr bool __charconv_is_eight_digits(uint64_t __v) noexcept
+{
+  // Every byte must be in [0x30, 0x39], so its upper nibble is 3 and adding 6 doesn't carry into it
+  return ((__v & 0xf0f0f0f0f0f0f0f0) | (((__v + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0) >> 4)) == 0x3333333333333333;
+}
+
+//! @brief Returns the value of the 8 decimal digits loaded by __charconv_load8, combining neighbouring digits, pairs
+//! and quadruples in three multiplications
+[[nodiscard]] _CCCL_API constexpr uint32_t __charconv_parse_eight_digits(uint64_t __v) noexcept
+{
+  constexpr uint64_t __mask = 0x000000ff000000ff;
+  constexpr uint64_t __mul1 = 100 + (uint64_t{1000000} << 32);
+  constexpr uint64_t __mul2 = 1 + (uint64_t{10000} << 32);
+
+  __v -= 0x3030303030303030;
+  __v = (__v * 10) + (__v >> 8);
+  __v = (((__v & __mask) * __mul1) + (((__v >> 16) & __mask) * __mul2)) >> 32;
+  return static_cast<uint32_t>(__v);
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_DIGITS_H
@@ -23,11 +23,13 @@
 #include <cuda/__cmath/neg.h>
 #include <cuda/__cmath/uabs.h>
 #include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/digits.h>
+#include <cuda/std/__charconv/from_chars_floating_point.h>
 #include <cuda/std/__charconv/from_chars_result.h>
 #include <cuda/std/__concepts/concept_macros.h>
 #include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__floating_point/format.h>
 #include <cuda/std/__limits/numeric_limits.h>
-#include <cuda/std/__type_traits/always_false.h>
 #include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/is_floating_point.h>
 #include <cuda/std/__type_traits/is_integer.h>
@@ -49,28 +51,93 @@ struct __from_chars_char_to_value_result
 [[nodiscard]] _CCCL_API constexpr __from_chars_char_to_value_result
 __from_chars_char_to_value(char __c, int __base) noexcept
 {
-  if (__base <= 10)
+  const int __value = ::cuda::std::__charconv_digit_values[static_cast<unsigned char>(__c)];
+  return {__value < __base, __value};
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_int_generic(const char* __first, const char* __last, _Tp& __value, int __base) noexcept
+{
+  // __value * __base + __digit overflows iff __value exceeds __max_value or equals it and __digit exceeds __max_digit
+  const auto __max_value = static_cast<_Tp>(numeric_limits<_Tp>::max() / static_cast<_Tp>(__base));
+  const auto __max_digit = static_cast<int>(numeric_limits<_Tp>::max() % static_cast<_Tp>(__base));
+
+  bool __overflow  = false;
+  const char* __it = __first;
+  for (; __it != __last; ++__it)
   {
-    return {'0' <= __c && __c < '0' + __base, __c - '0'};
+    const auto __digit = ::cuda::std::__from_chars_char_to_value(*__it, __base);
+    if (!__digit.__valid_)
+    {
+      break;
+    }
+    if (__overflow || __value > __max_value || (__value == __max_value && __digit.__value_ > __max_digit))
+    {
+      __overflow = true;
+    }
+    else
+    {
+      __value = static_cast<_Tp>(__value * static_cast<_Tp>(__base) + static_cast<_Tp>(__digit.__value_));
+    }
   }
-  else if ('0' <= __c && __c <= '9')
+  return {__it, (__overflow) ? errc::result_out_of_range : ((__it == __first) ? errc::invalid_argument : errc{})};
+}
+
+//! @brief Parses decimal digits 8 at a time as long as the value can't overflow and one at a time after that
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_int_base10(const char* __first, const char* __last, _Tp& __value) noexcept
+{
+  // Any sequence of up to digits10 digits fits into _Tp
+  constexpr int __safe_digits = numeric_limits<_Tp>::digits10;
+
+  const char* __safe_last = (__last - __first > __safe_digits) ? __first + __safe_digits : __last;
+  const char* __it        = __first;
+  if constexpr (__safe_digits >= 8)
   {
-    return {true, __c - '0'};
+    for (; __safe_last - __it >= 8; __it += 8)
+    {
+      const uint64_t __chunk = ::cuda::std::__charconv_load8(__it);
+      if (!::cuda::std::__charconv_is_eight_digits(__chunk))
+      {
+        break;
+      }
+      __value = static_cast<_Tp>(__value * _Tp{100000000} + ::cuda::std::__charconv_parse_eight_digits(__chunk));
+    }
   }
-  else if ('a' <= __c && __c < 'a' + __base - 10)
+  for (; __it != __safe_last && '0' <= *__it && *__it <= '9'; ++__it)
   {
-    return {true, __c - 'a' + 10};
+    __value = static_cast<_Tp>(__value * _Tp{10} + static_cast<_Tp>(*__it - '0'));
   }
-  else
+
+  constexpr auto __max_value = static_cast<_Tp>(numeric_limits<_Tp>::max() / 10);
+  constexpr auto __max_digit = static_cast<_Tp>(numeric_limits<_Tp>::max() % 10);
+
+  bool __overflow = false;
+  for (; __it != __last && '0' <= *__it && *__it <= '9'; ++__it)
   {
-    return {'A' <= __c && __c < 'A' + __base - 10, __c - 'A' + 10};
+    const auto __digit = static_cast<_Tp>(*__it - '0');
+    if (__overflow || __value > __max_value || (__value == __max_value && __digit > __max_digit))
+    {
+      __overflow = true;
+    }
+    else
+    {
+      __value = static_cast<_Tp>(__value * _Tp{10} + __digit);
+    }
   }
+  return {__it, (__overflow) ? errc::result_out_of_range : ((__it == __first) ? errc::invalid_argument : errc{})};
 }
 
+//! @brief Parses digits of a power of two base by shifting them in, the value overflows as soon as a set bit would be
+//! shifted out
 template <class _Tp>
 [[nodiscard]] _CCCL_API constexpr from_chars_result
-__from_chars_int_generic(const char* __first, const char* __last, _Tp& __value, int __base) noexcept
+__from_chars_int_pow2(const char* __first, const char* __last, _Tp& __value, int __base, int __log2_base) noexcept
 {
+  constexpr int __digits = numeric_limits<_Tp>::digits;
+
   bool __overflow  = false;
   const char* __it = __first;
   for (; __it != __last; ++__it)
@@ -80,19 +147,27 @@ __from_chars_int_generic(const char* __first, const char* __last, _Tp& __value,
     {
       break;
     }
-    if (!__overflow)
-    {
-      const auto __new_value = static_cast<_Tp>(__value * _Tp(__base) + _Tp(__digit.__value_));
-      if (__new_value < __value)
-      {
-        __overflow = true;
-      }
-      __value = __new_value;
-    }
+    __overflow |= (__value >> (__digits - __log2_base)) != 0;
+    __value = static_cast<_Tp>((__value << __log2_base) | static_cast<_Tp>(__digit.__value_));
   }
   return {__it, (__overflow) ? errc::result_out_of_range : ((__it == __first) ? errc::invalid_argument : errc{})};
 }
 
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_int(const char* __first, const char* __last, _Tp& __value, int __base) noexcept
+{
+  if (__base == 10)
+  {
+    return ::cuda::std::__from_chars_int_base10(__first, __last, __value);
+  }
+  else if (const int __log2_base = ::cuda::std::__charconv_log2_base(__base); __log2_base != 0)
+  {
+    return ::cuda::std::__from_chars_int_pow2(__first, __last, __value, __base, __log2_base);
+  }
+  return ::cuda::std::__from_chars_int_generic(__first, __last, __value, __base);
+}
+
 _CCCL_TEMPLATE(class _Tp)
 _CCCL_REQUIRES(__cccl_is_integer_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr from_chars_result
@@ -107,7 +182,7 @@ from_chars(const char* __first, const char* __last, _Tp& __value, int __base = 1
   if constexpr (is_signed_v<_Tp>)
   {
     bool __neg = (__first < __last && *__first == '-');
-    __ret      = ::cuda::std::__from_chars_int_generic(__first + __neg, __last, __result, __base);
+    __ret      = ::cuda::std::__from_chars_int(__first + __neg, __last, __result, __base);
     if (__ret.ec == errc{})
     {
       const auto __max = ::cuda::uabs((__neg) ? numeric_limits<_Tp>::min() : numeric_limits<_Tp>::max());
@@ -123,7 +198,7 @@ from_chars(const char* __first, const char* __last, _Tp& __value, int __base = 1
   }
   else
   {
-    __ret = ::cuda::std::__from_chars_int_generic(__first, __last, __result, __base);
+    __ret = ::cuda::std::__from_chars_int(__first, __last, __result, __base);
   }
 
   if (__ret.ec == errc{})
@@ -155,13 +230,12 @@ _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr from_chars_result
 from_chars(const char* __first, const char* __last, _Tp& __value, chars_format __fmt = chars_format::general) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::from_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  return {};
+  static_assert(__fp_format_of_v<_Tp> == __fp_format::__binary32 || __fp_format_of_v<_Tp> == __fp_format::__binary64,
+                "cuda::std::from_chars is only implemented for binary32 and binary64 floating point types");
+  _CCCL_ASSERT(__fmt == chars_format::scientific || __fmt == chars_format::fixed || __fmt == chars_format::general
+                 || __fmt == chars_format::hex,
+               "format must be one of the chars_format enumerators");
+  return ::cuda::std::__from_chars_fp(__first, __last, __value, __fmt);
 }
 
 _CCCL_END_NAMESPACE_CUDA_STD
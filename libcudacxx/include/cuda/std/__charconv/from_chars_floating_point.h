@@ -0,0 +1,609 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_FROM_CHARS_FLOATING_POINT_H
+#define _CUDA_STD___CHARCONV_FROM_CHARS_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__charconv/bigint.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/eisel_lemire_tables.h>
+#include <cuda/std/__charconv/from_chars_result.h>
+#include <cuda/std/__floating_point/format.h>
+#include <cuda/std/__floating_point/mask.h>
+#include <cuda/std/__floating_point/properties.h>
+#include <cuda/std/__floating_point/storage.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief Parameters of the Eisel-Lemire algorithm for a floating point format
+template <__fp_format _Fmt>
+struct __eisel_lemire_traits;
+
+template <>
+struct __eisel_lemire_traits<__fp_format::__binary32>
+{
+  static constexpr int __smallest_pow10      = -64; // w * 10^q rounds to zero for all smaller q
+  static constexpr int __largest_pow10       = 38; // w * 10^q overflows for all larger q
+  static constexpr int __min_round_to_even_q = -17;
+  static constexpr int __max_round_to_even_q = 10;
+  static constexpr int __max_digits          = 120; // digits that are ever needed to round correctly, plus margin
+};
+
+template <>
+struct __eisel_lemire_traits<__fp_format::__binary64>
+{
+  static constexpr int __smallest_pow10      = -342;
+  static constexpr int __largest_pow10       = 308;
+  static constexpr int __min_round_to_even_q = -4;
+  static constexpr int __max_round_to_even_q = 23;
+  static constexpr int __max_digits          = 800;
+};
+
+//! @brief Floating point value in the form of its biased exponent and explicit mantissa bits
+struct __from_chars_fp_bits
+{
+  uint64_t __mant_;
+  int __exp_;
+
+  [[nodiscard]] _CCCL_API friend constexpr bool
+  operator==(const __from_chars_fp_bits& __lhs, const __from_chars_fp_bits& __rhs) noexcept
+  {
+    return __lhs.__mant_ == __rhs.__mant_ && __lhs.__exp_ == __rhs.__exp_;
+  }
+};
+
+//! @brief Rounds __w * 10^__q to the nearest floating point value, see Daniel Lemire, "Number Parsing at a Gigabyte
+//! per Second", Software: Practice and Experience 51(8), 2021, and Noble Mushtak and Daniel Lemire, "Fast number
+//! parsing without fallback", Software: Practice and Experience 53(6), 2023, which shows that the truncated product
+//! is always sufficient.
+template <__fp_format _Fmt>
+[[nodiscard]] _CCCL_API constexpr __from_chars_fp_bits __eisel_lemire(int64_t __q, uint64_t __w) noexcept
+{
+  using _Traits             = __eisel_lemire_traits<_Fmt>;
+  constexpr int __mant_bits = __fp_mant_nbits_v<_Fmt>;
+  constexpr int __inf_exp   = (1 << __fp_exp_nbits_v<_Fmt>) - 1;
+  constexpr int __min_exp   = -__fp_exp_bias_v<_Fmt>;
+
+  if (__w == 0 || __q < _Traits::__smallest_pow10)
+  {
+    return {0, 0};
+  }
+  if (__q > _Traits::__largest_pow10)
+  {
+    return {0, __inf_exp};
+  }
+
+  const int __lz = ::cuda::std::countl_zero(__w);
+  __w <<= __lz;
+
+  // Only the __mant_bits + 3 most significant bits of the product are needed, the second half of the power of five is
+  // only multiplied if the first one leaves them undetermined
+  constexpr uint64_t __precision_mask = ~uint64_t{0} >> (__mant_bits + 3);
+
+  const auto& __pow5 = __eisel_lemire_pow5[__q + 342];
+  uint64_t __high    = ::cuda::mul_hi(__w, __pow5[0]);
+  uint64_t __low     = __w * __pow5[0];
+  if ((__high & __precision_mask) == __precision_mask)
+  {
+    const uint64_t __second_high = ::cuda::mul_hi(__w, __pow5[1]);
+    __low += __second_high;
+    __high += (__second_high > __low);
+  }
+
+  const int __upper_bit = static_cast<int>(__high >> 63);
+  const int __shift     = __upper_bit + 64 - __mant_bits - 3;
+  uint64_t __mant       = __high >> __shift;
+  // floor(log2(10^q)) + 63 is ((152170 + 65536) * q) >> 16) + 63
+  int __exp = static_cast<int>((((152170 + 65536) * __q) >> 16) + 63) + __upper_bit - __lz - __min_exp;
+
+  if (__exp <= 0)
+  {
+    // Subnormal or zero
+    if (-__exp + 1 >= 64)
+    {
+      return {0, 0};
+    }
+    __mant >>= -__exp + 1;
+    __mant += (__mant & 1);
+    __mant >>= 1;
+    // Rounding up may have produced the smallest normal value
+    return {__mant & __fp_mant_mask_v<_Fmt>, (__mant < (uint64_t{1} << __mant_bits)) ? 0 : 1};
+  }
+
+  // Round half to even is only relevant if the product is exact, which is only possible for small q
+  if (__low <= 1 && __q >= _Traits::__min_round_to_even_q && __q <= _Traits::__max_round_to_even_q
+      && (__mant & 3) == 1 && (__mant << __shift) == __high)
+  {
+    __mant &= ~uint64_t{1};
+  }
+
+  __mant += (__mant & 1);
+  __mant >>= 1;
+  if (__mant >= (uint64_t{2} << __mant_bits))
+  {
+    __mant = uint64_t{1} << __mant_bits;
+    ++__exp;
+  }
+  if (__exp >= __inf_exp)
+  {
+    return {0, __inf_exp};
+  }
+  return {__mant & __fp_mant_mask_v<_Fmt>, __exp};
+}
+
+//! @brief The decimal digits of a floating point number, which is the integer formed by the digits in
+//! [__first_, __last_) without the decimal point and leading zeros, times 10^__exp10_
+struct __from_chars_fp_decimal
+{
+  const char* __first_;
+  const char* __last_;
+  int64_t __exp10_;
+};
+
+//! @brief Decides between the neighbouring values __lower and its successor by comparing the exact decimal value with
+//! the halfway point between them
+template <__fp_format _Fmt>
+[[nodiscard]] _CCCL_API constexpr __from_chars_fp_bits
+__from_chars_fp_digit_comp(__from_chars_fp_decimal __dec, __from_chars_fp_bits __lower) noexcept
+{
+  using _Traits             = __eisel_lemire_traits<_Fmt>;
+  constexpr int __mant_bits = __fp_mant_nbits_v<_Fmt>;
+  // The compared values are of the same magnitude as the digits, which have at most __max_digits * log2(10) bits
+  using __bigint = __charconv_bigint<(_Traits::__max_digits * 3322 / 1000 + 128) / 32>;
+
+  // The first __max_digits significant digits, the rest only matters if any of them is nonzero
+  __bigint __digits{};
+  int64_t __exp10  = __dec.__exp10_;
+  int __ndigits    = 0;
+  bool __sticky    = false;
+  uint32_t __chunk = 0;
+  uint32_t __scale = 1;
+  for (const char* __it = __dec.__first_; __it != __dec.__last_; ++__it)
+  {
+    if (*__it == '.' || (__ndigits == 0 && *__it == '0'))
+    {
+      continue;
+    }
+    if (__ndigits == _Traits::__max_digits)
+    {
+      __sticky |= *__it != '0';
+      ++__exp10;
+      continue;
+    }
+    __chunk = __chunk * 10 + static_cast<uint32_t>(*__it - '0');
+    __scale *= 10;
+    ++__ndigits;
+    if (__scale == 1000000000)
+    {
+      __digits.__mul_add(__scale, __chunk);
+      __chunk = 0;
+      __scale = 1;
+    }
+  }
+  if (__scale != 1)
+  {
+    __digits.__mul_add(__scale, __chunk);
+  }
+
+  // The halfway point is (2 * m + 1) * 2^(e - 1)
+  const uint64_t __m = (__lower.__exp_ != 0) ? (__lower.__mant_ | (uint64_t{1} << __mant_bits)) : __lower.__mant_;
+  const int __e      = ((__lower.__exp_ != 0) ? __lower.__exp_ : 1) - __fp_exp_bias_v<_Fmt> - __mant_bits;
+  __bigint __halfway{2 * __m + 1};
+
+  // Compare __digits * 5^exp10 * 2^exp10 with __halfway * 2^(e - 1)
+  int64_t __exp2 = __exp10 - (__e - 1);
+  if (__exp10 >= 0)
+  {
+    __digits.__mul_pow5(static_cast<int>(__exp10));
+  }
+  else
+  {
+    __halfway.__mul_pow5(static_cast<int>(-__exp10));
+  }
+  if (__exp2 >= 0)
+  {
+    __digits.__shift_left(static_cast<int>(__exp2));
+  }
+  else
+  {
+    __halfway.__shift_left(static_cast<int>(-__exp2));
+  }
+
+  int __cmp = __compare(__digits, __halfway);
+  if (__cmp == 0 && __sticky)
+  {
+    __cmp = 1;
+  }
+
+  if (__cmp > 0 || (__cmp == 0 && (__lower.__mant_ & 1) != 0))
+  {
+    // The successor, which might carry into the exponent
+    const uint64_t __next = ((uint64_t{static_cast<uint32_t>(__lower.__exp_)} << __mant_bits) | __lower.__mant_) + 1;
+    return {__next & __fp_mant_mask_v<_Fmt>, static_cast<int>(__next >> __mant_bits)};
+  }
+  return __lower;
+}
+
+[[nodiscard]] _CCCL_API constexpr bool __from_chars_fp_is_digit(char __c) noexcept
+{
+  return '0' <= __c && __c <= '9';
+}
+
+[[nodiscard]] _CCCL_API constexpr int __from_chars_fp_hex_value(char __c) noexcept
+{
+  if ('0' <= __c && __c <= '9')
+  {
+    return __c - '0';
+  }
+  if ('a' <= __c && __c <= 'f')
+  {
+    return __c - 'a' + 10;
+  }
+  if ('A' <= __c && __c <= 'F')
+  {
+    return __c - 'A' + 10;
+  }
+  return -1;
+}
+
+[[nodiscard]] _CCCL_API constexpr char __from_chars_fp_to_lower(char __c) noexcept
+{
+  return ('A' <= __c && __c <= 'Z') ? static_cast<char>(__c - 'A' + 'a') : __c;
+}
+
+//! @brief Returns whether [__first, __last) starts with the lower case __str, ignoring the case
+[[nodiscard]] _CCCL_API constexpr bool
+__from_chars_fp_starts_with(const char* __first, const char* __last, const char* __str) noexcept
+{
+  for (; *__str != '\0'; ++__first, ++__str)
+  {
+    if (__first == __last || ::cuda::std::__from_chars_fp_to_lower(*__first) != *__str)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//! @brief Returns whether all digits of the number in [__first, __last) are zero
+[[nodiscard]] _CCCL_API constexpr bool
+__from_chars_fp_digits_are_zero(const char* __first, const char* __last, chars_format __fmt) noexcept
+{
+  const char __exp_char = (__fmt == chars_format::hex) ? 'p' : 'e';
+  for (; __first != __last; ++__first)
+  {
+    const char __c = ::cuda::std::__from_chars_fp_to_lower(*__first);
+    if (__c == __exp_char)
+    {
+      break;
+    }
+    if (__c != '0' && __c != '.')
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//! @brief Parses an optionally signed decimal exponent. Returns __first if there are no digits. Exponents that are
+//! too large for any finite nonzero result saturate
+[[nodiscard]] _CCCL_API constexpr const char*
+__from_chars_fp_parse_exponent(const char* __first, const char* __last, int64_t& __exp) noexcept
+{
+  const char* __it = __first;
+  bool __neg       = false;
+  if (__it != __last && (*__it == '+' || *__it == '-'))
+  {
+    __neg = *__it == '-';
+    ++__it;
+  }
+  if (__it == __last || !::cuda::std::__from_chars_fp_is_digit(*__it))
+  {
+    return __first;
+  }
+  int64_t __value = 0;
+  for (; __it != __last && ::cuda::std::__from_chars_fp_is_digit(*__it); ++__it)
+  {
+    if (__value < (int64_t{1} << 40))
+    {
+      __value = __value * 10 + (*__it - '0');
+    }
+  }
+  __exp = __neg ? -__value : __value;
+  return __it;
+}
+
+//! @brief Composes the bits of the value __mant * 2^__exp2, rounded half to even, where __sticky is whether any
+//! nonzero bits below __mant were dropped
+template <__fp_format _Fmt>
+[[nodiscard]] _CCCL_API constexpr __from_chars_fp_bits
+__from_chars_fp_round(uint64_t __mant, int64_t __exp2, bool __sticky) noexcept
+{
+  constexpr int __mant_bits = __fp_mant_nbits_v<_Fmt>;
+  constexpr int __inf_exp   = (1 << __fp_exp_nbits_v<_Fmt>) - 1;
+
+  if (__mant == 0)
+  {
+    return {0, 0};
+  }
+  const int __lz = ::cuda::std::countl_zero(__mant);
+  __mant <<= __lz;
+  __exp2 -= __lz;
+
+  // The most significant bit has the weight 2^(exp2 + 63)
+  const int64_t __biased = __exp2 + 63 + __fp_exp_bias_v<_Fmt>;
+  if (__biased >= __inf_exp)
+  {
+    return {0, __inf_exp};
+  }
+
+  // Number of dropped bits, subnormal results drop more of them
+  int64_t __dropped = 63 - __mant_bits + ((__biased < 1) ? 1 - __biased : 0);
+  if (__dropped > 64)
+  {
+    return {0, 0};
+  }
+
+  uint64_t __kept       = (__dropped == 64) ? 0 : __mant >> __dropped;
+  const uint64_t __rem  = (__dropped == 64) ? __mant : __mant & ((uint64_t{1} << __dropped) - 1);
+  const uint64_t __half = uint64_t{1} << (__dropped - 1);
+  if (__rem > __half || (__rem == __half && (__sticky || (__kept & 1) != 0)))
+  {
+    ++__kept;
+  }
+
+  if (__biased < 1)
+  {
+    // Rounding up may have produced the smallest normal value
+    return {__kept & __fp_mant_mask_v<_Fmt>, static_cast<int>(__kept >> __mant_bits)};
+  }
+
+  int __exp = static_cast<int>(__biased);
+  if (__kept == (uint64_t{2} << __mant_bits))
+  {
+    __kept >>= 1;
+    ++__exp;
+  }
+  if (__exp >= __inf_exp)
+  {
+    return {0, __inf_exp};
+  }
+  return {__kept & __fp_mant_mask_v<_Fmt>, __exp};
+}
+
+//! @brief Parses the hexadecimal digits and the binary exponent of the hex format, without the 0x prefix
+template <__fp_format _Fmt>
+[[nodiscard]] _CCCL_API constexpr const char*
+__from_chars_fp_parse_hex(const char* __first, const char* __last, __from_chars_fp_bits& __bits) noexcept
+{
+  uint64_t __mant  = 0;
+  int64_t __exp2   = 0;
+  bool __sticky    = false;
+  bool __has_digit = false;
+  bool __in_frac   = false;
+
+  const char* __it = __first;
+  for (; __it != __last; ++__it)
+  {
+    if (*__it == '.' && !__in_frac)
+    {
+      __in_frac = true;
+      continue;
+    }
+    const int __digit = ::cuda::std::__from_chars_fp_hex_value(*__it);
+    if (__digit < 0)
+    {
+      break;
+    }
+    __has_digit = true;
+    if ((__mant >> 60) == 0)
+    {
+      // Still room for another digit
+      __mant = (__mant << 4) | static_cast<uint64_t>(__digit);
+      __exp2 -= __in_frac ? 4 : 0;
+    }
+    else
+    {
+      __sticky |= __digit != 0;
+      __exp2 += __in_frac ? 0 : 4;
+    }
+  }
+  if (!__has_digit)
+  {
+    return __first;
+  }
+
+  if (__it != __last && (*__it == 'p' || *__it == 'P'))
+  {
+    int64_t __exp         = 0;
+    const char* __exp_end = ::cuda::std::__from_chars_fp_parse_exponent(__it + 1, __last, __exp);
+    if (__exp_end != __it + 1)
+    {
+      __exp2 += __exp;
+      __it = __exp_end;
+    }
+  }
+
+  __bits = ::cuda::std::__from_chars_fp_round<_Fmt>(__mant, __exp2, __sticky);
+  return __it;
+}
+
+//! @brief Parses the decimal digits and the decimal exponent as allowed by __fmt
+template <__fp_format _Fmt>
+[[nodiscard]] _CCCL_API constexpr const char* __from_chars_fp_parse_decimal(
+  const char* __first, const char* __last, chars_format __fmt, __from_chars_fp_bits& __bits) noexcept
+{
+  // The first 19 significant digits always fit into 64 bits
+  constexpr int __max_fast_digits = 19;
+
+  uint64_t __w      = 0;
+  int64_t __ndigits = 0; // significant digits, which start with the first nonzero one
+  int64_t __nfrac   = 0; // digits after the decimal point
+  bool __has_digit  = false;
+  bool __in_frac    = false;
+
+  const char* __it = __first;
+  for (; __it != __last; ++__it)
+  {
+    if (*__it == '.' && !__in_frac)
+    {
+      __in_frac = true;
+      continue;
+    }
+    if (!::cuda::std::__from_chars_fp_is_digit(*__it))
+    {
+      break;
+    }
+    __has_digit = true;
+    __nfrac += __in_frac;
+    if (__ndigits == 0 && *__it == '0')
+    {
+      continue;
+    }
+    if (__ndigits < __max_fast_digits)
+    {
+      __w = __w * 10 + static_cast<uint64_t>(*__it - '0');
+    }
+    ++__ndigits;
+  }
+  if (!__has_digit)
+  {
+    return __first;
+  }
+  const char* __digits_last = __it;
+
+  int64_t __exp = 0;
+  if ((__fmt & chars_format::scientific) == chars_format::scientific)
+  {
+    const char* __exp_end = __it;
+    if (__it != __last && (*__it == 'e' || *__it == 'E'))
+    {
+      __exp_end = ::cuda::std::__from_chars_fp_parse_exponent(__it + 1, __last, __exp);
+    }
+    if (__exp_end == __it || __exp_end == __it + 1)
+    {
+      // The scientific format requires an exponent, the general one only consumes a complete one
+      if (__fmt == chars_format::scientific)
+      {
+        return __first;
+      }
+    }
+    else
+    {
+      __it = __exp_end;
+    }
+  }
+
+  const bool __truncated = __ndigits > __max_fast_digits;
+  const int64_t __exp10  = __exp - __nfrac + (__truncated ? __ndigits - __max_fast_digits : 0);
+
+  __bits = ::cuda::std::__eisel_lemire<_Fmt>(__exp10, __w);
+  if (__truncated)
+  {
+    // The value is in [w, w + 1) * 10^exp10, only the remaining digits can decide between different results
+    const __from_chars_fp_bits __upper = ::cuda::std::__eisel_lemire<_Fmt>(__exp10, __w + 1);
+    if (!(__bits == __upper))
+    {
+      __bits = ::cuda::std::__from_chars_fp_digit_comp<_Fmt>({__first, __digits_last, __exp - __nfrac}, __bits);
+    }
+  }
+  return __it;
+}
+
+//! @brief Implements the floating point overload of from_chars
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_fp(const char* __first, const char* __last, _Tp& __value, chars_format __fmt) noexcept
+{
+  _CCCL_ASSERT(__first <= __last, "input range must be a valid range");
+
+  constexpr auto __fp_fmt   = __fp_format_of_v<_Tp>;
+  constexpr int __mant_bits = __fp_mant_nbits_v<__fp_fmt>;
+  constexpr int __inf_exp   = (1 << __fp_exp_nbits_v<__fp_fmt>) - 1;
+  using _Storage            = __fp_storage_of_t<_Tp>;
+
+  const char* __it = __first;
+  const bool __neg = __it != __last && *__it == '-';
+  __it += __neg;
+
+  __from_chars_fp_bits __bits{};
+  const char* __end = __it;
+  if (::cuda::std::__from_chars_fp_starts_with(__it, __last, "inf"))
+  {
+    __end  = __it + (::cuda::std::__from_chars_fp_starts_with(__it, __last, "infinity") ? 8 : 3);
+    __bits = {0, __inf_exp};
+  }
+  else if (::cuda::std::__from_chars_fp_starts_with(__it, __last, "nan"))
+  {
+    __end = __it + 3;
+    // An optional sequence of letters, digits and underscores in parentheses
+    if (__end != __last && *__end == '(')
+    {
+      const char* __p = __end + 1;
+      for (; __p != __last && (::cuda::std::__from_chars_fp_is_digit(*__p) || *__p == '_'
+                               || ('a' <= ::cuda::std::__from_chars_fp_to_lower(*__p)
+                                   && ::cuda::std::__from_chars_fp_to_lower(*__p) <= 'z'));
+           ++__p)
+      {
+      }
+      if (__p != __last && *__p == ')')
+      {
+        __end = __p + 1;
+      }
+    }
+    __bits = {uint64_t{1} << (__mant_bits - 1), __inf_exp};
+  }
+  else
+  {
+    __end = (__fmt == chars_format::hex)
+            ? ::cuda::std::__from_chars_fp_parse_hex<__fp_fmt>(__it, __last, __bits)
+            : ::cuda::std::__from_chars_fp_parse_decimal<__fp_fmt>(__it, __last, __fmt, __bits);
+    if (__end == __it)
+    {
+      return {__first, errc::invalid_argument};
+    }
+
+    // Results that overflow or that underflow to zero are out of range and leave the value unmodified
+    const bool __is_zero = __bits.__exp_ == 0 && __bits.__mant_ == 0;
+    if (__bits.__exp_ == __inf_exp || (__is_zero && !::cuda::std::__from_chars_fp_digits_are_zero(__it, __end, __fmt)))
+    {
+      return {__end, errc::result_out_of_range};
+    }
+  }
+
+  auto __storage = static_cast<_Storage>((static_cast<_Storage>(__bits.__exp_) << __mant_bits) | __bits.__mant_);
+  if (__neg)
+  {
+    __storage |= __fp_sign_mask_v<__fp_fmt>;
+  }
+  __value = ::cuda::std::__fp_from_storage<_Tp>(__storage);
+  return {__end, errc{}};
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_FROM_CHARS_FLOATING_POINT_H
@@ -0,0 +1,303 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_RYU_H
+#define _CUDA_STD___CHARCONV_RYU_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/std/__charconv/ryu_tables.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief Decimal floating point number __digits_ * 10^__exp10_
+struct __fp_decimal
+{
+  uint64_t __digits_;
+  int __exp10_;
+};
+
+inline constexpr int __ryu_pow5_inv_bitcount = 125;
+inline constexpr int __ryu_pow5_bitcount     = 125;
+
+//! @brief Returns the number of bits of 5^__e, valid for __e in [0, 3528]
+[[nodiscard]] _CCCL_API constexpr int __ryu_pow5_bits(int __e) noexcept
+{
+  return static_cast<int>((static_cast<uint32_t>(__e) * 1217359) >> 19) + 1;
+}
+
+//! @brief Returns floor(log10(2^__e)), valid for __e in [0, 1650]
+[[nodiscard]] _CCCL_API constexpr int __ryu_log10_pow2(int __e) noexcept
+{
+  return static_cast<int>((static_cast<uint32_t>(__e) * 78913) >> 18);
+}
+
+//! @brief Returns floor(log10(5^__e)), valid for __e in [0, 2620]
+[[nodiscard]] _CCCL_API constexpr int __ryu_log10_pow5(int __e) noexcept
+{
+  return static_cast<int>((static_cast<uint32_t>(__e) * 732923) >> 20);
+}
+
+[[nodiscard]] _CCCL_API constexpr bool __ryu_multiple_of_pow5(uint64_t __v, int __p) noexcept
+{
+  int __count = 0;
+  for (; __v % 5 == 0 && __count < __p; __v /= 5)
+  {
+    ++__count;
+  }
+  return __count >= __p;
+}
+
+[[nodiscard]] _CCCL_API constexpr bool __ryu_multiple_of_pow2(uint64_t __v, int __p) noexcept
+{
+  return (__v & ((uint64_t{1} << __p) - 1)) == 0;
+}
+
+//! @brief Returns (__m * __mul) >> __j, where __mul is a 128-bit {low, high} table entry and __j is in [64, 128)
+[[nodiscard]] _CCCL_API constexpr uint64_t __ryu_mul_shift(uint64_t __m, const uint64_t (&__mul)[2], int __j) noexcept
+{
+  const uint64_t __low_hi  = ::cuda::mul_hi(__m, __mul[0]);
+  const uint64_t __high_lo = __m * __mul[1];
+  const uint64_t __high_hi = ::cuda::mul_hi(__m, __mul[1]);
+
+  const uint64_t __sum_lo = __low_hi + __high_lo;
+  const uint64_t __sum_hi = __high_hi + (__sum_lo < __low_hi);
+
+  const int __shift = __j - 64;
+  return (__shift == 0) ? __sum_lo : ((__sum_hi << (64 - __shift)) | (__sum_lo >> __shift));
+}
+
+//! @brief Computes the shortest decimal representation that rounds to the finite nonzero IEEE-754 value with the given
+//! mantissa and biased exponent fields, see Ulf Adams, "Ryu: Fast Float-to-String Conversion", PLDI 2018.
+//!
+//! The tables cover the binary64 exponent range, so that binary32 values are converted by the same code.
+template <int _MantBits, int _ExpBias>
+[[nodiscard]] _CCCL_API constexpr __fp_decimal __ryu_shortest(uint64_t __ieee_mant, int __ieee_exp) noexcept
+{
+  static_assert(_MantBits <= 52 && _ExpBias <= 1023, "__ryu_shortest supports at most binary64");
+
+  // Integers in [1, 2^_MantBits] are printed exactly, the digits only need to be stripped of trailing zeros
+  if (__ieee_exp != 0)
+  {
+    const int __e2      = __ieee_exp - _ExpBias - _MantBits;
+    const uint64_t __m2 = (uint64_t{1} << _MantBits) | __ieee_mant;
+    if (__e2 <= 0 && __e2 >= -_MantBits && __ryu_multiple_of_pow2(__m2, -__e2))
+    {
+      __fp_decimal __ret{__m2 >> -__e2, 0};
+      while (__ret.__digits_ % 10 == 0)
+      {
+        __ret.__digits_ /= 10;
+        ++__ret.__exp10_;
+      }
+      return __ret;
+    }
+  }
+
+  int __e2      = 0;
+  uint64_t __m2 = 0;
+  if (__ieee_exp == 0)
+  {
+    __e2 = 1 - _ExpBias - _MantBits - 2;
+    __m2 = __ieee_mant;
+  }
+  else
+  {
+    __e2 = __ieee_exp - _ExpBias - _MantBits - 2;
+    __m2 = (uint64_t{1} << _MantBits) | __ieee_mant;
+  }
+  const bool __accept_bounds = (__m2 % 2) == 0;
+
+  // The halfway points to the neighbouring values are mv + 2 and mv - 1 - mm_shift
+  const uint64_t __mv       = 4 * __m2;
+  const uint32_t __mm_shift = __ieee_mant != 0 || __ieee_exp <= 1;
+
+  uint64_t __vr               = 0;
+  uint64_t __vp               = 0;
+  uint64_t __vm               = 0;
+  int __e10                   = 0;
+  bool __vm_is_trailing_zeros = false;
+  bool __vr_is_trailing_zeros = false;
+  if (__e2 >= 0)
+  {
+    const int __q = ::cuda::std::__ryu_log10_pow2(__e2) - (__e2 > 3);
+    __e10         = __q;
+    const int __k = __ryu_pow5_inv_bitcount + ::cuda::std::__ryu_pow5_bits(__q) - 1;
+    const int __i = -__e2 + __q + __k;
+
+    __vr = ::cuda::std::__ryu_mul_shift(__mv, __ryu_pow5_inv_split[__q], __i);
+    __vp = ::cuda::std::__ryu_mul_shift(__mv + 2, __ryu_pow5_inv_split[__q], __i);
+    __vm = ::cuda::std::__ryu_mul_shift(__mv - 1 - __mm_shift, __ryu_pow5_inv_split[__q], __i);
+    if (__q <= 21)
+    {
+      // Only one of mp, mv and mm can be a multiple of 5, if any
+      if (__mv % 5 == 0)
+      {
+        __vr_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow5(__mv, __q);
+      }
+      else if (__accept_bounds)
+      {
+        __vm_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow5(__mv - 1 - __mm_shift, __q);
+      }
+      else
+      {
+        __vp -= ::cuda::std::__ryu_multiple_of_pow5(__mv + 2, __q);
+      }
+    }
+  }
+  else
+  {
+    const int __q = ::cuda::std::__ryu_log10_pow5(-__e2) - (-__e2 > 1);
+    __e10         = __q + __e2;
+    const int __i = -__e2 - __q;
+    const int __k = ::cuda::std::__ryu_pow5_bits(__i) - __ryu_pow5_bitcount;
+    const int __j = __q - __k;
+
+    __vr = ::cuda::std::__ryu_mul_shift(__mv, __ryu_pow5_split[__i], __j);
+    __vp = ::cuda::std::__ryu_mul_shift(__mv + 2, __ryu_pow5_split[__i], __j);
+    __vm = ::cuda::std::__ryu_mul_shift(__mv - 1 - __mm_shift, __ryu_pow5_split[__i], __j);
+    if (__q <= 1)
+    {
+      // mv has at least q trailing zero bits, so vr is exact
+      __vr_is_trailing_zeros = true;
+      if (__accept_bounds)
+      {
+        __vm_is_trailing_zeros = __mm_shift == 1;
+      }
+      else
+      {
+        --__vp;
+      }
+    }
+    else if (__q < 63)
+    {
+      __vr_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow2(__mv, __q);
+    }
+  }
+
+  // Remove the digits that are shared by the whole rounding interval
+  int __removed                 = 0;
+  uint64_t __last_removed_digit = 0;
+  uint64_t __output             = 0;
+  if (__vm_is_trailing_zeros || __vr_is_trailing_zeros)
+  {
+    // General case, which happens rarely
+    while (__vp / 10 > __vm / 10)
+    {
+      __vm_is_trailing_zeros &= __vm % 10 == 0;
+      __vr_is_trailing_zeros &= __last_removed_digit == 0;
+      __last_removed_digit = __vr % 10;
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+      ++__removed;
+    }
+    if (__vm_is_trailing_zeros)
+    {
+      while (__vm % 10 == 0)
+      {
+        __vr_is_trailing_zeros &= __last_removed_digit == 0;
+        __last_removed_digit = __vr % 10;
+        __vr /= 10;
+        __vp /= 10;
+        __vm /= 10;
+        ++__removed;
+      }
+    }
+    if (__vr_is_trailing_zeros && __last_removed_digit == 5 && __vr % 2 == 0)
+    {
+      // Round to even if the exact value is .....50..0
+      __last_removed_digit = 4;
+    }
+    __output = __vr + ((__vr == __vm && (!__accept_bounds || !__vm_is_trailing_zeros)) || __last_removed_digit >= 5);
+  }
+  else
+  {
+    // Specialized for the common case, where the lower bound is never included and the exact value never needs to
+    // be rounded to even
+    bool __round_up = false;
+    if (__vp / 100 > __vm / 100)
+    {
+      __round_up = __vr % 100 >= 50;
+      __vr /= 100;
+      __vp /= 100;
+      __vm /= 100;
+      __removed += 2;
+    }
+    while (__vp / 10 > __vm / 10)
+    {
+      __round_up = __vr % 10 >= 5;
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+      ++__removed;
+    }
+    __output = __vr + (__vr == __vm || __round_up);
+  }
+  return {__output, __e10 + __removed};
+}
+
+//! @brief Decimal floating point number __digits_ * 10^__exp10_ that was truncated from a binary one, __exact_ is
+//! false if nonzero digits were cut off
+struct __fp_truncated_decimal
+{
+  uint64_t __digits_;
+  int __exp10_;
+  bool __exact_;
+};
+
+//! @brief Computes the leading 17 to 19 decimal digits of a finite nonzero normal binary64 value, or the leading 8 to
+//! 10 ones of a binary32 value, with the same multiplications that __ryu_shortest uses for the rounding interval.
+//! Subnormal values yield fewer digits.
+template <int _MantBits, int _ExpBias>
+[[nodiscard]] _CCCL_API constexpr __fp_truncated_decimal
+__ryu_truncated(uint64_t __ieee_mant, int __ieee_exp) noexcept
+{
+  static_assert(_MantBits <= 52 && _ExpBias <= 1023, "__ryu_truncated supports at most binary64");
+
+  const int __e2      = ((__ieee_exp == 0) ? 1 : __ieee_exp) - _ExpBias - _MantBits - 2;
+  const uint64_t __mv = 4 * ((__ieee_exp == 0) ? __ieee_mant : ((uint64_t{1} << _MantBits) | __ieee_mant));
+  if (__e2 >= 0)
+  {
+    // The value is __mv * 2^(__e2 - __q) / 5^__q, which is an integer only if 5^__q divides __mv
+    const int __q = ::cuda::std::__ryu_log10_pow2(__e2) - (__e2 > 3);
+    const int __k = __ryu_pow5_inv_bitcount + ::cuda::std::__ryu_pow5_bits(__q) - 1;
+    return {::cuda::std::__ryu_mul_shift(__mv, __ryu_pow5_inv_split[__q], -__e2 + __q + __k),
+            __q,
+            ::cuda::std::__ryu_multiple_of_pow5(__mv, __q)};
+  }
+  else
+  {
+    // The value is __mv * 5^__i / 2^__q, which is an integer only if 2^__q divides __mv
+    const int __q = ::cuda::std::__ryu_log10_pow5(-__e2) - (-__e2 > 1);
+    const int __i = -__e2 - __q;
+    const int __k = ::cuda::std::__ryu_pow5_bits(__i) - __ryu_pow5_bitcount;
+    return {::cuda::std::__ryu_mul_shift(__mv, __ryu_pow5_split[__i], __q - __k),
+            __q + __e2,
+            __q < 64 && ::cuda::std::__ryu_multiple_of_pow2(__mv, __q)};
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_RYU_H
@@ -21,11 +21,14 @@
 #endif // no system header
 
 #include <cuda/__cmath/uabs.h>
+#include <cuda/std/__bit/integral.h>
 #include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/digits.h>
+#include <cuda/std/__charconv/to_chars_floating_point.h>
 #include <cuda/std/__charconv/to_chars_result.h>
 #include <cuda/std/__concepts/concept_macros.h>
 #include <cuda/std/__cstddef/types.h>
-#include <cuda/std/__type_traits/always_false.h>
+#include <cuda/std/__floating_point/format.h>
 #include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/is_floating_point.h>
 #include <cuda/std/__type_traits/is_integer.h>
@@ -52,6 +55,26 @@ template <class _Tp>
 
   auto __uv = static_cast<_Up>(__v);
 
+  if (__base == 10)
+  {
+    int __r = 0;
+    if constexpr (sizeof(_Up) > sizeof(uint64_t))
+    {
+      // Strip 19 digits at a time until the rest fits into 64 bits
+      for (; (__uv >> 64) != 0; __uv /= __charconv_pow10[19])
+      {
+        __r += 19;
+      }
+    }
+    return __r + ::cuda::std::__charconv_decimal_width(static_cast<uint64_t>(__uv));
+  }
+
+  if (const int __log2_base = ::cuda::std::__charconv_log2_base(__base); __log2_base != 0)
+  {
+    const int __bits = (__uv == 0) ? 1 : ::cuda::std::bit_width(__uv);
+    return (__bits + __log2_base - 1) / __log2_base;
+  }
+
   const auto __ubase   = static_cast<_Up>(__base);
   const auto __ubase_2 = __ubase * __ubase;
   const auto __ubase_3 = __ubase_2 * __ubase;
@@ -84,6 +107,37 @@ template <class _Tp>
   _CCCL_UNREACHABLE();
 }
 
+//! @brief Writes the __n decimal digits of the unsigned __value to [__first, __first + __n), two at a time
+template <class _Tp>
+_CCCL_API constexpr void __to_chars_int_base10(char* __first, _Tp __value, int __n) noexcept
+{
+  if constexpr (sizeof(_Tp) > sizeof(uint64_t))
+  {
+    // Write 19 digits at a time until the rest fits into 64 bits
+    for (; (__value >> 64) != 0; __n -= 19)
+    {
+      const auto __chunk = static_cast<uint64_t>(__value % __charconv_pow10[19]);
+      __value /= __charconv_pow10[19];
+      ::cuda::std::__charconv_write_decimal(__first + __n - 19, __chunk, 19);
+    }
+  }
+  // 32-bit arithmetic is considerably faster on device
+  using _Up = ::cuda::std::conditional_t<sizeof(_Tp) <= sizeof(uint32_t), uint32_t, uint64_t>;
+  ::cuda::std::__charconv_write_decimal(__first, static_cast<_Up>(__value), __n);
+}
+
+//! @brief Writes the digits of the unsigned __value in base 2^__log2_base, ending at __last
+template <class _Tp>
+_CCCL_API constexpr void __to_chars_int_pow2(char* __last, _Tp __value, int __log2_base) noexcept
+{
+  const auto __mask = static_cast<_Tp>((1u << __log2_base) - 1);
+  do
+  {
+    *--__last = __charconv_digit_chars[static_cast<int>(__value & __mask)];
+    __value >>= __log2_base;
+  } while (__value != 0);
+}
+
 template <class _Tp>
 _CCCL_API constexpr void __to_chars_int_generic(char* __last, _Tp __value, int __base) noexcept
 {
@@ -123,7 +177,18 @@ to_chars(char* __first, char* __last, _Tp __value, int __base = 10) noexcept
 
     char* __new_last = __first + __n;
 
-    ::cuda::std::__to_chars_int_generic(__new_last, __value, __base);
+    if (__base == 10)
+    {
+      ::cuda::std::__to_chars_int_base10(__first, __value, __n);
+    }
+    else if (const int __log2_base = ::cuda::std::__charconv_log2_base(__base); __log2_base != 0)
+    {
+      ::cuda::std::__to_chars_int_pow2(__new_last, __value, __log2_base);
+    }
+    else
+    {
+      ::cuda::std::__to_chars_int_generic(__new_last, __value, __base);
+    }
 
     return {__new_last, errc{}};
   }
@@ -148,12 +213,9 @@ _CCCL_TEMPLATE(class _Tp)
 _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result to_chars(char* __first, char* __last, _Tp __value) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  return {};
+  static_assert(__charconv_fp_supported_v<__fp_format_of_v<_Tp>>,
+                "cuda::std::to_chars is only implemented for binary32 and binary64 floating point types");
+  return ::cuda::std::__to_chars_fp(__first, __last, __value, chars_format{}, -1);
 }
 
 _CCCL_TEMPLATE(class _Tp)
@@ -161,13 +223,12 @@ _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result
 to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  return {};
+  static_assert(__charconv_fp_supported_v<__fp_format_of_v<_Tp>>,
+                "cuda::std::to_chars is only implemented for binary32 and binary64 floating point types");
+  _CCCL_ASSERT(__fmt == chars_format::scientific || __fmt == chars_format::fixed || __fmt == chars_format::general
+                 || __fmt == chars_format::hex,
+               "format must be one of the chars_format enumerators");
+  return ::cuda::std::__to_chars_fp(__first, __last, __value, __fmt, -1);
 }
 
 _CCCL_TEMPLATE(class _Tp)
@@ -175,14 +236,17 @@ _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result
 to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt, int __prec) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  (void) __prec;
-  return {};
+  static_assert(__charconv_fp_supported_v<__fp_format_of_v<_Tp>>,
+                "cuda::std::to_chars is only implemented for binary32 and binary64 floating point types");
+  _CCCL_ASSERT(__fmt == chars_format::scientific || __fmt == chars_format::fixed || __fmt == chars_format::general
+                 || __fmt == chars_format::hex,
+               "format must be one of the chars_format enumerators");
+  // Like printf, a negative precision is ignored, which means 6 for the decimal formats and the exact value for hex
+  if (__prec < 0)
+  {
+    __prec = (__fmt == chars_format::hex) ? -1 : 6;
+  }
+  return ::cuda::std::__to_chars_fp(__first, __last, __value, __fmt, __prec);
 }
 
 _CCCL_END_NAMESPACE_CUDA_STD
@@ -0,0 +1,813 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_TO_CHARS_FLOATING_POINT_H
+#define _CUDA_STD___CHARCONV_TO_CHARS_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__charconv/bigint.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/digits.h>
+#include <cuda/std/__charconv/ryu.h>
+#include <cuda/std/__charconv/to_chars_result.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__floating_point/decompose.h>
+#include <cuda/std/__floating_point/format.h>
+#include <cuda/std/__floating_point/mask.h>
+#include <cuda/std/__floating_point/properties.h>
+#include <cuda/std/__floating_point/storage.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief Whether to_chars and from_chars are implemented for the floating point format
+template <__fp_format _Fmt>
+inline constexpr bool __charconv_fp_supported_v = _Fmt == __fp_format::__binary32 || _Fmt == __fp_format::__binary64;
+
+//! @brief Returns the length of the exponent of the scientific format, which has at least two digits
+[[nodiscard]] _CCCL_API constexpr int __to_chars_fp_exp10_width(int __exp) noexcept
+{
+  return (__exp <= -100 || __exp >= 100) ? 5 : 4;
+}
+
+_CCCL_API constexpr char* __to_chars_fp_write_exp10(char* __first, int __exp) noexcept
+{
+  *__first++ = 'e';
+  *__first++ = (__exp < 0) ? '-' : '+';
+
+  const int __abs = (__exp < 0) ? -__exp : __exp;
+  if (__abs >= 100)
+  {
+    *__first++ = static_cast<char>('0' + __abs / 100);
+  }
+  *__first++ = static_cast<char>('0' + (__abs / 10) % 10);
+  *__first++ = static_cast<char>('0' + __abs % 10);
+  return __first;
+}
+
+//! @brief Produces the exact decimal digits of a finite value __mant * 2^__exp one at a time, first the digits of the
+//! integer part and then the ones of the fraction.
+//!
+//! The integer part is converted to base 10^9 up front. The fraction is kept as __frac_ / 2^__frac_bits_ and yields
+//! nine digits per step: multiplying it by 10^9 = 5^9 * 2^9 only needs a multiplication by 5^9 while the denominator
+//! shrinks by 2^9.
+template <__fp_format _Fmt>
+class __to_chars_fp_exact_digits
+{
+  static constexpr int __max_int_bits  = __fp_exp_max_v<_Fmt> + 1;
+  static constexpr int __max_frac_bits = __fp_exp_bias_v<_Fmt> - 1 + __fp_mant_nbits_v<_Fmt> + 21; // 5^9 < 2^21
+  static constexpr int __limbs         =
+    ((__max_int_bits > __max_frac_bits ? __max_int_bits : __max_frac_bits) + 31) / 32;
+  static constexpr int __max_int_chunks = (__max_int_bits * 30103 / 100000 + 9) / 9;
+
+  static constexpr uint32_t __chunk_base = 1000000000;
+
+  using __bigint = __charconv_bigint<__limbs>;
+
+  uint32_t __int_chunks_[__max_int_chunks]{}; // base 10^9 digits of the integer part, least significant first
+  int __next_int_chunk_ = -1; // index of the next chunk to be consumed
+  int __int_digits_     = 0;
+  __bigint __frac_{};
+  int __frac_bits_        = 0;
+  uint32_t __chunk_       = 0; // unconsumed digits of the current chunk
+  uint32_t __chunk_pow10_ = 1; // 10^(number of unconsumed digits of the current chunk)
+
+  _CCCL_API constexpr void __refill() noexcept
+  {
+    __chunk_pow10_ = __chunk_base;
+    if (__next_int_chunk_ >= 0)
+    {
+      __chunk_ = __int_chunks_[__next_int_chunk_--];
+    }
+    else if (__frac_.__is_zero())
+    {
+      __chunk_ = 0;
+    }
+    else
+    {
+      __frac_.__mul_add(1953125); // 5^9
+      if (__frac_bits_ >= 9)
+      {
+        __frac_bits_ -= 9;
+      }
+      else
+      {
+        __frac_.__shift_left(9 - __frac_bits_);
+        __frac_bits_ = 0;
+      }
+      __chunk_ = __frac_.__split(__frac_bits_);
+    }
+  }
+
+public:
+  _CCCL_API constexpr __to_chars_fp_exact_digits(uint64_t __mant, int __exp) noexcept
+  {
+    __bigint __int{};
+    if (__exp >= 0)
+    {
+      __int = __bigint{__mant};
+      __int.__shift_left(__exp);
+    }
+    else if (__exp > -64)
+    {
+      __int        = __bigint{__mant >> -__exp};
+      __frac_      = __bigint{__mant & ((uint64_t{1} << -__exp) - 1)};
+      __frac_bits_ = -__exp;
+    }
+    else
+    {
+      __frac_      = __bigint{__mant};
+      __frac_bits_ = -__exp;
+    }
+
+    int __nchunks = 0;
+    while (!__int.__is_zero())
+    {
+      __int_chunks_[__nchunks++] = __int.__div_small(__chunk_base);
+    }
+    if (__nchunks > 0)
+    {
+      // The most significant chunk has no leading zeros
+      __chunk_       = __int_chunks_[__nchunks - 1];
+      __int_digits_  = 9 * (__nchunks - 1) + ::cuda::std::__charconv_decimal_width(__chunk_);
+      __chunk_pow10_ = 1;
+      for (int __i = __int_digits_ - 9 * (__nchunks - 1); __i > 0; --__i)
+      {
+        __chunk_pow10_ *= 10;
+      }
+      __next_int_chunk_ = __nchunks - 2;
+    }
+  }
+
+  //! @brief Returns the number of digits of the integer part, which is 0 if the integer part is 0
+  [[nodiscard]] _CCCL_API constexpr int __int_digits() const noexcept
+  {
+    return __int_digits_;
+  }
+
+  //! @brief Skips the leading zeros of a nonzero value that is less than 1 and returns their number
+  [[nodiscard]] _CCCL_API constexpr int __skip_leading_zeros() noexcept
+  {
+    _CCCL_ASSERT(__int_digits_ == 0 && !__frac_.__is_zero(), "value must be in (0, 1)");
+
+    // floor((frac_bits - bit_width(frac)) * log10(2)) never exceeds the number of leading zeros. Skipping them at once
+    // multiplies the fraction by 10^k = 5^k * 2^k
+    const int __k = ((__frac_bits_ - __frac_.__bit_width()) * 78913) >> 18;
+    __frac_.__mul_pow5(__k);
+    __frac_bits_ -= __k;
+
+    int __zeros = __k;
+    for (;;)
+    {
+      __refill();
+      if (__chunk_ != 0)
+      {
+        break;
+      }
+      __zeros += 9;
+    }
+    while (__chunk_ < __chunk_pow10_ / 10)
+    {
+      __chunk_pow10_ /= 10;
+      ++__zeros;
+    }
+    return __zeros;
+  }
+
+  //! @brief Returns the next digit
+  [[nodiscard]] _CCCL_API constexpr int __next() noexcept
+  {
+    if (__chunk_pow10_ == 1)
+    {
+      __refill();
+    }
+    __chunk_pow10_ /= 10;
+    const auto __digit = __chunk_ / __chunk_pow10_;
+    __chunk_ %= __chunk_pow10_;
+    return static_cast<int>(__digit);
+  }
+
+  //! @brief Returns whether all remaining digits are zero
+  [[nodiscard]] _CCCL_API constexpr bool __rest_is_zero() const noexcept
+  {
+    if (__chunk_ != 0 || !__frac_.__is_zero())
+    {
+      return false;
+    }
+    for (int __i = __next_int_chunk_; __i >= 0; --__i)
+    {
+      if (__int_chunks_[__i] != 0)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //! @brief Consumes the next digit and returns whether the digits produced so far have to be rounded up, rounding
+  //! half to even. __odd is whether the last produced digit is odd
+  [[nodiscard]] _CCCL_API constexpr bool __round_up(bool __odd) noexcept
+  {
+    const int __digit = __next();
+    return __digit > 5 || (__digit == 5 && (__odd || !__rest_is_zero()));
+  }
+};
+
+//! @brief Adds one to the last digit of [__first, __last), skipping the decimal point. Returns false if all digits
+//! were 9, which leaves them all 0
+_CCCL_API constexpr bool __to_chars_fp_propagate_carry(char* __first, char* __last) noexcept
+{
+  while (__last != __first)
+  {
+    --__last;
+    if (*__last == '.')
+    {
+      continue;
+    }
+    if (*__last != '9')
+    {
+      ++*__last;
+      return true;
+    }
+    *__last = '0';
+  }
+  return false;
+}
+
+//! @brief Writes the finite value __mant * 2^__exp with __prec digits after the decimal point
+template <__fp_format _Fmt>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_fixed(char* __first, char* __last, uint64_t __mant, int __exp, int __prec) noexcept
+{
+  __to_chars_fp_exact_digits<_Fmt> __digits{__mant, __exp};
+
+  const int __int_digits = __digits.__int_digits();
+  const ptrdiff_t __len  = ((__int_digits == 0) ? 1 : __int_digits) + ((__prec > 0) ? ptrdiff_t{__prec} + 1 : 0);
+  if (__last - __first < __len)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  char* __it = __first;
+  if (__int_digits == 0)
+  {
+    *__it++ = '0';
+  }
+  for (int __i = 0; __i < __int_digits; ++__i)
+  {
+    *__it++ = static_cast<char>('0' + __digits.__next());
+  }
+  if (__prec > 0)
+  {
+    *__it++ = '.';
+    for (int __i = 0; __i < __prec; ++__i)
+    {
+      *__it++ = static_cast<char>('0' + __digits.__next());
+    }
+  }
+
+  if (__digits.__round_up((__it[-1] - '0') % 2 != 0)
+      && !::cuda::std::__to_chars_fp_propagate_carry(__first, __it))
+  {
+    // All digits were 9, so the integer part gains a leading 1
+    if (__it == __last)
+    {
+      return {__last, errc::value_too_large};
+    }
+    for (char* __p = __it; __p != __first; --__p)
+    {
+      *__p = __p[-1];
+    }
+    *__first = '1';
+    ++__it;
+  }
+  return {__it, errc{}};
+}
+
+//! @brief Writes the finite value __mant * 2^__exp in scientific notation with __prec digits after the decimal point
+template <__fp_format _Fmt>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_scientific(char* __first, char* __last, uint64_t __mant, int __exp, int __prec) noexcept
+{
+  __to_chars_fp_exact_digits<_Fmt> __digits{__mant, __exp};
+
+  int __exp10 = 0;
+  if (__digits.__int_digits() > 0)
+  {
+    __exp10 = __digits.__int_digits() - 1;
+  }
+  else if (__mant != 0)
+  {
+    __exp10 = -1 - __digits.__skip_leading_zeros();
+  }
+
+  const ptrdiff_t __len =
+    1 + ((__prec > 0) ? ptrdiff_t{__prec} + 1 : 0) + ::cuda::std::__to_chars_fp_exp10_width(__exp10);
+  if (__last - __first < __len)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  char* __it = __first;
+  *__it++    = static_cast<char>('0' + __digits.__next());
+  if (__prec > 0)
+  {
+    *__it++ = '.';
+    for (int __i = 0; __i < __prec; ++__i)
+    {
+      *__it++ = static_cast<char>('0' + __digits.__next());
+    }
+  }
+
+  if (__digits.__round_up((__it[-1] - '0') % 2 != 0)
+      && !::cuda::std::__to_chars_fp_propagate_carry(__first, __it))
+  {
+    // All digits were 9 and are 0 now, the value was rounded up to the next power of 10
+    *__first = '1';
+    ++__exp10;
+    if (__last - __it < ::cuda::std::__to_chars_fp_exp10_width(__exp10))
+    {
+      return {__last, errc::value_too_large};
+    }
+  }
+  return {::cuda::std::__to_chars_fp_write_exp10(__it, __exp10), errc{}};
+}
+
+//! @brief Writes the finite nonzero value __mant * 2^__exp like printf's %g with precision __prec
+template <__fp_format _Fmt>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_general(char* __first, char* __last, uint64_t __mant, int __exp, int __prec) noexcept
+{
+  const int __sig_digits = (__prec == 0) ? 1 : __prec;
+
+  __to_chars_fp_exact_digits<_Fmt> __digits{__mant, __exp};
+  const int __skipped = (__digits.__int_digits() > 0) ? 0 : __digits.__skip_leading_zeros();
+  int __exp10         = (__digits.__int_digits() > 0) ? __digits.__int_digits() - 1 : -1 - __skipped;
+
+  // The first pass rounds to __sig_digits significant digits and finds how many of them remain once the trailing
+  // zeros are removed, which determines the notation and the length of the result
+  int __last_nonzero  = -1;
+  int __last_not_nine = -1;
+  int __digit         = 0;
+  int __i             = 0;
+  for (; __i < __sig_digits; ++__i)
+  {
+    __digit = __digits.__next();
+    if (__digit != 0)
+    {
+      __last_nonzero = __i;
+    }
+    if (__digit != 9)
+    {
+      __last_not_nine = __i;
+    }
+    if (__digits.__rest_is_zero())
+    {
+      break;
+    }
+  }
+  const bool __round_up = __i == __sig_digits && __digits.__round_up(__digit % 2 != 0);
+
+  int __len    = __last_nonzero + 1;
+  bool __carry = false;
+  if (__round_up)
+  {
+    __len   = __last_not_nine + 1;
+    __carry = __last_not_nine < 0;
+    if (__carry)
+    {
+      // All digits were 9, the value was rounded up to the next power of 10
+      __len = 1;
+      ++__exp10;
+    }
+  }
+
+  const bool __fixed       = -4 <= __exp10 && __exp10 < __sig_digits;
+  const int __frac_digits  = __fixed ? __len - 1 - __exp10 : __len - 1;
+  const ptrdiff_t __outlen =
+    __fixed ? ((__exp10 >= 0) ? __exp10 + 1 : 1) + ((__frac_digits > 0) ? __frac_digits + 1 : 0)
+            : __len + (__len > 1) + ::cuda::std::__to_chars_fp_exp10_width(__exp10);
+  if (__last - __first < __outlen)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  // The second pass writes the __len significant digits
+  __digits = __to_chars_fp_exact_digits<_Fmt>{__mant, __exp};
+  if (__digits.__int_digits() == 0)
+  {
+    (void) __digits.__skip_leading_zeros();
+  }
+  auto __next_digit = [&](int __idx) {
+    if (__carry)
+    {
+      return '1';
+    }
+    return static_cast<char>('0' + __digits.__next() + (__round_up && __idx == __len - 1));
+  };
+
+  char* __it = __first;
+  if (__fixed && __exp10 < 0)
+  {
+    *__it++ = '0';
+    *__it++ = '.';
+    for (int __z = -1; __z > __exp10; --__z)
+    {
+      *__it++ = '0';
+    }
+    for (int __idx = 0; __idx < __len; ++__idx)
+    {
+      *__it++ = __next_digit(__idx);
+    }
+  }
+  else if (__fixed)
+  {
+    for (int __idx = 0; __idx <= __exp10; ++__idx)
+    {
+      *__it++ = (__idx < __len) ? __next_digit(__idx) : '0';
+    }
+    if (__frac_digits > 0)
+    {
+      *__it++ = '.';
+      for (int __idx = __exp10 + 1; __idx < __len; ++__idx)
+      {
+        *__it++ = __next_digit(__idx);
+      }
+    }
+  }
+  else
+  {
+    *__it++ = __next_digit(0);
+    if (__len > 1)
+    {
+      *__it++ = '.';
+      for (int __idx = 1; __idx < __len; ++__idx)
+      {
+        *__it++ = __next_digit(__idx);
+      }
+    }
+    __it = ::cuda::std::__to_chars_fp_write_exp10(__it, __exp10);
+  }
+  return {__it, errc{}};
+}
+
+[[nodiscard]] _CCCL_API constexpr int __to_chars_fp_scientific_len(__fp_decimal __dec) noexcept
+{
+  const int __n = ::cuda::std::__charconv_decimal_width(__dec.__digits_);
+  return __n + (__n > 1) + ::cuda::std::__to_chars_fp_exp10_width(__dec.__exp10_ + __n - 1);
+}
+
+[[nodiscard]] _CCCL_API constexpr int __to_chars_fp_fixed_len(__fp_decimal __dec) noexcept
+{
+  const int __n = ::cuda::std::__charconv_decimal_width(__dec.__digits_);
+  const int __e = __dec.__exp10_;
+  return (__e >= 0) ? __n + __e : ((__n > -__e) ? __n + 1 : 2 - __e);
+}
+
+//! @brief Writes all digits of the decimal value __dec in scientific or fixed notation
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_write_decimal(char* __first, char* __last, __fp_decimal __dec, bool __scientific) noexcept
+{
+  const int __n     = ::cuda::std::__charconv_decimal_width(__dec.__digits_);
+  const int __e     = __dec.__exp10_;
+  const int __exp10 = __e + __n - 1;
+
+  const int __fixed_len = ::cuda::std::__to_chars_fp_fixed_len(__dec);
+  if (__last - __first < (__scientific ? ::cuda::std::__to_chars_fp_scientific_len(__dec) : __fixed_len))
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  if (__scientific)
+  {
+    // Write the digits one position to the right and move the first one in front of the decimal point
+    ::cuda::std::__charconv_write_decimal(__first + 1, __dec.__digits_, __n);
+    __first[0] = __first[1];
+    if (__n > 1)
+    {
+      __first[1] = '.';
+    }
+    return {::cuda::std::__to_chars_fp_write_exp10(__first + __n + (__n > 1), __exp10), errc{}};
+  }
+
+  if (__e >= 0)
+  {
+    ::cuda::std::__charconv_write_decimal(__first, __dec.__digits_, __n);
+    for (int __i = 0; __i < __e; ++__i)
+    {
+      __first[__n + __i] = '0';
+    }
+  }
+  else if (__n > -__e)
+  {
+    // Write the digits and move the fractional ones to the right of the decimal point
+    const int __int_len = __n + __e;
+    ::cuda::std::__charconv_write_decimal(__first, __dec.__digits_, __n);
+    for (int __i = __n; __i > __int_len; --__i)
+    {
+      __first[__i] = __first[__i - 1];
+    }
+    __first[__int_len] = '.';
+  }
+  else
+  {
+    __first[0] = '0';
+    __first[1] = '.';
+    for (int __i = 2; __i < __fixed_len - __n; ++__i)
+    {
+      __first[__i] = '0';
+    }
+    ::cuda::std::__charconv_write_decimal(__first + __fixed_len - __n, __dec.__digits_, __n);
+  }
+  return {__first + __fixed_len, errc{}};
+}
+
+//! @brief Writes the decimal value __dec, the shortest one that rounds to the finite value __mant * 2^__exp
+template <__fp_format _Fmt>
+[[nodiscard]] _CCCL_API constexpr to_chars_result __to_chars_fp_shortest(
+  char* __first, char* __last, __fp_decimal __dec, chars_format __fmt, uint64_t __mant, int __exp) noexcept
+{
+  const int __exp10 = __dec.__exp10_ + ::cuda::std::__charconv_decimal_width(__dec.__digits_) - 1;
+
+  bool __scientific = false;
+  switch (__fmt)
+  {
+    case chars_format::scientific:
+      __scientific = true;
+      break;
+    case chars_format::fixed:
+      break;
+    case chars_format::general:
+      __scientific = __exp10 < -4 || __exp10 >= 6;
+      break;
+    default: // the plain overload picks the shorter notation and prefers fixed one on ties
+      __scientific = ::cuda::std::__to_chars_fp_scientific_len(__dec) < ::cuda::std::__to_chars_fp_fixed_len(__dec);
+      break;
+  }
+
+  if (!__scientific && __dec.__exp10_ > 0 && __exp > 0)
+  {
+    // Large integers are printed with their exact digits rather than padded with zeros
+    return ::cuda::std::__to_chars_fp_fixed<_Fmt>(__first, __last, __mant, __exp, 0);
+  }
+  return ::cuda::std::__to_chars_fp_write_decimal(__first, __last, __dec, __scientific);
+}
+
+//! @brief Rounds the truncated decimal __trunc half to even to a multiple of 10^__exp10. Fails if the rounding depends
+//! on the digits that were cut off, which is the case if no digit of __trunc is rounded away.
+[[nodiscard]] _CCCL_API constexpr bool
+__to_chars_fp_round(__fp_truncated_decimal __trunc, int __exp10, __fp_decimal& __dec) noexcept
+{
+  const int __k = __exp10 - __trunc.__exp10_;
+  if (__k < 1)
+  {
+    return false;
+  }
+  __dec = {0, __exp10};
+  if (__k >= 20)
+  {
+    // __trunc has at most 20 digits, so the value is below half of 10^__exp10
+    return true;
+  }
+
+  const uint64_t __pow10 = __charconv_pow10[__k];
+  const uint64_t __rem   = __trunc.__digits_ % __pow10;
+  const uint64_t __half  = __pow10 / 2;
+  __dec.__digits_        = __trunc.__digits_ / __pow10;
+  __dec.__digits_ += __rem > __half || (__rem == __half && (!__trunc.__exact_ || __dec.__digits_ % 2 != 0));
+  return true;
+}
+
+//! @brief Writes a finite nonzero value with a precision from its leading decimal digits in __trunc. Fails if the
+//! precision asks for more digits than __trunc has, the exact digits are needed then.
+[[nodiscard]] _CCCL_API constexpr bool __to_chars_fp_precision_from_truncated(
+  char* __first,
+  char* __last,
+  __fp_truncated_decimal __trunc,
+  chars_format __fmt,
+  int __prec,
+  to_chars_result& __result) noexcept
+{
+  // Position of the leading digit
+  const int __lead = __trunc.__exp10_ + ::cuda::std::__charconv_decimal_width(__trunc.__digits_) - 1;
+
+  __fp_decimal __dec{};
+  if (__fmt == chars_format::fixed)
+  {
+    if (!::cuda::std::__to_chars_fp_round(__trunc, -__prec, __dec))
+    {
+      return false;
+    }
+    __result = ::cuda::std::__to_chars_fp_write_decimal(__first, __last, __dec, false);
+    return true;
+  }
+
+  const int __sig_digits = (__fmt == chars_format::scientific) ? __prec + 1 : ((__prec == 0) ? 1 : __prec);
+  if (!::cuda::std::__to_chars_fp_round(__trunc, __lead - __sig_digits + 1, __dec))
+  {
+    return false;
+  }
+  if (::cuda::std::__charconv_decimal_width(__dec.__digits_) > __sig_digits)
+  {
+    // All digits were 9, the value was rounded up to the next power of 10
+    __dec.__digits_ /= 10;
+    ++__dec.__exp10_;
+  }
+
+  bool __scientific = true;
+  if (__fmt == chars_format::general)
+  {
+    const int __exp10 = __dec.__exp10_ + __sig_digits - 1;
+    __scientific      = __exp10 < -4 || __exp10 >= __sig_digits;
+    for (; __dec.__digits_ % 10 == 0; __dec.__digits_ /= 10)
+    {
+      ++__dec.__exp10_;
+    }
+  }
+  __result = ::cuda::std::__to_chars_fp_write_decimal(__first, __last, __dec, __scientific);
+  return true;
+}
+
+//! @brief Writes a finite value in the hexadecimal notation of printf's %a without the 0x prefix. A negative __prec
+//! writes as many digits as needed to represent the value exactly
+template <__fp_format _Fmt>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_hex(char* __first, char* __last, uint64_t __ieee_mant, int __ieee_exp, int __prec) noexcept
+{
+  constexpr int __mant_bits = __fp_mant_nbits_v<_Fmt>;
+  constexpr int __nibbles   = (__mant_bits + 3) / 4;
+
+  // The significand is the leading digit followed by the fraction, left aligned to full hexadecimal digits
+  uint64_t __frac = __ieee_mant << (4 * __nibbles - __mant_bits);
+  uint64_t __lead = (__ieee_exp != 0);
+  int __exp2      = (__ieee_exp != 0) ? __ieee_exp - __fp_exp_bias_v<_Fmt> : 1 - __fp_exp_bias_v<_Fmt>;
+  if (__ieee_exp == 0 && __ieee_mant == 0)
+  {
+    __exp2 = 0;
+  }
+
+  int __frac_digits = __nibbles;
+  int __zeros       = 0;
+  if (__prec < 0)
+  {
+    for (; __frac_digits > 0 && (__frac & 0xf) == 0; --__frac_digits)
+    {
+      __frac >>= 4;
+    }
+  }
+  else if (__prec < __nibbles)
+  {
+    // Round half to even, which may carry into the leading digit
+    const int __dropped   = 4 * (__nibbles - __prec);
+    uint64_t __sig        = (__lead << (4 * __nibbles)) | __frac;
+    const uint64_t __rem  = __sig & ((uint64_t{1} << __dropped) - 1);
+    const uint64_t __half = uint64_t{1} << (__dropped - 1);
+    __sig >>= __dropped;
+    __sig += (__rem > __half || (__rem == __half && (__sig & 1) != 0));
+    __lead        = __sig >> (4 * __prec);
+    __frac        = __sig & ((uint64_t{1} << (4 * __prec)) - 1);
+    __frac_digits = __prec;
+  }
+  else
+  {
+    __zeros = __prec - __nibbles;
+  }
+
+  const uint32_t __abs_exp2 = static_cast<uint32_t>((__exp2 < 0) ? -__exp2 : __exp2);
+  const int __exp2_digits   = ::cuda::std::__charconv_decimal_width(__abs_exp2);
+  const ptrdiff_t __len     = 1 + ((__frac_digits + __zeros > 0) ? ptrdiff_t{__frac_digits} + __zeros + 1 : 0) + 2
+                        + __exp2_digits;
+  if (__last - __first < __len)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  constexpr char __hex_digits[] = "0123456789abcdef";
+  char* __it                    = __first;
+  *__it++                       = __hex_digits[__lead];
+  if (__frac_digits + __zeros > 0)
+  {
+    *__it++ = '.';
+    for (int __i = __frac_digits - 1; __i >= 0; --__i)
+    {
+      *__it++ = __hex_digits[(__frac >> (4 * __i)) & 0xf];
+    }
+    for (int __i = 0; __i < __zeros; ++__i)
+    {
+      *__it++ = '0';
+    }
+  }
+  *__it++ = 'p';
+  *__it++ = (__exp2 < 0) ? '-' : '+';
+  ::cuda::std::__charconv_write_decimal(__it, __abs_exp2, __exp2_digits);
+  return {__it + __exp2_digits, errc{}};
+}
+
+//! @brief Implements the floating point overloads of to_chars. A __fmt of chars_format{} selects the plain overload
+//! and a negative __prec the shortest round trip representation
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp(char* __first, char* __last, _Tp __value, chars_format __fmt, int __prec) noexcept
+{
+  _CCCL_ASSERT(__first <= __last, "output range must be a valid range");
+
+  constexpr auto __fp_fmt   = __fp_format_of_v<_Tp>;
+  constexpr int __mant_bits = __fp_mant_nbits_v<__fp_fmt>;
+  constexpr int __exp_bias  = __fp_exp_bias_v<__fp_fmt>;
+
+  const auto __bits = ::cuda::std::__fp_get_storage(__value);
+  if ((__bits & __fp_sign_mask_v<__fp_fmt>) != 0)
+  {
+    if (__first == __last)
+    {
+      return {__last, errc::value_too_large};
+    }
+    *__first++ = '-';
+  }
+
+  const uint64_t __ieee_mant = static_cast<uint64_t>(__bits & __fp_mant_mask_v<__fp_fmt>);
+  const int __ieee_exp       = ::cuda::std::__fp_get_exp_biased<__fp_fmt>(__bits);
+
+  if (__ieee_exp == (1 << __fp_exp_nbits_v<__fp_fmt>) - 1)
+  {
+    if (__last - __first < 3)
+    {
+      return {__last, errc::value_too_large};
+    }
+    const char* __str = (__ieee_mant == 0) ? "inf" : "nan";
+    __first[0]        = __str[0];
+    __first[1]        = __str[1];
+    __first[2]        = __str[2];
+    return {__first + 3, errc{}};
+  }
+
+  if (__fmt == chars_format::hex)
+  {
+    return ::cuda::std::__to_chars_fp_hex<__fp_fmt>(__first, __last, __ieee_mant, __ieee_exp, __prec);
+  }
+
+  // The value is __mant * 2^__exp
+  const uint64_t __mant = (__ieee_exp != 0) ? (__ieee_mant | (uint64_t{1} << __mant_bits)) : __ieee_mant;
+  const int __exp       = ((__ieee_exp != 0) ? __ieee_exp : 1) - __exp_bias - __mant_bits;
+
+  if (__prec >= 0)
+  {
+    // Most precisions need fewer digits than Ryu computes for the shortest representation, the exact digits are only
+    // generated for the others
+    to_chars_result __result{};
+    if (__mant != 0
+        && ::cuda::std::__to_chars_fp_precision_from_truncated(
+          __first,
+          __last,
+          ::cuda::std::__ryu_truncated<__mant_bits, __exp_bias>(__ieee_mant, __ieee_exp),
+          __fmt,
+          __prec,
+          __result))
+    {
+      return __result;
+    }
+
+    switch (__fmt)
+    {
+      case chars_format::fixed:
+        return ::cuda::std::__to_chars_fp_fixed<__fp_fmt>(__first, __last, __mant, __exp, __prec);
+      case chars_format::scientific:
+        return ::cuda::std::__to_chars_fp_scientific<__fp_fmt>(__first, __last, __mant, __exp, __prec);
+      default:
+        if (__mant == 0)
+        {
+          break;
+        }
+        return ::cuda::std::__to_chars_fp_general<__fp_fmt>(__first, __last, __mant, __exp, __prec);
+    }
+  }
+
+  const __fp_decimal __dec = (__mant == 0)
+                             ? __fp_decimal{0, 0}
+                             : ::cuda::std::__ryu_shortest<__mant_bits, __exp_bias>(__ieee_mant, __ieee_exp);
+  return ::cuda::std::__to_chars_fp_shortest<__fp_fmt>(__first, __last, __dec, __fmt, __mant, __exp);
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_TO_CHARS_FLOATING_POINT_H
@@ -20,25 +20,345 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__algorithm/copy_n.h>
+#include <cuda/std/__algorithm/fill_n.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__algorithm/transform.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__format/format_to_n_result.h>
 #include <cuda/std/__fwd/format.h>
+#include <cuda/std/__iterator/back_insert_iterator.h>
+#include <cuda/std/__iterator/incrementable_traits.h>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/string_view>
 
 #include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
 
-// todo: implement __fmt_output_buffer
-
+//! @brief The output buffer all formatting functions write to.
+//!
+//! Characters are collected in a contiguous range [__ptr_, __ptr_ + __capacity_) and handed to the owner of the buffer
+//! in bulk whenever the range is full and once more when formatting is done. The owner is type erased by a function
+//! pointer, so that format_context is the same type for every output iterator and the formatters don't pay for a
+//! virtual call or an iterator increment per character. The owner may replace the range when it is flushed.
+//!
+//! The buffer is never full outside of a member function, so push_back can store a character before it checks the
+//! capacity.
 template <class _CharT>
 class __fmt_output_buffer
 {
 public:
   using value_type = _CharT;
 
+  template <class _Owner>
+  _CCCL_API explicit __fmt_output_buffer(_CharT* __ptr, size_t __capacity, _Owner* __owner) noexcept
+      : __ptr_{__ptr}
+      , __capacity_{__capacity}
+      , __flush_{__flush_owner<_Owner>}
+      , __owner_{__owner}
+  {
+    _CCCL_ASSERT(__capacity_ > 0, "the buffer must have room for at least one character");
+  }
+
+  __fmt_output_buffer(const __fmt_output_buffer&)            = delete;
+  __fmt_output_buffer& operator=(const __fmt_output_buffer&) = delete;
+
+  //! @brief Replaces the range characters are written to, must only be called by the owner when it is flushed.
+  _CCCL_API void __reset(_CharT* __ptr, size_t __capacity) noexcept
+  {
+    _CCCL_ASSERT(__capacity > 0, "the buffer must have room for at least one character");
+    __ptr_      = __ptr;
+    __capacity_ = __capacity;
+  }
+
+  [[nodiscard]] _CCCL_API __back_insert_iterator<__fmt_output_buffer> __make_output_iterator() noexcept
+  {
+    return __back_insert_iterator<__fmt_output_buffer>{*this};
+  }
+
   _CCCL_API void push_back(_CharT __c)
   {
-    _CCCL_ASSERT(false, "unimplemented __fmt_output_buffer push_back method called");
-    (void) __c;
+    __ptr_[__size_++] = __c;
+    if (__size_ == __capacity_)
+    {
+      __flush();
+    }
+  }
+
+  //! @brief Appends all characters of __str, which may have a narrower character type.
+  template <class _InCharT>
+  _CCCL_API void __copy(basic_string_view<_InCharT> __str)
+  {
+    const _InCharT* __first = __str.data();
+    size_t __n              = __str.size();
+    while (__n >= __capacity_ - __size_)
+    {
+      const size_t __chunk = __capacity_ - __size_;
+      ::cuda::std::copy_n(__first, __chunk, __ptr_ + __size_);
+      __first += __chunk;
+      __n -= __chunk;
+      __size_ = __capacity_;
+      __flush();
+    }
+    ::cuda::std::copy_n(__first, __n, __ptr_ + __size_);
+    __size_ += __n;
+  }
+
+  //! @brief Appends __op(__c) for all characters __c in [__first, __last).
+  template <class _InIt, class _UnaryOp>
+  _CCCL_API void __transform(_InIt __first, _InIt __last, _UnaryOp __op)
+  {
+    _CCCL_ASSERT(__first <= __last, "not a valid range");
+    auto __n = static_cast<size_t>(__last - __first);
+    while (__n >= __capacity_ - __size_)
+    {
+      const size_t __chunk = __capacity_ - __size_;
+      ::cuda::std::transform(__first, __first + __chunk, __ptr_ + __size_, __op);
+      __first += __chunk;
+      __n -= __chunk;
+      __size_ = __capacity_;
+      __flush();
+    }
+    ::cuda::std::transform(__first, __last, __ptr_ + __size_, __op);
+    __size_ += __n;
+  }
+
+  //! @brief Appends __n copies of __value.
+  _CCCL_API void __fill(size_t __n, _CharT __value)
+  {
+    while (__n >= __capacity_ - __size_)
+    {
+      const size_t __chunk = __capacity_ - __size_;
+      ::cuda::std::fill_n(__ptr_ + __size_, __chunk, __value);
+      __n -= __chunk;
+      __size_ = __capacity_;
+      __flush();
+    }
+    ::cuda::std::fill_n(__ptr_ + __size_, __n, __value);
+    __size_ += __n;
+  }
+
+  //! @brief Hands the buffered characters to the owner.
+  _CCCL_API void __flush()
+  {
+    __flush_(__ptr_, __size_, __owner_);
+    __size_ = 0;
+  }
+
+private:
+  template <class _Owner>
+  _CCCL_API static void __flush_owner(_CharT* __ptr, size_t __n, void* __owner)
+  {
+    static_cast<_Owner*>(__owner)->__flush(__ptr, __n);
+  }
+
+  _CharT* __ptr_;
+  size_t __capacity_;
+  size_t __size_{0};
+  void (*__flush_)(_CharT*, size_t, void*);
+  void* __owner_;
+};
+
+template <class _OutIt>
+inline constexpr bool __fmt_is_output_buffer_iterator_v = false;
+template <class _CharT>
+inline constexpr bool __fmt_is_output_buffer_iterator_v<__back_insert_iterator<__fmt_output_buffer<_CharT>>> = true;
+
+//! @brief Whether the formatted output can be written to the output iterator directly instead of an internal buffer.
+template <class _OutIt, class _CharT>
+inline constexpr bool __fmt_enable_direct_output_v = is_same_v<_OutIt, _CharT*>;
+
+//! @brief The internal storage of the buffers that don't write to the output directly.
+template <class _CharT>
+struct __fmt_internal_storage
+{
+  static constexpr size_t __buffer_size = 256 / sizeof(_CharT);
+
+  _CharT __buffer_[__buffer_size];
+};
+
+//! @brief The buffer of format_to, which writes to _OutIt.
+//!
+//! If _OutIt is a pointer to _CharT the characters are written to the output directly and the buffer is only flushed
+//! once at the end to advance the iterator. Otherwise they are collected in an internal buffer and copied to the
+//! output 256 bytes at a time.
+template <class _OutIt, class _CharT, bool _Direct = __fmt_enable_direct_output_v<_OutIt, _CharT>>
+class __fmt_format_buffer
+{
+public:
+  _CCCL_API explicit __fmt_format_buffer(_OutIt __out_it)
+      : __output_{__storage_.__buffer_, __storage_.__buffer_size, this}
+      , __out_it_{::cuda::std::move(__out_it)}
+  {}
+
+  [[nodiscard]] _CCCL_API __back_insert_iterator<__fmt_output_buffer<_CharT>> __make_output_iterator() noexcept
+  {
+    return __output_.__make_output_iterator();
+  }
+
+  _CCCL_API void __flush(_CharT* __ptr, size_t __n)
+  {
+    __out_it_ = ::cuda::std::copy_n(__ptr, __n, ::cuda::std::move(__out_it_));
+  }
+
+  [[nodiscard]] _CCCL_API _OutIt __out_it() &&
+  {
+    __output_.__flush();
+    return ::cuda::std::move(__out_it_);
+  }
+
+private:
+  __fmt_internal_storage<_CharT> __storage_;
+  __fmt_output_buffer<_CharT> __output_;
+  _OutIt __out_it_;
+};
+
+template <class _OutIt, class _CharT>
+class __fmt_format_buffer<_OutIt, _CharT, true>
+{
+public:
+  _CCCL_API explicit __fmt_format_buffer(_OutIt __out_it)
+      : __output_{__out_it, numeric_limits<size_t>::max(), this}
+      , __out_it_{__out_it}
+  {}
+
+  [[nodiscard]] _CCCL_API __back_insert_iterator<__fmt_output_buffer<_CharT>> __make_output_iterator() noexcept
+  {
+    return __output_.__make_output_iterator();
+  }
+
+  _CCCL_API void __flush(_CharT*, size_t __n) noexcept
+  {
+    __out_it_ += __n;
+  }
+
+  [[nodiscard]] _CCCL_API _OutIt __out_it() &&
+  {
+    __output_.__flush();
+    return __out_it_;
   }
+
+private:
+  __fmt_output_buffer<_CharT> __output_;
+  _OutIt __out_it_;
+};
+
+//! @brief The buffer of format_to_n, which writes at most __max_size characters to _OutIt and counts the rest.
+template <class _OutIt, class _CharT, bool _Direct = __fmt_enable_direct_output_v<_OutIt, _CharT>>
+class __fmt_format_to_n_buffer
+{
+public:
+  _CCCL_API explicit __fmt_format_to_n_buffer(_OutIt __out_it, size_t __max_size)
+      : __output_{__storage_.__buffer_, __storage_.__buffer_size, this}
+      , __out_it_{::cuda::std::move(__out_it)}
+      , __max_size_{__max_size}
+  {}
+
+  [[nodiscard]] _CCCL_API __back_insert_iterator<__fmt_output_buffer<_CharT>> __make_output_iterator() noexcept
+  {
+    return __output_.__make_output_iterator();
+  }
+
+  _CCCL_API void __flush(_CharT* __ptr, size_t __n)
+  {
+    if (__size_ < __max_size_)
+    {
+      const size_t __count = (::cuda::std::min) (__n, __max_size_ - __size_);
+      __out_it_            = ::cuda::std::copy_n(__ptr, __count, ::cuda::std::move(__out_it_));
+    }
+    __size_ += __n;
+  }
+
+  [[nodiscard]] _CCCL_API format_to_n_result<_OutIt> __result() &&
+  {
+    __output_.__flush();
+    return {::cuda::std::move(__out_it_), static_cast<iter_difference_t<_OutIt>>(__size_)};
+  }
+
+private:
+  __fmt_internal_storage<_CharT> __storage_;
+  __fmt_output_buffer<_CharT> __output_;
+  _OutIt __out_it_;
+  size_t __max_size_;
+  size_t __size_{0};
+};
+
+//! The characters are written to the output directly until __max_size of them are written, everything after that is
+//! written to the internal storage and discarded.
+template <class _OutIt, class _CharT>
+class __fmt_format_to_n_buffer<_OutIt, _CharT, true>
+{
+public:
+  _CCCL_API explicit __fmt_format_to_n_buffer(_OutIt __out_it, size_t __max_size)
+      : __output_{(__max_size != 0) ? __out_it : __storage_.__buffer_,
+                  (__max_size != 0) ? __max_size : __storage_.__buffer_size,
+                  this}
+      , __out_it_{__out_it}
+      , __max_size_{__max_size}
+  {}
+
+  [[nodiscard]] _CCCL_API __back_insert_iterator<__fmt_output_buffer<_CharT>> __make_output_iterator() noexcept
+  {
+    return __output_.__make_output_iterator();
+  }
+
+  _CCCL_API void __flush(_CharT*, size_t __n) noexcept
+  {
+    if (__size_ < __max_size_)
+    {
+      // The output is full, discard everything that follows
+      __out_it_ += __n;
+      __output_.__reset(__storage_.__buffer_, __storage_.__buffer_size);
+    }
+    __size_ += __n;
+  }
+
+  [[nodiscard]] _CCCL_API format_to_n_result<_OutIt> __result() &&
+  {
+    __output_.__flush();
+    return {__out_it_, static_cast<iter_difference_t<_OutIt>>(__size_)};
+  }
+
+private:
+  __fmt_internal_storage<_CharT> __storage_;
+  __fmt_output_buffer<_CharT> __output_;
+  _OutIt __out_it_;
+  size_t __max_size_;
+  size_t __size_{0};
+};
+
+//! @brief The buffer of formatted_size, which only counts the characters.
+template <class _CharT>
+class __fmt_formatted_size_buffer
+{
+public:
+  _CCCL_API __fmt_formatted_size_buffer() noexcept
+      : __output_{__storage_.__buffer_, __storage_.__buffer_size, this}
+  {}
+
+  [[nodiscard]] _CCCL_API __back_insert_iterator<__fmt_output_buffer<_CharT>> __make_output_iterator() noexcept
+  {
+    return __output_.__make_output_iterator();
+  }
+
+  _CCCL_API void __flush(_CharT*, size_t __n) noexcept
+  {
+    __size_ += __n;
+  }
+
+  [[nodiscard]] _CCCL_API size_t __result() &&
+  {
+    __output_.__flush();
+    return __size_;
+  }
+
+private:
+  __fmt_internal_storage<_CharT> __storage_;
+  __fmt_output_buffer<_CharT> __output_;
+  size_t __size_{0};
 };
 
 _CCCL_END_NAMESPACE_CUDA_STD
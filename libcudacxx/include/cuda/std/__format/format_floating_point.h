@@ -0,0 +1,713 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD__FORMAT_FORMAT_FLOATING_POINT_H
+#define _CUDA_STD__FORMAT_FORMAT_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/copy_backward.h>
+#include <cuda/std/__algorithm/find.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/to_chars.h>
+#include <cuda/std/__charconv/to_chars_floating_point.h>
+#include <cuda/std/__charconv/to_chars_result.h>
+#include <cuda/std/__cmath/isfinite.h>
+#include <cuda/std/__cmath/isnan.h>
+#include <cuda/std/__cmath/signbit.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__floating_point/decompose.h>
+#include <cuda/std/__floating_point/format.h>
+#include <cuda/std/__floating_point/mask.h>
+#include <cuda/std/__floating_point/properties.h>
+#include <cuda/std/__floating_point/storage.h>
+#include <cuda/std/__format/format_integral.h>
+#include <cuda/std/__format/format_spec_parser.h>
+#include <cuda/std/__format/output_utils.h>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/to_underlying.h>
+#include <cuda/std/cstdint>
+
+#if _CCCL_HAS_LONG_DOUBLE()
+#  include <cstdio>
+#  include <cstdlib>
+#  include <cstring>
+#endif // _CCCL_HAS_LONG_DOUBLE()
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief The size of the stack buffer a floating-point value is formatted into. It holds the shortest representation
+//! and the precisions most format strings use, longer output is written in chunks.
+inline constexpr ptrdiff_t __fmt_fp_buffer_size = 128;
+
+//! @brief Whether floating-point values of type _Tp are converted by to_chars. Other types are only long double on the
+//! host, which is converted by the C library.
+template <class _Tp>
+inline constexpr bool __fmt_fp_uses_to_chars_v = __charconv_fp_supported_v<__fp_format_of_v<_Tp>>;
+
+[[nodiscard]] _CCCL_API constexpr char __fmt_fp_to_upper(char __c) noexcept
+{
+  return (__c >= 'a' && __c <= 'z') ? static_cast<char>(__c - 'a' + 'A') : __c;
+}
+
+//! @brief Writes a formatted value of __size characters, starting with the sign [__sign, __sign_last), padded to the
+//! width of __specs. __body writes the characters after the sign. Zero padding goes between the sign and the body.
+template <class _CharT, class _OutIt, class _Body>
+[[nodiscard]] _CCCL_API _OutIt __fmt_fp_write_padded(
+  const char* __sign,
+  const char* __sign_last,
+  size_t __size,
+  _OutIt __out_it,
+  __fmt_parsed_spec<_CharT> __specs,
+  _Body __body)
+{
+  const size_t __width = __specs.__width_;
+  if (__fmt_spec_alignment{__specs.__alignment_} == __fmt_spec_alignment::__zero_padding)
+  {
+    __out_it = ::cuda::std::__fmt_copy(__sign, __sign_last, ::cuda::std::move(__out_it));
+    if (__size < __width)
+    {
+      __out_it = ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __width - __size, _CharT{'0'});
+    }
+    return __body(::cuda::std::move(__out_it));
+  }
+
+  if (__size >= __width)
+  {
+    __out_it = ::cuda::std::__fmt_copy(__sign, __sign_last, ::cuda::std::move(__out_it));
+    return __body(::cuda::std::move(__out_it));
+  }
+
+  const auto __padding =
+    ::cuda::std::__fmt_padding_size(__size, __width, __fmt_spec_alignment{__specs.__alignment_});
+  __out_it = ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __padding.__before_, __specs.__fill_);
+  __out_it = ::cuda::std::__fmt_copy(__sign, __sign_last, ::cuda::std::move(__out_it));
+  __out_it = __body(::cuda::std::move(__out_it));
+  return ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __padding.__after_, __specs.__fill_);
+}
+
+//! @brief The result of rounding the leading digits of a value
+struct __fmt_fp_rounding
+{
+  bool __round_up_; //!< Whether the digits are rounded up
+  ptrdiff_t __carry_; //!< When rounding up, the index of the last digit that is not 9, -1 if all digits are 9
+  ptrdiff_t __last_nonzero_; //!< The index of the last nonzero digit before rounding, -1 if all digits are 0
+};
+
+//! @brief Rounds the next __count digits of __digits half to even. Takes the digits by value, so that the caller can
+//! generate the same digits again to write them.
+template <class _Digits>
+[[nodiscard]] _CCCL_API constexpr __fmt_fp_rounding __fmt_fp_round(_Digits __digits, ptrdiff_t __count) noexcept
+{
+  __fmt_fp_rounding __ret{false, -1, -1};
+  bool __odd = false;
+  for (ptrdiff_t __i = 0; __i < __count; ++__i)
+  {
+    if (__digits.__rest_is_zero())
+    {
+      return __ret;
+    }
+    const int __digit = __digits.__next();
+    if (__digit != 9)
+    {
+      __ret.__carry_ = __i;
+    }
+    if (__digit != 0)
+    {
+      __ret.__last_nonzero_ = __i;
+    }
+    __odd = (__digit & 1) != 0;
+  }
+  __ret.__round_up_ = __digits.__round_up(__odd);
+  return __ret;
+}
+
+//! @brief Writes the digits of a formatted value to the output in chunks of a small buffer. The decimal point is
+//! inserted before the digit with index __point.
+template <class _OutIt>
+class __fmt_fp_digit_writer
+{
+  static constexpr ptrdiff_t __chunk_size = 64;
+
+  char __chunk_[__chunk_size];
+  ptrdiff_t __size_  = 0;
+  ptrdiff_t __index_ = 0;
+  ptrdiff_t __point_;
+  _OutIt __out_it_;
+
+  _CCCL_API void __write_chunk()
+  {
+    __out_it_ = ::cuda::std::__fmt_copy(__chunk_, __chunk_ + __size_, ::cuda::std::move(__out_it_));
+    __size_   = 0;
+  }
+
+public:
+  _CCCL_API explicit __fmt_fp_digit_writer(_OutIt __out_it, ptrdiff_t __point)
+      : __point_{__point}
+      , __out_it_{::cuda::std::move(__out_it)}
+  {}
+
+  _CCCL_API void __put(char __c)
+  {
+    __chunk_[__size_++] = __c;
+    if (__size_ == __chunk_size)
+    {
+      __write_chunk();
+    }
+  }
+
+  _CCCL_API void __digit(int __digit)
+  {
+    if (__index_++ == __point_)
+    {
+      __put('.');
+    }
+    __put(static_cast<char>('0' + __digit));
+  }
+
+  _CCCL_API void __zeros(ptrdiff_t __n)
+  {
+    while (__n > 0)
+    {
+      if (__index_ == __point_)
+      {
+        __put('.');
+      }
+      const ptrdiff_t __run = (__point_ > __index_) ? (::cuda::std::min) (__n, __point_ - __index_) : __n;
+      __write_chunk();
+      __out_it_ = ::cuda::std::__fmt_fill(::cuda::std::move(__out_it_), static_cast<size_t>(__run), '0');
+      __index_ += __run;
+      __n -= __run;
+    }
+  }
+
+  [[nodiscard]] _CCCL_API _OutIt __finish()
+  {
+    __write_chunk();
+    return ::cuda::std::move(__out_it_);
+  }
+};
+
+//! @brief Formats a finite, non-negative value whose output does not fit the stack buffer in fixed, scientific or
+//! general notation with precision __prec.
+//!
+//! The exact digits of the value are generated twice, first to round them and then to write them in chunks, so the
+//! output can have any length. The general notation removes trailing zeros unless __keep_zeros is set.
+template <class _Tp, class _CharT, class _OutIt>
+[[nodiscard]] _CCCL_API _OutIt __fmt_format_fp_exact(
+  _Tp __value,
+  chars_format __fmt,
+  int __prec,
+  bool __keep_zeros,
+  bool __alternate_form,
+  bool __upper,
+  const char* __sign,
+  const char* __sign_last,
+  _OutIt __out_it,
+  __fmt_parsed_spec<_CharT> __specs)
+{
+  constexpr auto __fp_fmt   = __fp_format_of_v<_Tp>;
+  constexpr int __mant_bits = __fp_mant_nbits_v<__fp_fmt>;
+  using _Digits             = __to_chars_fp_exact_digits<__fp_fmt>;
+
+  const auto __bits          = ::cuda::std::__fp_get_storage(__value);
+  const uint64_t __ieee_mant = static_cast<uint64_t>(__bits & __fp_mant_mask_v<__fp_fmt>);
+  const int __ieee_exp       = ::cuda::std::__fp_get_exp_biased<__fp_fmt>(__bits);
+  const uint64_t __mant      = (__ieee_exp != 0) ? (__ieee_mant | (uint64_t{1} << __mant_bits)) : __ieee_mant;
+  const int __exp            = ((__ieee_exp != 0) ? __ieee_exp : 1) - __fp_exp_bias_v<__fp_fmt> - __mant_bits;
+
+  // Returns the decimal exponent of the first significant digit and makes it the next digit of __digits
+  const auto __exp10_of = [__mant](_Digits& __digits) {
+    if (__mant == 0)
+    {
+      return 0;
+    }
+    const int __int_digits = __digits.__int_digits();
+    return (__int_digits > 0) ? __int_digits - 1 : -1 - __digits.__skip_leading_zeros();
+  };
+
+  bool __strip = false;
+  if (__fmt == chars_format::general)
+  {
+    // The value is rounded to P significant digits with an exponent X. It is written in fixed notation with precision
+    // P - 1 - X if P > X >= -4, and in scientific notation with precision P - 1 otherwise.
+    const int __p = (__prec == 0) ? 1 : __prec;
+    _Digits __digits{__mant, __exp};
+    int __x               = __exp10_of(__digits);
+    const auto __rounding = ::cuda::std::__fmt_fp_round(__digits, __p);
+    __x += (__rounding.__round_up_ && __rounding.__carry_ < 0);
+    if (__p > __x && __x >= -4)
+    {
+      __fmt  = chars_format::fixed;
+      __prec = __p - 1 - __x;
+    }
+    else
+    {
+      __fmt  = chars_format::scientific;
+      __prec = __p - 1;
+    }
+    __strip = !__keep_zeros;
+  }
+
+  const bool __scientific = __fmt == chars_format::scientific;
+  _Digits __digits{__mant, __exp};
+  const int __int_digits = __scientific ? 0 : __digits.__int_digits();
+  int __exp10            = __scientific ? __exp10_of(__digits) : 0;
+
+  // The generated digits are the integer and fraction digits in fixed notation and the significant digits in
+  // scientific notation
+  ptrdiff_t __count      = __scientific ? ptrdiff_t{1} + __prec : ptrdiff_t{__int_digits} + __prec;
+  const auto __rounding  = ::cuda::std::__fmt_fp_round(__digits, __count);
+  const bool __carry_out = __rounding.__round_up_ && __rounding.__carry_ < 0;
+
+  // The written digits are an optional leading digit followed by the rounded generated digits. A value less than 1
+  // in fixed notation leads with 0, and a carry out of all digits leads with 1. In scientific notation the carry
+  // increments the exponent instead, so the last digit is dropped.
+  int __lead        = -1;
+  ptrdiff_t __point = __scientific ? 1 : __int_digits;
+  if (__scientific)
+  {
+    if (__carry_out)
+    {
+      __lead = 1;
+      --__count;
+      ++__exp10;
+    }
+  }
+  else if (__int_digits == 0)
+  {
+    __lead  = __carry_out;
+    __point = 1;
+  }
+  else if (__carry_out)
+  {
+    __lead = 1;
+    ++__point;
+  }
+
+  ptrdiff_t __total = (__lead >= 0) + __count;
+  if (__strip)
+  {
+    const ptrdiff_t __last_nonzero =
+      __carry_out
+        ? 0
+        : (__rounding.__round_up_ ? __rounding.__carry_ : __rounding.__last_nonzero_) + (__lead >= 0 ? 1 : 0);
+    __total = (::cuda::std::max) (__point, __last_nonzero + 1);
+    __count = __total - (__lead >= 0);
+  }
+  const bool __has_fraction = __total > __point;
+
+  char __exponent[8];
+  char* __exponent_last = __exponent;
+  if (__scientific)
+  {
+    __exponent_last = ::cuda::std::__to_chars_fp_write_exp10(__exponent, __exp10);
+    __exponent[0]   = __upper ? 'E' : 'e';
+  }
+
+  const size_t __size = static_cast<size_t>(
+    (__sign_last - __sign) + __total + ((__has_fraction || __alternate_form) ? 1 : 0) + (__exponent_last - __exponent));
+  return ::cuda::std::__fmt_fp_write_padded(
+    __sign, __sign_last, __size, ::cuda::std::move(__out_it), __specs, [&](_OutIt __out) {
+      __fmt_fp_digit_writer<_OutIt> __writer{::cuda::std::move(__out), __has_fraction ? __point : -1};
+      if (__lead >= 0)
+      {
+        __writer.__digit(__lead);
+      }
+      for (ptrdiff_t __i = 0; __i < __count; ++__i)
+      {
+        if (__rounding.__round_up_ && __i >= __rounding.__carry_)
+        {
+          if (__i == __rounding.__carry_)
+          {
+            __writer.__digit(__digits.__next() + 1);
+            continue;
+          }
+          __writer.__zeros(__count - __i);
+          break;
+        }
+        if (__digits.__rest_is_zero())
+        {
+          __writer.__zeros(__count - __i);
+          break;
+        }
+        __writer.__digit(__digits.__next());
+      }
+      if (__alternate_form && !__has_fraction)
+      {
+        __writer.__put('.');
+      }
+      for (const char* __it = __exponent; __it != __exponent_last; ++__it)
+      {
+        __writer.__put(*__it);
+      }
+      return __writer.__finish();
+    });
+}
+
+#if _CCCL_HAS_LONG_DOUBLE()
+//! @brief Converts a finite, non-negative long double like to_chars with the C library. Returns the length of the
+//! output if it is less than __n, in which case the output is written, and a length not less than __n otherwise.
+[[nodiscard]] _CCCL_HOST_API inline size_t
+__fmt_fp_long_double_to_chars(char* __first, size_t __n, long double __value, chars_format __fmt, int __prec)
+{
+  if (__fmt == chars_format{})
+  {
+    // The shortest representation is the correctly rounded one with the fewest digits that round trips
+    char __sci[64];
+    for (int __p = 0;; ++__p)
+    {
+      ::snprintf(__sci, sizeof(__sci), "%.*Le", __p, __value);
+      if (__p + 1 >= numeric_limits<long double>::max_digits10 || ::strtold(__sci, nullptr) == __value)
+      {
+        break;
+      }
+    }
+
+    // __sci is d[.ddd]e[+-]xx, which is written in fixed notation if that is not longer
+    char* __exp_pos = ::strchr(__sci, 'e');
+    const int __x   = static_cast<int>(::strtol(__exp_pos + 1, nullptr, 10));
+    char __digits[64];
+    int __n_digits = 0;
+    for (const char* __it = __sci; __it != __exp_pos; ++__it)
+    {
+      if (*__it != '.')
+      {
+        __digits[__n_digits++] = *__it;
+      }
+    }
+
+    const size_t __sci_len = ::strlen(__sci);
+    const size_t __fixed_len =
+      (__x >= __n_digits - 1)
+        ? static_cast<size_t>(__x + 1)
+        : static_cast<size_t>((__x >= 0) ? __n_digits + 1 : __n_digits + 1 - __x);
+    if (__sci_len < __fixed_len)
+    {
+      if (__sci_len < __n)
+      {
+        ::memcpy(__first, __sci, __sci_len);
+      }
+      return __sci_len;
+    }
+    if (__fixed_len < __n && __x >= __n_digits)
+    {
+      // Large integers are printed with their exact digits rather than padded with zeros, like to_chars does
+      ::snprintf(__first, __n, "%.0Lf", __value);
+    }
+    else if (__fixed_len < __n)
+    {
+      char* __it = __first;
+      if (__x < 0)
+      {
+        *__it++ = '0';
+        *__it++ = '.';
+        for (int __i = -1; __i > __x; --__i)
+        {
+          *__it++ = '0';
+        }
+      }
+      for (int __i = 0; __i < __n_digits; ++__i)
+      {
+        if (__x >= 0 && __i == __x + 1)
+        {
+          *__it++ = '.';
+        }
+        *__it++ = __digits[__i];
+      }
+      for (int __i = __n_digits; __i <= __x; ++__i)
+      {
+        *__it++ = '0';
+      }
+    }
+    return __fixed_len;
+  }
+
+  int __len = 0;
+  switch (__fmt)
+  {
+    case chars_format::hex:
+      // The output of %La starts with 0x, which to_chars omits
+      __len = (__prec < 0) ? ::snprintf(__first, __n, "%La", __value)
+                           : ::snprintf(__first, __n, "%.*La", __prec, __value);
+      if (static_cast<size_t>(__len) >= __n)
+      {
+        return static_cast<size_t>(__len);
+      }
+      ::memmove(__first, __first + 2, static_cast<size_t>(__len) - 2);
+      return static_cast<size_t>(__len) - 2;
+    case chars_format::scientific:
+      __len = ::snprintf(__first, __n, "%.*Le", __prec, __value);
+      break;
+    case chars_format::fixed:
+      __len = ::snprintf(__first, __n, "%.*Lf", __prec, __value);
+      break;
+    default:
+      __len = ::snprintf(__first, __n, "%.*Lg", __prec, __value);
+      break;
+  }
+  return static_cast<size_t>(__len);
+}
+
+//! @brief Owns the heap buffer a long double is formatted into when its output does not fit the stack buffer
+struct __fmt_fp_heap_buffer
+{
+  char* __ptr_;
+
+  _CCCL_HOST_API explicit __fmt_fp_heap_buffer(size_t __size)
+      : __ptr_{new char[__size]}
+  {}
+
+  __fmt_fp_heap_buffer(const __fmt_fp_heap_buffer&)            = delete;
+  __fmt_fp_heap_buffer& operator=(const __fmt_fp_heap_buffer&) = delete;
+
+  _CCCL_HOST_API ~__fmt_fp_heap_buffer()
+  {
+    delete[] __ptr_;
+  }
+};
+#endif // _CCCL_HAS_LONG_DOUBLE()
+
+//! @brief Converts a finite, non-negative value into [__first, __last) like to_chars. A __fmt of chars_format{}
+//! selects the shortest representation and a negative __prec the shortest one in the format __fmt.
+template <class _Tp>
+[[nodiscard]] _CCCL_API to_chars_result
+__fmt_fp_to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt, int __prec)
+{
+#if _CCCL_HAS_LONG_DOUBLE()
+  if constexpr (!__fmt_fp_uses_to_chars_v<_Tp>)
+  {
+    const auto __n   = static_cast<size_t>(__last - __first);
+    const size_t __len = ::cuda::std::__fmt_fp_long_double_to_chars(__first, __n, __value, __fmt, __prec);
+    return (__len < __n) ? to_chars_result{__first + __len, errc{}} : to_chars_result{__last, errc::value_too_large};
+  }
+  else
+#endif // _CCCL_HAS_LONG_DOUBLE()
+  {
+    if (__fmt == chars_format{})
+    {
+      return ::cuda::std::to_chars(__first, __last, __value);
+    }
+    if (__prec < 0)
+    {
+      return ::cuda::std::to_chars(__first, __last, __value, __fmt);
+    }
+    return ::cuda::std::to_chars(__first, __last, __value, __fmt, __prec);
+  }
+}
+
+//! @brief Writes the converted value [__first, __last) that follows the sign [__sign, __first) in a buffer with room
+//! for one more character. Applies the alternate form and upper case, and inserts __zeros zeros before the exponent.
+template <class _CharT, class _OutIt>
+[[nodiscard]] _CCCL_API _OutIt __fmt_fp_write_chars(
+  char* __sign,
+  char* __first,
+  char* __last,
+  size_t __zeros,
+  bool __hex,
+  bool __general,
+  int __prec,
+  bool __upper,
+  _OutIt __out_it,
+  __fmt_parsed_spec<_CharT> __specs)
+{
+  char* __exponent = ::cuda::std::find(__first, __last, __hex ? 'p' : 'e');
+  if (__specs.__std_.__alternate_form_)
+  {
+    // The alternate form always has a decimal point
+    if (::cuda::std::find(__first, __exponent, '.') == __exponent)
+    {
+      ::cuda::std::copy_backward(__exponent, __last, __last + 1);
+      *__exponent++ = '.';
+      ++__last;
+    }
+
+    // and the general format keeps its trailing zeros, so that there are P significant digits
+    if (__general)
+    {
+      int __digits   = 0;
+      bool __nonzero = false;
+      for (const char* __it = __first; __it != __exponent; ++__it)
+      {
+        if (*__it != '.')
+        {
+          __nonzero = __nonzero || *__it != '0';
+          __digits += __nonzero;
+        }
+      }
+      const int __p = (__prec == 0) ? 1 : __prec;
+      __zeros += static_cast<size_t>((::cuda::std::max) (__p - (::cuda::std::max) (__digits, 1), 0));
+    }
+  }
+
+  if (__upper)
+  {
+    for (char* __it = __first; __it != __last; ++__it)
+    {
+      *__it = ::cuda::std::__fmt_fp_to_upper(*__it);
+    }
+  }
+
+  const auto __size = static_cast<size_t>(__last - __sign) + __zeros;
+  return ::cuda::std::__fmt_fp_write_padded(
+    __sign, __first, __size, ::cuda::std::move(__out_it), __specs, [&](_OutIt __out) {
+      __out = ::cuda::std::__fmt_copy(__first, __exponent, ::cuda::std::move(__out));
+      __out = ::cuda::std::__fmt_fill(::cuda::std::move(__out), __zeros, '0');
+      return ::cuda::std::__fmt_copy(__exponent, __last, ::cuda::std::move(__out));
+    });
+}
+
+template <class _Tp, class _CharT, class _FmtCtx>
+[[nodiscard]] _CCCL_API typename _FmtCtx::iterator
+__fmt_format_fp(_Tp __value, _FmtCtx& __ctx, __fmt_parsed_spec<_CharT> __specs)
+{
+  char __buffer[__fmt_fp_buffer_size];
+  const bool __negative = ::cuda::std::signbit(__value);
+  char* __first         = ::cuda::std::__fmt_insert_sign(__buffer, __negative, __fmt_spec_sign{__specs.__std_.__sign_});
+
+  const __fmt_spec_type __type = __specs.__std_.__type_;
+  const bool __upper =
+    __type == __fmt_spec_type::__hexfloat_upper_case || __type == __fmt_spec_type::__scientific_upper_case
+    || __type == __fmt_spec_type::__fixed_upper_case || __type == __fmt_spec_type::__general_upper_case;
+
+  if (!::cuda::std::isfinite(__value))
+  {
+    // [format.string.std]/13 Zero padding does not apply to infinity and NaN
+    if (__fmt_spec_alignment{__specs.__alignment_} == __fmt_spec_alignment::__zero_padding)
+    {
+      __specs.__alignment_ = ::cuda::std::to_underlying(__fmt_spec_alignment::__right);
+    }
+    const char* __str = ::cuda::std::isnan(__value) ? (__upper ? "NAN" : "nan") : (__upper ? "INF" : "inf");
+    for (int __i = 0; __i < 3; ++__i)
+    {
+      *__first++ = __str[__i];
+    }
+    return ::cuda::std::__fmt_write(__buffer, __first, __ctx.out(), __specs);
+  }
+
+  // [format.string.std]/22 Without a type, the value is written like to_chars(first, last, value) or, with a
+  // precision, like to_chars(first, last, value, chars_format::general, precision)
+  chars_format __fmt = chars_format{};
+  int __prec         = __specs.__precision_;
+  switch (__type)
+  {
+    case __fmt_spec_type::__hexfloat_lower_case:
+    case __fmt_spec_type::__hexfloat_upper_case:
+      __fmt = chars_format::hex;
+      break;
+    case __fmt_spec_type::__scientific_lower_case:
+    case __fmt_spec_type::__scientific_upper_case:
+      __fmt = chars_format::scientific;
+      break;
+    case __fmt_spec_type::__fixed_lower_case:
+    case __fmt_spec_type::__fixed_upper_case:
+      __fmt = chars_format::fixed;
+      break;
+    case __fmt_spec_type::__general_lower_case:
+    case __fmt_spec_type::__general_upper_case:
+      __fmt = chars_format::general;
+      break;
+    default:
+      __fmt = __specs.__has_precision() ? chars_format::general : chars_format{};
+      break;
+  }
+  const bool __general =
+    __type == __fmt_spec_type::__general_lower_case || __type == __fmt_spec_type::__general_upper_case;
+
+  const _Tp __abs = __negative ? -__value : __value;
+
+  // The hexadecimal digits beyond those of the significand are zeros, which are written separately
+  size_t __zeros = 0;
+  if constexpr (__fmt_fp_uses_to_chars_v<_Tp>)
+  {
+    constexpr int __nibbles = (__fp_mant_nbits_v<__fp_format_of_v<_Tp>> + 3) / 4;
+    if (__fmt == chars_format::hex && __prec > __nibbles)
+    {
+      __zeros = static_cast<size_t>(__prec - __nibbles);
+      __prec  = __nibbles;
+    }
+  }
+
+  // Leave room for the decimal point of the alternate form
+  const auto __result =
+    ::cuda::std::__fmt_fp_to_chars(__first, __buffer + __fmt_fp_buffer_size - 1, __abs, __fmt, __prec);
+  if (__result.ec == errc{})
+  {
+    return ::cuda::std::__fmt_fp_write_chars(
+      __buffer,
+      __first,
+      __result.ptr,
+      __zeros,
+      __fmt == chars_format::hex,
+      __general,
+      __prec,
+      __upper,
+      __ctx.out(),
+      __specs);
+  }
+
+#if _CCCL_HAS_LONG_DOUBLE()
+  if constexpr (!__fmt_fp_uses_to_chars_v<_Tp>)
+  {
+    const size_t __sign_len = static_cast<size_t>(__first - __buffer);
+    const size_t __capacity = ::cuda::std::__fmt_fp_long_double_to_chars(nullptr, 0, __abs, __fmt, __prec) + 1;
+    __fmt_fp_heap_buffer __heap{__sign_len + __capacity + 1};
+    ::memcpy(__heap.__ptr_, __buffer, __sign_len);
+    char* __heap_first = __heap.__ptr_ + __sign_len;
+    const size_t __len = ::cuda::std::__fmt_fp_long_double_to_chars(__heap_first, __capacity, __abs, __fmt, __prec);
+    return ::cuda::std::__fmt_fp_write_chars(
+      __heap.__ptr_,
+      __heap_first,
+      __heap_first + __len,
+      __zeros,
+      __fmt == chars_format::hex,
+      __general,
+      __prec,
+      __upper,
+      __ctx.out(),
+      __specs);
+  }
+  else
+#endif // _CCCL_HAS_LONG_DOUBLE()
+  {
+    // Only a precision makes the output longer than the buffer
+    _CCCL_ASSERT(__fmt != chars_format{} && __fmt != chars_format::hex, "the shortest representation fits the buffer");
+    return ::cuda::std::__fmt_format_fp_exact(
+      __abs,
+      __fmt,
+      __prec,
+      __general && __specs.__std_.__alternate_form_,
+      __specs.__std_.__alternate_form_,
+      __upper,
+      __buffer,
+      __first,
+      __ctx.out(),
+      __specs);
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD__FORMAT_FORMAT_FLOATING_POINT_H
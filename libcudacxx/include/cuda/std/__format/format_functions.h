@@ -0,0 +1,312 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___FORMAT_FORMAT_FUNCTIONS_H
+#define _CUDA_STD___FORMAT_FORMAT_FUNCTIONS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__format/buffer.h>
+#include <cuda/std/__format/format_arg.h>
+#include <cuda/std/__format/format_arg_store.h>
+#include <cuda/std/__format/format_args.h>
+#include <cuda/std/__format/format_context.h>
+#include <cuda/std/__format/format_error.h>
+#include <cuda/std/__format/format_parse_context.h>
+#include <cuda/std/__format/format_to_n_result.h>
+#include <cuda/std/__format/formatter.h>
+#include <cuda/std/__format/output_utils.h>
+#include <cuda/std/__format/parse_arg_id.h>
+#include <cuda/std/__fwd/format.h>
+#include <cuda/std/__iterator/concepts.h>
+#include <cuda/std/__iterator/incrementable_traits.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_default_constructible.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__type_traits/type_identity.h>
+#include <cuda/std/__utility/monostate.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/string_view>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief The format string of the formatting functions.
+//!
+//! Unlike std::basic_format_string the constructor isn't consteval, the format string is validated while it is used.
+template <class _CharT, class... _Args>
+class _CCCL_TYPE_VISIBILITY_DEFAULT basic_format_string
+{
+public:
+  _CCCL_TEMPLATE(class _Tp)
+  _CCCL_REQUIRES(is_convertible_v<const _Tp&, basic_string_view<_CharT>>)
+  _CCCL_API constexpr basic_format_string(const _Tp& __str) noexcept
+      : __str_{__str}
+  {}
+
+  [[nodiscard]] _CCCL_API constexpr basic_string_view<_CharT> get() const noexcept
+  {
+    return __str_;
+  }
+
+private:
+  basic_string_view<_CharT> __str_;
+};
+
+template <class... _Args>
+using format_string = basic_format_string<char, type_identity_t<_Args>...>;
+#if _CCCL_HAS_WCHAR_T()
+template <class... _Args>
+using wformat_string = basic_format_string<wchar_t, type_identity_t<_Args>...>;
+#endif // _CCCL_HAS_WCHAR_T()
+
+//! Formats the argument of the replacement field starting at __begin, which points past the opening '{', and returns
+//! an iterator past the closing '}'.
+template <class _CharT, class _Ctx>
+[[nodiscard]] _CCCL_API const _CharT* __fmt_handle_replacement_field(
+  const _CharT* __begin, const _CharT* __end, basic_format_parse_context<_CharT>& __parse_ctx, _Ctx& __ctx)
+{
+  const auto __r = ::cuda::std::__fmt_parse_arg_id(__begin, __end, __parse_ctx);
+  if (__r.__last == __end)
+  {
+    ::cuda::std::__throw_format_error("The argument index should end with a ':' or a '}'");
+  }
+
+  const bool __parse = *__r.__last == _CharT{':'};
+  switch (*__r.__last)
+  {
+    case _CharT{':'}:
+      // The arg-id has a format-specifier, advance the input to the format-spec.
+      __parse_ctx.advance_to(__r.__last + 1);
+      break;
+    case _CharT{'}'}:
+      // The arg-id has no format-specifier.
+      __parse_ctx.advance_to(__r.__last);
+      break;
+    default:
+      ::cuda::std::__throw_format_error("The argument index should end with a ':' or a '}'");
+  }
+
+  ::cuda::std::visit_format_arg(
+    [&](auto __arg) {
+      using _Arg = decltype(__arg);
+      if constexpr (is_same_v<_Arg, monostate>)
+      {
+        ::cuda::std::__throw_format_error("The argument index value is too large for the number of arguments supplied");
+      }
+      else if constexpr (is_same_v<_Arg, typename basic_format_arg<_Ctx>::handle>)
+      {
+        __arg.format(__parse_ctx, __ctx);
+      }
+      else if constexpr (!is_default_constructible_v<formatter<_Arg, _CharT>>)
+      {
+        ::cuda::std::__throw_format_error("The argument type is not supported");
+      }
+      else
+      {
+        formatter<_Arg, _CharT> __formatter{};
+        if (__parse)
+        {
+          __parse_ctx.advance_to(__formatter.parse(__parse_ctx));
+        }
+        __ctx.advance_to(__formatter.format(__arg, __ctx));
+      }
+    },
+    __ctx.arg(__r.__value));
+
+  __begin = __parse_ctx.begin();
+  if (__begin == __end || *__begin != _CharT{'}'})
+  {
+    ::cuda::std::__throw_format_error("The replacement field misses a terminating '}'");
+  }
+  return ++__begin;
+}
+
+//! Writes the format string to __ctx with the replacement fields replaced by the formatted arguments. The text between
+//! replacement fields is copied in one piece.
+template <class _CharT, class _Ctx>
+_CCCL_API typename _Ctx::iterator __fmt_vformat_to(basic_format_parse_context<_CharT>& __parse_ctx, _Ctx& __ctx)
+{
+  static_assert(is_same_v<typename _Ctx::char_type, _CharT>);
+
+  const _CharT* __begin = __parse_ctx.begin();
+  const _CharT* __end   = __parse_ctx.end();
+  auto __out_it         = __ctx.out();
+  while (__begin != __end)
+  {
+    const _CharT* __it = __begin;
+    while (__it != __end && *__it != _CharT{'{'} && *__it != _CharT{'}'})
+    {
+      ++__it;
+    }
+    __out_it = ::cuda::std::__fmt_copy(
+      basic_string_view<_CharT>{__begin, static_cast<size_t>(__it - __begin)}, ::cuda::std::move(__out_it));
+    if (__it == __end)
+    {
+      break;
+    }
+
+    __begin = __it + 1;
+    if (*__it == _CharT{'{'})
+    {
+      if (__begin == __end)
+      {
+        ::cuda::std::__throw_format_error("The format string terminates at a '{'");
+      }
+      if (*__begin != _CharT{'{'})
+      {
+        __ctx.advance_to(::cuda::std::move(__out_it));
+        __begin  = ::cuda::std::__fmt_handle_replacement_field(__begin, __end, __parse_ctx, __ctx);
+        __out_it = __ctx.out();
+        continue;
+      }
+    }
+    else if (__begin == __end || *__begin != _CharT{'}'})
+    {
+      ::cuda::std::__throw_format_error("The format string contains an invalid escape sequence");
+    }
+
+    // An escaped brace
+    *__out_it++ = *__begin++;
+  }
+  return __out_it;
+}
+
+template <class _OutIt, class _CharT, class _FormatOutIt>
+[[nodiscard]] _CCCL_API _OutIt __fmt_vformat_to(
+  _OutIt __out_it,
+  basic_string_view<_CharT> __fmt,
+  basic_format_args<basic_format_context<_FormatOutIt, _CharT>> __args)
+{
+  basic_format_parse_context<_CharT> __parse_ctx{__fmt, __args.__size()};
+  if constexpr (is_same_v<_OutIt, _FormatOutIt>)
+  {
+    auto __ctx = ::cuda::std::__fmt_make_format_context(::cuda::std::move(__out_it), __args);
+    return ::cuda::std::__fmt_vformat_to(__parse_ctx, __ctx);
+  }
+  else
+  {
+    __fmt_format_buffer<_OutIt, _CharT> __buffer{::cuda::std::move(__out_it)};
+    auto __ctx = ::cuda::std::__fmt_make_format_context(__buffer.__make_output_iterator(), __args);
+    ::cuda::std::__fmt_vformat_to(__parse_ctx, __ctx);
+    return ::cuda::std::move(__buffer).__out_it();
+  }
+}
+
+template <class _OutIt, class _CharT, class _FormatOutIt>
+[[nodiscard]] _CCCL_API format_to_n_result<_OutIt> __fmt_vformat_to_n(
+  _OutIt __out_it,
+  iter_difference_t<_OutIt> __n,
+  basic_string_view<_CharT> __fmt,
+  basic_format_args<basic_format_context<_FormatOutIt, _CharT>> __args)
+{
+  const size_t __max_size = (__n > 0) ? static_cast<size_t>(__n) : 0;
+  __fmt_format_to_n_buffer<_OutIt, _CharT> __buffer{::cuda::std::move(__out_it), __max_size};
+  basic_format_parse_context<_CharT> __parse_ctx{__fmt, __args.__size()};
+  auto __ctx = ::cuda::std::__fmt_make_format_context(__buffer.__make_output_iterator(), __args);
+  ::cuda::std::__fmt_vformat_to(__parse_ctx, __ctx);
+  return ::cuda::std::move(__buffer).__result();
+}
+
+template <class _CharT, class _FormatOutIt>
+[[nodiscard]] _CCCL_API size_t __fmt_vformatted_size(
+  basic_string_view<_CharT> __fmt, basic_format_args<basic_format_context<_FormatOutIt, _CharT>> __args)
+{
+  __fmt_formatted_size_buffer<_CharT> __buffer{};
+  basic_format_parse_context<_CharT> __parse_ctx{__fmt, __args.__size()};
+  auto __ctx = ::cuda::std::__fmt_make_format_context(__buffer.__make_output_iterator(), __args);
+  ::cuda::std::__fmt_vformat_to(__parse_ctx, __ctx);
+  return ::cuda::std::move(__buffer).__result();
+}
+
+_CCCL_TEMPLATE(class _OutIt)
+_CCCL_REQUIRES(output_iterator<_OutIt, const char&>)
+_CCCL_API _OutIt vformat_to(_OutIt __out_it, string_view __fmt, format_args __args)
+{
+  return ::cuda::std::__fmt_vformat_to(::cuda::std::move(__out_it), __fmt, __args);
+}
+
+#if _CCCL_HAS_WCHAR_T()
+_CCCL_TEMPLATE(class _OutIt)
+_CCCL_REQUIRES(output_iterator<_OutIt, const wchar_t&>)
+_CCCL_API _OutIt vformat_to(_OutIt __out_it, wstring_view __fmt, wformat_args __args)
+{
+  return ::cuda::std::__fmt_vformat_to(::cuda::std::move(__out_it), __fmt, __args);
+}
+#endif // _CCCL_HAS_WCHAR_T()
+
+_CCCL_TEMPLATE(class _OutIt, class... _Args)
+_CCCL_REQUIRES(output_iterator<_OutIt, const char&>)
+_CCCL_API _OutIt format_to(_OutIt __out_it, format_string<_Args...> __fmt, _Args&&... __args)
+{
+  return ::cuda::std::__fmt_vformat_to(
+    ::cuda::std::move(__out_it), __fmt.get(), format_args{::cuda::std::make_format_args(__args...)});
+}
+
+#if _CCCL_HAS_WCHAR_T()
+_CCCL_TEMPLATE(class _OutIt, class... _Args)
+_CCCL_REQUIRES(output_iterator<_OutIt, const wchar_t&>)
+_CCCL_API _OutIt format_to(_OutIt __out_it, wformat_string<_Args...> __fmt, _Args&&... __args)
+{
+  return ::cuda::std::__fmt_vformat_to(
+    ::cuda::std::move(__out_it), __fmt.get(), wformat_args{::cuda::std::make_wformat_args(__args...)});
+}
+#endif // _CCCL_HAS_WCHAR_T()
+
+_CCCL_TEMPLATE(class _OutIt, class... _Args)
+_CCCL_REQUIRES(output_iterator<_OutIt, const char&>)
+_CCCL_API format_to_n_result<_OutIt>
+format_to_n(_OutIt __out_it, iter_difference_t<_OutIt> __n, format_string<_Args...> __fmt, _Args&&... __args)
+{
+  return ::cuda::std::__fmt_vformat_to_n(
+    ::cuda::std::move(__out_it), __n, __fmt.get(), format_args{::cuda::std::make_format_args(__args...)});
+}
+
+#if _CCCL_HAS_WCHAR_T()
+_CCCL_TEMPLATE(class _OutIt, class... _Args)
+_CCCL_REQUIRES(output_iterator<_OutIt, const wchar_t&>)
+_CCCL_API format_to_n_result<_OutIt>
+format_to_n(_OutIt __out_it, iter_difference_t<_OutIt> __n, wformat_string<_Args...> __fmt, _Args&&... __args)
+{
+  return ::cuda::std::__fmt_vformat_to_n(
+    ::cuda::std::move(__out_it), __n, __fmt.get(), wformat_args{::cuda::std::make_wformat_args(__args...)});
+}
+#endif // _CCCL_HAS_WCHAR_T()
+
+template <class... _Args>
+[[nodiscard]] _CCCL_API size_t formatted_size(format_string<_Args...> __fmt, _Args&&... __args)
+{
+  return ::cuda::std::__fmt_vformatted_size(__fmt.get(), format_args{::cuda::std::make_format_args(__args...)});
+}
+
+#if _CCCL_HAS_WCHAR_T()
+template <class... _Args>
+[[nodiscard]] _CCCL_API size_t formatted_size(wformat_string<_Args...> __fmt, _Args&&... __args)
+{
+  return ::cuda::std::__fmt_vformatted_size(__fmt.get(), wformat_args{::cuda::std::make_wformat_args(__args...)});
+}
+#endif // _CCCL_HAS_WCHAR_T()
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___FORMAT_FORMAT_FUNCTIONS_H
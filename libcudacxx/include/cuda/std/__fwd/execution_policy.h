@@ -63,6 +63,11 @@ template <uint32_t _Policy>
 inline constexpr __execution_backend __policy_to_execution_backend =
   __execution_backend{(_Policy & uint32_t{0x0000FF00}) >> 8};
 
+//! @brief Replaces the execution backend stored in _Policy
+template <uint32_t _Policy, __execution_backend _Backend>
+inline constexpr uint32_t __with_execution_backend =
+  (_Policy & uint32_t{0xFFFF00FF}) | (static_cast<uint32_t>(_Backend) << 8);
+
 template <uint32_t _Policy, __execution_backend _Backend = __policy_to_execution_backend<_Policy>>
 struct __execution_policy_base;
 
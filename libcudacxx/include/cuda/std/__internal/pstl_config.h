@@ -24,8 +24,19 @@
 #include <cuda/std/__cccl/prologue.h>
 
 #define _CCCL_HAS_BACKEND_CUDA() _CCCL_CUDA_COMPILATION() && !_CCCL_COMPILER(NVRTC)
-#define _CCCL_HAS_BACKEND_OMP()  0
-#define _CCCL_HAS_BACKEND_TBB()  0
+
+// The CPU backends are opt-in, as they require linking against the OpenMP or TBB runtime
+#if defined(CCCL_ENABLE_PSTL_OMP_BACKEND) && !_CCCL_COMPILER(NVRTC)
+#  define _CCCL_HAS_BACKEND_OMP() 1
+#else // ^^^ has OpenMP backend ^^^ / vvv no OpenMP backend vvv
+#  define _CCCL_HAS_BACKEND_OMP() 0
+#endif // ^^^ no OpenMP backend ^^^
+
+#if defined(CCCL_ENABLE_PSTL_TBB_BACKEND) && !_CCCL_COMPILER(NVRTC)
+#  define _CCCL_HAS_BACKEND_TBB() 1
+#else // ^^^ has TBB backend ^^^ / vvv no TBB backend vvv
+#  define _CCCL_HAS_BACKEND_TBB() 0
+#endif // ^^^ no TBB backend ^^^
 
 #include <cuda/std/__cccl/epilogue.h>
 
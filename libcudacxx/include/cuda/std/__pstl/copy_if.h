@@ -39,6 +39,12 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/copy_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_OMP()
+#    include <cuda/std/__pstl/omp/copy_if.h>
+#  endif // _CCCL_HAS_BACKEND_OMP()
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <cuda/std/__pstl/tbb/copy_if.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
 
 #  include <cuda/std/__cccl/prologue.h>
 
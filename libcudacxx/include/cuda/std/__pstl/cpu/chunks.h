@@ -0,0 +1,88 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_CHUNKS_H
+#define _CUDA_STD___PSTL_CPU_CHUNKS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+// The CPU backends share the implementation of the parallel algorithms. Each of them provides a bulk executor with
+//
+//   static int64_t __max_chunks() noexcept;                      // number of chunks that keeps all threads busy
+//   template <class _Fn> static void __run(int64_t __n, _Fn& __fn); // invokes __fn(__i) for all __i in [0, __n)
+//
+// The input is split into at most __max_chunks() contiguous chunks of nearly equal size, so that every chunk can be
+// processed serially and the results of the chunks can be combined in order.
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief Smallest number of elements that is worth handing to another thread
+inline constexpr int64_t __cpu_min_chunk_size = 1 << 13;
+
+//! @brief Returns the number of chunks @p __count elements are split into. A single chunk means that the algorithm
+//! should rather run serially
+template <class _Bulk>
+[[nodiscard]] _CCCL_HOST_API int64_t __cpu_num_chunks(const int64_t __count) noexcept
+{
+  return (::cuda::std::max) (int64_t{1}, (::cuda::std::min) (__count / __cpu_min_chunk_size, _Bulk::__max_chunks()));
+}
+
+//! @brief Returns the index of the first element of chunk @p __chunk
+[[nodiscard]] _CCCL_HOST_API constexpr int64_t
+__cpu_chunk_begin(const int64_t __count, const int64_t __num_chunks, const int64_t __chunk) noexcept
+{
+  return __chunk * (__count / __num_chunks) + (::cuda::std::min) (__chunk, __count % __num_chunks);
+}
+
+//! @brief Invokes @p __func(__chunk, __begin, __end) for every chunk of @p __count elements in parallel
+template <class _Bulk, class _Fn>
+_CCCL_HOST_API void __cpu_for_each_chunk(const int64_t __count, const int64_t __num_chunks, _Fn __func)
+{
+  auto __body = [&](const int64_t __chunk) {
+    __func(__chunk,
+           ::cuda::std::execution::__cpu_chunk_begin(__count, __num_chunks, __chunk),
+           ::cuda::std::execution::__cpu_chunk_begin(__count, __num_chunks, __chunk + 1));
+  };
+  _Bulk::__run(__num_chunks, __body);
+}
+
+//! @brief Default predicate of the algorithms that only conditionally write their output
+struct __cpu_always_true
+{
+  template <class... _Args>
+  [[nodiscard]] _CCCL_HOST_API constexpr bool operator()(const _Args&...) const noexcept
+  {
+    return true;
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_CPU_CHUNKS_H
@@ -0,0 +1,127 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_COPY_IF_H
+#define _CUDA_STD___PSTL_CPU_COPY_IF_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__algorithm/copy_if.h>
+#  include <cuda/std/__concepts/concept_macros.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
+#  include <cuda/std/__memory/unique_ptr.h>
+#  include <cuda/std/__pstl/cpu/chunks.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Counts the elements of every chunk that satisfy @p __pred and stores whether they do in @p __selected. On
+//! return, @p __offsets holds the position of the first selected element of every chunk among all selected elements,
+//! and @p __offsets[__num_chunks] the number of selected elements.
+template <class _Bulk, class _Iter, class _UnaryPredicate>
+_CCCL_HOST_API void __cpu_select_offsets(
+  _Iter __first,
+  const int64_t __count,
+  const int64_t __num_chunks,
+  _UnaryPredicate& __pred,
+  bool* __selected,
+  int64_t* __offsets)
+{
+  ::cuda::std::execution::__cpu_for_each_chunk<_Bulk>(
+    __count, __num_chunks, [&](const int64_t __chunk, const int64_t __begin, const int64_t __end) {
+      int64_t __num_selected = 0;
+      for (int64_t __i = __begin; __i < __end; ++__i)
+      {
+        __selected[__i] = static_cast<bool>(__pred(__first[__i]));
+        __num_selected += __selected[__i];
+      }
+      __offsets[__chunk + 1] = __num_selected;
+    });
+
+  __offsets[0] = 0;
+  for (int64_t __chunk = 0; __chunk < __num_chunks; ++__chunk)
+  {
+    __offsets[__chunk + 1] += __offsets[__chunk];
+  }
+}
+
+//! @brief Implementation of cuda::std::copy_if shared by the CPU backends
+template <class _Bulk>
+struct __pstl_cpu_copy_if
+{
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator, class _OutputIterator, class _UnaryPredicate)
+  _CCCL_REQUIRES(__has_forward_traversal<_OutputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    const _Policy&,
+    _InputIterator __first,
+    iter_difference_t<_InputIterator> __count,
+    _OutputIterator __result,
+    _UnaryPredicate __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      const int64_t __num_chunks = ::cuda::std::execution::__cpu_num_chunks<_Bulk>(__count);
+      if (__num_chunks > 1)
+      {
+        // The first pass evaluates the predicate once per element and counts the selected elements of every chunk,
+        // the second pass copies them to their final position
+        auto __selected = ::cuda::std::make_unique_for_overwrite<bool[]>(static_cast<size_t>(__count));
+        auto __offsets  = ::cuda::std::make_unique_for_overwrite<int64_t[]>(static_cast<size_t>(__num_chunks + 1));
+        ::cuda::std::execution::__cpu_select_offsets<_Bulk>(
+          __first, __count, __num_chunks, __pred, __selected.get(), __offsets.get());
+
+        ::cuda::std::execution::__cpu_for_each_chunk<_Bulk>(
+          __count, __num_chunks, [&](const int64_t __chunk, const int64_t __begin, const int64_t __end) {
+            auto __out = __result + __offsets[__chunk];
+            for (int64_t __i = __begin; __i < __end; ++__i)
+            {
+              if (__selected[__i])
+              {
+                *__out = __first[__i];
+                ++__out;
+              }
+            }
+          });
+        return __result + __offsets[__num_chunks];
+      }
+    }
+    auto __last = ::cuda::std::next(__first, __count);
+    return ::cuda::std::copy_if(
+      ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__result), ::cuda::std::move(__pred));
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_CPU_COPY_IF_H
@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_COPY_N_H
+#define _CUDA_STD___PSTL_CPU_COPY_N_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__algorithm/copy_n.h>
+#  include <cuda/std/__concepts/concept_macros.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/cpu/chunks.h>
+#  include <cuda/std/__type_traits/is_same.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Implementation of cuda::std::copy_n shared by the CPU backends. Elements are only copied if they satisfy the
+//! predicate, other elements of the output are left untouched.
+template <class _Bulk>
+struct __pstl_cpu_copy_n
+{
+  template <class _InputIterator, class _Size, class _OutputIterator, class _UnaryPred>
+  [[nodiscard]] _CCCL_HOST_API static _OutputIterator
+  __serial_impl(_InputIterator __first, _Size __count, _OutputIterator __result, _UnaryPred& __pred)
+  {
+    if constexpr (is_same_v<_UnaryPred, __cpu_always_true>)
+    {
+      return ::cuda::std::copy_n(::cuda::std::move(__first), __count, ::cuda::std::move(__result));
+    }
+    else
+    {
+      for (; __count > 0; --__count, (void) ++__first, (void) ++__result)
+      {
+        if (__pred(*__first))
+        {
+          *__result = *__first;
+        }
+      }
+      return __result;
+    }
+  }
+
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator, class _OutputIterator, class _UnaryPred = __cpu_always_true)
+  _CCCL_REQUIRES(__has_forward_traversal<_InputIterator> _CCCL_AND __has_forward_traversal<_OutputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    const _Policy&,
+    _InputIterator __first,
+    iter_difference_t<_InputIterator> __count,
+    _OutputIterator __result,
+    _UnaryPred __pred = {}) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      const int64_t __num_chunks = ::cuda::std::execution::__cpu_num_chunks<_Bulk>(__count);
+      if (__num_chunks > 1)
+      {
+        ::cuda::std::execution::__cpu_for_each_chunk<_Bulk>(
+          __count, __num_chunks, [&](int64_t, const int64_t __begin, const int64_t __end) {
+            (void) __serial_impl(__first + __begin, __end - __begin, __result + __begin, __pred);
+          });
+        return __result + __count;
+      }
+    }
+    return __serial_impl(::cuda::std::move(__first), __count, ::cuda::std::move(__result), __pred);
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_CPU_COPY_N_H
@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_FIND_IF_H
+#define _CUDA_STD___PSTL_CPU_FIND_IF_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__algorithm/find_if.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__pstl/cpu/chunks.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Implementation of cuda::std::find_if shared by the CPU backends
+template <class _Bulk>
+struct __pstl_cpu_find_if
+{
+  template <class _Policy, class _Iter, class _UnaryOp>
+  [[nodiscard]] _CCCL_HOST_API _Iter operator()(const _Policy&, _Iter __first, _Iter __last, _UnaryOp __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_Iter>)
+    {
+      const int64_t __count      = ::cuda::std::distance(__first, __last);
+      const int64_t __num_chunks = ::cuda::std::execution::__cpu_num_chunks<_Bulk>(__count);
+      if (__num_chunks > 1)
+      {
+        // Position of the first match found so far. Chunks stop searching once they pass it, so the chunks after the
+        // first match do not search until their end
+        ::cuda::std::atomic<int64_t> __found{__count};
+        ::cuda::std::execution::__cpu_for_each_chunk<_Bulk>(
+          __count, __num_chunks, [&](int64_t, const int64_t __begin, const int64_t __end) {
+            for (int64_t __i = __begin; __i < __end && __i < __found.load(memory_order_relaxed); ++__i)
+            {
+              if (__pred(__first[__i]))
+              {
+                int64_t __prev = __found.load(memory_order_relaxed);
+                while (__i < __prev && !__found.compare_exchange_weak(__prev, __i, memory_order_relaxed))
+                {
+                }
+                return;
+              }
+            }
+          });
+        return __first + __found.load(memory_order_relaxed);
+      }
+    }
+    return ::cuda::std::find_if(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_CPU_FIND_IF_H
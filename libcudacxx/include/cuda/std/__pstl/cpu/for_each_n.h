@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_FOR_EACH_N_H
+#define _CUDA_STD___PSTL_CPU_FOR_EACH_N_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__algorithm/for_each_n.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__pstl/cpu/chunks.h>
+#  include <cuda/std/__utility/convert_to_integral.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Implementation of cuda::std::for_each_n shared by the CPU backends
+template <class _Bulk>
+struct __pstl_cpu_for_each_n
+{
+  template <class _Policy, class _Iter, class _Size, class _Fn>
+  [[nodiscard]] _CCCL_HOST_API _Iter operator()(const _Policy&, _Iter __first, _Size __orig_n, _Fn __func) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_Iter>)
+    {
+      const int64_t __count      = static_cast<int64_t>(::cuda::std::__convert_to_integral(__orig_n));
+      const int64_t __num_chunks = ::cuda::std::execution::__cpu_num_chunks<_Bulk>(__count);
+      if (__num_chunks > 1)
+      {
+        ::cuda::std::execution::__cpu_for_each_chunk<_Bulk>(
+          __count, __num_chunks, [&](int64_t, const int64_t __begin, const int64_t __end) {
+            (void) ::cuda::std::for_each_n(__first + __begin, __end - __begin, __func);
+          });
+        return __first + __count;
+      }
+    }
+    return ::cuda::std::for_each_n(::cuda::std::move(__first), __orig_n, ::cuda::std::move(__func));
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_CPU_FOR_EACH_N_H
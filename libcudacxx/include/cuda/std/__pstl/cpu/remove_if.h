@@ -0,0 +1,113 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_REMOVE_IF_H
+#define _CUDA_STD___PSTL_CPU_REMOVE_IF_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__algorithm/remove_if.h>
+#  include <cuda/std/__concepts/concept_macros.h>
+#  include <cuda/std/__functional/not_fn.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
+#  include <cuda/std/__memory/builtin_new_allocator.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__memory/unique_ptr.h>
+#  include <cuda/std/__pstl/cpu/chunks.h>
+#  include <cuda/std/__pstl/cpu/copy_if.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Implementation of cuda::std::remove_if shared by the CPU backends
+//! @note The predicate selects the elements that are kept
+template <class _Bulk>
+struct __pstl_cpu_remove_if
+{
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator, class _UnaryPredicate)
+  _CCCL_REQUIRES(__has_forward_traversal<_InputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _InputIterator operator()(
+    const _Policy&, _InputIterator __first, iter_difference_t<_InputIterator> __count, _UnaryPredicate __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      const int64_t __num_chunks = ::cuda::std::execution::__cpu_num_chunks<_Bulk>(__count);
+      if (__num_chunks > 1)
+      {
+        using _Tp = iter_value_t<_InputIterator>;
+
+        auto __selected = ::cuda::std::make_unique_for_overwrite<bool[]>(static_cast<size_t>(__count));
+        auto __offsets  = ::cuda::std::make_unique_for_overwrite<int64_t[]>(static_cast<size_t>(__num_chunks + 1));
+        ::cuda::std::execution::__cpu_select_offsets<_Bulk>(
+          __first, __count, __num_chunks, __pred, __selected.get(), __offsets.get());
+
+        // A chunk may need to write over kept elements of the chunks before it that have not been moved yet, so the
+        // kept elements are moved out to a buffer and back in place
+        const int64_t __num_kept = __offsets[__num_chunks];
+        auto __storage           = ::cuda::std::__builtin_new_allocator::__allocate_type<_Tp>(static_cast<size_t>(__num_kept));
+        _Tp* __buffer            = static_cast<_Tp*>(__storage.get());
+
+        ::cuda::std::execution::__cpu_for_each_chunk<_Bulk>(
+          __count, __num_chunks, [&](const int64_t __chunk, const int64_t __begin, const int64_t __end) {
+            _Tp* __out = __buffer + __offsets[__chunk];
+            for (int64_t __i = __begin; __i < __end; ++__i)
+            {
+              if (__selected[__i])
+              {
+                ::cuda::std::__construct_at(__out, ::cuda::std::move(__first[__i]));
+                ++__out;
+              }
+            }
+          });
+
+        const int64_t __num_move_chunks = ::cuda::std::execution::__cpu_num_chunks<_Bulk>(__num_kept);
+        ::cuda::std::execution::__cpu_for_each_chunk<_Bulk>(
+          __num_kept, __num_move_chunks, [&](int64_t, const int64_t __begin, const int64_t __end) {
+            for (int64_t __i = __begin; __i < __end; ++__i)
+            {
+              __first[__i] = ::cuda::std::move(__buffer[__i]);
+            }
+            ::cuda::std::destroy_n(__buffer + __begin, __end - __begin);
+          });
+        return __first + __num_kept;
+      }
+    }
+    auto __last = ::cuda::std::next(__first, __count);
+    return ::cuda::std::remove_if(
+      ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::not_fn(::cuda::std::move(__pred)));
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_CPU_REMOVE_IF_H
@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_TRANSFORM_REDUCE_H
+#define _CUDA_STD___PSTL_CPU_TRANSFORM_REDUCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__concepts/concept_macros.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/next.h>
+#  include <cuda/std/__memory/unique_ptr.h>
+#  include <cuda/std/__numeric/transform_reduce.h>
+#  include <cuda/std/__optional/optional.h>
+#  include <cuda/std/__pstl/cpu/chunks.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Implementation of cuda::std::transform_reduce shared by the CPU backends
+template <class _Bulk>
+struct __pstl_cpu_transform_reduce
+{
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator, class _Size, class _Tp, class _ReductionOp, class _TransformOp)
+  _CCCL_REQUIRES(__has_forward_traversal<_InputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _Tp operator()(
+    const _Policy&,
+    _InputIterator __first,
+    _Size __count,
+    _Tp __init,
+    _ReductionOp __reduction_op,
+    _TransformOp __transform_op) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      const int64_t __n          = static_cast<int64_t>(__count);
+      const int64_t __num_chunks = ::cuda::std::execution::__cpu_num_chunks<_Bulk>(__n);
+      if (__num_chunks > 1)
+      {
+        // Every chunk holds at least two elements, so its partial result needs no initial value. The partial results
+        // are combined in order, the reduction operator needs not be commutative
+        auto __partials = ::cuda::std::make_unique<optional<_Tp>[]>(static_cast<size_t>(__num_chunks));
+        ::cuda::std::execution::__cpu_for_each_chunk<_Bulk>(
+          __n, __num_chunks, [&](const int64_t __chunk, const int64_t __begin, const int64_t __end) {
+            _Tp __partial(__reduction_op(__transform_op(__first[__begin]), __transform_op(__first[__begin + 1])));
+            for (int64_t __i = __begin + 2; __i < __end; ++__i)
+            {
+              __partial = __reduction_op(::cuda::std::move(__partial), __transform_op(__first[__i]));
+            }
+            __partials[__chunk].emplace(::cuda::std::move(__partial));
+          });
+
+        for (int64_t __chunk = 0; __chunk < __num_chunks; ++__chunk)
+        {
+          __init = __reduction_op(::cuda::std::move(__init), ::cuda::std::move(*__partials[__chunk]));
+        }
+        return __init;
+      }
+    }
+    auto __last = ::cuda::std::next(__first, __count);
+    return ::cuda::std::transform_reduce(
+      ::cuda::std::move(__first),
+      ::cuda::std::move(__last),
+      ::cuda::std::move(__init),
+      ::cuda::std::move(__reduction_op),
+      ::cuda::std::move(__transform_op));
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_CPU_TRANSFORM_REDUCE_H
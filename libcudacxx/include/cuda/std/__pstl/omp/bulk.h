@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_OMP_BULK_H
+#define _CUDA_STD___PSTL_OMP_BULK_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP()
+
+#  include <cuda/std/cstdint>
+
+#  if defined(_OPENMP)
+#    include <omp.h>
+#  endif // _OPENMP
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief Bulk executor of the OpenMP backend. Every chunk runs on a thread of a parallel region.
+//! @note Without OpenMP enabled in the host compiler, the chunks run serially on the calling thread
+struct __omp_bulk
+{
+  [[nodiscard]] _CCCL_HOST_API static int64_t __max_chunks() noexcept
+  {
+#  if defined(_OPENMP)
+    return ::omp_get_max_threads();
+#  else // ^^^ _OPENMP ^^^ / vvv !_OPENMP vvv
+    return 1;
+#  endif // ^^^ !_OPENMP ^^^
+  }
+
+  template <class _Fn>
+  _CCCL_HOST_API static void __run(const int64_t __n, _Fn& __func)
+  {
+    _CCCL_PRAGMA(omp parallel for schedule(static, 1))
+    for (int64_t __i = 0; __i < __n; ++__i)
+    {
+      __func(__i);
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP()
+
+#endif // _CUDA_STD___PSTL_OMP_BULK_H
@@ -39,6 +39,12 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/transform.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_OMP()
+#    include <cuda/std/__pstl/omp/transform.h>
+#  endif // _CCCL_HAS_BACKEND_OMP()
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <cuda/std/__pstl/tbb/transform.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -57,7 +63,7 @@ struct __replace_copy_select
   {}
 
   template <class _Up>
-  [[nodiscard]] _CCCL_DEVICE_API constexpr _Tp operator()(const _Up& __val) const
+  [[nodiscard]] _CCCL_API constexpr _Tp operator()(const _Up& __val) const
     noexcept(is_nothrow_copy_constructible_v<_Tp>)
   {
     return __val == __old_value_ ? __new_value_ : static_cast<_Tp>(__val);
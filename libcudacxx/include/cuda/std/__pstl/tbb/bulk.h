@@ -0,0 +1,59 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_TBB_BULK_H
+#define _CUDA_STD___PSTL_TBB_BULK_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/cstdint>
+
+#  include <tbb/parallel_for.h>
+#  include <tbb/task_arena.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief Bulk executor of the TBB backend. Chunks are tasks of the current arena, there are a few more of them than
+//! threads so that work stealing can balance chunks of uneven cost.
+struct __tbb_bulk
+{
+  [[nodiscard]] _CCCL_HOST_API static int64_t __max_chunks() noexcept
+  {
+    return 4 * static_cast<int64_t>(::tbb::this_task_arena::max_concurrency());
+  }
+
+  template <class _Fn>
+  _CCCL_HOST_API static void __run(const int64_t __n, _Fn& __func)
+  {
+    ::tbb::parallel_for(int64_t{0}, __n, [&__func](const int64_t __i) {
+      __func(__i);
+    });
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_TBB_BULK_H
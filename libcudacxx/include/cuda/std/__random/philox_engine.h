@@ -24,10 +24,12 @@
 #include <cuda/__cmath/mul_hi.h>
 #include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__random/is_seed_sequence.h>
+#include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/make_nbit_int.h>
 #include <cuda/std/array>
 #include <cuda/std/cstddef> // for size_t
 #include <cuda/std/cstdint>
+#include <cuda/std/span>
 
 #if !_CCCL_COMPILER(NVRTC)
 #  include <ios>
@@ -291,6 +293,49 @@ public:
     }
   }
 
+  //! This member function fills a range with random values and updates this philox_engine's state. The range holds
+  //! the same values as if each element was assigned ``(*this)()`` in order, and the engine ends in the same state.
+  //! Whole blocks of ``word_count`` values are computed for several consecutive counters at once, with the rounds laid
+  //! out across the counters so that the compiler can vectorize them.
+  //!
+  //! @param __out The range to fill.
+  _CCCL_API constexpr void generate_random(::cuda::std::span<result_type> __out) noexcept
+  {
+    result_type* __first    = __out.data();
+    ::cuda::std::size_t __n = __out.size();
+
+    // Use up the values left in the output buffer
+    while (__n > 0 && __j_ != word_count - 1)
+    {
+      *__first++ = (*this)();
+      --__n;
+    }
+
+    const result_type* const __bulk_first = __first;
+    while (__n >= word_count * __bulk_lanes)
+    {
+      __philox_lanes(__first);
+      __first += word_count * __bulk_lanes;
+      __n -= word_count * __bulk_lanes;
+    }
+
+    // Leave the last block in the output buffer, as operator() would, so that the serialized state matches
+    if (__first != __bulk_first)
+    {
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (::cuda::std::size_t __w = 0; __w < word_count; ++__w)
+      {
+        __y_[__w] = __first[__w - word_count];
+      }
+    }
+
+    while (__n > 0)
+    {
+      *__first++ = (*this)();
+      --__n;
+    }
+  }
+
   //! This function checks two philox_engines for equality.
   //! @param lhs The first philox_engine to test.
   //! @param rhs The second philox_engine to test.
@@ -403,7 +448,7 @@ public:
     // save old flags
     const typename ios_base::fmtflags __flags = __is.flags();
 
-    __is.flags(ios_base::dec);
+    __is.flags(ios_base::dec | ios_base::skipws);
 
     // input counter array (__x_)
     for (::cuda::std::size_t __i = 0; __i < word_count; ++__i)
@@ -519,6 +564,126 @@ private:
     __y_ = __S;
   }
 
+  // generate_random stores 32 bit words in 64 bits, so that a single 64 bit product yields both halves of a
+  // multiplication, which vector units compute for several counters at once. Other word sizes use __mulhilo, so that
+  // the values match operator() bit for bit.
+  using __lane_word_t = ::cuda::std::conditional_t<(word_size == 32), ::cuda::std::uint64_t, result_type>;
+
+  static _CCCL_API constexpr auto __mulhilo_lane(__lane_word_t __a, __lane_word_t __b) noexcept
+  {
+    if constexpr (word_size == 32)
+    {
+      const __lane_word_t __product = __a * __b;
+      return ::cuda::std::pair{__product >> word_size, __product & max()};
+    }
+    else
+    {
+      return __mulhilo(__a, __b);
+    }
+  }
+
+  // Computes the blocks of the next __bulk_lanes counters into __out and advances the counter past them. The state of
+  // each round is stored per word across the counters, so that every step of a round is one loop over the counters.
+  _CCCL_API constexpr void __philox_lanes(result_type* __out) noexcept
+  {
+    __lane_word_t __s[word_count][__bulk_lanes] = {};
+    if (__x_[0] <= max() - __bulk_lanes)
+    {
+      // The counters only differ in their least significant word
+      for (::cuda::std::size_t __l = 0; __l < __bulk_lanes; ++__l)
+      {
+        __s[0][__l] = static_cast<__lane_word_t>(__x_[0] + __l);
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (::cuda::std::size_t __w = 1; __w < word_count; ++__w)
+        {
+          __s[__w][__l] = static_cast<__lane_word_t>(__x_[__w]);
+        }
+      }
+      __x_[0] += __bulk_lanes;
+    }
+    else
+    {
+      for (::cuda::std::size_t __l = 0; __l < __bulk_lanes; ++__l)
+      {
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (::cuda::std::size_t __w = 0; __w < word_count; ++__w)
+        {
+          __s[__w][__l] = static_cast<__lane_word_t>(__x_[__w]);
+        }
+        __increment_counter();
+      }
+    }
+
+    // The round keys are the same for all counters
+    __lane_word_t __keys[round_count][word_count / 2] = {};
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (::cuda::std::size_t __i = 0; __i < word_count / 2; ++__i)
+    {
+      result_type __key = __k_[__i];
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (::cuda::std::size_t __j = 0; __j < round_count; ++__j)
+      {
+        __keys[__j][__i] = static_cast<__lane_word_t>(__key);
+        __key            = (__key + round_consts[__i]) & max();
+      }
+    }
+
+    constexpr __lane_word_t __m0 = static_cast<__lane_word_t>(multipliers[0]);
+    for (::cuda::std::size_t __l = 0; __l < __bulk_lanes; ++__l)
+    {
+      // Only two variants are allowed, n=2 or n=4
+      if constexpr (word_count == 2)
+      {
+        __lane_word_t __s0 = __s[0][__l];
+        __lane_word_t __s1 = __s[1][__l];
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (::cuda::std::size_t __j = 0; __j < round_count; ++__j)
+        {
+          auto [__hi, __lo] = __mulhilo_lane(__s0, __m0);
+          __s0              = __hi ^ __keys[__j][0] ^ __s1;
+          __s1              = __lo;
+        }
+        __s[0][__l] = __s0;
+        __s[1][__l] = __s1;
+      }
+      else // word_count == 4
+      {
+        constexpr __lane_word_t __m1 = static_cast<__lane_word_t>(multipliers[1]);
+        __lane_word_t __s0           = __s[0][__l];
+        __lane_word_t __s1           = __s[1][__l];
+        __lane_word_t __s2           = __s[2][__l];
+        __lane_word_t __s3           = __s[3][__l];
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (::cuda::std::size_t __j = 0; __j < round_count; ++__j)
+        {
+          auto [__hi0, __lo0] = __mulhilo_lane(__s2, __m0);
+          auto [__hi2, __lo2] = __mulhilo_lane(__s0, __m1);
+          __s0                = __hi0 ^ __keys[__j][0] ^ __s1;
+          __s1                = __lo0;
+          __s2                = __hi2 ^ __keys[__j][1] ^ __s3;
+          __s3                = __lo2;
+        }
+        __s[0][__l] = __s0;
+        __s[1][__l] = __s1;
+        __s[2][__l] = __s2;
+        __s[3][__l] = __s3;
+      }
+    }
+
+    // The values of one counter are consecutive in the output
+    for (::cuda::std::size_t __l = 0; __l < __bulk_lanes; ++__l)
+    {
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (::cuda::std::size_t __w = 0; __w < word_count; ++__w)
+      {
+        __out[__l * word_count + __w] = static_cast<result_type>(__s[__w][__l]);
+      }
+    }
+  }
+
+  // The number of counters generate_random evaluates at once
+  static constexpr ::cuda::std::size_t __bulk_lanes = 8;
+
   // The counter X, a big integer stored as word_count w-bit words.
   // The least significant word is __x_[0].
   ::cuda::std::array<result_type, word_count> __x_ = {};
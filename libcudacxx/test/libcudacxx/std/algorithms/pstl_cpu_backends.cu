@@ -0,0 +1,164 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// The parallel algorithms with the OpenMP and TBB backends, on host memory and with varying numbers of threads. The
+// build enables the backends whose runtime it finds.
+
+#include <cuda/iterator>
+#include <cuda/std/__pstl_algorithm>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+
+#if _CCCL_HAS_BACKEND_OMP()
+#  include <cuda/__execution/omp_policy.h>
+
+#  if defined(_OPENMP)
+#    include <omp.h>
+#  endif // _OPENMP
+#endif // _CCCL_HAS_BACKEND_OMP()
+
+#if _CCCL_HAS_BACKEND_TBB()
+#  include <cuda/__execution/tbb_policy.h>
+
+#  include <tbb/task_arena.h>
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#include <string>
+#include <vector>
+
+#include <testing.cuh>
+
+// Large enough to be split into chunks for many threads
+inline constexpr int size = 1 << 20;
+
+struct is_even
+{
+  constexpr bool operator()(const int& val) const noexcept
+  {
+    return (val % 2) == 0;
+  }
+};
+
+template <class Policy>
+void test_cpu_backend(const Policy& policy)
+{
+  std::vector<int> input(size);
+  std::vector<int> output(size, -1);
+  cuda::std::iota(input.begin(), input.end(), 0);
+
+  { // reduce, count and transform_reduce
+    CHECK(cuda::std::reduce(policy, input.begin(), input.end(), int64_t{0}) == int64_t{size} * (size - 1) / 2);
+    CHECK(cuda::std::count_if(policy, input.begin(), input.end(), is_even{}) == size / 2);
+    CHECK(cuda::std::transform_reduce(
+            policy, input.begin(), input.end(), int64_t{0}, cuda::std::plus<>{}, [](int val) {
+              return int64_t{val % 3};
+            })
+          == int64_t{size / 3} * 3);
+  }
+
+  { // the partial results are combined in order
+    std::vector<std::string> words(size / 16, "b");
+    words.front() = "a";
+    words.back()  = "c";
+    const auto res = cuda::std::reduce(policy, words.begin(), words.end(), std::string{});
+    CHECK(res.size() == words.size());
+    CHECK(res.front() == 'a');
+    CHECK(res.back() == 'c');
+  }
+
+  { // find_if returns the first match, even if chunks after it find matches first
+    for (const int pos : {0, size / 3, size - 1})
+    {
+      CHECK(cuda::std::find_if(policy, input.begin(), input.end(), [pos](int val) {
+              return val >= pos;
+            })
+            == input.begin() + pos);
+    }
+    CHECK(cuda::std::find(policy, input.begin(), input.end(), -1) == input.end());
+  }
+
+  { // copy_if keeps the order of the selected elements
+    const auto res = cuda::std::copy_if(policy, input.begin(), input.end(), output.begin(), is_even{});
+    CHECK(res == output.begin() + size / 2);
+    CHECK(cuda::std::equal(output.begin(), res, cuda::strided_iterator{cuda::counting_iterator{0}, 2}));
+  }
+
+  { // remove_if on elements that are not trivially copyable
+    std::vector<std::string> words(size / 16);
+    for (size_t i = 0; i < words.size(); ++i)
+    {
+      words[i] = std::to_string(i);
+    }
+    const auto res = cuda::std::remove_if(policy, words.begin(), words.end(), [](const std::string& word) {
+      return (word.back() - '0') % 2 == 1;
+    });
+    CHECK(res == words.begin() + words.size() / 2);
+    for (size_t i = 0; i < words.size() / 2; ++i)
+    {
+      CHECK(words[i] == std::to_string(2 * i));
+    }
+  }
+
+  { // transform, fill, replace, for_each and generate
+    cuda::std::transform(policy, input.begin(), input.end(), output.begin(), cuda::std::negate<>{});
+    CHECK(cuda::std::equal(output.begin(), output.end(), cuda::transform_iterator{input.begin(), cuda::std::negate<>{}}));
+
+    cuda::std::fill(policy, output.begin(), output.end(), 42);
+    cuda::std::replace_if(policy, output.begin(), output.begin() + size / 2, [](int) {
+      return true;
+    }, 1337);
+    CHECK(cuda::std::count(output.begin(), output.end(), 1337) == size / 2);
+
+    cuda::std::for_each(policy, output.begin(), output.end(), [](int& val) {
+      val = 0;
+    });
+    CHECK(cuda::std::count(output.begin(), output.end(), 0) == size);
+
+    cuda::std::generate_n(policy, output.begin(), size, [] {
+      return 7;
+    });
+    CHECK(cuda::std::count(output.begin(), output.end(), 7) == size);
+
+    cuda::std::copy(policy, input.begin(), input.end(), output.begin());
+    CHECK(output == input);
+  }
+}
+
+#if _CCCL_HAS_BACKEND_OMP()
+C2H_TEST("cuda::std parallel algorithms with the OpenMP backend", "[parallel algorithm]")
+{
+#  if defined(_OPENMP)
+  const int max_threads = omp_get_max_threads();
+  for (const int num_threads : {1, 2, 3, 8, 64})
+  {
+    omp_set_num_threads(num_threads);
+    test_cpu_backend(cuda::execution::__omp_par_unseq);
+  }
+  omp_set_num_threads(max_threads);
+#  else // ^^^ _OPENMP ^^^ / vvv !_OPENMP vvv
+  test_cpu_backend(cuda::execution::__omp_par_unseq);
+#  endif // ^^^ !_OPENMP ^^^
+}
+#endif // _CCCL_HAS_BACKEND_OMP()
+
+#if _CCCL_HAS_BACKEND_TBB()
+C2H_TEST("cuda::std parallel algorithms with the TBB backend", "[parallel algorithm]")
+{
+  for (const int num_threads : {1, 2, 3, 8, 64})
+  {
+    tbb::task_arena arena{num_threads};
+    arena.execute([] {
+      test_cpu_backend(cuda::execution::__tbb_par_unseq);
+    });
+  }
+}
+#endif // _CCCL_HAS_BACKEND_TBB()
@@ -0,0 +1,70 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/std/atomic>
+
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "../atomics.types.operations.req/atomic_helpers.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+#include "test_macros.h"
+
+template <class T, template <typename, typename> class Selector, cuda::thread_scope Scope>
+struct TestFn
+{
+  __host__ __device__ void operator()() const
+  {
+    using A = cuda::std::atomic<T>;
+
+    SHARED A* t;
+    SHARED A* done;
+    execute_on_main_thread([&] {
+      t    = (A*) malloc(sizeof(A));
+      done = (A*) malloc(sizeof(A));
+      cuda::std::atomic_init(t, T(1));
+      cuda::std::atomic_init(done, T(0));
+    });
+
+    // Both waiters must be released by a single notify_all, whichever of them is parked when it happens
+    auto agent_notify = LAMBDA()
+    {
+      cuda::std::atomic_store(t, T(2));
+      cuda::std::atomic_notify_all(t);
+    };
+
+    auto agent_wait = LAMBDA()
+    {
+      cuda::std::atomic_wait(t, T(1));
+      assert(cuda::std::atomic_load(t) == T(2));
+      cuda::std::atomic_fetch_add(done, T(1));
+    };
+
+    concurrent_agents_launch(agent_notify, agent_wait, agent_wait);
+
+    execute_on_main_thread([&] {
+      assert(cuda::std::atomic_load(done) == T(2));
+    });
+  }
+};
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, cuda_thread_count = 3;)
+
+  TestEachIntegralType<TestFn, shared_memory_selector>()();
+
+  return 0;
+}
@@ -8,7 +8,9 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <cuda/std/array>
 #include <cuda/std/random>
+#include <cuda/std/span>
 
 #include "random_utilities/test_engine.h"
 
@@ -43,6 +45,113 @@ __host__ __device__ TEST_CONSTEXPR_CXX20 bool test_set_counter()
   return true;
 }
 
+using philox2x20 = cuda::std::philox_engine<cuda::std::uint32_t, 20, 2, 10, 0xD2511, 0x9E377>;
+
+template <typename Engine>
+__host__ __device__ TEST_CONSTEXPR_CXX20 bool test_generate_random()
+{
+  using result_type         = typename Engine::result_type;
+  constexpr auto word_count = Engine::word_count;
+  using counter_t           = cuda::std::array<result_type, word_count>;
+  // Counters whose least significant word is about to overflow while generating a range
+  counter_t near_overflow_counter{};
+  near_overflow_counter[word_count - 2] = 5;
+  near_overflow_counter[word_count - 1] = Engine::max() - 10;
+
+  const unsigned long long discards[] = {0, 1, 3, 6};
+  const cuda::std::size_t sizes[]     = {0, 1, 4, 31, 32, 33, 100, 256};
+  for (int near_overflow = 0; near_overflow < 2; ++near_overflow)
+  {
+    for (auto discard : discards)
+    {
+      for (auto size : sizes)
+      {
+        Engine e1(23);
+        Engine e2(23);
+        if (near_overflow)
+        {
+          e1.set_counter(near_overflow_counter);
+          e2.set_counter(near_overflow_counter);
+        }
+        e1.discard(discard);
+        e2.discard(discard);
+
+        cuda::std::array<result_type, 256> values{};
+        static_assert(cuda::std::is_void_v<decltype(e1.generate_random(cuda::std::span<result_type>{values}))>);
+        e1.generate_random(cuda::std::span<result_type>{values.data(), size});
+        for (cuda::std::size_t i = 0; i < size; ++i)
+        {
+          assert(values[i] == e2());
+        }
+        assert(e1 == e2);
+        assert(e1() == e2());
+      }
+    }
+  }
+
+  // Streams partitioned with set_counter match one engine generating the whole range
+  Engine whole(7);
+  cuda::std::array<result_type, 128> expected{};
+  whole.generate_random(cuda::std::span<result_type>{expected});
+  for (result_type part = 0; part < 4; ++part)
+  {
+    Engine e(7);
+    counter_t counter{};
+    counter[word_count - 1] = part * (32 / word_count);
+    e.set_counter(counter);
+    cuda::std::array<result_type, 32> values{};
+    e.generate_random(cuda::std::span<result_type>{values});
+    for (cuda::std::size_t i = 0; i < values.size(); ++i)
+    {
+      assert(values[i] == expected[part * 32 + i]);
+    }
+  }
+  return true;
+}
+
+#if !_CCCL_COMPILER(NVRTC)
+// The serialized state includes the output buffer, which must match operator() also when generate_random ends on a
+// block boundary
+template <typename Engine>
+void test_generate_random_save()
+{
+  using result_type                    = typename Engine::result_type;
+  constexpr cuda::std::size_t block    = Engine::word_count;
+  const unsigned long long discards[]  = {0, 1, block - 1};
+  const cuda::std::size_t bulk_sizes[] = {8 * block, 16 * block, 24 * block};
+  for (auto discard : discards)
+  {
+    for (auto bulk_size : bulk_sizes)
+    {
+      Engine e1(23);
+      Engine e2(23);
+      e1.discard(discard);
+      e2.discard(discard);
+
+      // Reach the end of a block first, so that generate_random ends on a block boundary
+      const cuda::std::size_t size = (block - discard % block) % block + bulk_size;
+      cuda::std::array<result_type, 32 * 4> values{};
+      e1.generate_random(cuda::std::span<result_type>{values.data(), size});
+      for (cuda::std::size_t i = 0; i < size; ++i)
+      {
+        assert(values[i] == e2());
+      }
+
+      std::stringstream ss1;
+      std::stringstream ss2;
+      ss1 << e1;
+      ss2 << e2;
+      assert(ss1.str() == ss2.str());
+
+      Engine e3;
+      ss1 >> e3;
+      assert(e3 == e2);
+      assert(e3() == e2());
+    }
+  }
+}
+#endif // !_CCCL_COMPILER(NVRTC)
+
 __host__ __device__ TEST_CONSTEXPR_CXX20 bool test_against_reference()
 {
   // reference values obtained from other standard library implementations
@@ -85,10 +194,17 @@ __host__ __device__ TEST_CONSTEXPR_CXX20 bool test()
   test_set_counter<cuda::std::philox4x32>();
   test_set_counter<cuda::std::philox4x64>();
   test_against_reference();
+  test_generate_random<cuda::std::philox4x32>();
+  test_generate_random<cuda::std::philox4x64>();
+  // Words narrower than result_type go through the generic multiplication
+  test_generate_random<philox2x20>();
 #if TEST_STD_VER >= 2020
   static_assert(test_set_counter<cuda::std::philox4x32>());
   static_assert(test_set_counter<cuda::std::philox4x64>());
   static_assert(test_against_reference());
+  static_assert(test_generate_random<cuda::std::philox4x32>());
+  static_assert(test_generate_random<cuda::std::philox4x64>());
+  static_assert(test_generate_random<philox2x20>());
 #endif
   return true;
 }
@@ -96,5 +212,13 @@ __host__ __device__ TEST_CONSTEXPR_CXX20 bool test()
 int main(int, char**)
 {
   test();
+#if !_CCCL_COMPILER(NVRTC)
+  NV_IF_TARGET(NV_IS_HOST,
+               ({
+                 test_generate_random_save<cuda::std::philox4x32>();
+                 test_generate_random_save<cuda::std::philox4x64>();
+                 test_generate_random_save<philox2x20>();
+               }));
+#endif // !_CCCL_COMPILER(NVRTC)
   return 0;
 }
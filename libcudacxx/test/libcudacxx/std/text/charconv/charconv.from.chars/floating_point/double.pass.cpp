@@ -0,0 +1,221 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr double sentinel = 42;
+
+struct TestItem
+{
+  const char* str;
+  cuda::std::chars_format fmt;
+  double val; // sentinel if the value is left unmodified
+  int len; // number of parsed characters
+  cuda::std::errc ec;
+};
+
+// Source code for the generation of the test items
+// #include <charconv>
+// #include <cmath>
+// #include <cstdio>
+// #include <cstring>
+//
+// using T = double;
+//
+// struct Input
+// {
+//   const char* str;
+//   std::chars_format fmt;
+//   const char* fmt_name;
+// };
+//
+// constexpr auto general    = std::chars_format::general;
+// constexpr auto fixed      = std::chars_format::fixed;
+// constexpr auto scientific = std::chars_format::scientific;
+// constexpr auto hex        = std::chars_format::hex;
+//
+// constexpr Input list[] = {
+//   {"0", general, "general"},
+//   {"-0", general, "general"},
+//   {"1", general, "general"},
+//   {"-1.5", general, "general"},
+//   {"0.1", general, "general"},
+//   {".5", general, "general"},
+//   {"5.", general, "general"},
+//   {"1e23", general, "general"},
+//   {"9007199254740993", general, "general"},
+//   {"9007199254740993.00000000000000000000000000000000000001", general, "general"},
+//   {"2.4703282292062328e-324", general, "general"},
+//   {"2.4703282292062327e-324", general, "general"},
+//   {"1.7976931348623157e308", general, "general"},
+//   {"1.5e", general, "general"},
+//   {"1.5e+", general, "general"},
+//   {"1e-400", general, "general"},
+//   {"1e400", general, "general"},
+//   {"0e999999999999", general, "general"},
+//   {"inf", general, "general"},
+//   {"-INFINITY", general, "general"},
+//   {"infinit", general, "general"},
+//   {"nan", general, "general"},
+//   {"nan(1_x)", general, "general"},
+//   {"nan(", general, "general"},
+//   {"1e5", fixed, "fixed"},
+//   {"123.456", fixed, "fixed"},
+//   {"15", scientific, "scientific"},
+//   {"1.5E-2", scientific, "scientific"},
+//   {"1.8p1", hex, "hex"},
+//   {"-1.fffffffffffff8p1023", hex, "hex"},
+//   {"0x1p3", hex, "hex"},
+//   {"", general, "general"},
+//   {"+1", general, "general"},
+//   {" 1", general, "general"},
+//   {".", general, "general"},
+//   {"e5", general, "general"},
+// };
+//
+// void print_value(T v)
+// {
+//   if (std::isnan(v))
+//   {
+//     std::printf("cuda::std::numeric_limits<double>::quiet_NaN()");
+//   }
+//   else if (std::isinf(v))
+//   {
+//     std::printf("%scuda::std::numeric_limits<double>::infinity()", (v < 0) ? "-" : "");
+//   }
+//   else
+//   {
+//     std::printf("%a", v);
+//   }
+// }
+//
+// int main()
+// {
+//   for (const auto& input : list)
+//   {
+//     T value           = 42;
+//     const auto len    = std::strlen(input.str);
+//     const auto result = std::from_chars(input.str, input.str + len, value, input.fmt);
+//     const char* ec    = (result.ec == std::errc{}) ? "cuda::std::errc{}"
+//                       : (result.ec == std::errc::invalid_argument)
+//                         ? "cuda::std::errc::invalid_argument"
+//                         : "cuda::std::errc::result_out_of_range";
+//     std::printf("    TestItem{\"%s\", cuda::std::chars_format::%s, ", input.str, input.fmt_name);
+//     print_value(value);
+//     std::printf(", %d, %s},\n", static_cast<int>(result.ptr - input.str), ec);
+//   }
+// }
+
+__host__ __device__ constexpr cuda::std::array<TestItem, 36> get_test_items()
+{
+  return {{
+    TestItem{"0", cuda::std::chars_format::general, 0x0p+0, 1, cuda::std::errc{}},
+    TestItem{"-0", cuda::std::chars_format::general, -0x0p+0, 2, cuda::std::errc{}},
+    TestItem{"1", cuda::std::chars_format::general, 0x1p+0, 1, cuda::std::errc{}},
+    TestItem{"-1.5", cuda::std::chars_format::general, -0x1.8p+0, 4, cuda::std::errc{}},
+    TestItem{"0.1", cuda::std::chars_format::general, 0x1.999999999999ap-4, 3, cuda::std::errc{}},
+    TestItem{".5", cuda::std::chars_format::general, 0x1p-1, 2, cuda::std::errc{}},
+    TestItem{"5.", cuda::std::chars_format::general, 0x1.4p+2, 2, cuda::std::errc{}},
+    TestItem{"1e23", cuda::std::chars_format::general, 0x1.52d02c7e14af6p+76, 4, cuda::std::errc{}},
+    TestItem{"9007199254740993", cuda::std::chars_format::general, 0x1p+53, 16, cuda::std::errc{}},
+    TestItem{"9007199254740993.00000000000000000000000000000000000001", cuda::std::chars_format::general, 0x1.0000000000001p+53, 55, cuda::std::errc{}},
+    TestItem{"2.4703282292062328e-324", cuda::std::chars_format::general, 0x0.0000000000001p-1022, 23, cuda::std::errc{}},
+    TestItem{"2.4703282292062327e-324", cuda::std::chars_format::general, 0x1.5p+5, 23, cuda::std::errc::result_out_of_range},
+    TestItem{"1.7976931348623157e308", cuda::std::chars_format::general, 0x1.fffffffffffffp+1023, 22, cuda::std::errc{}},
+    TestItem{"1.5e", cuda::std::chars_format::general, 0x1.8p+0, 3, cuda::std::errc{}},
+    TestItem{"1.5e+", cuda::std::chars_format::general, 0x1.8p+0, 3, cuda::std::errc{}},
+    TestItem{"1e-400", cuda::std::chars_format::general, 0x1.5p+5, 6, cuda::std::errc::result_out_of_range},
+    TestItem{"1e400", cuda::std::chars_format::general, 0x1.5p+5, 5, cuda::std::errc::result_out_of_range},
+    TestItem{"0e999999999999", cuda::std::chars_format::general, 0x0p+0, 14, cuda::std::errc{}},
+    TestItem{"inf", cuda::std::chars_format::general, cuda::std::numeric_limits<double>::infinity(), 3, cuda::std::errc{}},
+    TestItem{"-INFINITY", cuda::std::chars_format::general, -cuda::std::numeric_limits<double>::infinity(), 9, cuda::std::errc{}},
+    TestItem{"infinit", cuda::std::chars_format::general, cuda::std::numeric_limits<double>::infinity(), 3, cuda::std::errc{}},
+    TestItem{"nan", cuda::std::chars_format::general, cuda::std::numeric_limits<double>::quiet_NaN(), 3, cuda::std::errc{}},
+    TestItem{"nan(1_x)", cuda::std::chars_format::general, cuda::std::numeric_limits<double>::quiet_NaN(), 8, cuda::std::errc{}},
+    TestItem{"nan(", cuda::std::chars_format::general, cuda::std::numeric_limits<double>::quiet_NaN(), 3, cuda::std::errc{}},
+    TestItem{"1e5", cuda::std::chars_format::fixed, 0x1p+0, 1, cuda::std::errc{}},
+    TestItem{"123.456", cuda::std::chars_format::fixed, 0x1.edd2f1a9fbe77p+6, 7, cuda::std::errc{}},
+    TestItem{"15", cuda::std::chars_format::scientific, 0x1.5p+5, 0, cuda::std::errc::invalid_argument},
+    TestItem{"1.5E-2", cuda::std::chars_format::scientific, 0x1.eb851eb851eb8p-7, 6, cuda::std::errc{}},
+    TestItem{"1.8p1", cuda::std::chars_format::hex, 0x1.8p+1, 5, cuda::std::errc{}},
+    TestItem{"-1.fffffffffffff8p1023", cuda::std::chars_format::hex, 0x1.5p+5, 22, cuda::std::errc::result_out_of_range},
+    TestItem{"0x1p3", cuda::std::chars_format::hex, 0x0p+0, 1, cuda::std::errc{}},
+    TestItem{"", cuda::std::chars_format::general, 0x1.5p+5, 0, cuda::std::errc::invalid_argument},
+    TestItem{"+1", cuda::std::chars_format::general, 0x1.5p+5, 0, cuda::std::errc::invalid_argument},
+    TestItem{" 1", cuda::std::chars_format::general, 0x1.5p+5, 0, cuda::std::errc::invalid_argument},
+    TestItem{".", cuda::std::chars_format::general, 0x1.5p+5, 0, cuda::std::errc::invalid_argument},
+    TestItem{"e5", cuda::std::chars_format::general, 0x1.5p+5, 0, cuda::std::errc::invalid_argument},
+  }};
+}
+
+__host__ __device__ constexpr void test_from_chars(const TestItem& item)
+{
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<double&>(),
+                                       cuda::std::chars_format{}))>);
+  static_assert(noexcept(cuda::std::from_chars(
+    cuda::std::declval<const char*>(), cuda::std::declval<const char*>(), cuda::std::declval<double&>())));
+
+  const auto len = cuda::std::strlen(item.str);
+
+  double value      = sentinel;
+  const auto result = cuda::std::from_chars(item.str, item.str + len, value, item.fmt);
+  assert(result.ec == item.ec);
+  assert(result.ptr == item.str + item.len);
+  if (item.val != item.val)
+  {
+    assert(value != value);
+  }
+  else
+  {
+    assert(value == item.val);
+  }
+
+  // The default format is general
+  if (item.fmt == cuda::std::chars_format::general)
+  {
+    double default_value      = sentinel;
+    const auto default_result = cuda::std::from_chars(item.str, item.str + len, default_value);
+    assert(default_result.ec == result.ec);
+    assert(default_result.ptr == result.ptr);
+    assert(default_value == value || (default_value != default_value && value != value));
+  }
+}
+
+__host__ __device__ constexpr bool test()
+{
+  constexpr auto items = get_test_items();
+
+  for (const auto& item : items)
+  {
+    test_from_chars(item);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if _CCCL_HAS_CONSTEXPR_BIT_CAST()
+  static_assert(test());
+#endif // _CCCL_HAS_CONSTEXPR_BIT_CAST()
+  return 0;
+}
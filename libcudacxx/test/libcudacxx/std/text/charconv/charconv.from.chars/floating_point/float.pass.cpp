@@ -0,0 +1,221 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr float sentinel = 42;
+
+struct TestItem
+{
+  const char* str;
+  cuda::std::chars_format fmt;
+  float val; // sentinel if the value is left unmodified
+  int len; // number of parsed characters
+  cuda::std::errc ec;
+};
+
+// Source code for the generation of the test items
+// #include <charconv>
+// #include <cmath>
+// #include <cstdio>
+// #include <cstring>
+//
+// using T = float;
+//
+// struct Input
+// {
+//   const char* str;
+//   std::chars_format fmt;
+//   const char* fmt_name;
+// };
+//
+// constexpr auto general    = std::chars_format::general;
+// constexpr auto fixed      = std::chars_format::fixed;
+// constexpr auto scientific = std::chars_format::scientific;
+// constexpr auto hex        = std::chars_format::hex;
+//
+// constexpr Input list[] = {
+//   {"0", general, "general"},
+//   {"-0", general, "general"},
+//   {"1", general, "general"},
+//   {"-1.5", general, "general"},
+//   {"0.1", general, "general"},
+//   {".5", general, "general"},
+//   {"5.", general, "general"},
+//   {"1e23", general, "general"},
+//   {"16777217", general, "general"},
+//   {"16777217.00000000000000000000000000000000000001", general, "general"},
+//   {"7.00649232162408535461864791644958065640130970938257885878534141944895541342930300743319094181060791015626e-46", general, "general"},
+//   {"7.00649232162408535461864791644958065640130970938257885878534141944895541342930300743319094181060791015625e-46", general, "general"},
+//   {"3.4028235e38", general, "general"},
+//   {"1.5e", general, "general"},
+//   {"1.5e+", general, "general"},
+//   {"1e-50", general, "general"},
+//   {"1e39", general, "general"},
+//   {"0e999999999999", general, "general"},
+//   {"inf", general, "general"},
+//   {"-INFINITY", general, "general"},
+//   {"infinit", general, "general"},
+//   {"nan", general, "general"},
+//   {"nan(1_x)", general, "general"},
+//   {"nan(", general, "general"},
+//   {"1e5", fixed, "fixed"},
+//   {"123.456", fixed, "fixed"},
+//   {"15", scientific, "scientific"},
+//   {"1.5E-2", scientific, "scientific"},
+//   {"1.8p1", hex, "hex"},
+//   {"-1.ffffffp127", hex, "hex"},
+//   {"0x1p3", hex, "hex"},
+//   {"", general, "general"},
+//   {"+1", general, "general"},
+//   {" 1", general, "general"},
+//   {".", general, "general"},
+//   {"e5", general, "general"},
+// };
+//
+// void print_value(T v)
+// {
+//   if (std::isnan(v))
+//   {
+//     std::printf("cuda::std::numeric_limits<float>::quiet_NaN()");
+//   }
+//   else if (std::isinf(v))
+//   {
+//     std::printf("%scuda::std::numeric_limits<float>::infinity()", (v < 0) ? "-" : "");
+//   }
+//   else
+//   {
+//     std::printf("%af", v);
+//   }
+// }
+//
+// int main()
+// {
+//   for (const auto& input : list)
+//   {
+//     T value           = 42;
+//     const auto len    = std::strlen(input.str);
+//     const auto result = std::from_chars(input.str, input.str + len, value, input.fmt);
+//     const char* ec    = (result.ec == std::errc{}) ? "cuda::std::errc{}"
+//                       : (result.ec == std::errc::invalid_argument)
+//                         ? "cuda::std::errc::invalid_argument"
+//                         : "cuda::std::errc::result_out_of_range";
+//     std::printf("    TestItem{\"%s\", cuda::std::chars_format::%s, ", input.str, input.fmt_name);
+//     print_value(value);
+//     std::printf(", %d, %s},\n", static_cast<int>(result.ptr - input.str), ec);
+//   }
+// }
+
+__host__ __device__ constexpr cuda::std::array<TestItem, 36> get_test_items()
+{
+  return {{
+    TestItem{"0", cuda::std::chars_format::general, 0x0p+0f, 1, cuda::std::errc{}},
+    TestItem{"-0", cuda::std::chars_format::general, -0x0p+0f, 2, cuda::std::errc{}},
+    TestItem{"1", cuda::std::chars_format::general, 0x1p+0f, 1, cuda::std::errc{}},
+    TestItem{"-1.5", cuda::std::chars_format::general, -0x1.8p+0f, 4, cuda::std::errc{}},
+    TestItem{"0.1", cuda::std::chars_format::general, 0x1.99999ap-4f, 3, cuda::std::errc{}},
+    TestItem{".5", cuda::std::chars_format::general, 0x1p-1f, 2, cuda::std::errc{}},
+    TestItem{"5.", cuda::std::chars_format::general, 0x1.4p+2f, 2, cuda::std::errc{}},
+    TestItem{"1e23", cuda::std::chars_format::general, 0x1.52d02cp+76f, 4, cuda::std::errc{}},
+    TestItem{"16777217", cuda::std::chars_format::general, 0x1p+24f, 8, cuda::std::errc{}},
+    TestItem{"16777217.00000000000000000000000000000000000001", cuda::std::chars_format::general, 0x1.000002p+24f, 47, cuda::std::errc{}},
+    TestItem{"7.00649232162408535461864791644958065640130970938257885878534141944895541342930300743319094181060791015626e-46", cuda::std::chars_format::general, 0x1p-149f, 110, cuda::std::errc{}},
+    TestItem{"7.00649232162408535461864791644958065640130970938257885878534141944895541342930300743319094181060791015625e-46", cuda::std::chars_format::general, 0x1.5p+5f, 110, cuda::std::errc::result_out_of_range},
+    TestItem{"3.4028235e38", cuda::std::chars_format::general, 0x1.fffffep+127f, 12, cuda::std::errc{}},
+    TestItem{"1.5e", cuda::std::chars_format::general, 0x1.8p+0f, 3, cuda::std::errc{}},
+    TestItem{"1.5e+", cuda::std::chars_format::general, 0x1.8p+0f, 3, cuda::std::errc{}},
+    TestItem{"1e-50", cuda::std::chars_format::general, 0x1.5p+5f, 5, cuda::std::errc::result_out_of_range},
+    TestItem{"1e39", cuda::std::chars_format::general, 0x1.5p+5f, 4, cuda::std::errc::result_out_of_range},
+    TestItem{"0e999999999999", cuda::std::chars_format::general, 0x0p+0f, 14, cuda::std::errc{}},
+    TestItem{"inf", cuda::std::chars_format::general, cuda::std::numeric_limits<float>::infinity(), 3, cuda::std::errc{}},
+    TestItem{"-INFINITY", cuda::std::chars_format::general, -cuda::std::numeric_limits<float>::infinity(), 9, cuda::std::errc{}},
+    TestItem{"infinit", cuda::std::chars_format::general, cuda::std::numeric_limits<float>::infinity(), 3, cuda::std::errc{}},
+    TestItem{"nan", cuda::std::chars_format::general, cuda::std::numeric_limits<float>::quiet_NaN(), 3, cuda::std::errc{}},
+    TestItem{"nan(1_x)", cuda::std::chars_format::general, cuda::std::numeric_limits<float>::quiet_NaN(), 8, cuda::std::errc{}},
+    TestItem{"nan(", cuda::std::chars_format::general, cuda::std::numeric_limits<float>::quiet_NaN(), 3, cuda::std::errc{}},
+    TestItem{"1e5", cuda::std::chars_format::fixed, 0x1p+0f, 1, cuda::std::errc{}},
+    TestItem{"123.456", cuda::std::chars_format::fixed, 0x1.edd2f2p+6f, 7, cuda::std::errc{}},
+    TestItem{"15", cuda::std::chars_format::scientific, 0x1.5p+5f, 0, cuda::std::errc::invalid_argument},
+    TestItem{"1.5E-2", cuda::std::chars_format::scientific, 0x1.eb851ep-7f, 6, cuda::std::errc{}},
+    TestItem{"1.8p1", cuda::std::chars_format::hex, 0x1.8p+1f, 5, cuda::std::errc{}},
+    TestItem{"-1.ffffffp127", cuda::std::chars_format::hex, 0x1.5p+5f, 13, cuda::std::errc::result_out_of_range},
+    TestItem{"0x1p3", cuda::std::chars_format::hex, 0x0p+0f, 1, cuda::std::errc{}},
+    TestItem{"", cuda::std::chars_format::general, 0x1.5p+5f, 0, cuda::std::errc::invalid_argument},
+    TestItem{"+1", cuda::std::chars_format::general, 0x1.5p+5f, 0, cuda::std::errc::invalid_argument},
+    TestItem{" 1", cuda::std::chars_format::general, 0x1.5p+5f, 0, cuda::std::errc::invalid_argument},
+    TestItem{".", cuda::std::chars_format::general, 0x1.5p+5f, 0, cuda::std::errc::invalid_argument},
+    TestItem{"e5", cuda::std::chars_format::general, 0x1.5p+5f, 0, cuda::std::errc::invalid_argument},
+  }};
+}
+
+__host__ __device__ constexpr void test_from_chars(const TestItem& item)
+{
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<float&>(),
+                                       cuda::std::chars_format{}))>);
+  static_assert(noexcept(cuda::std::from_chars(
+    cuda::std::declval<const char*>(), cuda::std::declval<const char*>(), cuda::std::declval<float&>())));
+
+  const auto len = cuda::std::strlen(item.str);
+
+  float value       = sentinel;
+  const auto result = cuda::std::from_chars(item.str, item.str + len, value, item.fmt);
+  assert(result.ec == item.ec);
+  assert(result.ptr == item.str + item.len);
+  if (item.val != item.val)
+  {
+    assert(value != value);
+  }
+  else
+  {
+    assert(value == item.val);
+  }
+
+  // The default format is general
+  if (item.fmt == cuda::std::chars_format::general)
+  {
+    float default_value       = sentinel;
+    const auto default_result = cuda::std::from_chars(item.str, item.str + len, default_value);
+    assert(default_result.ec == result.ec);
+    assert(default_result.ptr == result.ptr);
+    assert(default_value == value || (default_value != default_value && value != value));
+  }
+}
+
+__host__ __device__ constexpr bool test()
+{
+  constexpr auto items = get_test_items();
+
+  for (const auto& item : items)
+  {
+    test_from_chars(item);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if _CCCL_HAS_CONSTEXPR_BIT_CAST()
+  static_assert(test());
+#endif // _CCCL_HAS_CONSTEXPR_BIT_CAST()
+  return 0;
+}
@@ -779,6 +779,20 @@ __host__ __device__ constexpr void test_overflow()
     item.str_unsigned = "";
     test_from_chars<T>(item, base, true);
   }
+
+  // 5. Test overflow where the wrapped around value is still larger than the previous one
+  {
+    item.str_signed   = "999";
+    item.str_unsigned = "999";
+    test_from_chars<T>(item, base, true);
+  }
+
+  // 6. Test the same for a base that isn't a power of two and has letter digits
+  {
+    item.str_signed   = "aa";
+    item.str_unsigned = "aa";
+    test_from_chars<T>(item, 29, true);
+  }
 }
 
 template <int Base>
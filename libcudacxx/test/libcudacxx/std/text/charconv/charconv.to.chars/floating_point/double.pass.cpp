@@ -0,0 +1,368 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr int precision = 3;
+
+struct TestItem
+{
+  double val;
+  const char* str; // to_chars(first, last, val)
+  const char* str_fmt[4]; // to_chars(first, last, val, formats[i])
+  const char* str_fmt_prec[4]; // to_chars(first, last, val, formats[i], precision)
+};
+
+// Source code for the generation of the test items
+// #include <charconv>
+// #include <cstdio>
+// #include <limits>
+//
+// using T = double;
+//
+// constexpr T list[] = {
+//   0.0,
+//   -0.0,
+//   1.0,
+//   -1.5,
+//   0.1,
+//   0.3,
+//   9.5,
+//   123456.789,
+//   1e-7,
+//   1e21,
+//   1e23,
+//   9007199254740993.0,
+//   -2.5e-300,
+//   std::numeric_limits<T>::min(),
+//   std::numeric_limits<T>::denorm_min(),
+//   std::numeric_limits<T>::max(),
+//   std::numeric_limits<T>::infinity(),
+//   -std::numeric_limits<T>::infinity(),
+//   std::numeric_limits<T>::quiet_NaN(),
+// };
+//
+// constexpr std::chars_format formats[] = {
+//   std::chars_format::fixed, std::chars_format::scientific, std::chars_format::general, std::chars_format::hex};
+//
+// void print(const char* first, const char* last, const char* sep)
+// {
+//   std::printf("\"%.*s\"%s", static_cast<int>(last - first), first, sep);
+// }
+//
+// int main()
+// {
+//   for (auto v : list)
+//   {
+//     char buff[1000]{};
+//     std::printf("    TestItem{");
+//     if (v != v)
+//     {
+//       std::printf("cuda::std::numeric_limits<double>::quiet_NaN()");
+//     }
+//     else if (v == std::numeric_limits<T>::infinity() || v == -std::numeric_limits<T>::infinity())
+//     {
+//       std::printf("%scuda::std::numeric_limits<double>::infinity()", (v < 0) ? "-" : "");
+//     }
+//     else
+//     {
+//       std::printf("%a", v);
+//     }
+//     std::printf(",\n             ");
+//     print(buff, std::to_chars(buff, buff + sizeof(buff), v).ptr, ",\n             {");
+//     for (auto fmt : formats)
+//     {
+//       print(buff, std::to_chars(buff, buff + sizeof(buff), v, fmt).ptr, (fmt == std::chars_format::hex) ? "},\n             {" : ",\n              ");
+//     }
+//     for (auto fmt : formats)
+//     {
+//       print(buff, std::to_chars(buff, buff + sizeof(buff), v, fmt, 3).ptr, (fmt == std::chars_format::hex) ? "}},\n" : ",\n              ");
+//     }
+//   }
+// }
+
+__host__ __device__ constexpr cuda::std::array<TestItem, 19> get_test_items()
+{
+  return {{
+    TestItem{0x0p+0,
+             "0",
+             {"0",
+              "0e+00",
+              "0",
+              "0p+0"},
+             {"0.000",
+              "0.000e+00",
+              "0",
+              "0.000p+0"}},
+    TestItem{-0x0p+0,
+             "-0",
+             {"-0",
+              "-0e+00",
+              "-0",
+              "-0p+0"},
+             {"-0.000",
+              "-0.000e+00",
+              "-0",
+              "-0.000p+0"}},
+    TestItem{0x1p+0,
+             "1",
+             {"1",
+              "1e+00",
+              "1",
+              "1p+0"},
+             {"1.000",
+              "1.000e+00",
+              "1",
+              "1.000p+0"}},
+    TestItem{-0x1.8p+0,
+             "-1.5",
+             {"-1.5",
+              "-1.5e+00",
+              "-1.5",
+              "-1.8p+0"},
+             {"-1.500",
+              "-1.500e+00",
+              "-1.5",
+              "-1.800p+0"}},
+    TestItem{0x1.999999999999ap-4,
+             "0.1",
+             {"0.1",
+              "1e-01",
+              "0.1",
+              "1.999999999999ap-4"},
+             {"0.100",
+              "1.000e-01",
+              "0.1",
+              "1.99ap-4"}},
+    TestItem{0x1.3333333333333p-2,
+             "0.3",
+             {"0.3",
+              "3e-01",
+              "0.3",
+              "1.3333333333333p-2"},
+             {"0.300",
+              "3.000e-01",
+              "0.3",
+              "1.333p-2"}},
+    TestItem{0x1.3p+3,
+             "9.5",
+             {"9.5",
+              "9.5e+00",
+              "9.5",
+              "1.3p+3"},
+             {"9.500",
+              "9.500e+00",
+              "9.5",
+              "1.300p+3"}},
+    TestItem{0x1.e240c9fbe76c9p+16,
+             "123456.789",
+             {"123456.789",
+              "1.23456789e+05",
+              "123456.789",
+              "1.e240c9fbe76c9p+16"},
+             {"123456.789",
+              "1.235e+05",
+              "1.23e+05",
+              "1.e24p+16"}},
+    TestItem{0x1.ad7f29abcaf48p-24,
+             "1e-07",
+             {"0.0000001",
+              "1e-07",
+              "1e-07",
+              "1.ad7f29abcaf48p-24"},
+             {"0.000",
+              "1.000e-07",
+              "1e-07",
+              "1.ad8p-24"}},
+    TestItem{0x1.b1ae4d6e2ef5p+69,
+             "1e+21",
+             {"1000000000000000000000",
+              "1e+21",
+              "1e+21",
+              "1.b1ae4d6e2ef5p+69"},
+             {"1000000000000000000000.000",
+              "1.000e+21",
+              "1e+21",
+              "1.b1bp+69"}},
+    TestItem{0x1.52d02c7e14af6p+76,
+             "1e+23",
+             {"99999999999999991611392",
+              "1e+23",
+              "1e+23",
+              "1.52d02c7e14af6p+76"},
+             {"99999999999999991611392.000",
+              "1.000e+23",
+              "1e+23",
+              "1.52dp+76"}},
+    TestItem{0x1p+53,
+             "9007199254740992",
+             {"9007199254740992",
+              "9.007199254740992e+15",
+              "9.007199254740992e+15",
+              "1p+53"},
+             {"9007199254740992.000",
+              "9.007e+15",
+              "9.01e+15",
+              "1.000p+53"}},
+    TestItem{-0x1.ac9a7b3b7302fp-996,
+             "-2.5e-300",
+             {"-0.0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000025",
+              "-2.5e-300",
+              "-2.5e-300",
+              "-1.ac9a7b3b7302fp-996"},
+             {"-0.000",
+              "-2.500e-300",
+              "-2.5e-300",
+              "-1.acap-996"}},
+    TestItem{0x1p-1022,
+             "2.2250738585072014e-308",
+             {"0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000022250738585072014",
+              "2.2250738585072014e-308",
+              "2.2250738585072014e-308",
+              "1p-1022"},
+             {"0.000",
+              "2.225e-308",
+              "2.23e-308",
+              "1.000p-1022"}},
+    TestItem{0x0.0000000000001p-1022,
+             "5e-324",
+             {"0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000005",
+              "5e-324",
+              "5e-324",
+              "0.0000000000001p-1022"},
+             {"0.000",
+              "4.941e-324",
+              "4.94e-324",
+              "0.000p-1022"}},
+    TestItem{0x1.fffffffffffffp+1023,
+             "1.7976931348623157e+308",
+             {"179769313486231570814527423731704356798070567525844996598917476803157260780028538760589558632766878171540458953514382464234321326889464182768467546703537516986049910576551282076245490090389328944075868508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184124858368",
+              "1.7976931348623157e+308",
+              "1.7976931348623157e+308",
+              "1.fffffffffffffp+1023"},
+             {"179769313486231570814527423731704356798070567525844996598917476803157260780028538760589558632766878171540458953514382464234321326889464182768467546703537516986049910576551282076245490090389328944075868508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184124858368.000",
+              "1.798e+308",
+              "1.8e+308",
+              "2.000p+1023"}},
+    TestItem{cuda::std::numeric_limits<double>::infinity(),
+             "inf",
+             {"inf",
+              "inf",
+              "inf",
+              "inf"},
+             {"inf",
+              "inf",
+              "inf",
+              "inf"}},
+    TestItem{-cuda::std::numeric_limits<double>::infinity(),
+             "-inf",
+             {"-inf",
+              "-inf",
+              "-inf",
+              "-inf"},
+             {"-inf",
+              "-inf",
+              "-inf",
+              "-inf"}},
+    TestItem{cuda::std::numeric_limits<double>::quiet_NaN(),
+             "nan",
+             {"nan",
+              "nan",
+              "nan",
+              "nan"},
+             {"nan",
+              "nan",
+              "nan",
+              "nan"}},
+  }};
+}
+
+template <class... Args>
+__host__ __device__ constexpr void test_to_chars(const char* ref_str, double value, Args... args)
+{
+  constexpr cuda::std::size_t buff_size = 400;
+
+  static_assert(cuda::std::is_same_v<cuda::std::to_chars_result,
+                                     decltype(cuda::std::to_chars(
+                                       cuda::std::declval<char*>(), cuda::std::declval<char*>(), value, args...))>);
+  static_assert(noexcept(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), value, args...)));
+
+  char buff[buff_size + 1]{};
+  char* buff_start = buff + 1;
+
+  const auto ref_len = cuda::std::strlen(ref_str);
+
+  // Check valid buffer size
+  {
+    const auto result = cuda::std::to_chars(buff_start, buff_start + buff_size, value, args...);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff_start + ref_len);
+
+    // Compare with reference string
+    assert(cuda::std::strncmp(buff_start, ref_str, buff_size) == 0);
+
+    // Check that the operation did not underflow the buffer
+    assert(buff[0] == '\0');
+  }
+
+  // Check too small buffer
+  {
+    const auto result = cuda::std::to_chars(buff_start, buff_start + ref_len - 1, value, args...);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start + ref_len - 1);
+  }
+
+  // Check zero buffer
+  {
+    const auto result = cuda::std::to_chars(buff_start, buff_start, value, args...);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start);
+  }
+}
+
+__host__ __device__ constexpr bool test()
+{
+  constexpr auto items = get_test_items();
+
+  constexpr cuda::std::chars_format formats[] = {
+    cuda::std::chars_format::fixed,
+    cuda::std::chars_format::scientific,
+    cuda::std::chars_format::general,
+    cuda::std::chars_format::hex,
+  };
+
+  for (const auto& item : items)
+  {
+    test_to_chars(item.str, item.val);
+    for (cuda::std::size_t i = 0; i < cuda::std::size(formats); ++i)
+    {
+      test_to_chars(item.str_fmt[i], item.val, formats[i]);
+      test_to_chars(item.str_fmt_prec[i], item.val, formats[i], precision);
+    }
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if _CCCL_HAS_CONSTEXPR_BIT_CAST()
+  static_assert(test());
+#endif // _CCCL_HAS_CONSTEXPR_BIT_CAST()
+  return 0;
+}
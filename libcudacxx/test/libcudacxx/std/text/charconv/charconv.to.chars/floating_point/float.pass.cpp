@@ -0,0 +1,357 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr int precision = 3;
+
+struct TestItem
+{
+  float val;
+  const char* str; // to_chars(first, last, val)
+  const char* str_fmt[4]; // to_chars(first, last, val, formats[i])
+  const char* str_fmt_prec[4]; // to_chars(first, last, val, formats[i], precision)
+};
+
+// Source code for the generation of the test items
+// #include <charconv>
+// #include <cstdio>
+// #include <limits>
+//
+// using T = float;
+//
+// constexpr T list[] = {
+//   0.0f,
+//   -0.0f,
+//   1.0f,
+//   -1.5f,
+//   0.1f,
+//   0.3f,
+//   9.5f,
+//   123456.79f,
+//   1e-7f,
+//   1e10f,
+//   16777216.0f,
+//   -2.5e-30f,
+//   std::numeric_limits<T>::min(),
+//   std::numeric_limits<T>::denorm_min(),
+//   std::numeric_limits<T>::max(),
+//   std::numeric_limits<T>::infinity(),
+//   -std::numeric_limits<T>::infinity(),
+//   std::numeric_limits<T>::quiet_NaN(),
+// };
+//
+// constexpr std::chars_format formats[] = {
+//   std::chars_format::fixed, std::chars_format::scientific, std::chars_format::general, std::chars_format::hex};
+//
+// void print(const char* first, const char* last, const char* sep)
+// {
+//   std::printf("\"%.*s\"%s", static_cast<int>(last - first), first, sep);
+// }
+//
+// int main()
+// {
+//   for (auto v : list)
+//   {
+//     char buff[1000]{};
+//     std::printf("    TestItem{");
+//     if (v != v)
+//     {
+//       std::printf("cuda::std::numeric_limits<float>::quiet_NaN()");
+//     }
+//     else if (v == std::numeric_limits<T>::infinity() || v == -std::numeric_limits<T>::infinity())
+//     {
+//       std::printf("%scuda::std::numeric_limits<float>::infinity()", (v < 0) ? "-" : "");
+//     }
+//     else
+//     {
+//       std::printf("%af", v);
+//     }
+//     std::printf(",\n             ");
+//     print(buff, std::to_chars(buff, buff + sizeof(buff), v).ptr, ",\n             {");
+//     for (auto fmt : formats)
+//     {
+//       print(buff, std::to_chars(buff, buff + sizeof(buff), v, fmt).ptr, (fmt == std::chars_format::hex) ? "},\n             {" : ",\n              ");
+//     }
+//     for (auto fmt : formats)
+//     {
+//       print(buff, std::to_chars(buff, buff + sizeof(buff), v, fmt, 3).ptr, (fmt == std::chars_format::hex) ? "}},\n" : ",\n              ");
+//     }
+//   }
+// }
+
+__host__ __device__ constexpr cuda::std::array<TestItem, 18> get_test_items()
+{
+  return {{
+    TestItem{0x0p+0f,
+             "0",
+             {"0",
+              "0e+00",
+              "0",
+              "0p+0"},
+             {"0.000",
+              "0.000e+00",
+              "0",
+              "0.000p+0"}},
+    TestItem{-0x0p+0f,
+             "-0",
+             {"-0",
+              "-0e+00",
+              "-0",
+              "-0p+0"},
+             {"-0.000",
+              "-0.000e+00",
+              "-0",
+              "-0.000p+0"}},
+    TestItem{0x1p+0f,
+             "1",
+             {"1",
+              "1e+00",
+              "1",
+              "1p+0"},
+             {"1.000",
+              "1.000e+00",
+              "1",
+              "1.000p+0"}},
+    TestItem{-0x1.8p+0f,
+             "-1.5",
+             {"-1.5",
+              "-1.5e+00",
+              "-1.5",
+              "-1.8p+0"},
+             {"-1.500",
+              "-1.500e+00",
+              "-1.5",
+              "-1.800p+0"}},
+    TestItem{0x1.99999ap-4f,
+             "0.1",
+             {"0.1",
+              "1e-01",
+              "0.1",
+              "1.99999ap-4"},
+             {"0.100",
+              "1.000e-01",
+              "0.1",
+              "1.99ap-4"}},
+    TestItem{0x1.333334p-2f,
+             "0.3",
+             {"0.3",
+              "3e-01",
+              "0.3",
+              "1.333334p-2"},
+             {"0.300",
+              "3.000e-01",
+              "0.3",
+              "1.333p-2"}},
+    TestItem{0x1.3p+3f,
+             "9.5",
+             {"9.5",
+              "9.5e+00",
+              "9.5",
+              "1.3p+3"},
+             {"9.500",
+              "9.500e+00",
+              "9.5",
+              "1.300p+3"}},
+    TestItem{0x1.e240cap+16f,
+             "123456.79",
+             {"123456.79",
+              "1.2345679e+05",
+              "123456.79",
+              "1.e240cap+16"},
+             {"123456.789",
+              "1.235e+05",
+              "1.23e+05",
+              "1.e24p+16"}},
+    TestItem{0x1.ad7f2ap-24f,
+             "1e-07",
+             {"0.0000001",
+              "1e-07",
+              "1e-07",
+              "1.ad7f2ap-24"},
+             {"0.000",
+              "1.000e-07",
+              "1e-07",
+              "1.ad8p-24"}},
+    TestItem{0x1.2a05f2p+33f,
+             "1e+10",
+             {"10000000000",
+              "1e+10",
+              "1e+10",
+              "1.2a05f2p+33"},
+             {"10000000000.000",
+              "1.000e+10",
+              "1e+10",
+              "1.2a0p+33"}},
+    TestItem{0x1p+24f,
+             "16777216",
+             {"16777216",
+              "1.6777216e+07",
+              "1.6777216e+07",
+              "1p+24"},
+             {"16777216.000",
+              "1.678e+07",
+              "1.68e+07",
+              "1.000p+24"}},
+    TestItem{-0x1.95a5fp-99f,
+             "-2.5e-30",
+             {"-0.0000000000000000000000000000025",
+              "-2.5e-30",
+              "-2.5e-30",
+              "-1.95a5fp-99"},
+             {"-0.000",
+              "-2.500e-30",
+              "-2.5e-30",
+              "-1.95ap-99"}},
+    TestItem{0x1p-126f,
+             "1.1754944e-38",
+             {"0.000000000000000000000000000000000000011754944",
+              "1.1754944e-38",
+              "1.1754944e-38",
+              "1p-126"},
+             {"0.000",
+              "1.175e-38",
+              "1.18e-38",
+              "1.000p-126"}},
+    TestItem{0x1p-149f,
+             "1e-45",
+             {"0.000000000000000000000000000000000000000000001",
+              "1e-45",
+              "1e-45",
+              "0.000002p-126"},
+             {"0.000",
+              "1.401e-45",
+              "1.4e-45",
+              "0.000p-126"}},
+    TestItem{0x1.fffffep+127f,
+             "3.4028235e+38",
+             {"340282346638528859811704183484516925440",
+              "3.4028235e+38",
+              "3.4028235e+38",
+              "1.fffffep+127"},
+             {"340282346638528859811704183484516925440.000",
+              "3.403e+38",
+              "3.4e+38",
+              "2.000p+127"}},
+    TestItem{cuda::std::numeric_limits<float>::infinity(),
+             "inf",
+             {"inf",
+              "inf",
+              "inf",
+              "inf"},
+             {"inf",
+              "inf",
+              "inf",
+              "inf"}},
+    TestItem{-cuda::std::numeric_limits<float>::infinity(),
+             "-inf",
+             {"-inf",
+              "-inf",
+              "-inf",
+              "-inf"},
+             {"-inf",
+              "-inf",
+              "-inf",
+              "-inf"}},
+    TestItem{cuda::std::numeric_limits<float>::quiet_NaN(),
+             "nan",
+             {"nan",
+              "nan",
+              "nan",
+              "nan"},
+             {"nan",
+              "nan",
+              "nan",
+              "nan"}},
+  }};
+}
+
+template <class... Args>
+__host__ __device__ constexpr void test_to_chars(const char* ref_str, float value, Args... args)
+{
+  constexpr cuda::std::size_t buff_size = 400;
+
+  static_assert(cuda::std::is_same_v<cuda::std::to_chars_result,
+                                     decltype(cuda::std::to_chars(
+                                       cuda::std::declval<char*>(), cuda::std::declval<char*>(), value, args...))>);
+  static_assert(noexcept(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), value, args...)));
+
+  char buff[buff_size + 1]{};
+  char* buff_start = buff + 1;
+
+  const auto ref_len = cuda::std::strlen(ref_str);
+
+  // Check valid buffer size
+  {
+    const auto result = cuda::std::to_chars(buff_start, buff_start + buff_size, value, args...);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff_start + ref_len);
+
+    // Compare with reference string
+    assert(cuda::std::strncmp(buff_start, ref_str, buff_size) == 0);
+
+    // Check that the operation did not underflow the buffer
+    assert(buff[0] == '\0');
+  }
+
+  // Check too small buffer
+  {
+    const auto result = cuda::std::to_chars(buff_start, buff_start + ref_len - 1, value, args...);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start + ref_len - 1);
+  }
+
+  // Check zero buffer
+  {
+    const auto result = cuda::std::to_chars(buff_start, buff_start, value, args...);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start);
+  }
+}
+
+__host__ __device__ constexpr bool test()
+{
+  constexpr auto items = get_test_items();
+
+  constexpr cuda::std::chars_format formats[] = {
+    cuda::std::chars_format::fixed,
+    cuda::std::chars_format::scientific,
+    cuda::std::chars_format::general,
+    cuda::std::chars_format::hex,
+  };
+
+  for (const auto& item : items)
+  {
+    test_to_chars(item.str, item.val);
+    for (cuda::std::size_t i = 0; i < cuda::std::size(formats); ++i)
+    {
+      test_to_chars(item.str_fmt[i], item.val, formats[i]);
+      test_to_chars(item.str_fmt_prec[i], item.val, formats[i], precision);
+    }
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if _CCCL_HAS_CONSTEXPR_BIT_CAST()
+  static_assert(test());
+#endif // _CCCL_HAS_CONSTEXPR_BIT_CAST()
+  return 0;
+}
@@ -0,0 +1,144 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/format>
+
+// template<class Out, class... Args>
+//   Out format_to(Out out, format_string<Args...> fmt, Args&&... args);
+
+// Floating-point arguments
+
+#include <cuda/std/__format_>
+#include <cuda/std/cassert>
+#include <cuda/std/inplace_vector>
+#include <cuda/std/iterator>
+#include <cuda/std/limits>
+#include <cuda/std/string_view>
+
+#include "test_macros.h"
+
+template <class... Args>
+__host__ __device__ void test_format_to(cuda::std::string_view expected, cuda::std::string_view fmt, Args... args)
+{
+  // Contiguous output, which is written to directly
+  {
+    char buffer[1024]{};
+    char* out = cuda::std::format_to(buffer, fmt, args...);
+    assert((cuda::std::string_view{buffer, static_cast<cuda::std::size_t>(out - buffer)} == expected));
+  }
+
+  // Any other output iterator, which is written to through the internal buffer
+  {
+    using Container = cuda::std::inplace_vector<char, 1024>;
+    using OutIt     = cuda::std::__back_insert_iterator<Container>;
+
+    Container container{};
+    cuda::std::format_to(OutIt{container}, fmt, args...);
+    assert((cuda::std::string_view{container.data(), container.size()} == expected));
+  }
+}
+
+template <class T>
+__host__ __device__ void test_common()
+{
+  // Shortest round trip representation
+  test_format_to("[1.5]", "[{}]", T(1.5));
+  test_format_to("0 -0 0.25 -0.0625 1e+20", "{} {} {} {} {}", T(0), -T(0), T(0.25), T(-0.0625), T(1e20));
+
+  // Fixed notation is used unless scientific notation is shorter
+  test_format_to("1e+05 123456 0.001 1e-05", "{} {} {} {}", T(1e5), T(123456), T(1) / T(1000), T(1) / T(100000));
+
+  // Precision without a type is the general format
+  test_format_to("1.2 1e+02 0.0001 1e-05", "{:.2} {:.1} {:.3} {:.3}", T(1.25), T(100), T(1e-4), T(1e-5));
+
+  // Fixed, scientific and general with precision
+  test_format_to("1.250000 1.25 0 2", "{:f} {:.2f} {:.0f} {:.0f}", T(1.25), T(1.25), T(0.5), T(1.5));
+  test_format_to("1.250000e+00 1.2e+02 0e+00", "{:e} {:.1e} {:.0e}", T(1.25), T(125), T(0));
+  test_format_to("1.25 1e+02 0.125 1.00000e+06", "{:g} {:.1g} {:g} {:#g}", T(1.25), T(125), T(0.125), T(1e6));
+  test_format_to("1.25E+00 1.25E-10 INF NAN", "{:.2E} {:G} {:F} {:F}", T(1.25), T(1.25e-10),
+                 cuda::std::numeric_limits<T>::infinity(), cuda::std::numeric_limits<T>::quiet_NaN());
+
+  // Alternate form
+  test_format_to("1. 1.e+00 1.0000 1.", "{:#.0f} {:#.0e} {:#.5g} {:#}", T(1), T(1), T(1), T(1));
+
+  // Sign, width, fill and zero padding
+  test_format_to("+1.5 -1.5  1.5", "{:+} {:-} {: }", T(1.5), T(-1.5), T(1.5));
+  test_format_to("   1.5|1.5   | 1.5  ", "{:6}|{:<6}|{:^6}", T(1.5), T(1.5), T(1.5));
+  test_format_to("**-1.50***", "{:*^10.2f}", T(-1.5));
+  test_format_to("-001.5 +00001", "{:06} {:+06.0f}", T(-1.5), T(1));
+  test_format_to("  -inf", "{:06}", -cuda::std::numeric_limits<T>::infinity());
+  test_format_to("inf -inf nan", "{} {} {}", cuda::std::numeric_limits<T>::infinity(),
+                 -cuda::std::numeric_limits<T>::infinity(), cuda::std::numeric_limits<T>::quiet_NaN());
+  test_format_to("   nan", "{:>6}", cuda::std::numeric_limits<T>::quiet_NaN());
+
+  // Dynamic width and precision
+  test_format_to("  3.14", "{:{}.{}f}", T(3.14159), 6, 2);
+}
+
+template <class T>
+__host__ __device__ void test_binary()
+{
+  // Hexadecimal
+  test_format_to("1p+0 1.8p+1 0p+0", "{:a} {:a} {:a}", T(1), T(3), T(0));
+  test_format_to("1.80P+1 -1.P+0", "{:.2A} {:#A}", T(3), T(-1));
+  test_format_to("0001.8p+1", "{:09a}", T(3));
+
+  // The precision is not limited by the size of the value
+  test_format_to("1.00000000000000000000000000000000p+0", "{:.32a}", T(1));
+}
+
+__host__ __device__ void test_long_output()
+{
+  // The output does not fit into the internal buffers and is written in chunks
+  constexpr cuda::std::size_t precision = 300;
+
+  char expected[precision + 3]{'1', '.'};
+  for (cuda::std::size_t i = 0; i < precision; ++i)
+  {
+    expected[i + 2] = '0';
+  }
+  expected[precision + 2] = '\0';
+  test_format_to(cuda::std::string_view{expected, precision + 2}, "{:.300f}", 1.0f);
+  test_format_to(cuda::std::string_view{expected, precision + 2}, "{:.300f}", 1.0);
+  test_format_to("0.10000000000000000555111512312578270211815834045410156250000000000", "{:.65f}", 0.1);
+
+  // 2^-149 has 105 significant digits, which are followed by zeros
+  test_format_to("1.40129846432481707092372958328991613128026194187651577175706828388979108268586060148663818836212"
+                 "15820312500000000000000000000000000000000000000000e-45",
+                 "{:.145e}",
+                 cuda::std::numeric_limits<float>::denorm_min());
+
+  // Large values are written with all their digits
+  test_format_to("340282346638528859811704183484516925440.000", "{:.3f}", cuda::std::numeric_limits<float>::max());
+  test_format_to("10000000000000000000000.00 1180591620717411303424.00", "{:.2f} {:.2f}", 1e22, 0x1p70);
+  test_format_to("  1e+300", "{:>8}", 1e300);
+}
+
+__host__ __device__ bool test()
+{
+  test_common<float>();
+  test_common<double>();
+  test_binary<float>();
+  test_binary<double>();
+  test_long_output();
+
+#if _CCCL_HAS_LONG_DOUBLE()
+  test_common<long double>();
+  test_format_to("5.00000000000000000000e-01 1234.5", "{:.20e} {}", 0.5l, 1234.5l);
+#endif // _CCCL_HAS_LONG_DOUBLE()
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
@@ -0,0 +1,107 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/format>
+
+// template<class Out, class... Args>
+//   Out format_to(Out out, format_string<Args...> fmt, Args&&... args);
+// template<class Out>
+//   Out vformat_to(Out out, string_view fmt, format_args args);
+
+#include <cuda/std/__format_>
+#include <cuda/std/cassert>
+#include <cuda/std/inplace_vector>
+#include <cuda/std/iterator>
+#include <cuda/std/string_view>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+template <class... Args>
+__host__ __device__ void test_format_to(cuda::std::string_view expected, cuda::std::string_view fmt, Args... args)
+{
+  // Contiguous output, which is written to directly
+  {
+    char buffer[1024]{};
+    char* out = cuda::std::format_to(buffer, fmt, args...);
+    static_assert(cuda::std::is_same_v<decltype(out), char*>);
+    assert((cuda::std::string_view{buffer, static_cast<cuda::std::size_t>(out - buffer)} == expected));
+  }
+
+  // Any other output iterator, which is written to through the internal buffer
+  {
+    using Container = cuda::std::inplace_vector<char, 1024>;
+    using OutIt     = cuda::std::__back_insert_iterator<Container>;
+
+    Container container{};
+    OutIt out = cuda::std::format_to(OutIt{container}, fmt, args...);
+    assert(out.__get_container() == &container);
+    assert((cuda::std::string_view{container.data(), container.size()} == expected));
+  }
+
+  // vformat_to
+  {
+    char buffer[1024]{};
+    char* out = cuda::std::vformat_to(buffer, fmt, cuda::std::make_format_args(args...));
+    assert((cuda::std::string_view{buffer, static_cast<cuda::std::size_t>(out - buffer)} == expected));
+  }
+}
+
+__host__ __device__ void test_long_output()
+{
+  // The output is longer than the internal buffer, both as a single argument and as literal text
+  constexpr cuda::std::size_t size = 700;
+
+  char expected[size + 1]{};
+  for (cuda::std::size_t i = 0; i < size - 1; ++i)
+  {
+    expected[i] = '*';
+  }
+  expected[size - 1] = '7';
+  test_format_to(cuda::std::string_view{expected, size}, "{:*>700}", 7);
+
+  expected[size - 1] = '*';
+  test_format_to(cuda::std::string_view{expected, size}, cuda::std::string_view{expected, size});
+  test_format_to(cuda::std::string_view{expected, size}, "{}", static_cast<const char*>(expected));
+}
+
+__host__ __device__ bool test()
+{
+  test_format_to("", "");
+  test_format_to("text without replacement fields", "text without replacement fields");
+  test_format_to("{}", "{{}}");
+  test_format_to("{42}", "{{{}}}", 42);
+
+  // Automatic and manual indexing
+  test_format_to("1 2 3", "{} {} {}", 1, 2, 3);
+  test_format_to("3 1 2 1", "{2} {0} {1} {0}", 1, 2, 3);
+
+  // Arguments of all kinds
+  test_format_to("-1 2 -3 4", "{} {} {} {}", -1, 2u, -3ll, 4ull);
+  test_format_to("true c abc def", "{} {} {} {}", true, 'c', "abc", cuda::std::string_view{"def"});
+  test_format_to("0x0", "{}", static_cast<const void*>(nullptr));
+
+  // Format specifications
+  test_format_to("  42|42  | 42 ", "{:4}|{:<4}|{:^4}", 42, 42, 42);
+  test_format_to("0x00ff 0B101 +017", "{:#06x} {:#B} {:+04o}", 255, 5, 15);
+  test_format_to("-0042", "{:05}", -42);
+  test_format_to("ab***", "{:*<5.2}", "abcdef");
+  test_format_to("      true", "{:>{}}", true, 10);
+
+  test_long_output();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
@@ -0,0 +1,92 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/format>
+
+// template<class Out, class... Args>
+//   format_to_n_result<Out> format_to_n(Out out, iter_difference_t<Out> n,
+//                                       format_string<Args...> fmt, Args&&... args);
+
+#include <cuda/std/__format_>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/inplace_vector>
+#include <cuda/std/iterator>
+#include <cuda/std/string_view>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+template <class... Args>
+__host__ __device__ void
+test_format_to_n(cuda::std::string_view expected, cuda::std::ptrdiff_t n, cuda::std::string_view fmt, Args... args)
+{
+  const auto size    = static_cast<cuda::std::ptrdiff_t>(expected.size());
+  const auto written = static_cast<cuda::std::size_t>((n < 0) ? 0 : (n < size) ? n : size);
+
+  // Contiguous output, which is written to directly
+  {
+    char buffer[1024]{};
+    auto result = cuda::std::format_to_n(buffer, n, fmt, args...);
+    static_assert(cuda::std::is_same_v<decltype(result), cuda::std::format_to_n_result<char*>>);
+    assert(result.size == size);
+    assert(result.out == buffer + written);
+    assert((cuda::std::string_view{buffer, written} == expected.substr(0, written)));
+  }
+
+  // Any other output iterator, which is written to through the internal buffer
+  {
+    using Container = cuda::std::inplace_vector<char, 1024>;
+    using OutIt     = cuda::std::__back_insert_iterator<Container>;
+
+    Container container{};
+    auto result = cuda::std::format_to_n(OutIt{container}, n, fmt, args...);
+    static_assert(cuda::std::is_same_v<decltype(result), cuda::std::format_to_n_result<OutIt>>);
+    assert(result.size == size);
+    assert((cuda::std::string_view{container.data(), container.size()} == expected.substr(0, written)));
+  }
+}
+
+template <class... Args>
+__host__ __device__ void test(cuda::std::string_view expected, cuda::std::string_view fmt, Args... args)
+{
+  const auto size = static_cast<cuda::std::ptrdiff_t>(expected.size());
+  test_format_to_n(expected, -1, fmt, args...);
+  test_format_to_n(expected, 0, fmt, args...);
+  test_format_to_n(expected, 1, fmt, args...);
+  test_format_to_n(expected, size / 2, fmt, args...);
+  test_format_to_n(expected, size, fmt, args...);
+  test_format_to_n(expected, size + 1, fmt, args...);
+}
+
+__host__ __device__ bool test()
+{
+  test("", "");
+  test("hello world", "hello {}", "world");
+  test("{42}", "{{{}}}", 42);
+  test("  -42|0x2a|true", "{:5}|{:#x}|{}", -42, 42, true);
+
+  // The output is longer than the internal buffer
+  char expected[600]{};
+  for (auto& c : expected)
+  {
+    c = '-';
+  }
+  expected[599] = '1';
+  test(cuda::std::string_view{expected, 600}, "{:->600}", 1);
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
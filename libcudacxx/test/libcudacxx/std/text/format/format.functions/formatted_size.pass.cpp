@@ -0,0 +1,46 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/format>
+
+// template<class... Args>
+//   size_t formatted_size(format_string<Args...> fmt, Args&&... args);
+
+#include <cuda/std/__format_>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+__host__ __device__ bool test()
+{
+  static_assert(cuda::std::is_same_v<decltype(cuda::std::formatted_size("")), cuda::std::size_t>);
+
+  assert(cuda::std::formatted_size("") == 0);
+  assert(cuda::std::formatted_size("text") == 4);
+  assert(cuda::std::formatted_size("{{}}") == 2);
+  assert(cuda::std::formatted_size("{}", 12345) == 5);
+  assert(cuda::std::formatted_size("{} {}", -1, "abc") == 6);
+  assert(cuda::std::formatted_size("{:#x}", 255u) == 4);
+  assert(cuda::std::formatted_size("{:>{}}", 'c', 7) == 7);
+
+  // The output is longer than the internal buffer
+  assert(cuda::std::formatted_size("{:1000}", true) == 1000);
+  assert(cuda::std::formatted_size("{:1000}{:1000}", 1, 2) == 2000);
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
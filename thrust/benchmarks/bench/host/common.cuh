@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: BSD-3
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <tbb/global_control.h>
+#endif
+
+// The host benchmarks time the algorithms of the CPP, OMP and TBB device systems on the CPU, without a GPU, for a
+// range of thread counts. They report elements/s and GB/s like the device benchmarks, so their results can be stored
+// and compared by the benchmark scripts.
+
+// The thread counts every host benchmark is run with. Counts above the number of hardware threads are skipped.
+inline const std::vector<nvbench::int64_t> host_thread_counts{1, 2, 4, 8, 16, 32, 64};
+
+using host_types = nvbench::type_list<int32_t, int64_t, float, double>;
+
+// Limits the device system to the given number of threads while alive
+class host_thread_limit
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  int m_max_threads;
+
+public:
+  explicit host_thread_limit(int threads)
+      : m_max_threads(omp_get_max_threads())
+  {
+    omp_set_num_threads(threads);
+  }
+
+  ~host_thread_limit()
+  {
+    omp_set_num_threads(m_max_threads);
+  }
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  tbb::global_control m_limit;
+
+public:
+  explicit host_thread_limit(int threads)
+      : m_limit(tbb::global_control::max_allowed_parallelism, static_cast<std::size_t>(threads))
+  {}
+#else // CPP
+public:
+  explicit host_thread_limit(int) {}
+#endif
+
+  host_thread_limit(const host_thread_limit&)            = delete;
+  host_thread_limit& operator=(const host_thread_limit&) = delete;
+};
+
+// Returns the number of threads of the state, or skips the state and returns 0 if the device system cannot run on
+// that many threads
+inline int host_threads(nvbench::state& state)
+{
+  const auto threads = static_cast<int>(state.get_int64("Threads"));
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CPP
+  if (threads != 1)
+  {
+    state.skip("The CPP system is sequential");
+    return 0;
+  }
+#endif
+
+  const auto hardware_threads = static_cast<int>(std::thread::hardware_concurrency());
+  if (hardware_threads != 0 && threads > hardware_threads)
+  {
+    state.skip("Only " + std::to_string(hardware_threads) + " hardware threads available");
+    return 0;
+  }
+
+  return threads;
+}
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: BSD-3
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+
+#include "common.cuh"
+
+template <typename T>
+static void inclusive(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+  const int threads   = host_threads(state);
+  if (threads == 0)
+  {
+    return;
+  }
+
+  thrust::device_vector<T> input = generate(elements);
+  thrust::device_vector<T> output(elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  host_thread_limit limit(threads);
+  state.exec(nvbench::exec_tag::no_gpu, [&](nvbench::launch&) {
+    thrust::inclusive_scan(thrust::device, input.cbegin(), input.cend(), output.begin());
+  });
+}
+
+NVBENCH_BENCH_TYPES(inclusive, NVBENCH_TYPE_AXES(host_types))
+  .set_name("inclusive")
+  .set_type_axes_names({"T{ct}"})
+  .set_is_cpu_only(true)
+  .add_int64_axis("Threads", host_thread_counts)
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4));
+
+template <typename T>
+static void exclusive(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+  const int threads   = host_threads(state);
+  if (threads == 0)
+  {
+    return;
+  }
+
+  thrust::device_vector<T> input = generate(elements);
+  thrust::device_vector<T> output(elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  host_thread_limit limit(threads);
+  state.exec(nvbench::exec_tag::no_gpu, [&](nvbench::launch&) {
+    thrust::exclusive_scan(thrust::device, input.cbegin(), input.cend(), output.begin());
+  });
+}
+
+NVBENCH_BENCH_TYPES(exclusive, NVBENCH_TYPE_AXES(host_types))
+  .set_name("exclusive")
+  .set_type_axes_names({"T{ct}"})
+  .set_is_cpu_only(true)
+  .add_int64_axis("Threads", host_thread_counts)
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4));
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: BSD-3
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/set_operations.h>
+#include <thrust/sort.h>
+
+#include "common.cuh"
+
+template <typename T, typename OpT>
+static void run(nvbench::state& state, OpT op)
+{
+  const auto elements       = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto size_ratio     = static_cast<std::size_t>(state.get_int64("SizeRatio"));
+  const bit_entropy entropy = str_to_entropy(state.get_string("Entropy"));
+  const int threads         = host_threads(state);
+  if (threads == 0)
+  {
+    return;
+  }
+
+  const auto elements_in_A = static_cast<std::size_t>(static_cast<double>(size_ratio * elements) / 100.0f);
+
+  thrust::device_vector<T> input = generate(elements, entropy);
+  thrust::device_vector<T> output(elements);
+
+  thrust::sort(input.begin(), input.begin() + elements_in_A);
+  thrust::sort(input.begin() + elements_in_A, input.end());
+
+  host_thread_limit limit(threads);
+
+  // not a warm-up run, we need to run once to determine the size of the output
+  const auto result_ends =
+    op(input.cbegin(), input.cbegin() + elements_in_A, input.cbegin() + elements_in_A, input.cend(), output.begin());
+  const std::size_t elements_in_AB = ::cuda::std::distance(output.begin(), result_ends);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements_in_AB);
+
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::no_batch, [&](nvbench::launch&) {
+    op(input.cbegin(), input.cbegin() + elements_in_A, input.cbegin() + elements_in_A, input.cend(), output.begin());
+  });
+}
+
+template <typename T>
+static void basic(nvbench::state& state, nvbench::type_list<T>)
+{
+  const std::string& operation = state.get_string("Operation");
+
+  if (operation == "union")
+  {
+    run<T>(state, [](auto... args) {
+      return thrust::set_union(thrust::device, args...);
+    });
+  }
+  else if (operation == "intersection")
+  {
+    run<T>(state, [](auto... args) {
+      return thrust::set_intersection(thrust::device, args...);
+    });
+  }
+  else if (operation == "difference")
+  {
+    run<T>(state, [](auto... args) {
+      return thrust::set_difference(thrust::device, args...);
+    });
+  }
+  else
+  {
+    run<T>(state, [](auto... args) {
+      return thrust::set_symmetric_difference(thrust::device, args...);
+    });
+  }
+}
+
+using types = nvbench::type_list<int32_t, int64_t>;
+
+NVBENCH_BENCH_TYPES(basic, NVBENCH_TYPE_AXES(types))
+  .set_name("base")
+  .set_type_axes_names({"T{ct}"})
+  .set_is_cpu_only(true)
+  .add_string_axis("Operation", {"union", "intersection", "difference", "symmetric_difference"})
+  .add_int64_axis("Threads", host_thread_counts)
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_string_axis("Entropy", {"1.000", "0.201"})
+  .add_int64_axis("SizeRatio", {25, 50, 75});
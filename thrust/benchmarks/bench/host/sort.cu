@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: BSD-3
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sort.h>
+
+#include "common.cuh"
+
+template <typename T>
+static void keys(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements       = static_cast<std::size_t>(state.get_int64("Elements"));
+  const bit_entropy entropy = str_to_entropy(state.get_string("Entropy"));
+  const int threads         = host_threads(state);
+  if (threads == 0)
+  {
+    return;
+  }
+
+  thrust::device_vector<T> input = generate(elements, entropy);
+  thrust::device_vector<T> vec(elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  host_thread_limit limit(threads);
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    vec = input;
+    timer.start();
+    thrust::sort(thrust::device, vec.begin(), vec.end());
+    timer.stop();
+  });
+}
+
+NVBENCH_BENCH_TYPES(keys, NVBENCH_TYPE_AXES(host_types))
+  .set_name("keys")
+  .set_type_axes_names({"T{ct}"})
+  .set_is_cpu_only(true)
+  .add_int64_axis("Threads", host_thread_counts)
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_string_axis("Entropy", {"1.000", "0.201"});
+
+template <typename KeyT, typename ValueT>
+static void pairs(nvbench::state& state, nvbench::type_list<KeyT, ValueT>)
+{
+  const auto elements       = static_cast<std::size_t>(state.get_int64("Elements"));
+  const bit_entropy entropy = str_to_entropy(state.get_string("Entropy"));
+  const int threads         = host_threads(state);
+  if (threads == 0)
+  {
+    return;
+  }
+
+  thrust::device_vector<KeyT> in_keys     = generate(elements, entropy);
+  thrust::device_vector<ValueT> in_values = generate(elements);
+  thrust::device_vector<KeyT> keys(elements);
+  thrust::device_vector<ValueT> values(elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<KeyT>(elements);
+  state.add_global_memory_reads<ValueT>(elements);
+  state.add_global_memory_writes<KeyT>(elements);
+  state.add_global_memory_writes<ValueT>(elements);
+
+  host_thread_limit limit(threads);
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    keys   = in_keys;
+    values = in_values;
+    timer.start();
+    thrust::sort_by_key(thrust::device, keys.begin(), keys.end(), values.begin());
+    timer.stop();
+  });
+}
+
+using key_types   = nvbench::type_list<int32_t, int64_t>;
+using value_types = nvbench::type_list<int32_t, int64_t>;
+
+NVBENCH_BENCH_TYPES(pairs, NVBENCH_TYPE_AXES(key_types, value_types))
+  .set_name("pairs")
+  .set_type_axes_names({"KeyT{ct}", "ValueT{ct}"})
+  .set_is_cpu_only(true)
+  .add_int64_axis("Threads", host_thread_counts)
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_string_axis("Entropy", {"1.000", "0.201"});
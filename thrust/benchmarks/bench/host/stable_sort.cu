@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: BSD-3
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/merge.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "common.cuh"
+
+// Thread scaling of the device system's stable_sort. On the OMP system it is compared against tiles merged pairwise
+// by a shrinking number of threads.
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+// The tiles are sorted in parallel, but every level of the merge tree halves the number of threads merging, and the
+// top level merge is done by a single thread.
+template <typename T>
+static void pairwise_stable_sort(T* data, std::size_t n)
+{
+  std::vector<T> temp(n);
+
+#  pragma omp parallel
+  {
+    const std::size_t num_threads = omp_get_num_threads();
+    const std::size_t p_i         = omp_get_thread_num();
+    const std::size_t tile        = (n + num_threads - 1) / num_threads;
+
+    thrust::stable_sort(thrust::seq, data + std::min(p_i * tile, n), data + std::min(p_i * tile + tile, n));
+
+    for (std::size_t run = tile; run < n; run *= 2)
+    {
+#  pragma omp barrier
+      const std::size_t lo = p_i * tile;
+      if (p_i % (2 * run / tile) == 0 && lo + run < n)
+      {
+        const std::size_t hi = std::min(lo + 2 * run, n);
+        std::copy(data + lo, data + hi, temp.data() + lo);
+        thrust::merge(
+          thrust::seq, temp.data() + lo, temp.data() + lo + run, temp.data() + lo + run, temp.data() + hi, data + lo);
+      }
+    }
+  }
+}
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+
+template <typename T>
+static void keys(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements          = static_cast<std::size_t>(state.get_int64("Elements"));
+  const std::string& algorithm = state.get_string("Algorithm");
+  const int threads            = host_threads(state);
+  if (threads == 0)
+  {
+    return;
+  }
+
+#if THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_OMP
+  if (algorithm == "pairwise")
+  {
+    state.skip("The pairwise merge is only implemented with OpenMP");
+    return;
+  }
+#endif
+
+  thrust::device_vector<T> input = generate(elements);
+  thrust::device_vector<T> vec(elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  host_thread_limit limit(threads);
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    vec = input;
+    timer.start();
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+    if (algorithm == "pairwise")
+    {
+      pairwise_stable_sort(thrust::raw_pointer_cast(vec.data()), elements);
+    }
+    else
+#endif
+    {
+      thrust::stable_sort(thrust::device, vec.begin(), vec.end());
+    }
+    timer.stop();
+  });
+}
+
+NVBENCH_BENCH_TYPES(keys, NVBENCH_TYPE_AXES(nvbench::type_list<int32_t, int64_t>))
+  .set_name("keys")
+  .set_type_axes_names({"T{ct}"})
+  .set_is_cpu_only(true)
+  .add_int64_axis("Threads", host_thread_counts)
+  .add_int64_power_of_two_axis("Elements", nvbench::range(20, 28, 4))
+  .add_string_axis("Algorithm", {"parallel_merge", "pairwise"});
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: BSD-3
+
+#include <thrust/binary_search.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sort.h>
+
+#include "common.cuh"
+
+template <typename T>
+static void lower_bound(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements      = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto needles_ratio = static_cast<std::size_t>(state.get_int64("NeedlesRatio"));
+  const auto needles       = needles_ratio * static_cast<std::size_t>(static_cast<double>(elements) / 100.0);
+  const int threads        = host_threads(state);
+  if (threads == 0)
+  {
+    return;
+  }
+
+  thrust::device_vector<T> data = generate(elements + needles);
+  thrust::device_vector<std::size_t> result(needles);
+  thrust::sort(data.begin(), data.begin() + elements);
+
+  state.add_element_count(needles);
+  state.add_global_memory_reads<T>(needles);
+  state.add_global_memory_writes<std::size_t>(needles);
+
+  host_thread_limit limit(threads);
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::no_batch, [&](nvbench::launch&) {
+    thrust::lower_bound(
+      thrust::device, data.begin(), data.begin() + elements, data.begin() + elements, data.end(), result.begin());
+  });
+}
+
+using types = nvbench::type_list<int32_t, int64_t>;
+
+NVBENCH_BENCH_TYPES(lower_bound, NVBENCH_TYPE_AXES(types))
+  .set_name("lower_bound")
+  .set_type_axes_names({"T{ct}"})
+  .set_is_cpu_only(true)
+  .add_int64_axis("Threads", host_thread_counts)
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_int64_axis("NeedlesRatio", {1, 25, 50});
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: BSD-3
+
+#include <thrust/mr/new.h>
+#include <thrust/mr/pool.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+// Allocation churn on a pool resource: a set of live blocks is kept, and every operation frees a random one of them
+// and allocates a new block in its place. Most requests are small and served from the pooled buckets, the rest are
+// tensor sized and go through the cache of oversized blocks, which fills up with thousands of blocks of different
+// sizes. The "upstream" resource serves the same requests without any pooling.
+
+struct block
+{
+  void* ptr;
+  std::size_t bytes;
+};
+
+// sizes are log-uniform within both the small and the large range
+static std::vector<std::size_t> generate_sizes(std::size_t count, double large_fraction)
+{
+  std::mt19937_64 rng(count);
+  std::bernoulli_distribution is_large(large_fraction);
+  std::uniform_real_distribution<double> small_log2(4.0, 16.0);
+  std::uniform_real_distribution<double> large_log2(16.0, 22.0);
+
+  std::vector<std::size_t> sizes(count);
+  for (auto& size : sizes)
+  {
+    size = static_cast<std::size_t>(std::exp2(is_large(rng) ? large_log2(rng) : small_log2(rng)));
+  }
+  return sizes;
+}
+
+template <typename Resource>
+static void churn(nvbench::state& state, Resource& resource)
+{
+  const auto live_blocks    = static_cast<std::size_t>(state.get_int64("LiveBlocks"));
+  const auto operations     = static_cast<std::size_t>(state.get_int64("Operations"));
+  const double large_blocks = state.get_float64("LargeFraction");
+
+  const std::vector<std::size_t> sizes = generate_sizes(live_blocks + operations, large_blocks);
+
+  std::mt19937_64 rng(operations);
+  std::uniform_int_distribution<std::size_t> dist(0, live_blocks - 1);
+  std::vector<std::size_t> victims(operations);
+  for (auto& victim : victims)
+  {
+    victim = dist(rng);
+  }
+
+  std::vector<block> live(live_blocks);
+  for (std::size_t i = 0; i < live_blocks; ++i)
+  {
+    live[i] = {resource.do_allocate(sizes[i], THRUST_MR_DEFAULT_ALIGNMENT), sizes[i]};
+  }
+
+  state.add_element_count(operations, "Operations");
+
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    timer.start();
+    for (std::size_t i = 0; i < operations; ++i)
+    {
+      block& victim = live[victims[i]];
+      resource.do_deallocate(victim.ptr, victim.bytes, THRUST_MR_DEFAULT_ALIGNMENT);
+
+      const std::size_t bytes = sizes[live_blocks + i];
+      victim                  = {resource.do_allocate(bytes, THRUST_MR_DEFAULT_ALIGNMENT), bytes};
+    }
+    timer.stop();
+  });
+
+  for (const block& b : live)
+  {
+    resource.do_deallocate(b.ptr, b.bytes, THRUST_MR_DEFAULT_ALIGNMENT);
+  }
+}
+
+static void allocation_churn(nvbench::state& state)
+{
+  thrust::mr::new_delete_resource upstream;
+
+  if (state.get_string("Resource") == "upstream")
+  {
+    churn(state, upstream);
+  }
+  else
+  {
+    thrust::mr::pool_options options = thrust::mr::unsynchronized_pool_resource<
+      thrust::mr::new_delete_resource>::get_default_options();
+    options.largest_block_size = 1 << 16;
+
+    thrust::mr::unsynchronized_pool_resource<thrust::mr::new_delete_resource> pool(&upstream, options);
+    churn(state, pool);
+
+    const thrust::mr::pool_cache_statistics stats = pool.get_cache_statistics();
+    state.add_summary("CacheHitRate")
+      .set_string("name", "Cache Hit Rate")
+      .set_float64("value", static_cast<double>(stats.hits) / static_cast<double>(stats.hits + stats.misses));
+  }
+}
+
+NVBENCH_BENCH(allocation_churn)
+  .set_name("allocation_churn")
+  .set_is_cpu_only(true)
+  .add_int64_power_of_two_axis("LiveBlocks", nvbench::range(8, 12, 4))
+  .add_int64_axis("Operations", {1 << 16})
+  .add_float64_axis("LargeFraction", {0.25})
+  .add_string_axis("Resource", {"pool", "upstream"});
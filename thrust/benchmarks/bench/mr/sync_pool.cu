@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: BSD-3
+
+#include <thrust/mr/disjoint_tls_pool.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/scalable_sync_pool.h>
+#include <thrust/mr/sync_pool.h>
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+// Many threads allocating and freeing temporaries of a few KiB at the same time, as algorithms using a
+// thrust::mr::allocator for their temporary storage do. A third of the blocks is freed by another thread than the one
+// that allocated it. The "mutex" resource is synchronized_pool_resource, "scalable" is
+// scalable_synchronized_pool_resource, and "disjoint_tls" uses a thread local disjoint pool per thread, which does not
+// support freeing blocks from another thread, so there every thread frees only its own blocks.
+
+using upstream_t = thrust::mr::new_delete_resource;
+
+template <typename Allocate, typename Deallocate>
+static void run_threads(std::size_t num_threads,
+                        std::size_t operations,
+                        bool cross_thread_frees,
+                        Allocate allocate,
+                        Deallocate deallocate)
+{
+  constexpr std::size_t live_blocks = 8;
+
+  // the blocks a thread hands over to its neighbor to free
+  std::vector<std::vector<std::pair<void*, std::size_t>>> handed_over(num_threads);
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t] {
+      void* live[live_blocks] = {};
+      auto& mine              = handed_over[t];
+      mine.reserve(operations / 3 + 1);
+
+      for (std::size_t i = 0; i < operations; ++i)
+      {
+        const std::size_t slot  = i % live_blocks;
+        const std::size_t bytes = std::size_t(256) << (slot % 5);
+        if (live[slot])
+        {
+          if (cross_thread_frees && i % 3 == 0)
+          {
+            mine.emplace_back(live[slot], bytes);
+          }
+          else
+          {
+            deallocate(live[slot], bytes);
+          }
+        }
+        live[slot] = allocate(bytes);
+      }
+
+      for (std::size_t slot = 0; slot < live_blocks; ++slot)
+      {
+        deallocate(live[slot], std::size_t(256) << (slot % 5));
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  // free the handed over blocks from the neighboring threads
+  threads.clear();
+  for (std::size_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t] {
+      for (const auto& block : handed_over[(t + 1) % num_threads])
+      {
+        deallocate(block.first, block.second);
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+static void threads(nvbench::state& state)
+{
+  const auto num_threads       = static_cast<std::size_t>(state.get_int64("Threads"));
+  const auto operations        = static_cast<std::size_t>(state.get_int64("Operations"));
+  const std::string& resource  = state.get_string("Resource");
+  const bool cross_thread_free = resource != "disjoint_tls";
+
+  upstream_t upstream;
+  thrust::mr::synchronized_pool_resource<upstream_t> mutex_pool(&upstream);
+  thrust::mr::scalable_synchronized_pool_resource<upstream_t> scalable_pool(&upstream);
+
+  state.add_element_count(num_threads * operations, "Operations");
+
+  state.exec(nvbench::exec_tag::no_gpu | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    timer.start();
+    if (resource == "mutex")
+    {
+      run_threads(
+        num_threads,
+        operations,
+        cross_thread_free,
+        [&](std::size_t bytes) {
+          return mutex_pool.do_allocate(bytes);
+        },
+        [&](void* p, std::size_t bytes) {
+          mutex_pool.do_deallocate(p, bytes);
+        });
+    }
+    else if (resource == "scalable")
+    {
+      run_threads(
+        num_threads,
+        operations,
+        cross_thread_free,
+        [&](std::size_t bytes) {
+          return scalable_pool.do_allocate(bytes);
+        },
+        [&](void* p, std::size_t bytes) {
+          scalable_pool.do_deallocate(p, bytes);
+        });
+    }
+    else
+    {
+      run_threads(
+        num_threads,
+        operations,
+        cross_thread_free,
+        [&](std::size_t bytes) {
+          return thrust::mr::tls_disjoint_pool(&upstream, &upstream).do_allocate(bytes);
+        },
+        [&](void* p, std::size_t bytes) {
+          thrust::mr::tls_disjoint_pool(&upstream, &upstream).do_deallocate(p, bytes);
+        });
+    }
+    timer.stop();
+  });
+}
+
+NVBENCH_BENCH(threads)
+  .set_name("threads")
+  .set_is_cpu_only(true)
+  .add_int64_axis("Threads", {1, 8, 48})
+  .add_int64_axis("Operations", {1 << 16})
+  .add_string_axis("Resource", {"mutex", "scalable", "disjoint_tls"});
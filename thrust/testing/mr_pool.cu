@@ -2,8 +2,13 @@
 
 #include <thrust/mr/new.h>
 #include <thrust/mr/pool.h>
+#include <thrust/mr/scalable_sync_pool.h>
 #include <thrust/mr/sync_pool.h>
 
+#include <cstring>
+#include <thread>
+#include <vector>
+
 #include <unittest/unittest.h>
 
 template <typename T>
@@ -244,6 +249,12 @@ void TestSynchronizedPool()
 }
 DECLARE_UNITTEST(TestSynchronizedPool);
 
+void TestScalableSynchronizedPool()
+{
+  TestPool<thrust::mr::scalable_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestScalableSynchronizedPool);
+
 template <template <typename> class PoolTemplate>
 void TestPoolCachingOversized()
 {
@@ -353,6 +364,149 @@ void TestSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestSynchronizedPoolCachingOversized);
 
+void TestScalableSynchronizedPoolCachingOversized()
+{
+  TestPoolCachingOversized<thrust::mr::scalable_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestScalableSynchronizedPoolCachingOversized);
+
+void TestScalableSynchronizedPoolConcurrent()
+{
+  using Pool = thrust::mr::scalable_synchronized_pool_resource<thrust::mr::new_delete_resource>;
+
+  Pool pool;
+
+  const std::size_t num_threads = 8;
+  const std::size_t count       = 4096;
+
+  // every thread frees the blocks allocated by the next one, so that full magazines move between threads
+  std::vector<std::vector<void*>> blocks(num_threads, std::vector<void*>(count));
+  std::vector<char> intact(num_threads, 1);
+
+  auto fill = [&](std::size_t t) {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const std::size_t bytes = 8 << (i % 8);
+      blocks[t][i]            = pool.do_allocate(bytes);
+      std::memset(blocks[t][i], static_cast<int>(t), bytes);
+    }
+  };
+
+  auto check_and_free = [&](std::size_t t) {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const std::size_t bytes    = 8 << (i % 8);
+      const unsigned char* block = static_cast<unsigned char*>(blocks[t][i]);
+      if (block[0] != t || block[bytes - 1] != t)
+      {
+        intact[t] = 0;
+      }
+      pool.do_deallocate(blocks[t][i], bytes);
+    }
+  };
+
+  for (int round = 0; round < 3; ++round)
+  {
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+      threads.emplace_back(fill, t);
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+
+    threads.clear();
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+      threads.emplace_back(check_and_free, (t + 1) % num_threads);
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  for (std::size_t t = 0; t < num_threads; ++t)
+  {
+    ASSERT_EQUAL(intact[t], 1);
+  }
+}
+DECLARE_UNITTEST(TestScalableSynchronizedPoolConcurrent);
+
+template <template <typename> class PoolTemplate>
+void TestPoolCacheStatistics()
+{
+  using Pool = PoolTemplate<thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(opts);
+
+  // fill the cache with blocks of many different size classes
+  const std::size_t count = 1000;
+  std::vector<void*> blocks(count);
+  std::size_t cached_bytes = 0;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    blocks[i] = pool.do_allocate(2048 + 64 * i, 32);
+    cached_bytes += 2048 + 64 * i;
+  }
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    pool.do_deallocate(blocks[i], 2048 + 64 * i, 32);
+  }
+
+  thrust::mr::pool_cache_statistics stats = pool.get_cache_statistics();
+  ASSERT_EQUAL(stats.hits, 0u);
+  ASSERT_EQUAL(stats.misses, count);
+  ASSERT_EQUAL(stats.cached_blocks, count);
+  ASSERT_EQUAL(stats.cached_bytes, cached_bytes);
+
+  // from the biggest to the smallest, every request is served by a cached block
+  for (std::size_t i = count; i-- > 0;)
+  {
+    blocks[i] = pool.do_allocate(2048 + 64 * i, 32);
+  }
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    pool.do_deallocate(blocks[i], 2048 + 64 * i, 32);
+  }
+
+  stats = pool.get_cache_statistics();
+  ASSERT_EQUAL(stats.hits, count);
+  ASSERT_EQUAL(stats.misses, count);
+  ASSERT_EQUAL(stats.cached_blocks, count);
+  ASSERT_EQUAL(stats.cached_bytes, cached_bytes);
+
+  // nothing cached is bigger than this, so the request must miss
+  void* big = pool.do_allocate(2048 + 64 * count, 32);
+  stats     = pool.get_cache_statistics();
+  ASSERT_EQUAL(stats.misses, count + 1);
+  pool.do_deallocate(big, 2048 + 64 * count, 32);
+
+  pool.release();
+
+  stats = pool.get_cache_statistics();
+  ASSERT_EQUAL(stats.cached_blocks, 0u);
+  ASSERT_EQUAL(stats.cached_bytes, 0u);
+}
+
+void TestUnsynchronizedPoolCacheStatistics()
+{
+  TestPoolCacheStatistics<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolCacheStatistics);
+
+void TestSynchronizedPoolCacheStatistics()
+{
+  TestPoolCacheStatistics<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolCacheStatistics);
+
 template <template <typename> class PoolTemplate>
 void TestGlobalPool()
 {
@@ -372,3 +526,9 @@ void TestSynchronizedGlobalPool()
   TestGlobalPool<thrust::mr::synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedGlobalPool);
+
+void TestScalableSynchronizedGlobalPool()
+{
+  TestGlobalPool<thrust::mr::scalable_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestScalableSynchronizedGlobalPool);
@@ -0,0 +1,91 @@
+#include <thrust/host_vector.h>
+#include <thrust/merge.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/internal/merge_path.h>
+
+#include <cuda/std/functional>
+
+#include <unittest/unittest.h>
+
+void TestOmpMergePathSearchSimple()
+{
+  using thrust::system::detail::internal::merge_path_search;
+
+  const int a[] = {1, 3, 3, 5};
+  const int b[] = {2, 3, 4};
+  const ::cuda::std::less<int> comp;
+
+  // merged: 1a 2b 3a 3a 3b 4b 5a
+  ASSERT_EQUAL(merge_path_search(0, a, 4, b, 3, comp), 0);
+  ASSERT_EQUAL(merge_path_search(1, a, 4, b, 3, comp), 1);
+  ASSERT_EQUAL(merge_path_search(2, a, 4, b, 3, comp), 1);
+  ASSERT_EQUAL(merge_path_search(3, a, 4, b, 3, comp), 2);
+  ASSERT_EQUAL(merge_path_search(4, a, 4, b, 3, comp), 3);
+  ASSERT_EQUAL(merge_path_search(5, a, 4, b, 3, comp), 3);
+  ASSERT_EQUAL(merge_path_search(6, a, 4, b, 3, comp), 3);
+  ASSERT_EQUAL(merge_path_search(7, a, 4, b, 3, comp), 4);
+}
+DECLARE_UNITTEST(TestOmpMergePathSearchSimple);
+
+void TestOmpBalancedPathSearchSimple()
+{
+  using thrust::system::detail::internal::balanced_path_search;
+
+  const int a[] = {1, 3, 3, 5};
+  const int b[] = {2, 3, 4};
+  const ::cuda::std::less<int> comp;
+
+  // splits inside the run of 3s move back to its start
+  for (int diag = 2; diag <= 4; ++diag)
+  {
+    const auto split = balanced_path_search(diag, a, 4, b, 3, comp);
+    ASSERT_EQUAL(split.first, 1);
+    ASSERT_EQUAL(split.second, 1);
+  }
+
+  const auto split = balanced_path_search(5, a, 4, b, 3, comp);
+  ASSERT_EQUAL(split.first, 3);
+  ASSERT_EQUAL(split.second, 2);
+
+  const auto end = balanced_path_search(7, a, 4, b, 3, comp);
+  ASSERT_EQUAL(end.first, 4);
+  ASSERT_EQUAL(end.second, 3);
+}
+DECLARE_UNITTEST(TestOmpBalancedPathSearchSimple);
+
+template <typename T>
+struct TestOmpMergePathSearch
+{
+  void operator()(const size_t n)
+  {
+    using thrust::system::detail::internal::merge_path_search;
+
+    thrust::host_vector<T> a = unittest::random_integers<T>(n);
+    thrust::host_vector<T> b = unittest::random_integers<T>(n / 2 + 1);
+    thrust::sort(a.begin(), a.end());
+    thrust::sort(b.begin(), b.end());
+
+    const auto n1 = static_cast<long>(a.size());
+    const auto n2 = static_cast<long>(b.size());
+
+    thrust::host_vector<T> merged(a.size() + b.size());
+    thrust::merge(thrust::host, a.begin(), a.end(), b.begin(), b.end(), merged.begin());
+
+    // the pieces merged independently must concatenate to the merge of the whole ranges
+    const long step = (n1 + n2) / 7 + 1;
+    for (long diag = 0; diag < n1 + n2; diag += step)
+    {
+      const long end  = diag + step < n1 + n2 ? diag + step : n1 + n2;
+      const long i0   = merge_path_search(diag, a.begin(), n1, b.begin(), n2, ::cuda::std::less<T>());
+      const long i1   = merge_path_search(end, a.begin(), n1, b.begin(), n2, ::cuda::std::less<T>());
+      const long size = end - diag;
+
+      thrust::host_vector<T> piece(size);
+      thrust::merge(
+        thrust::host, a.begin() + i0, a.begin() + i1, b.begin() + (diag - i0), b.begin() + (end - i1), piece.begin());
+
+      ASSERT_EQUAL(piece, thrust::host_vector<T>(merged.begin() + diag, merged.begin() + end));
+    }
+  }
+};
+VariableUnitTest<TestOmpMergePathSearch, IntegralTypes> TestOmpMergePathSearchInstance;
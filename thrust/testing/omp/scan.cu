@@ -0,0 +1,137 @@
+#include <thrust/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/scan.h>
+#include <thrust/system/omp/detail/scan.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <cuda/std/cstdint>
+
+#include <vector>
+
+#include <omp.h>
+#include <unittest/unittest.h>
+
+// Composition of the affine maps x -> a * x + b modulo 2^32, with a in the upper and b in the lower half. The operation
+// is associative but not commutative, so combining the tile prefixes in the wrong order changes the result.
+struct compose_affine
+{
+  _CCCL_HOST_DEVICE ::cuda::std::uint64_t operator()(::cuda::std::uint64_t f, ::cuda::std::uint64_t g) const
+  {
+    const auto fa = static_cast<::cuda::std::uint32_t>(f >> 32);
+    const auto fb = static_cast<::cuda::std::uint32_t>(f);
+    const auto ga = static_cast<::cuda::std::uint32_t>(g >> 32);
+    const auto gb = static_cast<::cuda::std::uint32_t>(g);
+    const ::cuda::std::uint32_t a = fa * ga;
+    const ::cuda::std::uint32_t b = fb * ga + gb;
+    return (static_cast<::cuda::std::uint64_t>(a) << 32) | b;
+  }
+};
+
+// Runs the scans of a test with at least four threads, so that the tiles are scanned concurrently and the look-back
+// over unfinished predecessors is reached
+struct omp_threads_guard
+{
+  int num_threads = omp_get_max_threads();
+
+  omp_threads_guard()
+  {
+    omp_set_num_threads(num_threads < 4 ? 4 : num_threads);
+  }
+
+  ~omp_threads_guard()
+  {
+    omp_set_num_threads(num_threads);
+  }
+};
+
+// Sizes spanning one and many tiles of the given element type, and one more or less than a multiple of the tile size
+template <typename T>
+std::vector<size_t> lookback_scan_sizes()
+{
+  const size_t tile = thrust::system::omp::detail::scan_tile_bytes / sizeof(T);
+  return {tile - 1, tile, tile + 1, 2 * tile - 1, 2 * tile + 1, 7 * tile, 7 * tile + 1, 64 * tile - 1, 64 * tile + 3};
+}
+
+thrust::host_vector<::cuda::std::uint64_t> random_affine_maps(size_t n)
+{
+  thrust::host_vector<::cuda::std::uint64_t> maps = unittest::random_integers<::cuda::std::uint64_t>(n);
+  for (auto& map : maps)
+  {
+    // odd multipliers keep the maps invertible, so the composition does not collapse to a constant
+    map |= ::cuda::std::uint64_t{1} << 32;
+  }
+  return maps;
+}
+
+void TestOmpScanNonCommutative()
+{
+  omp_threads_guard guard;
+  for (const size_t n : lookback_scan_sizes<::cuda::std::uint64_t>())
+  {
+    const auto input = random_affine_maps(n);
+    const ::cuda::std::uint64_t init{(::cuda::std::uint64_t{3} << 32) | 5};
+
+    thrust::host_vector<::cuda::std::uint64_t> reference(n);
+    thrust::host_vector<::cuda::std::uint64_t> result(n);
+
+    thrust::inclusive_scan(thrust::seq, input.begin(), input.end(), reference.begin(), compose_affine{});
+    thrust::inclusive_scan(thrust::omp::par, input.begin(), input.end(), result.begin(), compose_affine{});
+    ASSERT_EQUAL(reference, result);
+
+    thrust::inclusive_scan(thrust::seq, input.begin(), input.end(), reference.begin(), init, compose_affine{});
+    thrust::inclusive_scan(thrust::omp::par, input.begin(), input.end(), result.begin(), init, compose_affine{});
+    ASSERT_EQUAL(reference, result);
+
+    thrust::exclusive_scan(thrust::seq, input.begin(), input.end(), reference.begin(), init, compose_affine{});
+    thrust::exclusive_scan(thrust::omp::par, input.begin(), input.end(), result.begin(), init, compose_affine{});
+    ASSERT_EQUAL(reference, result);
+  }
+}
+DECLARE_UNITTEST(TestOmpScanNonCommutative);
+
+void TestOmpScanInPlace()
+{
+  omp_threads_guard guard;
+  for (const size_t n : lookback_scan_sizes<::cuda::std::uint64_t>())
+  {
+    const auto input = random_affine_maps(n);
+
+    thrust::host_vector<::cuda::std::uint64_t> reference(n);
+    thrust::inclusive_scan(thrust::seq, input.begin(), input.end(), reference.begin(), compose_affine{});
+    thrust::host_vector<::cuda::std::uint64_t> data = input;
+    thrust::inclusive_scan(thrust::omp::par, data.begin(), data.end(), data.begin(), compose_affine{});
+    ASSERT_EQUAL(reference, data);
+
+    const ::cuda::std::uint64_t init{::cuda::std::uint64_t{1} << 32};
+    thrust::exclusive_scan(thrust::seq, input.begin(), input.end(), reference.begin(), init, compose_affine{});
+    data = input;
+    thrust::exclusive_scan(thrust::omp::par, data.begin(), data.end(), data.begin(), init, compose_affine{});
+    ASSERT_EQUAL(reference, data);
+  }
+}
+DECLARE_UNITTEST(TestOmpScanInPlace);
+
+template <typename T>
+struct TestOmpScanManyTiles
+{
+  void operator()()
+  {
+    omp_threads_guard guard;
+    for (const size_t n : lookback_scan_sizes<T>())
+    {
+      const thrust::host_vector<T> input = unittest::random_integers<T>(n);
+
+      thrust::host_vector<T> reference(n);
+      thrust::host_vector<T> result(n);
+
+      thrust::inclusive_scan(thrust::seq, input.begin(), input.end(), reference.begin());
+      thrust::inclusive_scan(thrust::omp::par, input.begin(), input.end(), result.begin());
+      ASSERT_EQUAL(reference, result);
+
+      thrust::exclusive_scan(thrust::seq, input.begin(), input.end(), reference.begin(), T(13));
+      thrust::exclusive_scan(thrust::omp::par, input.begin(), input.end(), result.begin(), T(13));
+      ASSERT_EQUAL(reference, result);
+    }
+  }
+};
+SimpleUnitTest<TestOmpScanManyTiles, IntegralTypes> TestOmpScanManyTilesInstance;
@@ -194,6 +194,48 @@ struct TestReduceByKeyToDiscardIterator
 };
 VariableUnitTest<TestReduceByKeyToDiscardIterator, IntegralTypes> TestReduceByKeyToDiscardIteratorInstance;
 
+template <typename K>
+struct TestReduceByKeyLongSegments
+{
+  void operator()(const size_t n)
+  {
+    using V = unsigned int; // ValueType
+
+    // segments spanning many elements, so that parallel implementations see segments crossing the
+    // boundaries of the pieces of the input, and outputs sized to the number of segments exactly
+    const size_t segment_size = 10000;
+
+    thrust::host_vector<K> h_keys(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      h_keys[i] = static_cast<K>((i / segment_size) % 2);
+    }
+    thrust::host_vector<V> h_vals   = unittest::random_integers<V>(n);
+    thrust::device_vector<K> d_keys = h_keys;
+    thrust::device_vector<V> d_vals = h_vals;
+
+    const size_t N = (n + segment_size - 1) / segment_size;
+
+    thrust::host_vector<K> h_keys_output(N);
+    thrust::host_vector<V> h_vals_output(N);
+    thrust::device_vector<K> d_keys_output(N);
+    thrust::device_vector<V> d_vals_output(N);
+
+    auto h_last =
+      thrust::reduce_by_key(h_keys.begin(), h_keys.end(), h_vals.begin(), h_keys_output.begin(), h_vals_output.begin());
+    auto d_last =
+      thrust::reduce_by_key(d_keys.begin(), d_keys.end(), d_vals.begin(), d_keys_output.begin(), d_vals_output.begin());
+
+    ASSERT_EQUAL(h_last.first - h_keys_output.begin(), static_cast<std::ptrdiff_t>(N));
+    ASSERT_EQUAL(d_last.first - d_keys_output.begin(), static_cast<std::ptrdiff_t>(N));
+    ASSERT_EQUAL(d_last.second - d_vals_output.begin(), static_cast<std::ptrdiff_t>(N));
+
+    ASSERT_EQUAL(h_keys_output, d_keys_output);
+    ASSERT_EQUAL(h_vals_output, d_vals_output);
+  }
+};
+VariableUnitTest<TestReduceByKeyLongSegments, IntegralTypes> TestReduceByKeyLongSegmentsInstance;
+
 template <typename InputIterator1, typename InputIterator2, typename OutputIterator1, typename OutputIterator2>
 cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   my_system& system,
@@ -1,5 +1,6 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/retag.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 
 #include <unittest/unittest.h>
@@ -120,3 +121,58 @@ struct TestStableSortByKeySemantics
 VariableUnitTest<TestStableSortByKeySemantics,
                  unittest::type_list<unittest::uint8_t, unittest::uint16_t, unittest::uint32_t>>
   TestStableSortByKeySemanticsInstance;
+
+template <typename T>
+struct TestStableSortByKeyDescending
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_keys   = unittest::random_integers<T>(n);
+    thrust::device_vector<T> d_keys = h_keys;
+
+    thrust::host_vector<int> h_values(n);
+    thrust::sequence(h_values.begin(), h_values.end());
+    thrust::device_vector<int> d_values = h_values;
+
+    thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), ::cuda::std::greater<T>());
+    thrust::stable_sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin(), ::cuda::std::greater<T>());
+
+    ASSERT_EQUAL(h_keys, d_keys);
+    ASSERT_EQUAL(h_values, d_values);
+  }
+};
+VariableUnitTest<TestStableSortByKeyDescending, IntegralTypes> TestStableSortByKeyDescendingInstance;
+
+template <typename T>
+struct TestStableSortByKeySignedZeros
+{
+  void operator()(const size_t n)
+  {
+    // -0.0 and +0.0 are equivalent, so their values must keep their relative order
+    thrust::host_vector<T> h_keys(n);
+    for (size_t i = 0; i < n; i++)
+    {
+      h_keys[i] = i % 3 == 0 ? T(-0.0) : i % 3 == 1 ? T(0.0) : T(static_cast<int>(i % 7) - 3);
+    }
+    thrust::device_vector<T> d_keys = h_keys;
+
+    thrust::host_vector<int> h_values(n);
+    thrust::sequence(h_values.begin(), h_values.end());
+    thrust::device_vector<int> d_values = h_values;
+
+    thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin());
+    thrust::stable_sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin());
+
+    ASSERT_EQUAL(h_values, d_values);
+
+    thrust::host_vector<int> values = d_values;
+    for (size_t i = 1; i < n; i++)
+    {
+      if (h_keys[i - 1] == T(0) && h_keys[i] == T(0))
+      {
+        ASSERT_EQUAL(true, values[i - 1] < values[i]);
+      }
+    }
+  }
+};
+VariableUnitTest<TestStableSortByKeySignedZeros, FloatingPointTypes> TestStableSortByKeySignedZerosInstance;
@@ -0,0 +1,102 @@
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/sort.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <cuda/std/functional>
+
+#include <unittest/unittest.h>
+
+// Compares the vectorized searches of the TBB backend against the sequential ones
+template <typename T, typename... Compare>
+void test_searches(const thrust::host_vector<T>& haystack, const thrust::host_vector<T>& queries, Compare... comp)
+{
+  thrust::host_vector<size_t> reference(queries.size());
+  thrust::host_vector<size_t> result(queries.size());
+
+  thrust::lower_bound(
+    thrust::seq, haystack.begin(), haystack.end(), queries.begin(), queries.end(), reference.begin(), comp...);
+  thrust::lower_bound(
+    thrust::tbb::par, haystack.begin(), haystack.end(), queries.begin(), queries.end(), result.begin(), comp...);
+  ASSERT_EQUAL(reference, result);
+
+  thrust::upper_bound(
+    thrust::seq, haystack.begin(), haystack.end(), queries.begin(), queries.end(), reference.begin(), comp...);
+  thrust::upper_bound(
+    thrust::tbb::par, haystack.begin(), haystack.end(), queries.begin(), queries.end(), result.begin(), comp...);
+  ASSERT_EQUAL(reference, result);
+
+  thrust::host_vector<bool> reference_found(queries.size());
+  thrust::host_vector<bool> found(queries.size());
+  thrust::binary_search(
+    thrust::seq, haystack.begin(), haystack.end(), queries.begin(), queries.end(), reference_found.begin(), comp...);
+  thrust::binary_search(
+    thrust::tbb::par, haystack.begin(), haystack.end(), queries.begin(), queries.end(), found.begin(), comp...);
+  ASSERT_EQUAL(reference_found, found);
+}
+
+// Random keys drawn from [0, num_keys), so that small key ranges produce long runs of equivalent elements
+template <typename T>
+thrust::host_vector<T> random_keys(size_t n, unsigned num_keys, unsigned seed)
+{
+  thrust::host_vector<T> keys = unittest::random_integers<unsigned>(n + seed);
+  keys.erase(keys.begin(), keys.begin() + seed);
+  for (auto& key : keys)
+  {
+    key = static_cast<T>(static_cast<unsigned>(key) % num_keys);
+  }
+  return keys;
+}
+
+template <typename T>
+struct TestTbbVectorizedSearchManyDuplicates
+{
+  void operator()()
+  {
+    const size_t sizes[]        = {1000, 100000, 1 << 18};
+    const unsigned key_ranges[] = {1, 4, 1000, 1000000};
+    for (const size_t n : sizes)
+    {
+      for (const unsigned num_keys : key_ranges)
+      {
+        thrust::host_vector<T> haystack = random_keys<T>(n, num_keys, 1);
+        thrust::sort(haystack.begin(), haystack.end());
+
+        // queries include values below, inside and above the haystack, unsorted and sorted
+        thrust::host_vector<T> queries = random_keys<T>(n / 2 + 3, num_keys + 2, 2);
+        test_searches(haystack, queries);
+
+        thrust::sort(queries.begin(), queries.end());
+        test_searches(haystack, queries);
+
+        // sorted queries with long runs of the same value, which gallop from the previous result
+        test_searches(haystack, haystack);
+      }
+    }
+  }
+};
+SimpleUnitTest<TestTbbVectorizedSearchManyDuplicates, unittest::type_list<int, unsigned long long>>
+  TestTbbVectorizedSearchManyDuplicatesInstance;
+
+void TestTbbVectorizedSearchDescending()
+{
+  thrust::host_vector<int> haystack = random_keys<int>(300000, 100, 1);
+  thrust::sort(haystack.begin(), haystack.end(), ::cuda::std::greater<int>());
+
+  thrust::host_vector<int> queries = random_keys<int>(200000, 102, 2);
+  test_searches(haystack, queries, ::cuda::std::greater<int>());
+
+  thrust::sort(queries.begin(), queries.end(), ::cuda::std::greater<int>());
+  test_searches(haystack, queries, ::cuda::std::greater<int>());
+}
+DECLARE_UNITTEST(TestTbbVectorizedSearchDescending);
+
+void TestTbbVectorizedSearchEmpty()
+{
+  const thrust::host_vector<int> empty;
+  const thrust::host_vector<int> keys = random_keys<int>(10000, 10, 1);
+  test_searches(empty, keys);
+  test_searches(keys, empty);
+}
+DECLARE_UNITTEST(TestTbbVectorizedSearchEmpty);
@@ -0,0 +1,111 @@
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/set_operations.h>
+#include <thrust/sort.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <cuda/std/functional>
+
+#include <unittest/unittest.h>
+
+// Sorted random keys drawn from [0, num_keys), so that small key ranges produce long runs of equivalent elements
+template <typename T>
+thrust::host_vector<T> sorted_keys(size_t n, unsigned num_keys, unsigned seed)
+{
+  thrust::host_vector<T> keys = unittest::random_integers<unsigned>(n + seed);
+  keys.erase(keys.begin(), keys.begin() + seed);
+  for (auto& key : keys)
+  {
+    key = static_cast<T>(static_cast<unsigned>(key) % num_keys);
+  }
+  thrust::sort(keys.begin(), keys.end());
+  return keys;
+}
+
+// Compares every set operation of the TBB backend against the sequential one. The sizes span many pieces of the
+// parallel scan and the output of a piece depends on how runs of equivalent elements are split between the inputs.
+template <typename T>
+void test_set_operations(const thrust::host_vector<T>& a, const thrust::host_vector<T>& b)
+{
+  thrust::host_vector<T> reference(a.size() + b.size());
+  thrust::host_vector<T> result(a.size() + b.size());
+
+  auto ref_end = thrust::set_union(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), reference.begin());
+  auto res_end = thrust::set_union(thrust::tbb::par, a.begin(), a.end(), b.begin(), b.end(), result.begin());
+  ASSERT_EQUAL(ref_end - reference.begin(), res_end - result.begin());
+  ASSERT_EQUAL(reference, result);
+
+  ref_end = thrust::set_intersection(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), reference.begin());
+  res_end = thrust::set_intersection(thrust::tbb::par, a.begin(), a.end(), b.begin(), b.end(), result.begin());
+  ASSERT_EQUAL(ref_end - reference.begin(), res_end - result.begin());
+  ASSERT_EQUAL(reference, result);
+
+  ref_end = thrust::set_difference(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), reference.begin());
+  res_end = thrust::set_difference(thrust::tbb::par, a.begin(), a.end(), b.begin(), b.end(), result.begin());
+  ASSERT_EQUAL(ref_end - reference.begin(), res_end - result.begin());
+  ASSERT_EQUAL(reference, result);
+
+  ref_end = thrust::set_symmetric_difference(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), reference.begin());
+  res_end =
+    thrust::set_symmetric_difference(thrust::tbb::par, a.begin(), a.end(), b.begin(), b.end(), result.begin());
+  ASSERT_EQUAL(ref_end - reference.begin(), res_end - result.begin());
+  ASSERT_EQUAL(reference, result);
+}
+
+template <typename T>
+struct TestTbbSetOperationsManyDuplicates
+{
+  void operator()()
+  {
+    const size_t sizes[]        = {1000, (1 << 13) + 1, 100000, 1 << 20};
+    const unsigned key_ranges[] = {1, 3, 100, 100000};
+    for (const size_t n : sizes)
+    {
+      for (const unsigned num_keys : key_ranges)
+      {
+        test_set_operations(sorted_keys<T>(n, num_keys, 1), sorted_keys<T>(n, num_keys, 2));
+        test_set_operations(sorted_keys<T>(n, num_keys, 3), sorted_keys<T>(n / 7 + 1, num_keys, 4));
+        test_set_operations(sorted_keys<T>(n / 5 + 1, num_keys, 5), sorted_keys<T>(n, num_keys, 6));
+      }
+    }
+  }
+};
+SimpleUnitTest<TestTbbSetOperationsManyDuplicates, unittest::type_list<int, unsigned long long>>
+  TestTbbSetOperationsManyDuplicatesInstance;
+
+void TestTbbSetOperationsEmpty()
+{
+  const thrust::host_vector<int> empty;
+  const thrust::host_vector<int> keys = sorted_keys<int>(100000, 10, 1);
+  test_set_operations(empty, empty);
+  test_set_operations(keys, empty);
+  test_set_operations(empty, keys);
+}
+DECLARE_UNITTEST(TestTbbSetOperationsEmpty);
+
+void TestTbbSetOperationsDescending()
+{
+  thrust::host_vector<int> a = sorted_keys<int>(200000, 50, 1);
+  thrust::host_vector<int> b = sorted_keys<int>(150000, 50, 2);
+  thrust::sort(a.begin(), a.end(), ::cuda::std::greater<int>());
+  thrust::sort(b.begin(), b.end(), ::cuda::std::greater<int>());
+
+  thrust::host_vector<int> reference(a.size() + b.size());
+  thrust::host_vector<int> result(a.size() + b.size());
+
+  auto ref_end = thrust::set_union(
+    thrust::seq, a.begin(), a.end(), b.begin(), b.end(), reference.begin(), ::cuda::std::greater<int>());
+  auto res_end = thrust::set_union(
+    thrust::tbb::par, a.begin(), a.end(), b.begin(), b.end(), result.begin(), ::cuda::std::greater<int>());
+  ASSERT_EQUAL(ref_end - reference.begin(), res_end - result.begin());
+  ASSERT_EQUAL(reference, result);
+
+  ref_end = thrust::set_difference(
+    thrust::seq, a.begin(), a.end(), b.begin(), b.end(), reference.begin(), ::cuda::std::greater<int>());
+  res_end = thrust::set_difference(
+    thrust::tbb::par, a.begin(), a.end(), b.begin(), b.end(), result.begin(), ::cuda::std::greater<int>());
+  ASSERT_EQUAL(ref_end - reference.begin(), res_end - result.begin());
+  ASSERT_EQUAL(reference, result);
+}
+DECLARE_UNITTEST(TestTbbSetOperationsDescending);
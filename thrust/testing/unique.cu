@@ -173,6 +173,42 @@ struct TestUnique
 };
 VariableUnitTest<TestUnique, IntegralTypes> TestUniqueInstance;
 
+template <typename T>
+struct TestUniqueLongRuns
+{
+  void operator()(const size_t n)
+  {
+    // runs spanning many elements, so that parallel implementations see runs crossing the boundaries of
+    // the pieces of the input
+    const size_t run_size = 10000;
+
+    thrust::host_vector<T> h_data(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      h_data[i] = static_cast<T>((i / run_size) % 2);
+    }
+    thrust::device_vector<T> d_data = h_data;
+
+    const size_t N = (n + run_size - 1) / run_size;
+
+    thrust::device_vector<T> d_output(N);
+    auto d_copy_last = thrust::unique_copy(d_data.begin(), d_data.end(), d_output.begin());
+    auto d_new_last  = thrust::unique(d_data.begin(), d_data.end());
+    auto h_new_last  = thrust::unique(h_data.begin(), h_data.end());
+
+    ASSERT_EQUAL(h_new_last - h_data.begin(), static_cast<std::ptrdiff_t>(N));
+    ASSERT_EQUAL(d_new_last - d_data.begin(), static_cast<std::ptrdiff_t>(N));
+    ASSERT_EQUAL(d_copy_last - d_output.begin(), static_cast<std::ptrdiff_t>(N));
+
+    h_data.resize(N);
+    d_data.resize(N);
+
+    ASSERT_EQUAL(h_data, d_data);
+    ASSERT_EQUAL(h_data, d_output);
+  }
+};
+VariableUnitTest<TestUniqueLongRuns, IntegralTypes> TestUniqueLongRunsInstance;
+
 template <typename Vector>
 void TestUniqueCopySimple()
 {
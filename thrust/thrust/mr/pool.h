@@ -26,9 +26,12 @@
 
 #include <cuda/__cmath/ilog.h>
 #include <cuda/__cmath/pow2.h>
+#include <cuda/std/__bit/countr.h>
 #include <cuda/std/__host_stdlib/algorithm>
 #include <cuda/std/cassert>
+#include <cuda/std/climits>
 #include <cuda/std/cstdint>
+#include <cuda/std/limits>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -38,6 +41,24 @@ namespace mr
  *  \{
  */
 
+/*! Statistics of the cache of oversized and overaligned blocks of a pool resource.
+ */
+struct pool_cache_statistics
+{
+  /*! The number of oversized or overaligned allocations served from the cache.
+   */
+  std::size_t hits;
+  /*! The number of oversized or overaligned allocations that had to be requested from upstream.
+   */
+  std::size_t misses;
+  /*! The number of blocks currently held in the cache.
+   */
+  std::size_t cached_blocks;
+  /*! The total size in bytes of the blocks currently held in the cache.
+   */
+  std::size_t cached_bytes;
+};
+
 /*! A memory resource adaptor allowing for pooling and caching allocations from \p Upstream, using memory allocated
  *      from it for both blocks then allocated to the user and for internal bookkeeping of the cached memory.
  *
@@ -105,6 +126,8 @@ public:
       , m_allocated()
       , m_oversized()
       , m_cached_oversized()
+      , m_cached_mask()
+      , m_statistics()
   {
     assert(m_options.validate());
 
@@ -126,6 +149,8 @@ public:
       , m_allocated()
       , m_oversized()
       , m_cached_oversized()
+      , m_cached_mask()
+      , m_statistics()
   {
     assert(m_options.validate());
 
@@ -165,24 +190,16 @@ private:
     chunk_descriptor_ptr next;
   };
 
-  // this was originally a forward list, but I made it a doubly linked list
-  // because that way deallocation when not caching is faster and doesn't require
-  // traversal of a linked list (it's still a forward list for the cached list,
-  // because allocation from that list already traverses)
-  //
-  // TODO: investigate whether it's better to have this be a doubly-linked list
-  // with fast do_deallocate when !m_options.cache_oversized, or to have this be
-  // a forward list and require traversal in do_deallocate
-  //
-  // I assume that it is better this way, but the additional pointer could
-  // potentially hurt? these are supposed to be oversized and/or overaligned,
-  // so they are kinda memory intensive already
+  // every oversized block is on the doubly linked list of all oversized blocks, so that deallocation when not
+  // caching doesn't require traversal of a linked list; a cached block is additionally on the doubly linked list of
+  // its size class, so that it can be taken out of the middle of that list when it is reused
   struct oversized_block_descriptor
   {
     std::size_t size;
     std::size_t alignment;
     oversized_block_descriptor_ptr prev;
     oversized_block_descriptor_ptr next;
+    oversized_block_descriptor_ptr prev_cached;
     oversized_block_descriptor_ptr next_cached;
     std::size_t current_size;
   };
@@ -195,6 +212,24 @@ private:
 
   using pool_vector = thrust::host_vector<pool, allocator<pool, Upstream>>;
 
+  // cached oversized blocks are binned by size class; every power of two is split into 2^cached_subclasses_log2 classes
+  // of equal width, so that the blocks of a class differ in size by less than 25%
+  static constexpr std::size_t cached_subclasses_log2 = 2;
+  static constexpr std::size_t cached_class_count     = (sizeof(std::size_t) * CHAR_BIT) << cached_subclasses_log2;
+  static constexpr std::size_t cached_mask_bits       = sizeof(::cuda::std::uint64_t) * CHAR_BIT;
+
+  // returns the size class of a block, classes are ordered by the sizes of their blocks
+  static std::size_t cached_class(std::size_t size)
+  {
+    const std::size_t size_log2 = ::cuda::ilog2(size);
+    if (size_log2 < cached_subclasses_log2)
+    {
+      return size;
+    }
+    const std::size_t subclass = (size >> (size_log2 - cached_subclasses_log2)) & ((1 << cached_subclasses_log2) - 1);
+    return (size_log2 << cached_subclasses_log2) | subclass;
+  }
+
   Upstream* m_upstream;
 
   pool_options m_options;
@@ -203,7 +238,89 @@ private:
   pool_vector m_pools;
   chunk_descriptor_ptr m_allocated;
   oversized_block_descriptor_ptr m_oversized;
-  oversized_block_descriptor_ptr m_cached_oversized;
+  // heads of the lists of cached blocks of every size class, and a bit mask of the classes with any cached blocks
+  oversized_block_descriptor_ptr m_cached_oversized[cached_class_count];
+  ::cuda::std::uint64_t m_cached_mask[cached_class_count / cached_mask_bits];
+
+  pool_cache_statistics m_statistics;
+
+  // returns the first size class at or above the given one that has any cached blocks, or cached_class_count
+  std::size_t next_cached_class(std::size_t size_class) const
+  {
+    if (size_class >= cached_class_count)
+    {
+      return cached_class_count;
+    }
+
+    std::size_t word           = size_class / cached_mask_bits;
+    ::cuda::std::uint64_t bits = m_cached_mask[word] & (~::cuda::std::uint64_t(0) << (size_class % cached_mask_bits));
+    while (!bits)
+    {
+      if (++word == cached_class_count / cached_mask_bits)
+      {
+        return cached_class_count;
+      }
+      bits = m_cached_mask[word];
+    }
+    return word * cached_mask_bits + ::cuda::std::countr_zero(bits);
+  }
+
+  // pushes a block, whose descriptor is passed in and not yet written back, to the front of its size class
+  void push_cached(oversized_block_descriptor_ptr block, oversized_block_descriptor& desc)
+  {
+    const std::size_t size_class = cached_class(desc.size);
+    desc.prev_cached             = oversized_block_descriptor_ptr();
+    desc.next_cached             = m_cached_oversized[size_class];
+
+    if (oversized_block_ptr_traits::get(desc.next_cached))
+    {
+      thrust::raw_reference_cast(*desc.next_cached).prev_cached = block;
+    }
+
+    m_cached_oversized[size_class] = block;
+    m_cached_mask[size_class / cached_mask_bits] |= ::cuda::std::uint64_t(1) << (size_class % cached_mask_bits);
+
+    ++m_statistics.cached_blocks;
+    m_statistics.cached_bytes += desc.size;
+  }
+
+  // unlinks a block from the list of its size class
+  void erase_cached(oversized_block_descriptor& desc)
+  {
+    const std::size_t size_class = cached_class(desc.size);
+
+    if (oversized_block_ptr_traits::get(desc.prev_cached))
+    {
+      thrust::raw_reference_cast(*desc.prev_cached).next_cached = desc.next_cached;
+    }
+    else
+    {
+      m_cached_oversized[size_class] = desc.next_cached;
+      if (!oversized_block_ptr_traits::get(desc.next_cached))
+      {
+        m_cached_mask[size_class / cached_mask_bits] &= ~(::cuda::std::uint64_t(1) << (size_class % cached_mask_bits));
+      }
+    }
+
+    if (oversized_block_ptr_traits::get(desc.next_cached))
+    {
+      thrust::raw_reference_cast(*desc.next_cached).prev_cached = desc.prev_cached;
+    }
+
+    desc.prev_cached = oversized_block_descriptor_ptr();
+    desc.next_cached = oversized_block_descriptor_ptr();
+
+    --m_statistics.cached_blocks;
+    m_statistics.cached_bytes -= desc.size;
+  }
+
+  // whether a cached block can serve an allocation, i.e. it is big and aligned enough, but not bigger or more aligned
+  // than requested by a factor of the respective cutoff or more
+  bool is_good_fit(const oversized_block_descriptor& desc, std::size_t bytes, std::size_t alignment) const
+  {
+    return desc.size >= bytes && desc.alignment >= alignment && desc.size / bytes < m_options.cached_size_cutoff_factor
+        && desc.alignment / alignment < m_options.cached_alignment_cutoff_factor;
+  }
 
 public:
   /*! Releases all held memory to upstream.
@@ -241,7 +358,26 @@ public:
       m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
     }
 
-    m_cached_oversized = oversized_block_descriptor_ptr();
+    for (std::size_t i = 0; i < cached_class_count; ++i)
+    {
+      m_cached_oversized[i] = oversized_block_descriptor_ptr();
+    }
+    for (std::size_t i = 0; i < cached_class_count / cached_mask_bits; ++i)
+    {
+      m_cached_mask[i] = 0;
+    }
+
+    m_statistics.cached_blocks = 0;
+    m_statistics.cached_bytes  = 0;
+  }
+
+  /*! Returns the statistics of the cache of oversized and overaligned blocks. The hit and miss counts accumulate over
+   *      the lifetime of the resource, while the cached block and byte counts reflect the current contents of the
+   *      cache.
+   */
+  pool_cache_statistics get_cache_statistics() const
+  {
+    return m_statistics;
   }
 
   [[nodiscard]] virtual void_ptr
@@ -253,51 +389,32 @@ public:
     // an oversized and/or overaligned allocation requested; needs to be allocated separately
     if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
     {
-      if (m_options.cache_oversized)
+      if (m_options.cache_oversized && m_options.cached_size_cutoff_factor != 0)
       {
-        oversized_block_descriptor_ptr ptr       = m_cached_oversized;
-        oversized_block_descriptor_ptr* previous = &m_cached_oversized;
-        while (oversized_block_ptr_traits::get(ptr))
+        // only the classes between the one of the requested size and the one of the biggest block still within the
+        // size cutoff can hold a good fit; the first class may also hold blocks that are too small
+        const std::size_t max_size =
+          bytes > (::cuda::std::numeric_limits<std::size_t>::max)() / m_options.cached_size_cutoff_factor
+            ? (::cuda::std::numeric_limits<std::size_t>::max)()
+            : bytes * m_options.cached_size_cutoff_factor - 1;
+        const std::size_t last_class = cached_class(max_size);
+
+        std::size_t size_class = next_cached_class(cached_class(bytes));
+        for (; size_class <= last_class; size_class = next_cached_class(size_class + 1))
         {
-          oversized_block_descriptor desc = *ptr;
-          bool is_good                    = desc.size >= bytes && desc.alignment >= alignment;
-
-          // if the size is bigger than the requested size by a factor
-          // bigger than or equal to the specified cutoff for size,
-          // allocate a new block
-          if (is_good)
-          {
-            std::size_t size_factor = desc.size / bytes;
-            if (size_factor >= m_options.cached_size_cutoff_factor)
-            {
-              is_good = false;
-            }
-          }
-
-          // if the alignment is bigger than the requested one by a factor
-          // bigger than or equal to the specified cutoff for alignment,
-          // allocate a new block
-          if (is_good)
+          oversized_block_descriptor_ptr ptr = m_cached_oversized[size_class];
+          while (oversized_block_ptr_traits::get(ptr))
           {
-            std::size_t alignment_factor = desc.alignment / alignment;
-            if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
-            {
-              is_good = false;
-            }
-          }
+            oversized_block_descriptor desc = *ptr;
 
-          if (is_good)
-          {
-            if (previous != &m_cached_oversized)
+            if (!is_good_fit(desc, bytes, alignment))
             {
-              *previous = desc.next_cached;
-            }
-            else
-            {
-              m_cached_oversized = desc.next_cached;
+              ptr = desc.next_cached;
+              continue;
             }
 
-            desc.next_cached = oversized_block_descriptor_ptr();
+            erase_cached(desc);
+            ++m_statistics.hits;
 
             auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
 
@@ -326,13 +443,11 @@ public:
 
             return static_cast<void_ptr>(ret);
           }
-
-          previous = &thrust::raw_reference_cast(*ptr).next_cached;
-          ptr      = *previous;
         }
       }
 
       // no fitting cached block found; allocate a new one that's just up to the specs
+      ++m_statistics.misses;
       void_ptr allocated = m_upstream->do_allocate(bytes + sizeof(oversized_block_descriptor), alignment);
       oversized_block_descriptor_ptr block =
         static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(allocated) + bytes));
@@ -342,6 +457,7 @@ public:
       desc.alignment    = alignment;
       desc.prev         = oversized_block_descriptor_ptr();
       desc.next         = m_oversized;
+      desc.prev_cached  = oversized_block_descriptor_ptr();
       desc.next_cached  = oversized_block_descriptor_ptr();
       desc.current_size = bytes;
       *block            = desc;
@@ -444,8 +560,6 @@ public:
 
       if (m_options.cache_oversized)
       {
-        desc.next_cached = m_cached_oversized;
-
         if (desc.size != n)
         {
           desc.current_size = desc.size;
@@ -466,8 +580,8 @@ public:
           }
         }
 
-        m_cached_oversized = block;
-        *block             = desc;
+        push_cached(block, desc);
+        *block = desc;
 
         return;
       }
@@ -0,0 +1,383 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief A version of \p unsynchronized_pool_resource synchronized for many concurrently allocating threads.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/pool.h>
+
+#include <cuda/__cmath/ilog.h>
+#include <cuda/__cmath/pow2.h>
+#include <cuda/std/__host_stdlib/algorithm>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A synchronized version of \p unsynchronized_pool_resource that scales to many threads allocating at the same time.
+ *
+ *  Unlike \p synchronized_pool_resource, which serializes every allocation and deallocation on a single mutex, this
+ *      resource keeps small blocks in magazines: fixed size stacks of blocks of a single bucket. Every thread owns a
+ *      loaded and a spare magazine per bucket, from which it allocates and to which it deallocates without contention.
+ *      Full magazines, including ones filled by threads deallocating blocks allocated by other threads, are handed in
+ *      as a batch to a lock-free stack shared by all threads, from which threads whose magazines ran dry take them.
+ *      Only when that stack is empty does a thread refill a magazine from the underlying \p
+ *      unsynchronized_pool_resource, which is guarded by a mutex, as are oversized and overaligned allocations.
+ *
+ *  Blocks held in magazines are not returned to the underlying pool until \p release is called.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory
+ */
+template <typename Upstream>
+struct scalable_synchronized_pool_resource : public memory_resource<typename Upstream::pointer>
+{
+  using unsync_pool = unsynchronized_pool_resource<Upstream>;
+  using lock_t      = std::lock_guard<std::mutex>;
+
+  using void_ptr = typename Upstream::pointer;
+
+public:
+  /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
+   *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+   *      just a slight departure from the defaults is easy.
+   */
+  static pool_options get_default_options()
+  {
+    return unsync_pool::get_default_options();
+  }
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param options pool options to use
+   */
+  scalable_synchronized_pool_resource(Upstream* upstream, pool_options options = get_default_options())
+      : m_options(options)
+      , m_smallest_block_log2(::cuda::ceil_ilog2(options.smallest_block_size))
+      , m_bucket_count(::cuda::ceil_ilog2(options.largest_block_size) - m_smallest_block_log2 + 1)
+      , m_slot_count(::cuda::next_power_of_two((std::max) (std::thread::hardware_concurrency(), 1u)))
+      , m_slots(new slot[m_slot_count])
+      , m_depots(new depot[m_bucket_count])
+      , upstream_pool(upstream, options)
+  {
+    init_slots();
+  }
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   *
+   *  \param options pool options to use
+   */
+  scalable_synchronized_pool_resource(pool_options options = get_default_options())
+      : scalable_synchronized_pool_resource(get_global_resource<Upstream>(), options)
+  {}
+
+  /*! Destructor. Releases all held memory to upstream.
+   */
+  ~scalable_synchronized_pool_resource()
+  {
+    release();
+
+    for (std::size_t i = 0; i < m_slot_count; ++i)
+    {
+      for (std::size_t bucket = 0; bucket < m_bucket_count; ++bucket)
+      {
+        delete m_slots[i].loaded[bucket];
+        delete m_slots[i].previous[bucket];
+      }
+    }
+
+    for (std::size_t bucket = 0; bucket < m_bucket_count; ++bucket)
+    {
+      delete_all(m_depots[bucket].full.exchange(nullptr));
+      delete_all(m_depots[bucket].empty.exchange(nullptr));
+    }
+  }
+
+  /*! Releases all held memory to upstream. Must not be called concurrently with allocations or deallocations.
+   */
+  void release()
+  {
+    for (std::size_t i = 0; i < m_slot_count; ++i)
+    {
+      lock_t slot_lock(m_slots[i].mtx);
+      for (std::size_t bucket = 0; bucket < m_bucket_count; ++bucket)
+      {
+        if (m_slots[i].loaded[bucket])
+        {
+          m_slots[i].loaded[bucket]->count   = 0;
+          m_slots[i].previous[bucket]->count = 0;
+        }
+      }
+    }
+
+    // the blocks in the full magazines belong to the pool, which releases them below
+    for (std::size_t bucket = 0; bucket < m_bucket_count; ++bucket)
+    {
+      magazine* first = m_depots[bucket].full.exchange(nullptr, std::memory_order_acquire);
+      if (first)
+      {
+        magazine* last = first;
+        for (magazine* m = first; m; m = m->next)
+        {
+          m->count = 0;
+          last     = m;
+        }
+        push(m_depots[bucket].empty, first, last);
+      }
+    }
+
+    lock_t lock(mtx);
+    upstream_pool.release();
+  }
+
+  /*! Returns the statistics of the cache of oversized and overaligned blocks of the underlying pool.
+   */
+  pool_cache_statistics get_cache_statistics() const
+  {
+    lock_t lock(mtx);
+    return upstream_pool.get_cache_statistics();
+  }
+
+  [[nodiscard]] virtual void_ptr
+  do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    bytes = (std::max) (bytes, m_options.smallest_block_size);
+
+    if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock(mtx);
+      return upstream_pool.do_allocate(bytes, alignment);
+    }
+
+    const std::size_t bucket = ::cuda::ceil_ilog2(bytes) - m_smallest_block_log2;
+    slot& s                  = this_slot();
+    lock_t lock(s.mtx);
+
+    magazine*& loaded   = s.loaded[bucket];
+    magazine*& previous = s.previous[bucket];
+    prepare(loaded, previous, bucket);
+
+    if (loaded->count == 0)
+    {
+      if (previous->count != 0)
+      {
+        std::swap(loaded, previous);
+      }
+      else if (magazine* full = pop(m_depots[bucket].full))
+      {
+        push(m_depots[bucket].empty, previous, previous);
+        previous = loaded;
+        loaded   = full;
+      }
+      else
+      {
+        refill(*loaded, bucket);
+      }
+    }
+
+    return loaded->blocks[--loaded->count];
+  }
+
+  virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    n = (std::max) (n, m_options.smallest_block_size);
+
+    if (n > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock(mtx);
+      upstream_pool.do_deallocate(p, n, alignment);
+      return;
+    }
+
+    const std::size_t bucket = ::cuda::ceil_ilog2(n) - m_smallest_block_log2;
+    slot& s                  = this_slot();
+    lock_t lock(s.mtx);
+
+    magazine*& loaded   = s.loaded[bucket];
+    magazine*& previous = s.previous[bucket];
+    prepare(loaded, previous, bucket);
+
+    if (loaded->count == capacity(bucket))
+    {
+      if (previous->count == 0)
+      {
+        std::swap(loaded, previous);
+      }
+      else
+      {
+        // hand in the spare full magazine as a batch, whichever threads allocated its blocks
+        push(m_depots[bucket].full, previous, previous);
+        previous = loaded;
+        loaded   = take_empty(bucket);
+      }
+    }
+
+    loaded->blocks[loaded->count++] = p;
+  }
+
+private:
+  static constexpr std::size_t magazine_capacity = 32;
+  // limit on the memory held by a magazine of big blocks
+  static constexpr std::size_t magazine_bytes = static_cast<std::size_t>(1) << 18;
+
+  struct magazine
+  {
+    std::size_t count = 0;
+    magazine* next    = nullptr;
+    void_ptr blocks[magazine_capacity];
+  };
+
+  // the magazines of a thread; threads beyond the number of slots share them
+  struct alignas(64) slot
+  {
+    std::mutex mtx;
+    std::unique_ptr<magazine*[]> loaded;
+    std::unique_ptr<magazine*[]> previous;
+  };
+
+  // the magazines of a bucket shared by all threads
+  struct alignas(64) depot
+  {
+    std::atomic<magazine*> full{nullptr};
+    std::atomic<magazine*> empty{nullptr};
+  };
+
+  pool_options m_options;
+  std::size_t m_smallest_block_log2;
+  std::size_t m_bucket_count;
+  std::size_t m_slot_count;
+  std::unique_ptr<slot[]> m_slots;
+  std::unique_ptr<depot[]> m_depots;
+
+  mutable std::mutex mtx;
+  unsync_pool upstream_pool;
+
+  void init_slots()
+  {
+    for (std::size_t i = 0; i < m_slot_count; ++i)
+    {
+      m_slots[i].loaded.reset(new magazine*[m_bucket_count]());
+      m_slots[i].previous.reset(new magazine*[m_bucket_count]());
+    }
+  }
+
+  static std::size_t this_thread_index()
+  {
+    static std::atomic<std::size_t> next_index{0};
+    thread_local const std::size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+    return index;
+  }
+
+  slot& this_slot()
+  {
+    return m_slots[this_thread_index() & (m_slot_count - 1)];
+  }
+
+  std::size_t capacity(std::size_t bucket) const
+  {
+    const std::size_t blocks = magazine_bytes >> (bucket + m_smallest_block_log2);
+    return (std::min) (magazine_capacity, (std::max) (blocks, std::size_t(1)));
+  }
+
+  // pushes the chain of magazines [first, last] to a stack
+  static void push(std::atomic<magazine*>& stack, magazine* first, magazine* last)
+  {
+    magazine* head = stack.load(std::memory_order_relaxed);
+    do
+    {
+      last->next = head;
+    } while (!stack.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  // pops a magazine from a stack. The whole stack is taken at once, which unlike popping a single magazine is not
+  // prone to ABA, and everything but the first magazine is put back.
+  static magazine* pop(std::atomic<magazine*>& stack)
+  {
+    if (!stack.load(std::memory_order_relaxed))
+    {
+      return nullptr;
+    }
+
+    magazine* head = stack.exchange(nullptr, std::memory_order_acquire);
+    if (head && head->next)
+    {
+      magazine* rest     = head->next;
+      magazine* expected = nullptr;
+      if (!stack.compare_exchange_strong(expected, rest, std::memory_order_release, std::memory_order_relaxed))
+      {
+        magazine* last = rest;
+        while (last->next)
+        {
+          last = last->next;
+        }
+        push(stack, rest, last);
+      }
+    }
+    return head;
+  }
+
+  static void delete_all(magazine* m)
+  {
+    while (m)
+    {
+      magazine* next = m->next;
+      delete m;
+      m = next;
+    }
+  }
+
+  magazine* take_empty(std::size_t bucket)
+  {
+    magazine* m = pop(m_depots[bucket].empty);
+    return m ? m : new magazine();
+  }
+
+  void prepare(magazine*& loaded, magazine*& previous, std::size_t bucket)
+  {
+    if (!loaded)
+    {
+      loaded   = take_empty(bucket);
+      previous = take_empty(bucket);
+    }
+  }
+
+  // fills an empty magazine with blocks allocated from the underlying pool under a single lock
+  void refill(magazine& m, std::size_t bucket)
+  {
+    const std::size_t bytes = static_cast<std::size_t>(1) << (bucket + m_smallest_block_log2);
+    const std::size_t count = capacity(bucket);
+
+    lock_t lock(mtx);
+    for (; m.count < count; ++m.count)
+    {
+      m.blocks[m.count] = upstream_pool.do_allocate(bytes, m_options.alignment);
+    }
+  }
+};
+
+/*! \} // memory_resources
+ */
+} // namespace mr
+THRUST_NAMESPACE_END
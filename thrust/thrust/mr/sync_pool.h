@@ -75,6 +75,16 @@ public:
     upstream_pool.release();
   }
 
+  /*! Returns the statistics of the cache of oversized and overaligned blocks. The hit and miss counts accumulate over
+   *      the lifetime of the resource, while the cached block and byte counts reflect the current contents of the
+   *      cache.
+   */
+  pool_cache_statistics get_cache_statistics() const
+  {
+    lock_t lock(mtx);
+    return upstream_pool.get_cache_statistics();
+  }
+
   [[nodiscard]] virtual void_ptr
   do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
@@ -89,7 +99,7 @@ public:
   }
 
 private:
-  std::mutex mtx;
+  mutable std::mutex mtx;
   unsync_pool upstream_pool;
 };
 
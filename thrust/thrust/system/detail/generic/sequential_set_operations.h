@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file sequential_set_operations.h
+ *  \brief Function objects applying the sequential set operations to pieces of the inputs.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/seq.h>
+#include <thrust/set_operations.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+// The parallel host backends split the inputs of a set operation into pieces and run the sequential
+// set operation on every piece. These function objects let them pass the operation as a parameter.
+struct sequential_set_difference_fn
+{
+  template <typename... Args>
+  auto operator()(Args... args) const
+  {
+    return thrust::set_difference(thrust::seq, args...);
+  }
+};
+
+struct sequential_set_intersection_fn
+{
+  template <typename... Args>
+  auto operator()(Args... args) const
+  {
+    return thrust::set_intersection(thrust::seq, args...);
+  }
+};
+
+struct sequential_set_symmetric_difference_fn
+{
+  template <typename... Args>
+  auto operator()(Args... args) const
+  {
+    return thrust::set_symmetric_difference(thrust::seq, args...);
+  }
+};
+
+struct sequential_set_union_fn
+{
+  template <typename... Args>
+  auto operator()(Args... args) const
+  {
+    return thrust::set_union(thrust::seq, args...);
+  }
+};
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file merge_path.h
+ *  \brief Partitioning of two sorted ranges along their merge path.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cuda/std/__utility/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// Returns how many of the first diag elements of the stable merge of [first1, first1 + n1) and
+// [first2, first2 + n2) come from the first range. Equivalent elements of the first range precede
+// those of the second range, as in thrust::merge.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename Size, typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE Size merge_path_search(
+  Size diag, RandomAccessIterator1 first1, Size n1, RandomAccessIterator2 first2, Size n2, StrictWeakOrdering comp)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  Size lo = diag > n2 ? diag - n2 : Size(0);
+  Size hi = diag < n1 ? diag : n1;
+
+  while (lo < hi)
+  {
+    const Size mid = lo + (hi - lo) / 2;
+    if (wrapped_comp(first2[diag - 1 - mid], first1[mid]))
+    {
+      hi = mid;
+    }
+    else
+    {
+      lo = mid + 1;
+    }
+  }
+
+  return lo;
+}
+
+// Returns the number of elements of [first, first + n) that are ordered before value.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename Size, typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE Size merge_path_lower_bound(
+  RandomAccessIterator first, Size n, const T& value, thrust::detail::wrapped_function<StrictWeakOrdering, bool> comp)
+{
+  Size lo = 0;
+  while (n > 0)
+  {
+    const Size half = n / 2;
+    if (comp(first[lo + half], value))
+    {
+      lo += half + 1;
+      n -= half + 1;
+    }
+    else
+    {
+      n = half;
+    }
+  }
+  return lo;
+}
+
+// Like merge_path_search, but moves the split point back to the start of the run of equivalent
+// elements it falls into, so that the elements of an equivalence class from both ranges end up on
+// the same side. Returns the number of elements of each range before the split. Set operations
+// applied independently to the pieces of such a partition concatenate to the result for the whole
+// ranges.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename Size, typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE ::cuda::std::pair<Size, Size> balanced_path_search(
+  Size diag, RandomAccessIterator1 first1, Size n1, RandomAccessIterator2 first2, Size n2, StrictWeakOrdering comp)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  const Size i = system::detail::internal::merge_path_search(diag, first1, n1, first2, n2, comp);
+  const Size j = diag - i;
+
+  // Everything before the split is ordered before or equivalent to the first element after it,
+  // so only the elements before the split need to be searched.
+  if (i < n1 && (j == n2 || !wrapped_comp(first2[j], first1[i])))
+  {
+    const thrust::detail::it_value_t<RandomAccessIterator1> pivot = first1[i];
+    return ::cuda::std::make_pair(system::detail::internal::merge_path_lower_bound(first1, i, pivot, wrapped_comp),
+                                  system::detail::internal::merge_path_lower_bound(first2, j, pivot, wrapped_comp));
+  }
+  if (j < n2)
+  {
+    const thrust::detail::it_value_t<RandomAccessIterator2> pivot = first2[j];
+    return ::cuda::std::make_pair(system::detail::internal::merge_path_lower_bound(first1, i, pivot, wrapped_comp),
+                                  system::detail::internal::merge_path_lower_bound(first2, j, pivot, wrapped_comp));
+  }
+  return ::cuda::std::make_pair(n1, n2);
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,337 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file radix_sort.h
+ *  \brief Parallel LSD radix sort of arithmetic keys for the host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__bit/bit_cast.h>
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/__type_traits/is_integral.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__type_traits/is_signed.h>
+#include <cuda/std/__type_traits/is_trivially_copyable.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/__utility/swap.h>
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+namespace radix_sort_detail
+{
+inline constexpr int radix_bits  = 8;
+inline constexpr int num_buckets = 1 << radix_bits;
+
+// Every bucket collects this many keys before writing them out together, so that the scatter writes
+// whole cache lines instead of touching a different line for every key
+template <typename KeyType>
+inline constexpr int buffer_size = sizeof(KeyType) >= 64 ? 1 : static_cast<int>(64 / sizeof(KeyType));
+
+template <typename KeyType>
+inline constexpr bool is_radix_key_v =
+  (::cuda::std::is_integral_v<KeyType> && !::cuda::std::is_same_v<KeyType, bool>)
+  || ::cuda::std::is_same_v<KeyType, float> || ::cuda::std::is_same_v<KeyType, double>;
+
+template <typename KeyType>
+struct radix_bits_type : ::cuda::std::make_unsigned<KeyType>
+{};
+
+template <>
+struct radix_bits_type<float>
+{
+  using type = ::cuda::std::uint32_t;
+};
+
+template <>
+struct radix_bits_type<double>
+{
+  using type = ::cuda::std::uint64_t;
+};
+
+// Maps a key to an unsigned integer whose order matches the order of the keys, or its reverse if
+// Descending is true.
+template <typename KeyType, bool Descending>
+struct radix_encoder
+{
+  using bits_type = typename radix_bits_type<KeyType>::type;
+
+  static constexpr bits_type sign_bit = static_cast<bits_type>(bits_type(1) << (8 * sizeof(bits_type) - 1));
+
+  bits_type operator()(KeyType key) const
+  {
+    bits_type bits{};
+    if constexpr (::cuda::std::is_floating_point_v<KeyType>)
+    {
+      // -0.0 compares equal to +0.0, so both have to land in the same bucket to keep the sort stable
+      bits = ::cuda::std::bit_cast<bits_type>(key == KeyType(0) ? KeyType(0) : key);
+      bits = (bits & sign_bit) ? static_cast<bits_type>(~bits) : static_cast<bits_type>(bits ^ sign_bit);
+    }
+    else if constexpr (::cuda::std::is_signed_v<KeyType>)
+    {
+      bits = static_cast<bits_type>(static_cast<bits_type>(key) ^ sign_bit);
+    }
+    else
+    {
+      bits = static_cast<bits_type>(key);
+    }
+
+    if constexpr (Descending)
+    {
+      bits = static_cast<bits_type>(~bits);
+    }
+    return bits;
+  }
+};
+
+template <typename KeyType, bool Descending>
+struct radix_digit
+{
+  radix_encoder<KeyType, Descending> encode;
+  int shift;
+
+  unsigned int operator()(KeyType key) const
+  {
+    return static_cast<unsigned int>(encode(key) >> shift) & (num_buckets - 1);
+  }
+};
+
+template <typename KeyType, typename StrictWeakOrdering>
+inline constexpr bool is_descending_v = ::cuda::std::is_same_v<StrictWeakOrdering, ::cuda::std::greater<KeyType>>;
+
+// Counts the keys of every block that fall into each bucket
+template <typename KeyType, bool Descending, typename Size, typename ParallelFor>
+void histogram(const KeyType* keys,
+               Size n,
+               Size num_blocks,
+               Size block_size,
+               radix_digit<KeyType, Descending> digit,
+               Size* counts,
+               ParallelFor parallel_for)
+{
+  parallel_for(num_blocks, [=](Size block) {
+    Size* block_counts = counts + block * num_buckets;
+    for (int bucket = 0; bucket < num_buckets; ++bucket)
+    {
+      block_counts[bucket] = 0;
+    }
+
+    const Size end = (::cuda::std::min) (block * block_size + block_size, n);
+    for (Size i = block * block_size; i < end; ++i)
+    {
+      ++block_counts[digit(keys[i])];
+    }
+  });
+}
+
+// Replaces the counts by the position in the output where every block writes its keys of each
+// bucket. Returns false if all keys fall into the same bucket, in which case the pass can be skipped.
+template <typename Size>
+bool scan_counts(Size n, Size num_blocks, Size* counts)
+{
+  Size sum = 0;
+  for (int bucket = 0; bucket < num_buckets; ++bucket)
+  {
+    const Size bucket_begin = sum;
+    for (Size block = 0; block < num_blocks; ++block)
+    {
+      const Size count                      = counts[block * num_buckets + bucket];
+      counts[block * num_buckets + bucket] = sum;
+      sum += count;
+    }
+
+    if (sum - bucket_begin == n)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Moves the keys (and values) of every block to the positions computed by scan_counts. Each block
+// gathers its keys in small per-bucket buffers, and writes a buffer to the output once it is full.
+template <bool HasValues, typename KeyType, typename ValueType, bool Descending, typename Size, typename ParallelFor>
+void scatter(const KeyType* keys,
+             const ValueType* values,
+             Size n,
+             Size num_blocks,
+             Size block_size,
+             radix_digit<KeyType, Descending> digit,
+             Size* offsets,
+             KeyType* keys_result,
+             ValueType* values_result,
+             KeyType* keys_buffer,
+             ValueType* values_buffer,
+             ParallelFor parallel_for)
+{
+  constexpr int size = buffer_size<KeyType>;
+
+  parallel_for(num_blocks, [=](Size block) {
+    Size* block_offsets   = offsets + block * num_buckets;
+    KeyType* block_keys   = keys_buffer + block * num_buckets * size;
+    ValueType* block_vals = HasValues ? values_buffer + block * num_buckets * size : nullptr;
+
+    int fill[num_buckets] = {};
+
+    auto flush = [&](unsigned int bucket, int count) {
+      const Size out = block_offsets[bucket];
+      for (int j = 0; j < count; ++j)
+      {
+        keys_result[out + j] = block_keys[bucket * size + j];
+      }
+      if constexpr (HasValues)
+      {
+        for (int j = 0; j < count; ++j)
+        {
+          values_result[out + j] = block_vals[bucket * size + j];
+        }
+      }
+      block_offsets[bucket] = out + count;
+    };
+
+    const Size end = (::cuda::std::min) (block * block_size + block_size, n);
+    for (Size i = block * block_size; i < end; ++i)
+    {
+      const unsigned int bucket = digit(keys[i]);
+      const int j               = fill[bucket]++;
+
+      block_keys[bucket * size + j] = keys[i];
+      if constexpr (HasValues)
+      {
+        block_vals[bucket * size + j] = values[i];
+      }
+
+      if (j + 1 == size)
+      {
+        flush(bucket, size);
+        fill[bucket] = 0;
+      }
+    }
+
+    for (unsigned int bucket = 0; bucket < num_buckets; ++bucket)
+    {
+      flush(bucket, fill[bucket]);
+    }
+  });
+}
+} // namespace radix_sort_detail
+
+// True if a sort of [first, last) with comp can be done by stable_radix_sort
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+inline constexpr bool use_radix_sort =
+  thrust::is_contiguous_iterator_v<RandomAccessIterator>
+  && radix_sort_detail::is_radix_key_v<thrust::detail::it_value_t<RandomAccessIterator>>
+  && (::cuda::std::is_same_v<StrictWeakOrdering, ::cuda::std::less<thrust::detail::it_value_t<RandomAccessIterator>>>
+      || radix_sort_detail::is_descending_v<thrust::detail::it_value_t<RandomAccessIterator>, StrictWeakOrdering>);
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+inline constexpr bool use_radix_sort_by_key =
+  use_radix_sort<RandomAccessIterator1, StrictWeakOrdering> && thrust::is_contiguous_iterator_v<RandomAccessIterator2>
+  && ::cuda::std::is_trivially_copyable_v<thrust::detail::it_value_t<RandomAccessIterator2>>;
+
+// Sorts [keys, keys + n) and permutes [values, values + n) alongside if HasValues is true. The input is
+// split into num_blocks blocks, and parallel_for(num_blocks, f) must call f(block) for every block,
+// possibly in parallel. Every pass of eight bits counts the keys of each block per bucket, scans the
+// counts to find where each block writes the keys of a bucket, and scatters the keys to the other
+// of two buffers.
+template <bool HasValues,
+          typename StrictWeakOrdering,
+          typename DerivedPolicy,
+          typename KeyType,
+          typename ValueType,
+          typename Size,
+          typename ParallelFor>
+void stable_radix_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  KeyType* keys,
+  ValueType* values,
+  Size n,
+  Size num_blocks,
+  ParallelFor parallel_for)
+{
+  constexpr bool descending = radix_sort_detail::is_descending_v<KeyType, StrictWeakOrdering>;
+  constexpr int size        = radix_sort_detail::buffer_size<KeyType>;
+  constexpr int num_passes  = static_cast<int>(sizeof(KeyType) * 8 / radix_sort_detail::radix_bits);
+
+  const Size block_size = (n + num_blocks - 1) / num_blocks;
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> keys_temp(exec, n);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> values_temp(exec, HasValues ? n : 0);
+  thrust::detail::temporary_array<Size, DerivedPolicy> counts(exec, num_blocks * radix_sort_detail::num_buckets);
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> keys_buffer(
+    exec, num_blocks * radix_sort_detail::num_buckets * size);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> values_buffer(
+    exec, HasValues ? num_blocks * radix_sort_detail::num_buckets * size : 0);
+
+  KeyType* keys_src     = keys;
+  KeyType* keys_dst     = thrust::raw_pointer_cast(keys_temp.data());
+  ValueType* values_src = values;
+  ValueType* values_dst = thrust::raw_pointer_cast(values_temp.data());
+  Size* counts_ptr      = thrust::raw_pointer_cast(counts.data());
+
+  for (int pass = 0; pass < num_passes; ++pass)
+  {
+    const radix_sort_detail::radix_digit<KeyType, descending> digit{{}, pass * radix_sort_detail::radix_bits};
+
+    radix_sort_detail::histogram(keys_src, n, num_blocks, block_size, digit, counts_ptr, parallel_for);
+
+    if (!radix_sort_detail::scan_counts(n, num_blocks, counts_ptr))
+    {
+      continue;
+    }
+
+    radix_sort_detail::scatter<HasValues>(
+      keys_src,
+      values_src,
+      n,
+      num_blocks,
+      block_size,
+      digit,
+      counts_ptr,
+      keys_dst,
+      values_dst,
+      thrust::raw_pointer_cast(keys_buffer.data()),
+      thrust::raw_pointer_cast(values_buffer.data()),
+      parallel_for);
+
+    ::cuda::std::swap(keys_src, keys_dst);
+    ::cuda::std::swap(values_src, values_dst);
+  }
+
+  // the sorted keys are in the temporary storage after an odd number of passes
+  if (keys_src != keys)
+  {
+    parallel_for(num_blocks, [=](Size block) {
+      const Size end = (::cuda::std::min) (block * block_size + block_size, n);
+      for (Size i = block * block_size; i < end; ++i)
+      {
+        keys[i] = keys_src[i];
+        if constexpr (HasValues)
+        {
+          values[i] = values_src[i];
+        }
+      }
+    });
+  }
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -112,7 +112,8 @@ struct RadixEncoder<float>
       float f;
       std::uint32_t i;
     } u;
-    u.f                = x;
+    // -0.0 compares equal to +0.0 and must not be ordered before it
+    u.f                = x == float(0) ? float(0) : x;
     std::uint32_t mask = -static_cast<std::int32_t>(u.i >> 31) | (static_cast<std::uint32_t>(1) << 31);
     return u.i ^ mask;
   }
@@ -128,7 +129,8 @@ struct RadixEncoder<double>
       double f;
       std::uint64_t i;
     } u;
-    u.f                = x;
+    // -0.0 compares equal to +0.0 and must not be ordered before it
+    u.f                = x == double(0) ? double(0) : x;
     std::uint64_t mask = -static_cast<std::int64_t>(u.i >> 63) | (static_cast<std::uint64_t>(1) << 63);
     return u.i ^ mask;
   }
@@ -13,8 +13,14 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/copy_if.h>
+#include <thrust/copy.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/select.h>
+
+#include <cuda/std/__iterator/distance.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
@@ -32,8 +38,30 @@ OutputIterator copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  // omp prefers generic::copy_if to cpp::copy_if
-  return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
+  using IndexType = thrust::detail::it_difference_t<InputIterator1>;
+
+  const IndexType n          = ::cuda::std::distance(first, last);
+  const IndexType num_pieces = select_detail::num_pieces(n);
+
+  if (num_pieces <= 1)
+  {
+    return thrust::copy_if(thrust::seq, first, last, stencil, result, pred);
+  }
+
+  thrust::detail::wrapped_function<Predicate, bool> wrapped_pred{pred};
+
+  select_detail::selection<IndexType, DerivedPolicy> selection(exec, n, num_pieces);
+  const IndexType count = selection.flag([&](IndexType i) {
+    return wrapped_pred(stencil[i]);
+  });
+  selection.write([&](IndexType i, IndexType out, bool selected) {
+    if (selected)
+    {
+      result[out] = first[i];
+    }
+  });
+
+  return result + count;
 } // end copy_if()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
@@ -27,7 +27,8 @@ THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
 template <typename IndexType>
-thrust::system::detail::internal::uniform_decomposition<IndexType> default_decomposition(IndexType n)
+thrust::system::detail::internal::uniform_decomposition<IndexType>
+default_decomposition(IndexType n, IndexType granularity = 1)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -39,9 +40,9 @@ thrust::system::detail::internal::uniform_decomposition<IndexType> default_decom
     "OpenMP compiler support is not enabled");
 
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, omp_get_num_procs());
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, granularity, omp_get_num_procs());
 #else
-  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, 1);
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, granularity, 1);
 #endif
 }
 } // end namespace system::omp::detail
@@ -1,6 +1,10 @@
 // SPDX-FileCopyrightText: Copyright (c) 2008-2013, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+/*! \file merge.h
+ *  \brief OpenMP implementations of merge algorithms.
+ */
+
 #pragma once
 
 #include <thrust/detail/config.h>
@@ -13,5 +17,136 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits merge
-#include <thrust/system/cpp/detail/merge.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/merge.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace merge_detail
+{
+// Splitting work into pieces smaller than this costs more in synchronization than it gains
+inline constexpr int min_elements_per_thread = 1 << 13;
+} // namespace merge_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator
+merge(execution_policy<DerivedPolicy>&,
+      InputIterator1 first1,
+      InputIterator1 last1,
+      InputIterator2 first2,
+      InputIterator2 last2,
+      OutputIterator result,
+      StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  using IndexType = thrust::detail::it_difference_t<InputIterator1>;
+
+  const IndexType n1 = ::cuda::std::distance(first1, last1);
+  const IndexType n2 = ::cuda::std::distance(first2, last2);
+
+  // every thread merges an equally sized piece of the output, whose inputs are found by searching
+  // the merge path at both ends of the piece
+  const auto decomp = omp::detail::default_decomposition<IndexType>(n1 + n2, merge_detail::min_elements_per_thread);
+  const IndexType num_pieces = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (IndexType p = 0; p < num_pieces; ++p)
+  {
+    const IndexType begin  = decomp[p].begin();
+    const IndexType end    = decomp[p].end();
+    const IndexType begin1 = system::detail::internal::merge_path_search(begin, first1, n1, first2, n2, comp);
+    const IndexType end1   = system::detail::internal::merge_path_search(end, first1, n1, first2, n2, comp);
+
+    thrust::merge(
+      thrust::seq, first1 + begin1, first1 + end1, first2 + (begin - begin1), first2 + (end - end1), result + begin, comp);
+  }
+
+  return result + (n1 + n2);
+} // end merge()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+::cuda::std::pair<OutputIterator1, OutputIterator2> merge_by_key(
+  execution_policy<DerivedPolicy>&,
+  InputIterator1 keys_first1,
+  InputIterator1 keys_last1,
+  InputIterator2 keys_first2,
+  InputIterator2 keys_last2,
+  InputIterator3 values_first1,
+  InputIterator4 values_first2,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  using IndexType = thrust::detail::it_difference_t<InputIterator1>;
+
+  const IndexType n1 = ::cuda::std::distance(keys_first1, keys_last1);
+  const IndexType n2 = ::cuda::std::distance(keys_first2, keys_last2);
+
+  const auto decomp = omp::detail::default_decomposition<IndexType>(n1 + n2, merge_detail::min_elements_per_thread);
+  const IndexType num_pieces = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (IndexType p = 0; p < num_pieces; ++p)
+  {
+    const IndexType begin  = decomp[p].begin();
+    const IndexType end    = decomp[p].end();
+    const IndexType begin1 = system::detail::internal::merge_path_search(begin, keys_first1, n1, keys_first2, n2, comp);
+    const IndexType end1   = system::detail::internal::merge_path_search(end, keys_first1, n1, keys_first2, n2, comp);
+    const IndexType begin2 = begin - begin1;
+    const IndexType end2   = end - end1;
+
+    thrust::merge_by_key(
+      thrust::seq,
+      keys_first1 + begin1,
+      keys_first1 + end1,
+      keys_first2 + begin2,
+      keys_first2 + end2,
+      values_first1 + begin1,
+      values_first2 + begin2,
+      keys_result + begin,
+      values_result + begin,
+      comp);
+  }
+
+  return ::cuda::std::make_pair(keys_result + (n1 + n2), values_result + (n1 + n2));
+} // end merge_by_key()
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
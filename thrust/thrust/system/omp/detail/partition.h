@@ -17,22 +17,23 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/partition.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/partition.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/select.h>
 
+#include <cuda/std/__iterator/distance.h>
 #include <cuda/std/__utility/pair.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
-template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
-ForwardIterator
-stable_partition(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
-{
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, pred);
-} // end stable_partition()
-
+// Every element is moved to its final position in a temporary buffer, the elements that satisfy the
+// predicate in front of the ones that don't, and from there back to the input range.
 template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
 ForwardIterator stable_partition(
   execution_policy<DerivedPolicy>& exec,
@@ -41,44 +42,105 @@ ForwardIterator stable_partition(
   InputIterator stencil,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
+  using IndexType = thrust::detail::it_difference_t<ForwardIterator>;
+  using ValueType = thrust::detail::it_value_t<ForwardIterator>;
+
+  const IndexType n          = ::cuda::std::distance(first, last);
+  const IndexType num_pieces = select_detail::num_pieces(n);
+
+  if (num_pieces <= 1)
+  {
+    return thrust::stable_partition(thrust::seq, first, last, stencil, pred);
+  }
+
+  thrust::detail::wrapped_function<Predicate, bool> wrapped_pred{pred};
+
+  select_detail::selection<IndexType, DerivedPolicy> selection(exec, n, num_pieces);
+  const IndexType count = selection.flag([&](IndexType i) {
+    return wrapped_pred(stencil[i]);
+  });
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> partitioned(0, exec, n);
+  ValueType* buffer = thrust::raw_pointer_cast(partitioned.data());
+  selection.write([&](IndexType i, IndexType out, bool selected) {
+    select_detail::move_construct(buffer + (selected ? out : count + i - out), first[i]);
+  });
+  select_detail::move_back(buffer, n, first);
+
+  return first + count;
+} // end stable_partition()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
+ForwardIterator
+stable_partition(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
+{
+  // the sequential implementation does not support a stencil overlapping the input
+  if (select_detail::num_pieces(::cuda::std::distance(first, last)) <= 1)
+  {
+    return thrust::stable_partition(thrust::seq, first, last, pred);
+  }
+  return omp::detail::stable_partition(exec, first, last, first, pred);
 } // end stable_partition()
 
 template <typename DerivedPolicy,
-          typename InputIterator,
+          typename InputIterator1,
+          typename InputIterator2,
           typename OutputIterator1,
           typename OutputIterator2,
           typename Predicate>
 ::cuda::std::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   execution_policy<DerivedPolicy>& exec,
-  InputIterator first,
-  InputIterator last,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
   OutputIterator1 out_true,
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  using IndexType = thrust::detail::it_difference_t<InputIterator1>;
+
+  const IndexType n          = ::cuda::std::distance(first, last);
+  const IndexType num_pieces = select_detail::num_pieces(n);
+
+  if (num_pieces <= 1)
+  {
+    return thrust::stable_partition_copy(thrust::seq, first, last, stencil, out_true, out_false, pred);
+  }
+
+  thrust::detail::wrapped_function<Predicate, bool> wrapped_pred{pred};
+
+  select_detail::selection<IndexType, DerivedPolicy> selection(exec, n, num_pieces);
+  const IndexType count = selection.flag([&](IndexType i) {
+    return wrapped_pred(stencil[i]);
+  });
+  selection.write([&](IndexType i, IndexType out, bool selected) {
+    if (selected)
+    {
+      out_true[out] = first[i];
+    }
+    else
+    {
+      out_false[i - out] = first[i];
+    }
+  });
+
+  return ::cuda::std::make_pair(out_true + count, out_false + (n - count));
 } // end stable_partition_copy()
 
 template <typename DerivedPolicy,
-          typename InputIterator1,
-          typename InputIterator2,
+          typename InputIterator,
           typename OutputIterator1,
           typename OutputIterator2,
           typename Predicate>
 ::cuda::std::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   execution_policy<DerivedPolicy>& exec,
-  InputIterator1 first,
-  InputIterator1 last,
-  InputIterator2 stencil,
+  InputIterator first,
+  InputIterator last,
   OutputIterator1 out_true,
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  return omp::detail::stable_partition_copy(exec, first, last, first, out_true, out_false, pred);
 } // end stable_partition_copy()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
@@ -17,12 +17,54 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/reduce.h>
+#include <thrust/system/detail/internal/decompose.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/pair.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+namespace reduce_by_key_detail
+{
+// Splitting work into pieces smaller than this costs more in synchronization than it gains
+inline constexpr int min_elements_per_thread = 1 << 13;
+
+template <typename IndexType>
+IndexType num_pieces(IndexType n)
+{
+  // Avoid issues on compilers that don't provide `omp_get_max_threads()`.
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const IndexType max_pieces = (n + min_elements_per_thread - 1) / min_elements_per_thread;
+  return (::cuda::std::min) (static_cast<IndexType>(omp_get_max_threads()), max_pieces);
+#else
+  return 1;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+} // namespace reduce_by_key_detail
+
+// Every thread owns a piece of the input. A first pass over the keys counts the segments starting in
+// every piece and reduces the values in front of the first segment head of the piece, which belong
+// to a segment started in a preceding piece. A sequential scan over the pieces turns the counts into
+// output positions and combines these leading reductions into a carry for the last segment of every
+// piece. In the second pass, every thread reduces the segments starting in its piece, adds the carry
+// to its last one and writes them straight to their final positions, so the values are read only
+// once and no temporary storage proportional to the input is needed.
 template <typename DerivedPolicy,
           typename InputIterator1,
           typename InputIterator2,
@@ -40,9 +82,141 @@ template <typename DerivedPolicy,
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
-  // omp prefers generic::reduce_by_key to cpp::reduce_by_key
-  return thrust::system::detail::generic::reduce_by_key(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  using IndexType = thrust::detail::it_difference_t<InputIterator1>;
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = thrust::detail::it_value_t<InputIterator2>;
+
+  const IndexType n          = ::cuda::std::distance(keys_first, keys_last);
+  const IndexType num_pieces = reduce_by_key_detail::num_pieces(n);
+
+  if (num_pieces <= 1)
+  {
+    return thrust::reduce_by_key(
+      thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+
+  thrust::detail::wrapped_function<BinaryPredicate, bool> pred{binary_pred};
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> op{binary_op};
+
+  const thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, 1, num_pieces);
+
+  // for every piece, the position of its first segment head and the output position of that segment
+  thrust::detail::temporary_array<IndexType, DerivedPolicy> indices(exec, 2 * num_pieces + 1);
+  IndexType* first_head = thrust::raw_pointer_cast(indices.data());
+  IndexType* offsets    = first_head + num_pieces;
+
+  // for every piece, the reduction of the values in front of its first segment head, and then the
+  // carry into its last segment
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> leads(exec, num_pieces);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, num_pieces);
+  ValueType* lead  = thrust::raw_pointer_cast(leads.data());
+  ValueType* carry = thrust::raw_pointer_cast(carries.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (IndexType p = 0; p < num_pieces; ++p)
+  {
+    const IndexType begin = decomp[p].begin();
+    const IndexType end   = decomp[p].end();
+
+    IndexType i = begin;
+    if (p != 0 && pred(keys_first[begin - 1], keys_first[begin]))
+    {
+      ValueType sum = values_first[begin];
+      for (++i; i < end && pred(keys_first[i - 1], keys_first[i]); ++i)
+      {
+        sum = op(sum, values_first[i]);
+      }
+      lead[p] = sum;
+    }
+    first_head[p] = i;
+
+    IndexType count = 0;
+    if (i < end)
+    {
+      for (++count, ++i; i < end; ++i)
+      {
+        count += !pred(keys_first[i - 1], keys_first[i]);
+      }
+    }
+    offsets[p] = count;
+  }
+
+  // a piece has a carry if the next one does not start with a segment head
+  auto has_carry = [&](IndexType p) {
+    return p + 1 < num_pieces && first_head[p + 1] != decomp[p + 1].begin();
+  };
+
+  IndexType sum = 0;
+  for (IndexType p = 0; p < num_pieces; ++p)
+  {
+    const IndexType count = offsets[p];
+    offsets[p]            = sum;
+    sum += count;
+  }
+  offsets[num_pieces] = sum;
+
+  // the carry of a piece is the lead of the next piece, continued by the carry of that piece if no
+  // segment starts in it
+  for (IndexType p = num_pieces - 1; p-- > 0;)
+  {
+    if (has_carry(p))
+    {
+      const IndexType next = p + 1;
+      carry[p]             = lead[next];
+      if (first_head[next] == decomp[next].end() && has_carry(next))
+      {
+        carry[p] = op(carry[p], carry[next]);
+      }
+    }
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (IndexType p = 0; p < num_pieces; ++p)
+  {
+    const IndexType end = decomp[p].end();
+    IndexType i         = first_head[p];
+    if (i == end)
+    {
+      continue;
+    }
+
+    IndexType out  = offsets[p];
+    IndexType head = i;
+    ValueType sum  = values_first[i];
+    for (++i; i < end; ++i)
+    {
+      if (pred(keys_first[i - 1], keys_first[i]))
+      {
+        sum = op(sum, values_first[i]);
+      }
+      else
+      {
+        keys_output[out]   = keys_first[head];
+        values_output[out] = sum;
+        ++out;
+        head = i;
+        sum  = values_first[i];
+      }
+    }
+
+    if (has_carry(p))
+    {
+      sum = op(sum, carry[p]);
+    }
+    keys_output[out]   = keys_first[head];
+    values_output[out] = sum;
+  }
+
+  return ::cuda::std::make_pair(keys_output + offsets[num_pieces], values_output + offsets[num_pieces]);
 } // end reduce_by_key()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
@@ -13,20 +13,24 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/remove.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/remove.h>
+#include <thrust/system/omp/detail/copy_if.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/select.h>
+
+#include <cuda/std/__functional/not_fn.h>
+#include <cuda/std/__iterator/distance.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
-template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
-ForwardIterator
-remove_if(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
-{
-  // omp prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, pred);
-}
-
+// The elements that are kept are moved to a temporary buffer at their final positions, and from there back
+// to the input range, as a piece cannot be compacted in place while preceding pieces are still being read.
 template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
 ForwardIterator remove_if(
   execution_policy<DerivedPolicy>& exec,
@@ -35,16 +39,47 @@ ForwardIterator remove_if(
   InputIterator stencil,
   Predicate pred)
 {
-  // omp prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, stencil, pred);
+  using IndexType = thrust::detail::it_difference_t<ForwardIterator>;
+  using ValueType = thrust::detail::it_value_t<ForwardIterator>;
+
+  const IndexType n          = ::cuda::std::distance(first, last);
+  const IndexType num_pieces = select_detail::num_pieces(n);
+
+  if (num_pieces <= 1)
+  {
+    return thrust::remove_if(thrust::seq, first, last, stencil, pred);
+  }
+
+  thrust::detail::wrapped_function<Predicate, bool> wrapped_pred{pred};
+
+  select_detail::selection<IndexType, DerivedPolicy> selection(exec, n, num_pieces);
+  const IndexType count = selection.flag([&](IndexType i) {
+    return !wrapped_pred(stencil[i]);
+  });
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> kept(0, exec, count);
+  ValueType* buffer = thrust::raw_pointer_cast(kept.data());
+  selection.write([&](IndexType i, IndexType out, bool selected) {
+    if (selected)
+    {
+      select_detail::move_construct(buffer + out, first[i]);
+    }
+  });
+  select_detail::move_back(buffer, count, first);
+
+  return first + count;
 }
 
-template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Predicate>
-OutputIterator remove_copy_if(
-  execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, OutputIterator result, Predicate pred)
+template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
+ForwardIterator
+remove_if(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
 {
-  // omp prefers generic::remove_copy_if to cpp::remove_copy_if
-  return thrust::system::detail::generic::remove_copy_if(exec, first, last, result, pred);
+  // the sequential implementation does not support a stencil overlapping the input
+  if (select_detail::num_pieces(::cuda::std::distance(first, last)) <= 1)
+  {
+    return thrust::remove_if(thrust::seq, first, last, pred);
+  }
+  return omp::detail::remove_if(exec, first, last, first, pred);
 }
 
 template <typename DerivedPolicy,
@@ -60,8 +95,14 @@ OutputIterator remove_copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  // omp prefers generic::remove_copy_if to cpp::remove_copy_if
-  return thrust::system::detail::generic::remove_copy_if(exec, first, last, stencil, result, pred);
+  return omp::detail::copy_if(exec, first, last, stencil, result, ::cuda::std::not_fn(pred));
+}
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Predicate>
+OutputIterator remove_copy_if(
+  execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, OutputIterator result, Predicate pred)
+{
+  return omp::detail::remove_copy_if(exec, first, last, first, result, pred);
 }
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
@@ -15,12 +15,15 @@
 
 // OMP parallel scan implementation
 #include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/execution_policy.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
 
 #include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__functional/invoke.h>
 #include <cuda/std/__iterator/advance.h>
 #include <cuda/std/__iterator/distance.h>
@@ -29,6 +32,9 @@
 #include <cuda/std/__numeric/reduce.h>
 #include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/atomic>
+
+#include <thread>
 
 #include <omp.h>
 
@@ -42,6 +48,177 @@ struct __no_init_tag
 // Benchmarking shows parallel overhead dominates for small arrays
 inline constexpr size_t parallel_scan_threshold = 1024;
 
+// Size of the input of a tile, chosen such that a tile is still in the cache when it is read the
+// second time
+inline constexpr size_t scan_tile_bytes = 1 << 16;
+
+namespace scan_detail
+{
+// Progress of a tile, published after its aggregate or inclusive prefix has been written
+enum tile_status : int
+{
+  tile_invalid,
+  tile_aggregate,
+  tile_prefix
+};
+
+// Scans [first, first + n) into result, starting from prefix if HasPrefix is true. Returns the
+// reduction of prefix and the whole tile.
+template <bool IsInclusive,
+          bool HasPrefix,
+          typename AccumT,
+          typename InputIterator,
+          typename OutputIterator,
+          typename Size,
+          typename BinaryFunction>
+AccumT scan_tile(InputIterator first, Size n, OutputIterator result, AccumT prefix, BinaryFunction binary_op)
+{
+  Size i = 0;
+  if constexpr (!HasPrefix)
+  {
+    prefix = *first;
+    if constexpr (IsInclusive)
+    {
+      *result = prefix;
+    }
+    i = 1;
+  }
+
+  for (; i < n; ++i)
+  {
+    // read before writing, the scan may be in place
+    const AccumT value = first[i];
+    if constexpr (IsInclusive)
+    {
+      prefix    = binary_op(prefix, value);
+      result[i] = prefix;
+    }
+    else
+    {
+      result[i] = prefix;
+      prefix    = binary_op(prefix, value);
+    }
+  }
+  return prefix;
+}
+
+// Single pass scan. The input is split into cache sized tiles, which the threads of the team claim
+// in order. A thread reduces its tile and publishes the aggregate, then looks back over the status
+// of the preceding tiles until it finds one with a published inclusive prefix, combining the
+// aggregates it passes on the way. It publishes its own inclusive prefix for its successors and
+// finally scans the tile, which is still in the cache, starting from the exclusive prefix. If the
+// predecessor has already published its inclusive prefix when the tile is claimed, the reduction is
+// skipped and the tile is read only once.
+template <bool IsInclusive,
+          bool HasInit,
+          typename DerivedPolicy,
+          typename AccumT,
+          typename InputIterator,
+          typename OutputIterator,
+          typename Size,
+          typename BinaryFunction>
+void decoupled_lookback_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  Size n,
+  OutputIterator result,
+  [[maybe_unused]] AccumT init,
+  BinaryFunction binary_op,
+  int num_threads)
+{
+  const Size tile_size = (::cuda::std::max) (Size(1), static_cast<Size>(scan_tile_bytes / sizeof(AccumT)));
+  const Size num_tiles = ::cuda::ceil_div(n, tile_size);
+
+  thrust::detail::temporary_array<int, DerivedPolicy> status(exec, num_tiles);
+  thrust::detail::temporary_array<AccumT, DerivedPolicy> aggregates(exec, num_tiles);
+  thrust::detail::temporary_array<AccumT, DerivedPolicy> prefixes(exec, num_tiles);
+
+  int* status_ptr     = thrust::raw_pointer_cast(status.data());
+  AccumT* aggregate   = thrust::raw_pointer_cast(aggregates.data());
+  AccumT* prefix      = thrust::raw_pointer_cast(prefixes.data());
+  Size next_tile      = 0;
+  const int team_size = static_cast<int>((::cuda::std::min) (static_cast<Size>(num_threads), num_tiles));
+
+  for (Size tile = 0; tile < num_tiles; ++tile)
+  {
+    status_ptr[tile] = tile_invalid;
+  }
+
+  THRUST_PRAGMA_OMP(parallel num_threads(team_size))
+  {
+    while (true)
+    {
+      const Size tile = ::cuda::std::atomic_ref<Size>(next_tile).fetch_add(1, ::cuda::std::memory_order_relaxed);
+      if (tile >= num_tiles)
+      {
+        break;
+      }
+
+      const Size start = tile * tile_size;
+      const Size count = (::cuda::std::min) (tile_size, n - start);
+
+      ::cuda::std::atomic_ref<int> tile_status(status_ptr[tile]);
+
+      if (tile == 0)
+      {
+        if constexpr (HasInit)
+        {
+          prefix[0] = scan_tile<IsInclusive, true>(first, count, result, init, binary_op);
+        }
+        else
+        {
+          prefix[0] = scan_tile<IsInclusive, false>(first, count, result, init, binary_op);
+        }
+        tile_status.store(tile_prefix, ::cuda::std::memory_order_release);
+        continue;
+      }
+
+      ::cuda::std::atomic_ref<int> predecessor(status_ptr[tile - 1]);
+      if (predecessor.load(::cuda::std::memory_order_acquire) == tile_prefix)
+      {
+        prefix[tile] = scan_tile<IsInclusive, true>(first + start, count, result + start, prefix[tile - 1], binary_op);
+        tile_status.store(tile_prefix, ::cuda::std::memory_order_release);
+        continue;
+      }
+
+      const AccumT reduction =
+        ::cuda::std::reduce(first + start + 1, first + start + count, AccumT(first[start]), binary_op);
+      aggregate[tile] = reduction;
+      tile_status.store(tile_aggregate, ::cuda::std::memory_order_release);
+
+      auto wait = [&](Size look) {
+        ::cuda::std::atomic_ref<int> look_status(status_ptr[look]);
+        int state = look_status.load(::cuda::std::memory_order_acquire);
+        for (int spin = 0; state == tile_invalid; ++spin)
+        {
+          if (spin >= 64)
+          {
+            std::this_thread::yield();
+          }
+          state = look_status.load(::cuda::std::memory_order_acquire);
+        }
+        return state;
+      };
+
+      // look back until a tile with an inclusive prefix is found
+      Size look        = tile - 1;
+      int state        = wait(look);
+      AccumT exclusive = state == tile_prefix ? prefix[look] : aggregate[look];
+      while (state != tile_prefix)
+      {
+        state     = wait(--look);
+        exclusive = binary_op(state == tile_prefix ? prefix[look] : aggregate[look], exclusive);
+      }
+
+      prefix[tile] = binary_op(exclusive, reduction);
+      tile_status.store(tile_prefix, ::cuda::std::memory_order_release);
+
+      scan_tile<IsInclusive, true>(first + start, count, result + start, exclusive, binary_op);
+    }
+  }
+}
+} // namespace scan_detail
+
 template <bool IsInclusive,
           typename DerivedPolicy,
           typename InputIterator,
@@ -95,76 +272,15 @@ OutputIterator scan_impl(
     }
   }
 
-  _CCCL_ASSERT(num_threads > 1, "Parallel scan requires multiple threads");
-
-  temporary_array<accum_t, DerivedPolicy> block_sums(exec, num_threads);
-
-  // Step 1: Reduce each block (N reads)
-  THRUST_PRAGMA_OMP(parallel num_threads(num_threads))
-  {
-    const int tid         = omp_get_thread_num();
-    const Size block_size = ::cuda::ceil_div(n, num_threads);
-    const Size start      = tid * block_size;
-    const Size end        = ::cuda::std::min(start + block_size, n);
-
-    if (start < n)
-    {
-      // For both has_init and no-init cases: reduce each block using first element as init
-      accum_t first_elem = *(first + start);
-      block_sums[tid]    = ::cuda::std::reduce(first + start + 1, first + end, first_elem, wrapped_binary_op);
-    }
-  }
-
-  // Step 2: Scan block sums
   if constexpr (has_init)
   {
-    ::cuda::std::exclusive_scan(block_sums.begin(), block_sums.end(), block_sums.begin(), init, wrapped_binary_op);
+    scan_detail::decoupled_lookback_scan<IsInclusive, true>(
+      exec, first, n, result, accum_t(init), wrapped_binary_op, num_threads);
   }
   else
   {
-    // For no init inclusive scan: exclusive_scan starting at second element with first element as init
-    accum_t first_block_sum = block_sums[0];
-    ::cuda::std::exclusive_scan(
-      block_sums.begin() + 1, block_sums.end(), block_sums.begin() + 1, first_block_sum, wrapped_binary_op);
-  }
-
-  // Step 3: Scan each block with offset (N reads/writes)
-  THRUST_PRAGMA_OMP(parallel num_threads(num_threads))
-  {
-    const int tid         = omp_get_thread_num();
-    const Size block_size = ::cuda::ceil_div(n, num_threads);
-    const Size start      = tid * block_size;
-    const Size end        = ::cuda::std::min(start + block_size, n);
-
-    if (start < n)
-    {
-      if constexpr (IsInclusive)
-      {
-        if constexpr (has_init)
-        {
-          const accum_t prefix = block_sums[tid];
-          ::cuda::std::inclusive_scan(first + start, first + end, result + start, wrapped_binary_op, prefix);
-        }
-        else
-        {
-          // For no init: thread 0 has no prefix, others use block_sums
-          if (tid == 0)
-          {
-            ::cuda::std::inclusive_scan(first + start, first + end, result + start, wrapped_binary_op);
-          }
-          else
-          {
-            const accum_t prefix = block_sums[tid];
-            ::cuda::std::inclusive_scan(first + start, first + end, result + start, wrapped_binary_op, prefix);
-          }
-        }
-      }
-      else
-      {
-        const accum_t prefix = block_sums[tid];
-        ::cuda::std::exclusive_scan(first + start, first + end, result + start, prefix, wrapped_binary_op);
-      }
-    }
+    scan_detail::decoupled_lookback_scan<IsInclusive, false>(
+      exec, first, n, result, accum_t(*first), wrapped_binary_op, num_threads);
   }
 
   return result + n;
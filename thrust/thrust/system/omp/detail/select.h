@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file select.h
+ *  \brief Single-pass stream compaction shared by the OpenMP implementations of copy_if, remove, unique and
+ *         partition.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/cstdint>
+
+#include <new>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace select_detail
+{
+// Splitting work into pieces smaller than this costs more in synchronization than it gains
+inline constexpr int min_elements_per_thread = 1 << 13;
+
+template <typename IndexType>
+IndexType num_pieces(IndexType n)
+{
+  // Avoid issues on compilers that don't provide `omp_get_max_threads()`.
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const IndexType max_pieces = (n + min_elements_per_thread - 1) / min_elements_per_thread;
+  return (::cuda::std::min) (static_cast<IndexType>(omp_get_max_threads()), max_pieces);
+#else
+  return 1;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+using mask_word                    = ::cuda::std::uint64_t;
+inline constexpr int bits_per_word = 64;
+
+// Every thread owns a piece of the input. The first pass evaluates the selection flag of every element of
+// the piece exactly once, caches it in a bitmask and counts the selected elements. A sequential scan over
+// the pieces turns the counts into output positions, from which the second pass writes the elements of
+// every piece straight to their final positions. Compared to materializing a flag and a scatter index per
+// element, only one bit per element is stored and the input is read just once per pass.
+//
+// Pieces are multiples of the word size, so no two threads write to the same word of the bitmask.
+template <typename IndexType, typename DerivedPolicy>
+class selection
+{
+public:
+  selection(execution_policy<DerivedPolicy>& exec, IndexType n, IndexType num_pieces)
+      : m_decomp(n, bits_per_word, num_pieces)
+      , m_masks(0, exec, (n + bits_per_word - 1) / bits_per_word)
+      , m_offsets(0, exec, m_decomp.size() + 1)
+  {}
+
+  // Evaluates flag(i) for every i in [0, n) and returns the number of selected elements
+  template <typename Flag>
+  IndexType flag(Flag flag)
+  {
+    const IndexType pieces = m_decomp.size();
+    mask_word* masks       = thrust::raw_pointer_cast(m_masks.data());
+    IndexType* offsets     = thrust::raw_pointer_cast(m_offsets.data());
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for (IndexType p = 0; p < pieces; ++p)
+    {
+      const IndexType end = m_decomp[p].end();
+      IndexType count     = 0;
+      for (IndexType w = m_decomp[p].begin(); w < end; w += bits_per_word)
+      {
+        const IndexType last = (::cuda::std::min) (static_cast<IndexType>(w + bits_per_word), end);
+        mask_word bits       = 0;
+        for (IndexType i = w; i < last; ++i)
+        {
+          const bool selected = flag(i);
+          bits |= mask_word{selected} << (i - w);
+          count += selected;
+        }
+        masks[w / bits_per_word] = bits;
+      }
+      offsets[p] = count;
+    }
+
+    IndexType sum = 0;
+    for (IndexType p = 0; p < pieces; ++p)
+    {
+      const IndexType count = offsets[p];
+      offsets[p]            = sum;
+      sum += count;
+    }
+    offsets[pieces] = sum;
+    return sum;
+  }
+
+  // Invokes write(i, out, selected) for every i in [0, n), where out is the number of selected elements in
+  // front of i. Must be preceded by flag().
+  template <typename Write>
+  void write(Write write) const
+  {
+    const IndexType pieces   = m_decomp.size();
+    const mask_word* masks   = thrust::raw_pointer_cast(m_masks.data());
+    const IndexType* offsets = thrust::raw_pointer_cast(m_offsets.data());
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for (IndexType p = 0; p < pieces; ++p)
+    {
+      const IndexType end = m_decomp[p].end();
+      IndexType out       = offsets[p];
+      for (IndexType w = m_decomp[p].begin(); w < end; w += bits_per_word)
+      {
+        const IndexType last = (::cuda::std::min) (static_cast<IndexType>(w + bits_per_word), end);
+        const mask_word bits = masks[w / bits_per_word];
+        for (IndexType i = w; i < last; ++i)
+        {
+          const bool selected = (bits >> (i - w)) & 1;
+          write(i, out, selected);
+          out += selected;
+        }
+      }
+    }
+  }
+
+private:
+  thrust::system::detail::internal::uniform_decomposition<IndexType> m_decomp;
+  thrust::detail::temporary_array<mask_word, DerivedPolicy> m_masks;
+  thrust::detail::temporary_array<IndexType, DerivedPolicy> m_offsets;
+};
+
+// Moves an element into uninitialized storage of a temporary buffer
+template <typename T, typename Reference>
+void move_construct(T* p, Reference&& ref)
+{
+  ::new (static_cast<void*>(p)) T(::cuda::std::move(ref));
+}
+
+// Moves the n elements of a buffer back into the range starting at result
+template <typename T, typename IndexType, typename OutputIterator>
+void move_back(T* buffer, IndexType n, OutputIterator result)
+{
+  THRUST_PRAGMA_OMP(parallel for)
+  for (IndexType i = 0; i < n; ++i)
+  {
+    result[i] = ::cuda::std::move(buffer[i]);
+  }
+}
+} // namespace select_detail
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
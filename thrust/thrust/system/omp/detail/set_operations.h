@@ -1,6 +1,10 @@
 // SPDX-FileCopyrightText: Copyright (c) 2008-2013, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+/*! \file set_operations.h
+ *  \brief OpenMP implementations of set operations.
+ */
+
 #pragma once
 
 #include <thrust/detail/config.h>
@@ -13,5 +17,219 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits set_operations
-#include <thrust/system/cpp/detail/set_operations.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/set_operations.h>
+#include <thrust/system/detail/generic/sequential_set_operations.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace set_operations_detail
+{
+using thrust::system::detail::generic::sequential_set_difference_fn;
+using thrust::system::detail::generic::sequential_set_intersection_fn;
+using thrust::system::detail::generic::sequential_set_symmetric_difference_fn;
+using thrust::system::detail::generic::sequential_set_union_fn;
+
+// The input ranges are split along their merge path into one piece per thread, such that no run of
+// equivalent elements straddles two pieces. The sequential set operation is then applied to every
+// piece twice: once to count its output, and once more after a scan over the counts has determined
+// where the output of each piece starts.
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+OutputIterator set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  SetOperation set_op)
+{
+  using IndexType = thrust::detail::it_difference_t<InputIterator1>;
+
+  const IndexType n1 = ::cuda::std::distance(first1, last1);
+  const IndexType n2 = ::cuda::std::distance(first2, last2);
+
+  const auto decomp = omp::detail::default_decomposition<IndexType>(n1 + n2, merge_detail::min_elements_per_thread);
+  const IndexType num_pieces = decomp.size();
+
+  if (num_pieces <= 1)
+  {
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  // for every piece boundary, the positions in both inputs and the position in the output
+  thrust::detail::temporary_array<IndexType, DerivedPolicy> temp(exec, 3 * (num_pieces + 1));
+  IndexType* splits1 = thrust::raw_pointer_cast(temp.data());
+  IndexType* splits2 = splits1 + (num_pieces + 1);
+  IndexType* offsets = splits2 + (num_pieces + 1);
+
+  splits1[num_pieces] = n1;
+  splits2[num_pieces] = n2;
+  offsets[0]          = 0;
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (IndexType p = 0; p < num_pieces; ++p)
+  {
+    const auto split = system::detail::internal::balanced_path_search(decomp[p].begin(), first1, n1, first2, n2, comp);
+    splits1[p]       = split.first;
+    splits2[p]       = split.second;
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (IndexType p = 0; p < num_pieces; ++p)
+  {
+    const auto discard = thrust::make_discard_iterator();
+    offsets[p + 1] =
+      set_op(first1 + splits1[p], first1 + splits1[p + 1], first2 + splits2[p], first2 + splits2[p + 1], discard, comp)
+      - discard;
+  }
+
+  for (IndexType p = 0; p < num_pieces; ++p)
+  {
+    offsets[p + 1] += offsets[p];
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (IndexType p = 0; p < num_pieces; ++p)
+  {
+    set_op(first1 + splits1[p],
+           first1 + splits1[p + 1],
+           first2 + splits2[p],
+           first2 + splits2[p + 1],
+           result + offsets[p],
+           comp);
+  }
+
+  return result + offsets[num_pieces];
+}
+} // namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::sequential_set_difference_fn{});
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::sequential_set_intersection_fn{});
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::sequential_set_symmetric_difference_fn{});
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::sequential_set_union_fn{});
+} // end set_union()
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
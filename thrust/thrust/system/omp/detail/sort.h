@@ -20,59 +20,141 @@
 #  include <omp.h>
 #endif // omp support
 
+#include <thrust/copy.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/internal/radix_sort.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/type_traits/unwrap_contiguous_iterator.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
 namespace sort_detail
 {
-template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void inplace_merge(execution_policy<DerivedPolicy>& exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
+// Merges every pair of adjacent sorted runs of length run in [0, n), restricted to the part of the
+// output in [begin, end). The inputs of that part are found by searching the merge path of each pair
+// in keys, and merge(first1, last1, first2, last2, result) is called with the positions of the
+// inputs and the output for every pair the part overlaps.
+template <typename IndexType, typename RandomAccessIterator, typename StrictWeakOrdering, typename MergeFunction>
+void merge_runs(
+  IndexType n,
+  IndexType run,
+  IndexType begin,
+  IndexType end,
+  RandomAccessIterator keys,
+  StrictWeakOrdering comp,
+  MergeFunction merge)
 {
-  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  for (IndexType lo = begin - begin % (2 * run); lo < end; lo += 2 * run)
+  {
+    const IndexType mid = (::cuda::std::min) (lo + run, n);
+    const IndexType hi  = (::cuda::std::min) (mid + run, n);
 
-  thrust::detail::temporary_array<value_type, DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type, DerivedPolicy> b(exec, middle, last);
+    const IndexType first = (::cuda::std::max) (begin, lo) - lo;
+    const IndexType last  = (::cuda::std::min) (end, hi) - lo;
 
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+    const IndexType first1 =
+      system::detail::internal::merge_path_search(first, keys + lo, mid - lo, keys + mid, hi - mid, comp);
+    const IndexType last1 =
+      system::detail::internal::merge_path_search(last, keys + lo, mid - lo, keys + mid, hi - mid, comp);
+
+    merge(lo + first1, lo + last1, mid + (first - first1), mid + (last - last1), lo + first);
+  }
 }
 
-template <typename DerivedPolicy,
-          typename RandomAccessIterator1,
-          typename RandomAccessIterator2,
-          typename StrictWeakOrdering>
-void inplace_merge_by_key(
-  execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator1 first1,
-  RandomAccessIterator1 middle1,
-  RandomAccessIterator1 last1,
-  RandomAccessIterator2 first2,
-  StrictWeakOrdering comp)
+// Sorts [0, n) by sorting num_tiles tiles independently and then merging pairs of runs until a single
+// run is left. The runs are merged back and forth between the input and a buffer, and every merge
+// level is split evenly across all threads. sort_tile(begin, end) sorts the input in [begin, end),
+// merge_level(from_buffer, run, begin, end) calls merge_runs in the given direction, and
+// copy_back(begin, end) copies the buffer to the input if the last merge level ended up there.
+template <typename IndexType, typename SortTile, typename MergeLevel, typename CopyBack>
+void merge_sort(IndexType n, IndexType num_tiles, SortTile sort_tile, MergeLevel merge_level, CopyBack copy_back)
 {
-  using value_type1 = thrust::detail::it_value_t<RandomAccessIterator1>;
-  using value_type2 = thrust::detail::it_value_t<RandomAccessIterator2>;
+  // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const IndexType tile = (n + num_tiles - 1) / num_tiles;
+
+  THRUST_PRAGMA_OMP(parallel)
+  {
+    const IndexType num_threads = omp_get_num_threads();
+    const IndexType p_i         = omp_get_thread_num();
+
+    for (IndexType t = p_i; t < num_tiles; t += num_threads)
+    {
+      sort_tile(t * tile, (::cuda::std::min) (t * tile + tile, n));
+    }
+
+    // every thread produces an equal share of the output of each merge level
+    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, 1, num_threads);
+
+    bool in_buffer = false;
+    for (IndexType run = tile; run < n; run *= 2)
+    {
+      THRUST_PRAGMA_OMP(barrier)
+
+      // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
+      ;
 
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1 - first1);
+      if (p_i < decomp.size())
+      {
+        merge_level(in_buffer, run, decomp[p_i].begin(), decomp[p_i].end());
+      }
+      in_buffer = !in_buffer;
+    }
+
+    if (in_buffer)
+    {
+      THRUST_PRAGMA_OMP(barrier)
+
+      // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
+      ;
+
+      if (p_i < decomp.size())
+      {
+        copy_back(decomp[p_i].begin(), decomp[p_i].end());
+      }
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
 
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> rhs2(exec, middle2, last2);
+// Calls f(block) for every block in [0, num_blocks) in parallel
+struct parallel_for_blocks
+{
+  template <typename IndexType, typename Function>
+  void operator()(IndexType num_blocks, Function f) const
+  {
+    THRUST_PRAGMA_OMP(parallel for)
+    for (IndexType block = 0; block < num_blocks; ++block)
+    {
+      f(block);
+    }
+  }
+};
 
-  thrust::merge_by_key(
-    thrust::seq, lhs1.begin(), lhs1.end(), rhs1.begin(), rhs1.end(), lhs2.begin(), rhs2.begin(), first1, first2, comp);
+template <typename IndexType>
+IndexType num_tiles(IndexType n)
+{
+  // Avoid issues on compilers that don't provide `omp_get_max_threads()`.
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const IndexType max_tiles = (n + merge_detail::min_elements_per_thread - 1) / merge_detail::min_elements_per_thread;
+  return (::cuda::std::min) (static_cast<IndexType>(omp_get_max_threads()), max_tiles);
+#else
+  return 1;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 } // namespace sort_detail
 
@@ -89,65 +171,74 @@ void stable_sort(
                                                         (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
                 "OpenMP compiler support is not enabled");
 
-  // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
-#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using IndexType  = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
 
-  if (first == last)
+  const IndexType n         = last - first;
+  const IndexType num_tiles = sort_detail::num_tiles(n);
+
+  if (num_tiles <= 1)
   {
+    thrust::stable_sort(thrust::seq, first, last, comp);
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
+  // arithmetic keys in contiguous storage sorted by less or greater take a parallel radix sort
+  if constexpr (system::detail::internal::use_radix_sort<RandomAccessIterator, StrictWeakOrdering>)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
+    system::detail::internal::stable_radix_sort<false, StrictWeakOrdering>(
+      exec,
+      thrust::unwrap_contiguous_iterator(first),
+      static_cast<value_type*>(nullptr),
+      n,
+      num_tiles,
+      sort_detail::parallel_for_blocks{});
+    return;
+  }
+
+  thrust::detail::temporary_array<value_type, DerivedPolicy> temp(exec, n);
+  value_type* buffer = thrust::raw_pointer_cast(temp.data());
 
-    // process id
-    IndexType p_i = omp_get_thread_num();
+  auto sort_tile = [&](IndexType begin, IndexType end) {
+    thrust::stable_sort(thrust::seq, first + begin, first + end, comp);
+  };
 
-    // every thread sorts its own tile
-    if (p_i < decomp.size())
+  auto merge_level = [&](bool from_buffer, IndexType run, IndexType begin, IndexType end) {
+    if (from_buffer)
     {
-      thrust::stable_sort(thrust::seq, first + decomp[p_i].begin(), first + decomp[p_i].end(), comp);
+      sort_detail::merge_runs(
+        n,
+        run,
+        begin,
+        end,
+        buffer,
+        comp,
+        [&](IndexType first1, IndexType last1, IndexType first2, IndexType last2, IndexType result) {
+          thrust::merge(
+            thrust::seq, buffer + first1, buffer + last1, buffer + first2, buffer + last2, first + result, comp);
+        });
     }
-
-    THRUST_PRAGMA_OMP(barrier)
-
-    // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
-    ;
-
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
-
-    while (nseg > 1)
+    else
     {
-      if (c >= decomp.size())
-      {
-        c = decomp.size() - 1;
-      }
-
-      if ((p_i % h) == 0 && c > b)
-      {
-        sort_detail::inplace_merge(
-          exec, first + decomp[a].begin(), first + decomp[b].end(), first + decomp[c].end(), comp);
-
-        b = c;
-        c += h;
-      }
+      sort_detail::merge_runs(
+        n,
+        run,
+        begin,
+        end,
+        first,
+        comp,
+        [&](IndexType first1, IndexType last1, IndexType first2, IndexType last2, IndexType result) {
+          thrust::merge(
+            thrust::seq, first + first1, first + last1, first + first2, first + last2, buffer + result, comp);
+        });
+    }
+  };
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+  auto copy_back = [&](IndexType begin, IndexType end) {
+    thrust::copy(thrust::seq, buffer + begin, buffer + end, first + begin);
+  };
 
-      THRUST_PRAGMA_OMP(barrier)
-
-      // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
-      ;
-    }
-  }
-#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+  sort_detail::merge_sort(n, num_tiles, sort_tile, merge_level, copy_back);
 }
 
 template <typename DerivedPolicy,
@@ -170,76 +261,96 @@ void stable_sort_by_key(
                                                         (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
                 "OpenMP compiler support is not enabled");
 
-  // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
-#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator1>;
+  using IndexType  = thrust::detail::it_difference_t<RandomAccessIterator1>;
+  using key_type   = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator2>;
 
-  if (keys_first == keys_last)
+  const IndexType n         = keys_last - keys_first;
+  const IndexType num_tiles = sort_detail::num_tiles(n);
+
+  if (num_tiles <= 1)
   {
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
+  if constexpr (system::detail::internal::
+                  use_radix_sort_by_key<RandomAccessIterator1, RandomAccessIterator2, StrictWeakOrdering>)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
-      keys_last - keys_first, 1, omp_get_num_threads());
+    system::detail::internal::stable_radix_sort<true, StrictWeakOrdering>(
+      exec,
+      thrust::unwrap_contiguous_iterator(keys_first),
+      thrust::unwrap_contiguous_iterator(values_first),
+      n,
+      num_tiles,
+      sort_detail::parallel_for_blocks{});
+    return;
+  }
+
+  thrust::detail::temporary_array<key_type, DerivedPolicy> keys_temp(exec, n);
+  thrust::detail::temporary_array<value_type, DerivedPolicy> values_temp(exec, n);
+  key_type* keys_buffer     = thrust::raw_pointer_cast(keys_temp.data());
+  value_type* values_buffer = thrust::raw_pointer_cast(values_temp.data());
 
-    // process id
-    IndexType p_i = omp_get_thread_num();
+  auto sort_tile = [&](IndexType begin, IndexType end) {
+    thrust::stable_sort_by_key(thrust::seq, keys_first + begin, keys_first + end, values_first + begin, comp);
+  };
 
-    // every thread sorts its own tile
-    if (p_i < decomp.size())
+  auto merge_level = [&](bool from_buffer, IndexType run, IndexType begin, IndexType end) {
+    if (from_buffer)
     {
-      thrust::stable_sort_by_key(
-        thrust::seq,
-        keys_first + decomp[p_i].begin(),
-        keys_first + decomp[p_i].end(),
-        values_first + decomp[p_i].begin(),
-        comp);
+      sort_detail::merge_runs(
+        n,
+        run,
+        begin,
+        end,
+        keys_buffer,
+        comp,
+        [&](IndexType first1, IndexType last1, IndexType first2, IndexType last2, IndexType result) {
+          thrust::merge_by_key(
+            thrust::seq,
+            keys_buffer + first1,
+            keys_buffer + last1,
+            keys_buffer + first2,
+            keys_buffer + last2,
+            values_buffer + first1,
+            values_buffer + first2,
+            keys_first + result,
+            values_first + result,
+            comp);
+        });
     }
-
-    THRUST_PRAGMA_OMP(barrier)
-
-    // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
-    ;
-
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
-
-    while (nseg > 1)
+    else
     {
-      if (c >= decomp.size())
-      {
-        c = decomp.size() - 1;
-      }
-
-      if ((p_i % h) == 0 && c > b)
-      {
-        sort_detail::inplace_merge_by_key(
-          exec,
-          keys_first + decomp[a].begin(),
-          keys_first + decomp[b].end(),
-          keys_first + decomp[c].end(),
-          values_first + decomp[a].begin(),
-          comp);
-
-        b = c;
-        c += h;
-      }
-
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      sort_detail::merge_runs(
+        n,
+        run,
+        begin,
+        end,
+        keys_first,
+        comp,
+        [&](IndexType first1, IndexType last1, IndexType first2, IndexType last2, IndexType result) {
+          thrust::merge_by_key(
+            thrust::seq,
+            keys_first + first1,
+            keys_first + last1,
+            keys_first + first2,
+            keys_first + last2,
+            values_first + first1,
+            values_first + first2,
+            keys_buffer + result,
+            values_buffer + result,
+            comp);
+        });
+    }
+  };
 
-      THRUST_PRAGMA_OMP(barrier)
+  auto copy_back = [&](IndexType begin, IndexType end) {
+    thrust::copy(thrust::seq, keys_buffer + begin, keys_buffer + end, keys_first + begin);
+    thrust::copy(thrust::seq, values_buffer + begin, values_buffer + end, values_first + begin);
+  };
 
-      // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
-      ;
-    }
-  }
-#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+  sort_detail::merge_sort(n, num_tiles, sort_tile, merge_level, copy_back);
 }
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
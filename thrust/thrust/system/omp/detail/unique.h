@@ -13,20 +13,57 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/unique.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/select.h>
+#include <thrust/unique.h>
 
+#include <cuda/std/__iterator/distance.h>
 #include <cuda/std/__utility/pair.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+// The first element of every group of equal elements is kept. Like remove_if, unique moves the kept elements
+// to a temporary buffer first, as a piece cannot be compacted in place while preceding pieces are still read.
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 ForwardIterator
 unique(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique to cpp::unique
-  return thrust::system::detail::generic::unique(exec, first, last, binary_pred);
+  using IndexType = thrust::detail::it_difference_t<ForwardIterator>;
+  using ValueType = thrust::detail::it_value_t<ForwardIterator>;
+
+  const IndexType n          = ::cuda::std::distance(first, last);
+  const IndexType num_pieces = select_detail::num_pieces(n);
+
+  if (num_pieces <= 1)
+  {
+    return thrust::unique(thrust::seq, first, last, binary_pred);
+  }
+
+  thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_pred{binary_pred};
+
+  select_detail::selection<IndexType, DerivedPolicy> selection(exec, n, num_pieces);
+  const IndexType count = selection.flag([&](IndexType i) {
+    return i == 0 || !wrapped_pred(first[i - 1], first[i]);
+  });
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> kept(0, exec, count);
+  ValueType* buffer = thrust::raw_pointer_cast(kept.data());
+  selection.write([&](IndexType i, IndexType out, bool selected) {
+    if (selected)
+    {
+      select_detail::move_construct(buffer + out, first[i]);
+    }
+  });
+  select_detail::move_back(buffer, count, first);
+
+  return first + count;
 } // end unique()
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryPredicate>
@@ -37,8 +74,30 @@ OutputIterator unique_copy(
   OutputIterator output,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_copy to cpp::unique_copy
-  return thrust::system::detail::generic::unique_copy(exec, first, last, output, binary_pred);
+  using IndexType = thrust::detail::it_difference_t<InputIterator>;
+
+  const IndexType n          = ::cuda::std::distance(first, last);
+  const IndexType num_pieces = select_detail::num_pieces(n);
+
+  if (num_pieces <= 1)
+  {
+    return thrust::unique_copy(thrust::seq, first, last, output, binary_pred);
+  }
+
+  thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_pred{binary_pred};
+
+  select_detail::selection<IndexType, DerivedPolicy> selection(exec, n, num_pieces);
+  const IndexType count = selection.flag([&](IndexType i) {
+    return i == 0 || !wrapped_pred(first[i - 1], first[i]);
+  });
+  selection.write([&](IndexType i, IndexType out, bool selected) {
+    if (selected)
+    {
+      output[out] = first[i];
+    }
+  });
+
+  return output + count;
 } // end unique_copy()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
@@ -13,14 +13,22 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/unique_by_key.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/select.h>
+#include <thrust/unique.h>
 
+#include <cuda/std/__iterator/distance.h>
 #include <cuda/std/__utility/pair.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+// See unique(). The keys and values that are kept are moved to separate temporary buffers.
 template <typename DerivedPolicy, typename ForwardIterator1, typename ForwardIterator2, typename BinaryPredicate>
 ::cuda::std::pair<ForwardIterator1, ForwardIterator2> unique_by_key(
   execution_policy<DerivedPolicy>& exec,
@@ -29,8 +37,40 @@ template <typename DerivedPolicy, typename ForwardIterator1, typename ForwardIte
   ForwardIterator2 values_first,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_by_key to cpp::unique_by_key
-  return thrust::system::detail::generic::unique_by_key(exec, keys_first, keys_last, values_first, binary_pred);
+  using IndexType = thrust::detail::it_difference_t<ForwardIterator1>;
+  using KeyType   = thrust::detail::it_value_t<ForwardIterator1>;
+  using ValueType = thrust::detail::it_value_t<ForwardIterator2>;
+
+  const IndexType n          = ::cuda::std::distance(keys_first, keys_last);
+  const IndexType num_pieces = select_detail::num_pieces(n);
+
+  if (num_pieces <= 1)
+  {
+    return thrust::unique_by_key(thrust::seq, keys_first, keys_last, values_first, binary_pred);
+  }
+
+  thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_pred{binary_pred};
+
+  select_detail::selection<IndexType, DerivedPolicy> selection(exec, n, num_pieces);
+  const IndexType count = selection.flag([&](IndexType i) {
+    return i == 0 || !wrapped_pred(keys_first[i - 1], keys_first[i]);
+  });
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> kept_keys(0, exec, count);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> kept_values(0, exec, count);
+  KeyType* key_buffer     = thrust::raw_pointer_cast(kept_keys.data());
+  ValueType* value_buffer = thrust::raw_pointer_cast(kept_values.data());
+  selection.write([&](IndexType i, IndexType out, bool selected) {
+    if (selected)
+    {
+      select_detail::move_construct(key_buffer + out, keys_first[i]);
+      select_detail::move_construct(value_buffer + out, values_first[i]);
+    }
+  });
+  select_detail::move_back(key_buffer, count, keys_first);
+  select_detail::move_back(value_buffer, count, values_first);
+
+  return ::cuda::std::make_pair(keys_first + count, values_first + count);
 } // end unique_by_key()
 
 template <typename DerivedPolicy,
@@ -48,9 +88,32 @@ template <typename DerivedPolicy,
   OutputIterator2 values_output,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_by_key_copy to cpp::unique_by_key_copy
-  return thrust::system::detail::generic::unique_by_key_copy(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
+  using IndexType = thrust::detail::it_difference_t<InputIterator1>;
+
+  const IndexType n          = ::cuda::std::distance(keys_first, keys_last);
+  const IndexType num_pieces = select_detail::num_pieces(n);
+
+  if (num_pieces <= 1)
+  {
+    return thrust::unique_by_key_copy(
+      thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
+  }
+
+  thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_pred{binary_pred};
+
+  select_detail::selection<IndexType, DerivedPolicy> selection(exec, n, num_pieces);
+  const IndexType count = selection.flag([&](IndexType i) {
+    return i == 0 || !wrapped_pred(keys_first[i - 1], keys_first[i]);
+  });
+  selection.write([&](IndexType i, IndexType out, bool selected) {
+    if (selected)
+    {
+      keys_output[out]   = keys_first[i];
+      values_output[out] = values_first[i];
+    }
+  });
+
+  return ::cuda::std::make_pair(keys_output + count, values_output + count);
 } // end unique_by_key_copy()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
@@ -13,5 +13,200 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits binary_search
+// this system inherits the scalar binary search algorithms
 #include <thrust/system/cpp/detail/binary_search.h>
+
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace binary_search_detail
+{
+// Number of queries below which a range is not split any further
+inline constexpr int grain_size = 1 << 10;
+
+// Returns the first position in [lo, hi) at which pred is false, given that pred is true for a
+// prefix of the range.
+template <typename Size, typename RandomAccessIterator, typename Predicate>
+Size partition_point(RandomAccessIterator first, Size lo, Size hi, Predicate pred)
+{
+  while (lo < hi)
+  {
+    const Size mid = lo + (hi - lo) / 2;
+    if (pred(first[mid]))
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+// Like partition_point, but probes with doubling steps from lo first, so that the search costs
+// the logarithm of the distance to the result rather than of the size of the range.
+template <typename Size, typename RandomAccessIterator, typename Predicate>
+Size gallop(RandomAccessIterator first, Size lo, Size hi, Predicate pred)
+{
+  Size step = 1;
+  while (step <= hi - lo && pred(first[lo + step - 1]))
+  {
+    lo += step;
+    step *= 2;
+  }
+  return binary_search_detail::partition_point(first, lo, (::cuda::std::min) (lo + step - 1, hi), pred);
+}
+
+struct lower_bound_fn
+{
+  static constexpr bool is_upper_bound = false;
+
+  template <typename Size, typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+  Size operator()(RandomAccessIterator, Size, Size pos, const T&, StrictWeakOrdering) const
+  {
+    return pos;
+  }
+};
+
+struct upper_bound_fn
+{
+  static constexpr bool is_upper_bound = true;
+
+  template <typename Size, typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+  Size operator()(RandomAccessIterator, Size, Size pos, const T&, StrictWeakOrdering) const
+  {
+    return pos;
+  }
+};
+
+struct binary_search_fn
+{
+  static constexpr bool is_upper_bound = false;
+
+  template <typename Size, typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+  bool operator()(RandomAccessIterator first, Size n, Size pos, const T& value, StrictWeakOrdering comp) const
+  {
+    return pos < n && !comp(value, first[pos]);
+  }
+};
+
+// Every task searches a contiguous range of queries. Queries are often sorted, and the result for a
+// query that is not ordered before its predecessor can not come before the previous result, so the
+// search gallops forward from there instead of starting over.
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SearchFunction>
+OutputIterator search(
+  execution_policy<DerivedPolicy>&,
+  ForwardIterator first,
+  ForwardIterator last,
+  InputIterator values_first,
+  InputIterator values_last,
+  OutputIterator output,
+  StrictWeakOrdering comp,
+  SearchFunction func)
+{
+  using Size      = thrust::detail::it_difference_t<ForwardIterator>;
+  using QuerySize = thrust::detail::it_difference_t<InputIterator>;
+
+  const Size n                = ::cuda::std::distance(first, last);
+  const QuerySize num_queries = ::cuda::std::distance(values_first, values_last);
+
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<QuerySize>(0, num_queries, grain_size), [=](const ::tbb::blocked_range<QuerySize>& r) {
+      Size pos = 0;
+      for (QuerySize i = r.begin(); i != r.end(); ++i)
+      {
+        const auto& value = values_first[i];
+        auto pred         = [&](const auto& x) {
+          return SearchFunction::is_upper_bound ? !wrapped_comp(value, x) : wrapped_comp(x, value);
+        };
+
+        if (i != r.begin() && !wrapped_comp(value, values_first[i - 1]))
+        {
+          pos = binary_search_detail::gallop(first, pos, n, pred);
+        }
+        else
+        {
+          pos = binary_search_detail::partition_point(first, Size(0), n, pred);
+        }
+
+        output[i] = func(first, n, pos, value, wrapped_comp);
+      }
+    });
+
+  return output + num_queries;
+}
+} // namespace binary_search_detail
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator lower_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  InputIterator values_first,
+  InputIterator values_last,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::search(
+    exec, first, last, values_first, values_last, output, comp, binary_search_detail::lower_bound_fn{});
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator upper_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  InputIterator values_first,
+  InputIterator values_last,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::search(
+    exec, first, last, values_first, values_last, output, comp, binary_search_detail::upper_bound_fn{});
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  InputIterator values_first,
+  InputIterator values_last,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::search(
+    exec, first, last, values_first, values_last, output, comp, binary_search_detail::binary_search_fn{});
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
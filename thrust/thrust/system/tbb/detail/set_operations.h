@@ -12,6 +12,250 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/set_operations.h>
+#include <thrust/system/detail/generic/sequential_set_operations.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
 
-// this system inherits set_operations
-#include <thrust/system/cpp/detail/set_operations.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/pair.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_scan.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace set_operations_detail
+{
+// Number of input elements below which a piece is not split any further
+inline constexpr int grain_size = 1 << 13;
+
+using thrust::system::detail::generic::sequential_set_difference_fn;
+using thrust::system::detail::generic::sequential_set_intersection_fn;
+using thrust::system::detail::generic::sequential_set_symmetric_difference_fn;
+using thrust::system::detail::generic::sequential_set_union_fn;
+
+// Scans over the pieces of the inputs. The pre-scan only counts the output of a range of pieces,
+// while the final scan writes it at the position given by the output of all preceding pieces.
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation,
+          typename Size>
+struct body
+{
+  InputIterator1 first1;
+  InputIterator2 first2;
+  OutputIterator result;
+  const Size* splits1;
+  const Size* splits2;
+  StrictWeakOrdering comp;
+  SetOperation set_op;
+  Size sum;
+
+  body(InputIterator1 first1,
+       InputIterator2 first2,
+       OutputIterator result,
+       const Size* splits1,
+       const Size* splits2,
+       StrictWeakOrdering comp,
+       SetOperation set_op)
+      : first1(first1)
+      , first2(first2)
+      , result(result)
+      , splits1(splits1)
+      , splits2(splits2)
+      , comp(comp)
+      , set_op(set_op)
+      , sum(0)
+  {}
+
+  body(body& b, ::tbb::split)
+      : first1(b.first1)
+      , first2(b.first2)
+      , result(b.result)
+      , splits1(b.splits1)
+      , splits2(b.splits2)
+      , comp(b.comp)
+      , set_op(b.set_op)
+      , sum(0)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::pre_scan_tag)
+  {
+    for (Size p = r.begin(); p != r.end(); ++p)
+    {
+      const auto discard = thrust::make_discard_iterator();
+      sum += set_op(first1 + splits1[p],
+                    first1 + splits1[p + 1],
+                    first2 + splits2[p],
+                    first2 + splits2[p + 1],
+                    discard,
+                    comp)
+           - discard;
+    }
+  }
+
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::final_scan_tag)
+  {
+    for (Size p = r.begin(); p != r.end(); ++p)
+    {
+      const OutputIterator out = result + sum;
+      sum += set_op(first1 + splits1[p],
+                    first1 + splits1[p + 1],
+                    first2 + splits2[p],
+                    first2 + splits2[p + 1],
+                    out,
+                    comp)
+           - out;
+    }
+  }
+
+  void reverse_join(body& b)
+  {
+    sum = b.sum + sum;
+  }
+
+  void assign(body& b)
+  {
+    sum = b.sum;
+  }
+};
+
+// The input ranges are split along their merge path into pieces, such that no run of equivalent
+// elements straddles two pieces. A parallel scan over the pieces then counts the output of every
+// piece and writes it after the output of all pieces before it.
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+OutputIterator set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  SetOperation set_op)
+{
+  using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+  const Size n1         = ::cuda::std::distance(first1, last1);
+  const Size n2         = ::cuda::std::distance(first2, last2);
+  const Size num_pieces = (n1 + n2 + grain_size - 1) / grain_size;
+
+  if (num_pieces <= 1)
+  {
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  // for every piece boundary, the positions in both inputs
+  thrust::detail::temporary_array<Size, DerivedPolicy> temp(exec, 2 * (num_pieces + 1));
+  Size* splits1 = thrust::raw_pointer_cast(temp.data());
+  Size* splits2 = splits1 + (num_pieces + 1);
+
+  splits1[num_pieces] = n1;
+  splits2[num_pieces] = n2;
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_pieces), [=](const ::tbb::blocked_range<Size>& r) {
+    for (Size p = r.begin(); p != r.end(); ++p)
+    {
+      const auto split =
+        system::detail::internal::balanced_path_search(p * Size(grain_size), first1, n1, first2, n2, comp);
+      splits1[p] = split.first;
+      splits2[p] = split.second;
+    }
+  });
+
+  body<InputIterator1, InputIterator2, OutputIterator, StrictWeakOrdering, SetOperation, Size> scan_body(
+    first1, first2, result, splits1, splits2, comp, set_op);
+  ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, num_pieces), scan_body);
+
+  return result + scan_body.sum;
+}
+} // namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::sequential_set_difference_fn{});
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::sequential_set_intersection_fn{});
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::sequential_set_symmetric_difference_fn{});
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::sequential_set_union_fn{});
+} // end set_union()
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
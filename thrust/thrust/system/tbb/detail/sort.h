@@ -18,11 +18,16 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/internal/radix_sort.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/type_traits/unwrap_contiguous_iterator.h>
 
+#include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__iterator/distance.h>
 
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
+#include <tbb/task_arena.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
@@ -237,12 +242,51 @@ void merge_sort_by_key(
 }
 } // namespace sort_by_key_detail
 
+namespace radix_sort_detail
+{
+// Calls f(block) for every block in [0, num_blocks) in parallel
+struct parallel_for_blocks
+{
+  template <typename Size, typename Function>
+  void operator()(Size num_blocks, Function f) const
+  {
+    ::tbb::parallel_for(Size(0), num_blocks, f);
+  }
+};
+
+// One block per worker, but no smaller than what a sequential sort is used for
+template <typename Size>
+Size num_blocks(Size n)
+{
+  return (::cuda::std::min) (static_cast<Size>(::tbb::this_task_arena::max_concurrency()),
+                             (n + sort_detail::threshold - 1) / sort_detail::threshold);
+}
+} // namespace radix_sort_detail
+
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
 void stable_sort(
   execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
 {
   using key_type = thrust::detail::it_value_t<RandomAccessIterator>;
 
+  // arithmetic keys in contiguous storage sorted by less or greater take a parallel radix sort
+  if constexpr (system::detail::internal::use_radix_sort<RandomAccessIterator, StrictWeakOrdering>)
+  {
+    const auto n          = ::cuda::std::distance(first, last);
+    const auto num_blocks = radix_sort_detail::num_blocks(n);
+    if (num_blocks > 1)
+    {
+      system::detail::internal::stable_radix_sort<false, StrictWeakOrdering>(
+        exec,
+        thrust::unwrap_contiguous_iterator(first),
+        static_cast<key_type*>(nullptr),
+        n,
+        num_blocks,
+        radix_sort_detail::parallel_for_blocks{});
+      return;
+    }
+  }
+
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
 
   sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
@@ -262,6 +306,24 @@ void stable_sort_by_key(
   using key_type = thrust::detail::it_value_t<RandomAccessIterator1>;
   using val_type = thrust::detail::it_value_t<RandomAccessIterator2>;
 
+  if constexpr (system::detail::internal::
+                  use_radix_sort_by_key<RandomAccessIterator1, RandomAccessIterator2, StrictWeakOrdering>)
+  {
+    const auto n          = ::cuda::std::distance(first1, last1);
+    const auto num_blocks = radix_sort_detail::num_blocks(n);
+    if (num_blocks > 1)
+    {
+      system::detail::internal::stable_radix_sort<true, StrictWeakOrdering>(
+        exec,
+        thrust::unwrap_contiguous_iterator(first1),
+        thrust::unwrap_contiguous_iterator(first2),
+        n,
+        num_blocks,
+        radix_sort_detail::parallel_for_blocks{});
+      return;
+    }
+  }
+
   RandomAccessIterator2 last2 = first2 + ::cuda::std::distance(first1, last1);
 
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);